@@ -66,6 +66,9 @@
 #define SUPPORT_COMPRESSION_API         1
 // Support automatic generated events, loading and recording of those events when required
 #define SUPPORT_AUTOMATION_EVENTS       1
+// Cache linked shader program binaries in app cache directory, skipping shaders compilation on next launches
+// NOTE: Requires program binaries support (GL_OES_get_program_binary), only available on PLATFORM_ANDROID
+#define SUPPORT_SHADER_CACHE            1
 // Support custom frame control, only for advance users
 // By default EndDrawing() does this job: draws everything + SwapScreenBuffer() + manage frame timing + PollInputEvents()
 // Enabling this flag allows manual control of the frame processes, use at your own risk
@@ -89,6 +92,11 @@
 
 #define MAX_AUTOMATION_EVENTS       16384       // Maximum number of automation events to record
 
+#define MAX_SCREENSHOT_JOBS             4       // Maximum number of screenshots being exported, taking more waits for oldest one
+
+#define MAX_GIF_RECORD_QUEUE            3       // Maximum number of GIF frames waiting to be encoded, more are dropped
+#define GIF_RECORD_FRAMERATE           10       // GIF frame recorded every n game frames
+
 //------------------------------------------------------------------------------------
 // Module: rlgl - Configuration values
 //------------------------------------------------------------------------------------
@@ -137,10 +145,21 @@
 // Use QUADS instead of TRIANGLES for drawing when possible
 // Some lines-based shapes could still use lines
 #define SUPPORT_QUADS_DRAW_MODE         1
+// Draw rounded rectangles, circles and rings with *SDF() functions as one quad per shape,
+// anti-aliased in fragment shader (signed distance), falls back to tessellation if not supported
+#define SUPPORT_SDF_SHAPES              1
+// Skip shapes completely outside viewport and scissor area before tessellation [rlCheckCulledRec()]
+// Culled shapes are reported in render stats [rlGetRenderStats()]
+#define SUPPORT_SHAPES_CULLING          1
+// Anti-alias lines and splines with alpha-feathered edge strips, enabled at runtime with SetShapesFeather()
+// Thick lines and splines look smooth with no MSAA required
+#define SUPPORT_SHAPES_FEATHER          1
 
 // rshapes: Configuration values
 //------------------------------------------------------------------------------------
 #define SPLINE_SEGMENT_DIVISIONS       24       // Spline segments subdivisions
+#define SPLINE_FLATTEN_TOLERANCE     0.1f       // Curved splines maximum flattening error, Bezier and Catmull-Rom segments are subdivided adaptively
+#define SPLINE_SEGMENT_MAX_DIVISIONS  128       // Curved splines maximum subdivisions per segment
 
 
 //------------------------------------------------------------------------------------
@@ -170,6 +189,13 @@
 // Support multiple image editing functions to scale, adjust colors, flip, draw on images, crop...
 // If not defined, still some functions are supported: ImageFormat(), ImageCrop(), ImageToPOT()
 #define SUPPORT_IMAGE_MANIPULATION      1
+// Support a pool of worker threads for heavy image processing, like ImageBlurGaussian() or ImageResize()
+// NOTE: Requires pthreads, one thread per big core, results are identical to single-threaded processing
+#define SUPPORT_IMAGE_THREADS           1
+
+// rtextures: Configuration values
+//------------------------------------------------------------------------------------
+#define MAX_TEXTURE_ATLAS_IMAGES    65536       // Maximum number of images in a texture atlas, handles index range (16 bit)
 
 
 //------------------------------------------------------------------------------------
@@ -191,6 +217,9 @@
 // drawing text and shapes with a single draw call [SetShapesTexture()].
 #define SUPPORT_FONT_ATLAS_WHITE_REC    1
 
+// Skip text completely outside viewport and scissor area before generating glyph quads [rlCheckCulledRec()]
+#define SUPPORT_TEXT_CULLING            1
+
 // rtext: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_TEXT_BUFFER_LENGTH       1024       // Size of internal static buffers used on some functions:
@@ -250,5 +279,6 @@
 // utils: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_TRACELOG_MSG_LENGTH       256       // Max length of one trace-log message
+#define MAX_ASSET_PACKS                 4       // Maximum number of asset packs mounted at once
 
 #endif // CONFIG_H
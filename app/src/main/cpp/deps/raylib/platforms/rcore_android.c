@@ -86,6 +86,10 @@ void ClosePlatform(void);        // Close platform
 static void AndroidCommandCallback(struct android_app *app, int32_t cmd);           // Process Android activity lifecycle commands
 static int32_t AndroidInputCallback(struct android_app *app, AInputEvent *event);   // Process Android inputs
 static GamepadButton AndroidTranslateGamepadButton(int button);                     // Map Android gamepad button to raylib gamepad button
+#if defined(SUPPORT_SHADER_CACHE)
+static unsigned char *LoadShaderCacheData(unsigned long long key, int *dataSize);   // Load shader program binary from app cache directory
+static bool SaveShaderCacheData(unsigned long long key, const unsigned char *data, int dataSize);   // Save shader program binary to app cache directory
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Declaration
@@ -571,6 +575,11 @@ int InitPlatform(void)
     InitAssetManager(platform.app->activity->assetManager, platform.app->activity->internalDataPath);   // Initialize assets manager
 
     CORE.Storage.basePath = platform.app->activity->internalDataPath;   // Define base path for storage
+
+#if defined(SUPPORT_SHADER_CACHE)
+    // NOTE: Shader cache must be set before rlglInit() to cache default shader
+    rlSetShaderCache(LoadShaderCacheData, SaveShaderCacheData, GetTime);
+#endif
     //----------------------------------------------------------------------------
 
     TRACELOG(LOG_INFO, "PLATFORM: ANDROID: Initialized successfully");
@@ -790,6 +799,14 @@ static void AndroidCommandCallback(struct android_app *app, int32_t cmd)
                     // NOTE: CORE.Window.currentFbo.width and CORE.Window.currentFbo.height not used, just stored as globals in rlgl
                     rlglInit(CORE.Window.currentFbo.width, CORE.Window.currentFbo.height);
 
+                #if defined(SUPPORT_SHADER_CACHE)
+                    // Report shader cache usage for default shaders on startup
+                    int cacheHits = 0, cacheMisses = 0;
+                    float cacheTimeSaved = 0.0f;
+                    rlGetShaderCacheStats(&cacheHits, &cacheMisses, &cacheTimeSaved);
+                    TRACELOG(LOG_INFO, "SHADER: Cache: %i hits | %i misses | %.2f ms saved", cacheHits, cacheMisses, cacheTimeSaved);
+                #endif
+
                     // Setup default viewport
                     // NOTE: It updated CORE.Window.render.width and CORE.Window.render.height
                     SetupViewport(CORE.Window.currentFbo.width, CORE.Window.currentFbo.height);
@@ -1132,4 +1149,31 @@ static int32_t AndroidInputCallback(struct android_app *app, AInputEvent *event)
     return 0;
 }
 
+#if defined(SUPPORT_SHADER_CACHE)
+// Load shader program binary from app cache directory
+// NOTE: App cache directory is the sibling of internal data path (files), file paths are
+// relative to internal data path, same as any other file loading on Android (android_fopen())
+static unsigned char *LoadShaderCacheData(unsigned long long key, int *dataSize)
+{
+    char filePath[512] = { 0 };
+    snprintf(filePath, sizeof(filePath), "%s/../cache/shader_%016llx.bin", platform.app->activity->internalDataPath, key);
+
+    // NOTE: Checked first to avoid file loading warnings on cache misses
+    if (!FileExists(filePath)) return NULL;
+
+    snprintf(filePath, sizeof(filePath), "../cache/shader_%016llx.bin", key);
+
+    return LoadFileData(filePath, dataSize);
+}
+
+// Save shader program binary to app cache directory
+static bool SaveShaderCacheData(unsigned long long key, const unsigned char *data, int dataSize)
+{
+    char filePath[512] = { 0 };
+    snprintf(filePath, sizeof(filePath), "../cache/shader_%016llx.bin", key);
+
+    return SaveFileData(filePath, (void *)data, dataSize);
+}
+#endif
+
 // EOF
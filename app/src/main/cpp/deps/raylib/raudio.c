@@ -739,6 +739,7 @@ Wave LoadWave(const char *fileName)
 {
     Wave wave = { 0 };
 
+#if defined(RAUDIO_STANDALONE)
     // Loading file to memory
     int dataSize = 0;
     unsigned char *fileData = LoadFileData(fileName, &dataSize);
@@ -747,6 +748,15 @@ Wave LoadWave(const char *fileName)
     if (fileData != NULL) wave = LoadWaveFromMemory(GetFileExtension(fileName), fileData, dataSize);
 
     RL_FREE(fileData);
+#else
+    // Loading file view (memory-mapped, no copy)
+    FileView view = LoadFileView(fileName);
+
+    // Loading wave from memory data
+    if (view.data != NULL) wave = LoadWaveFromMemory(GetFileExtension(fileName), view.data, view.size);
+
+    UnloadFileView(view);
+#endif
 
     return wave;
 }
@@ -292,6 +292,16 @@ typedef struct NPatchInfo {
     int layout;             // Layout of the n-patch: 3x3, 1x3 or 3x1
 } NPatchInfo;
 
+// TextureAtlas, images packed at runtime into shared texture pages
+// NOTE: Actual struct is defined internally in rtextures module
+typedef struct TextureAtlas TextureAtlas;
+
+// AtlasRegion, texture atlas image region
+typedef struct AtlasRegion {
+    Texture2D texture;      // Atlas page texture
+    Rectangle source;       // Image rectangle in page texture
+} AtlasRegion;
+
 // GlyphInfo, font characters glyphs info
 typedef struct GlyphInfo {
     int value;              // Character value (Unicode)
@@ -301,6 +311,10 @@ typedef struct GlyphInfo {
     Image image;            // Character image data
 } GlyphInfo;
 
+// Glyphs lookup index, opaque struct
+// NOTE: Actual struct is defined internally in rtext module
+typedef struct rGlyphLookup rGlyphLookup;
+
 // Font, font texture and GlyphInfo array data
 typedef struct Font {
     int baseSize;           // Base size (default chars height)
@@ -309,8 +323,21 @@ typedef struct Font {
     Texture2D texture;      // Texture atlas containing the glyphs
     Rectangle *recs;        // Rectangles in texture for the glyphs
     GlyphInfo *glyphs;      // Glyphs info data
+    rGlyphLookup *glyphLookup; // Glyphs lookup index (codepoint to glyph index), built on font loading
+    int type;               // Font type (FontType), FONT_SDF fonts are drawn with built-in SDF shader (if no custom shader is set)
 } Font;
 
+// TextLayout, text shaped once into glyph quads, to be drawn many times
+typedef struct TextLayout {
+    Font font;              // Font used to shape the text (not owned)
+    char *text;             // Text shaped (UTF-8 copy)
+    float fontSize;         // Font size used to shape the text
+    float spacing;          // Characters spacing used to shape the text
+    int quadCount;          // Number of glyph quads (spaces and line-breaks not included)
+    float *quads;           // Glyph quads: position (x0, y0, x1, y1) relative to layout origin + texcoords (u0, v0, u1, v1)
+    Vector2 size;           // Text size measured on shaping (same as MeasureTextEx())
+} TextLayout;
+
 // Camera, defines position/orientation in 3d space
 typedef struct Camera3D {
     Vector3 position;       // Camera position
@@ -506,6 +533,14 @@ typedef struct FilePathList {
     char **paths;                   // Filepaths entries
 } FilePathList;
 
+// File view, read-only file data (memory-mapped if supported)
+typedef struct FileView {
+    const unsigned char *data;      // File data (read-only)
+    int size;                       // File data size in bytes
+    int type;                       // File view type (internal: heap copy, memory-mapped, asset buffer)
+    void *handle;                   // File view platform handle (internal)
+} FileView;
+
 // Automation event
 typedef struct AutomationEvent {
     unsigned int frame;             // Event frame
@@ -876,7 +911,7 @@ typedef enum {
 typedef enum {
     FONT_DEFAULT = 0,               // Default font generation, anti-aliased
     FONT_BITMAP,                    // Bitmap font generation, no anti-aliasing
-    FONT_SDF                        // SDF font generation, requires external shader
+    FONT_SDF                        // SDF font generation, drawn with built-in SDF shader (if no custom shader is set)
 } FontType;
 
 // Color blending modes (pre-defined)
@@ -929,6 +964,13 @@ typedef enum {
     NPATCH_THREE_PATCH_HORIZONTAL   // Npatch layout: 3x1 tiles
 } NPatchLayout;
 
+// Screenshot encoders
+typedef enum {
+    SCREENSHOT_PNG = 0,             // PNG, deflate compressed on a single thread
+    SCREENSHOT_PNG_PARALLEL,        // PNG, deflate split in chunks compressed in parallel (slightly bigger files)
+    SCREENSHOT_QOI                  // QOI, fastest encoding, bigger files
+} ScreenshotEncoder;
+
 // Callbacks to hook some internal functions
 // WARNING: These callbacks are intended for advance users
 typedef void (*TraceLogCallback)(int logLevel, const char *text, va_list args);  // Logging: Redirect trace log messages
@@ -936,6 +978,9 @@ typedef unsigned char *(*LoadFileDataCallback)(const char *fileName, int *dataSi
 typedef bool (*SaveFileDataCallback)(const char *fileName, void *data, int dataSize);   // FileIO: Save binary data
 typedef char *(*LoadFileTextCallback)(const char *fileName);            // FileIO: Load text data
 typedef bool (*SaveFileTextCallback)(const char *fileName, char *text); // FileIO: Save text data
+typedef Texture2D (*UploadTextureCallback)(Image image);                // Textures: Upload image loaded asynchronously
+
+typedef void (*ScreenshotCallback)(const char *fileName, bool success); // Screenshot export finished, called on main thread
 
 //------------------------------------------------------------------------------------
 // Global Variables Definition
@@ -1075,6 +1120,8 @@ RLAPI void UnloadRandomSequence(int *sequence);                   // Unload rand
 
 // Misc. functions
 RLAPI void TakeScreenshot(const char *fileName);                  // Takes a screenshot of current screen (filename extension defines format)
+RLAPI void TakeScreenshotAsync(const char *fileName, ScreenshotCallback callback); // Takes a screenshot of current screen, encoded and saved on a worker thread
+RLAPI void SetScreenshotEncoder(int encoder, int compressionLevel); // Set screenshot encoder (ScreenshotEncoder) and compression level [0..8]
 RLAPI void SetConfigFlags(unsigned int flags);                    // Setup init configuration flags (view FLAGS)
 RLAPI void OpenURL(const char *url);                              // Open URL with default system browser (if available)
 
@@ -1097,6 +1144,10 @@ RLAPI void SetSaveFileTextCallback(SaveFileTextCallback callback); // Set custom
 // Files management functions
 RLAPI unsigned char *LoadFileData(const char *fileName, int *dataSize); // Load file data as byte array (read)
 RLAPI void UnloadFileData(unsigned char *data);                   // Unload file data allocated by LoadFileData()
+RLAPI FileView LoadFileView(const char *fileName);                // Load file data as read-only view (memory-mapped if supported, no copy)
+RLAPI void UnloadFileView(FileView view);                         // Unload file view loaded by LoadFileView()
+RLAPI bool MountAssetPack(const char *fileName);                  // Mount asset pack (.rpak), files are looked up in mounted packs before file system
+RLAPI void UnmountAssetPack(const char *fileName);                // Unmount asset pack
 RLAPI bool SaveFileData(const char *fileName, void *data, int dataSize); // Save data to file from byte array (write), returns true on success
 RLAPI bool ExportDataAsCode(const unsigned char *data, int dataSize, const char *fileName); // Export data to code (.h), returns true on success
 RLAPI char *LoadFileText(const char *fileName);                   // Load text data from file (read), returns a '\0' terminated string
@@ -1216,6 +1267,7 @@ RLAPI void UpdateCameraPro(Camera *camera, Vector3 movement, Vector3 rotation, f
 // NOTE: It can be useful when using basic shapes and one single font,
 // defining a font char white rectangle would allow drawing everything in a single draw call
 RLAPI void SetShapesTexture(Texture2D texture, Rectangle source);       // Set texture and rectangle to be used on shapes drawing
+RLAPI void SetShapesFeather(float feather);                             // Set feather width for lines and splines anti-aliasing, 0 disables it
 
 // Basic shapes drawing functions
 RLAPI void DrawPixel(int posX, int posY, Color color);                                                   // Draw a pixel
@@ -1247,6 +1299,11 @@ RLAPI void DrawRectangleLines(int posX, int posY, int width, int height, Color c
 RLAPI void DrawRectangleLinesEx(Rectangle rec, float lineThick, Color color);                            // Draw rectangle outline with extended parameters
 RLAPI void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color color);              // Draw rectangle with rounded edges
 RLAPI void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, float lineThick, Color color); // Draw rectangle with rounded edges outline
+RLAPI void DrawRectangleRoundedSDF(Rectangle rec, float roundness, Color color);                         // Draw rectangle with rounded edges (single quad, anti-aliased SDF)
+RLAPI void DrawRectangleRoundedLinesSDF(Rectangle rec, float roundness, float lineThick, Color color);   // Draw rectangle with rounded edges outline (single quad, anti-aliased SDF)
+RLAPI void DrawCircleSDF(Vector2 center, float radius, Color color);                                     // Draw a color-filled circle (single quad, anti-aliased SDF)
+RLAPI void DrawCircleLinesSDF(Vector2 center, float radius, Color color);                                // Draw circle outline (single quad, anti-aliased SDF)
+RLAPI void DrawRingSDF(Vector2 center, float innerRadius, float outerRadius, Color color);               // Draw ring (single quad, anti-aliased SDF)
 RLAPI void DrawTriangle(Vector2 v1, Vector2 v2, Vector2 v3, Color color);                                // Draw a color-filled triangle (vertex in counter-clockwise order!)
 RLAPI void DrawTriangleLines(Vector2 v1, Vector2 v2, Vector2 v3, Color color);                           // Draw triangle outline (vertex in counter-clockwise order!)
 RLAPI void DrawTriangleFan(Vector2 *points, int pointCount, Color color);                                // Draw a triangle fan defined by points (first vertex is the center)
@@ -1384,11 +1441,29 @@ RLAPI void UnloadRenderTexture(RenderTexture2D target);
 RLAPI void UpdateTexture(Texture2D texture, const void *pixels);                                         // Update GPU texture with new data
 RLAPI void UpdateTextureRec(Texture2D texture, Rectangle rec, const void *pixels);                       // Update GPU texture rectangle with new data
 
+// Texture asynchronous loading functions
+// NOTE: Textures are read and decoded on loader threads, uploaded by UpdateTextureUploads() on GL thread
+RLAPI Texture2D *LoadTextureAsync(const char *fileName);                                                 // Load texture asynchronously, texture id is 0 until uploaded
+RLAPI void UnloadTextureAsync(Texture2D *texture);                                                       // Unload texture loaded asynchronously (loading cancelled if not done)
+RLAPI bool IsTextureAsyncDone(const Texture2D *texture);                                                 // Check if texture loaded asynchronously has been uploaded (or failed)
+RLAPI void UpdateTextureUploads(void);                                                                   // Upload decoded textures within per frame budget (called by EndDrawing())
+RLAPI void SetTextureUploadBudget(int bytes, float milliseconds);                                        // Set per frame budget uploading textures loaded asynchronously
+RLAPI void SetUploadTextureCallback(UploadTextureCallback callback);                                     // Set custom texture upload function (NULL for default)
+
 // Texture configuration functions
 RLAPI void GenTextureMipmaps(Texture2D *texture);                                                        // Generate GPU mipmaps for a texture
 RLAPI void SetTextureFilter(Texture2D texture, int filter);                                              // Set texture scaling filter mode
 RLAPI void SetTextureWrap(Texture2D texture, int wrap);                                                  // Set texture wrapping mode
 
+// Texture atlas functions
+// NOTE: These functions require GPU access
+RLAPI TextureAtlas *LoadTextureAtlas(int pageWidth, int pageHeight, int padding, int maxPages);          // Load texture atlas, images packed at runtime into shared pages
+RLAPI void UnloadTextureAtlas(TextureAtlas *atlas);                                                      // Unload texture atlas pages and data
+RLAPI int AddTextureAtlasImage(TextureAtlas *atlas, Image image);                                        // Add image to texture atlas, returns image handle (-1 on failure)
+RLAPI void RemoveTextureAtlasImage(TextureAtlas *atlas, int handle);                                     // Remove image from texture atlas
+RLAPI AtlasRegion GetTextureAtlasRegion(TextureAtlas *atlas, int handle);                                // Get texture atlas image region (texture and source rectangle)
+RLAPI void DefragTextureAtlas(TextureAtlas *atlas);                                                      // Defragment texture atlas, reclaiming space of removed images
+
 // Texture drawing functions
 RLAPI void DrawTexture(Texture2D texture, int posX, int posY, Color tint);                               // Draw a Texture2D
 RLAPI void DrawTextureV(Texture2D texture, Vector2 position, Color tint);                                // Draw a Texture2D with position defined as Vector2
@@ -1424,6 +1499,8 @@ RLAPI Font LoadFont(const char *fileName);
 RLAPI Font LoadFontEx(const char *fileName, int fontSize, int *codepoints, int codepointCount);  // Load font from file with extended parameters, use NULL for codepoints and 0 for codepointCount to load the default character set
 RLAPI Font LoadFontFromImage(Image image, Color key, int firstChar);                        // Load font from Image (XNA style)
 RLAPI Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount); // Load font from memory buffer, fileType refers to extension: i.e. '.ttf'
+RLAPI Font LoadFontSDF(const char *fileName, int fontSize, int *codepoints, int codepointCount);  // Load SDF font from TTF/OTF file, one atlas for all sizes
+RLAPI Font GenFontSDF(Font font, int scale);                                                // Generate SDF font from bitmap font glyphs (i.e. default font), upscaled by scale
 RLAPI bool IsFontReady(Font font);                                                          // Check if a font is ready
 RLAPI GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount, int type); // Load font data for further use
 RLAPI Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyphCount, int fontSize, int padding, int packMethod); // Generate image font atlas using chars info
@@ -1433,14 +1510,23 @@ RLAPI bool ExportFontAsCode(Font font, const char *fileName);
 
 // Text drawing functions
 RLAPI void DrawFPS(int posX, int posY);                                                     // Draw current FPS
+RLAPI void DrawRenderStats(int posX, int posY);                                             // Draw render stats of last frame (draw calls, vertex, flushes, overflows, texture switches, uploads)
 RLAPI void DrawText(const char *text, int posX, int posY, int fontSize, Color color);       // Draw text (using default font)
 RLAPI void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint); // Draw text using font and additional parameters
 RLAPI void DrawTextPro(Font font, const char *text, Vector2 position, Vector2 origin, float rotation, float fontSize, float spacing, Color tint); // Draw text using Font and pro parameters (rotation)
 RLAPI void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint); // Draw one character (codepoint)
 RLAPI void DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Vector2 position, float fontSize, float spacing, Color tint); // Draw multiple character (codepoint)
 
+// Text layout functions (text shaped and measured once, drawn many times)
+RLAPI TextLayout LoadTextLayout(Font font, const char *text, float fontSize, float spacing); // Load text layout, text shaped into glyph quads
+RLAPI void UnloadTextLayout(TextLayout layout);                                             // Unload text layout from memory (RAM)
+RLAPI bool UpdateTextLayout(TextLayout *layout, Font font, const char *text, float fontSize, float spacing); // Update text layout, re-shaped only if font, text or size changed (returns true if re-shaped)
+RLAPI void DrawTextLayout(TextLayout layout, Vector2 position, Color tint);                  // Draw text layout (single batch append)
+
 // Text font info functions
 RLAPI void SetTextLineSpacing(int spacing);                                                 // Set vertical line spacing when drawing with line-breaks
+RLAPI void SetTextOutlineSDF(float size, Color color);                                      // Set outline for SDF fonts drawing (size in pixels, 0 for no outline)
+RLAPI Shader GetFontShader(Font font, float fontSize);                                      // Get shader to draw font at size (built-in SDF shader for SDF fonts, default shader otherwise)
 RLAPI int MeasureText(const char *text, int fontSize);                                      // Measure string width for default font
 RLAPI Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing);    // Measure string size for Font
 RLAPI int GetGlyphIndex(Font font, int codepoint);                                          // Get glyph index position in font for a codepoint (unicode character), fallback to '?' if not found
@@ -27,6 +27,10 @@
 *           Define static inline functions code, so #include header suffices for use.
 *           This may use up lots of memory.
 *
+*       #define RAYMATH_DISABLE_SIMD
+*           Disable NEON (arm64/armv7) and SSE (x86/x86_64) code paths, selected at compile time,
+*           scalar code is always kept as reference implementation
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -165,6 +169,18 @@ typedef struct float16 {
 
 #include <math.h>       // Required for: sinf(), cosf(), tan(), atan2f(), sqrtf(), floor(), fminf(), fmaxf(), fabs()
 
+// SIMD code paths, selected at compile time
+// NOTE: SIMD functions perform the same operations in the same order than scalar ones
+#if !defined(RAYMATH_DISABLE_SIMD)
+    #if defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #include <arm_neon.h>   // Required for: NEON intrinsics
+        #define RAYMATH_SIMD_NEON
+    #elif defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+        #include <xmmintrin.h>  // Required for: SSE intrinsics
+        #define RAYMATH_SIMD_SSE
+    #endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Utils math
 //----------------------------------------------------------------------------------
@@ -405,6 +421,57 @@ RMAPI Vector2 Vector2Transform(Vector2 v, Matrix mat)
     return result;
 }
 
+// Transform an array of vectors by a given Matrix
+// NOTE: Same result as Vector2Transform() for every vector, points and result can be the same array
+RMAPI void Vector2TransformArray(const Vector2 *points, Vector2 *result, int count, Matrix mat)
+{
+    int i = 0;
+
+#if defined(RAYMATH_SIMD_NEON)
+    float32x4_t m0 = vdupq_n_f32(mat.m0), m4 = vdupq_n_f32(mat.m4);
+    float32x4_t m1 = vdupq_n_f32(mat.m1), m5 = vdupq_n_f32(mat.m5);
+    float32x4_t m12 = vdupq_n_f32(mat.m12), m13 = vdupq_n_f32(mat.m13);
+    float32x4_t zero = vdupq_n_f32(0.0f);
+
+    // Four vectors per iteration, deinterleaved on load and interleaved on store
+    for (; (i + 4) <= count; i += 4)
+    {
+        float32x4x2_t v = vld2q_f32(&points[i].x);
+        float32x4x2_t r;
+
+        // z = 0 contribution kept to match scalar rounding (m8*z, m9*z)
+        r.val[0] = vaddq_f32(vaddq_f32(vaddq_f32(vmulq_f32(m0, v.val[0]), vmulq_f32(m4, v.val[1])), zero), m12);
+        r.val[1] = vaddq_f32(vaddq_f32(vaddq_f32(vmulq_f32(m1, v.val[0]), vmulq_f32(m5, v.val[1])), zero), m13);
+
+        vst2q_f32(&result[i].x, r);
+    }
+#elif defined(RAYMATH_SIMD_SSE)
+    __m128 c0 = _mm_setr_ps(mat.m0, mat.m1, mat.m0, mat.m1);
+    __m128 c1 = _mm_setr_ps(mat.m4, mat.m5, mat.m4, mat.m5);
+    __m128 c3 = _mm_setr_ps(mat.m12, mat.m13, mat.m12, mat.m13);
+
+    // Two vectors per iteration (xyxy)
+    for (; (i + 2) <= count; i += 2)
+    {
+        __m128 v = _mm_loadu_ps(&points[i].x);
+        __m128 x = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 0, 0));
+        __m128 y = _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 1, 1));
+
+        _mm_storeu_ps(&result[i].x, _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, x), _mm_mul_ps(c1, y)), _mm_setzero_ps()), c3));
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        float x = points[i].x;
+        float y = points[i].y;
+        float z = 0;
+
+        result[i].x = mat.m0*x + mat.m4*y + mat.m8*z + mat.m12;
+        result[i].y = mat.m1*x + mat.m5*y + mat.m9*z + mat.m13;
+    }
+}
+
 // Calculate linear interpolation between two vectors
 RMAPI Vector2 Vector2Lerp(Vector2 v1, Vector2 v2, float amount)
 {
@@ -809,6 +876,73 @@ RMAPI Vector3 Vector3Transform(Vector3 v, Matrix mat)
     return result;
 }
 
+// Transform an array of vectors by a given Matrix
+// NOTE: Same result as Vector3Transform() for every vector, points and result can be the same array
+RMAPI void Vector3TransformArray(const Vector3 *points, Vector3 *result, int count, Matrix mat)
+{
+    int i = 0;
+
+#if defined(RAYMATH_SIMD_NEON)
+    float32x4_t m0 = vdupq_n_f32(mat.m0), m4 = vdupq_n_f32(mat.m4), m8 = vdupq_n_f32(mat.m8), m12 = vdupq_n_f32(mat.m12);
+    float32x4_t m1 = vdupq_n_f32(mat.m1), m5 = vdupq_n_f32(mat.m5), m9 = vdupq_n_f32(mat.m9), m13 = vdupq_n_f32(mat.m13);
+    float32x4_t m2 = vdupq_n_f32(mat.m2), m6 = vdupq_n_f32(mat.m6), m10 = vdupq_n_f32(mat.m10), m14 = vdupq_n_f32(mat.m14);
+
+    // Four vectors per iteration, deinterleaved on load and interleaved on store
+    for (; (i + 4) <= count; i += 4)
+    {
+        float32x4x3_t v = vld3q_f32(&points[i].x);
+        float32x4x3_t r;
+
+        r.val[0] = vaddq_f32(vaddq_f32(vaddq_f32(vmulq_f32(m0, v.val[0]), vmulq_f32(m4, v.val[1])), vmulq_f32(m8, v.val[2])), m12);
+        r.val[1] = vaddq_f32(vaddq_f32(vaddq_f32(vmulq_f32(m1, v.val[0]), vmulq_f32(m5, v.val[1])), vmulq_f32(m9, v.val[2])), m13);
+        r.val[2] = vaddq_f32(vaddq_f32(vaddq_f32(vmulq_f32(m2, v.val[0]), vmulq_f32(m6, v.val[1])), vmulq_f32(m10, v.val[2])), m14);
+
+        vst3q_f32(&result[i].x, r);
+    }
+#elif defined(RAYMATH_SIMD_SSE)
+    __m128 m0 = _mm_set1_ps(mat.m0), m4 = _mm_set1_ps(mat.m4), m8 = _mm_set1_ps(mat.m8), m12 = _mm_set1_ps(mat.m12);
+    __m128 m1 = _mm_set1_ps(mat.m1), m5 = _mm_set1_ps(mat.m5), m9 = _mm_set1_ps(mat.m9), m13 = _mm_set1_ps(mat.m13);
+    __m128 m2 = _mm_set1_ps(mat.m2), m6 = _mm_set1_ps(mat.m6), m10 = _mm_set1_ps(mat.m10), m14 = _mm_set1_ps(mat.m14);
+
+    // Four vectors per iteration, deinterleaved after load and interleaved before store (as NEON vld3/vst3)
+    // NOTE: Loads and stores do not overlap between iterations, partially overlapping stores
+    // would stall next loads (store forwarding) when transforming in place
+    for (; (i + 4) <= count; i += 4)
+    {
+        __m128 a = _mm_loadu_ps(&points[i].x);          // x0 y0 z0 x1
+        __m128 b = _mm_loadu_ps(&points[i].x + 4);      // y1 z1 x2 y2
+        __m128 c = _mm_loadu_ps(&points[i].x + 8);      // z2 x3 y3 z3
+
+        __m128 x = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+        __m128 y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+        __m128 z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), c, _MM_SHUFFLE(3, 0, 2, 0));
+
+        __m128 rx = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m0, x), _mm_mul_ps(m4, y)), _mm_mul_ps(m8, z)), m12);
+        __m128 ry = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m1, x), _mm_mul_ps(m5, y)), _mm_mul_ps(m9, z)), m13);
+        __m128 rz = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m2, x), _mm_mul_ps(m6, y)), _mm_mul_ps(m10, z)), m14);
+
+        a = _mm_shuffle_ps(_mm_shuffle_ps(rx, ry, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(rz, rx, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+        b = _mm_shuffle_ps(_mm_shuffle_ps(ry, rz, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(rx, ry, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+        c = _mm_shuffle_ps(_mm_shuffle_ps(rz, rx, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(ry, rz, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+
+        _mm_storeu_ps(&result[i].x, a);
+        _mm_storeu_ps(&result[i].x + 4, b);
+        _mm_storeu_ps(&result[i].x + 8, c);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        float x = points[i].x;
+        float y = points[i].y;
+        float z = points[i].z;
+
+        result[i].x = mat.m0*x + mat.m4*y + mat.m8*z + mat.m12;
+        result[i].y = mat.m1*x + mat.m5*y + mat.m9*z + mat.m13;
+        result[i].z = mat.m2*x + mat.m6*y + mat.m10*z + mat.m14;
+    }
+}
+
 // Transform a vector by quaternion rotation
 RMAPI Vector3 Vector3RotateByQuaternion(Vector3 v, Quaternion q)
 {
@@ -1199,6 +1333,110 @@ RMAPI Matrix MatrixInvert(Matrix mat)
 {
     Matrix result = { 0 };
 
+#if defined(RAYMATH_SIMD_NEON) || defined(RAYMATH_SIMD_SSE)
+    // Same products and sums than scalar code, on columns of a (c0 = { a00, a01, a02, a03 }, ...):
+    //  - 2x2 determinants: lo = { b00, b01, b02, b03 }, hi = { b06, b07, b08, b09 }, mid = { b04, b05, b10, b11 }
+    //  - memory rows 0 and 2 of result are (p1 - p2) + p3, rows 1 and 3 are (p2 - p1) - p3, with
+    //    p = { a1, a0, a0, a0 }*b1, { a2, a2, a1, a1 }*b2, { a3, a3, a3, a2 }*b3 for columns c1, c0, c3, c2
+    //  - b factors have alternate signs (exact negations): rows 0-1 use b06..b11, rows 2-3 use b00..b05
+    float *res = &result.m0;
+    float p[8] = { 0 };
+
+#if defined(RAYMATH_SIMD_NEON)
+    float32x4x4_t c = vld4q_f32(&mat.m0);     // Deinterleaving load, memory rows transposed into columns
+    float32x4_t c0 = c.val[0], c1 = c.val[1], c2 = c.val[2], c3 = c.val[3];
+
+    float32x4_t lo = vsubq_f32(
+        vmulq_f32(vsetq_lane_f32(vgetq_lane_f32(c0, 1), vdupq_lane_f32(vget_low_f32(c0), 0), 3), vsetq_lane_f32(vgetq_lane_f32(c1, 2), vextq_f32(c1, c1, 1), 3)),
+        vmulq_f32(vsetq_lane_f32(vgetq_lane_f32(c0, 2), vextq_f32(c0, c0, 1), 3), vsetq_lane_f32(vgetq_lane_f32(c1, 1), vdupq_lane_f32(vget_low_f32(c1), 0), 3)));
+    float32x4_t hi = vsubq_f32(
+        vmulq_f32(vsetq_lane_f32(vgetq_lane_f32(c2, 1), vdupq_lane_f32(vget_low_f32(c2), 0), 3), vsetq_lane_f32(vgetq_lane_f32(c3, 2), vextq_f32(c3, c3, 1), 3)),
+        vmulq_f32(vsetq_lane_f32(vgetq_lane_f32(c2, 2), vextq_f32(c2, c2, 1), 3), vsetq_lane_f32(vgetq_lane_f32(c3, 1), vdupq_lane_f32(vget_low_f32(c3), 0), 3)));
+    float32x4_t mid = vsubq_f32(
+        vmulq_f32(vcombine_f32(vget_low_f32(vextq_f32(c0, c0, 1)), vget_low_f32(vextq_f32(c2, c2, 1))), vcombine_f32(vdup_lane_f32(vget_high_f32(c1), 1), vdup_lane_f32(vget_high_f32(c3), 1))),
+        vmulq_f32(vcombine_f32(vdup_lane_f32(vget_high_f32(c0), 1), vdup_lane_f32(vget_high_f32(c2), 1)), vcombine_f32(vget_low_f32(vextq_f32(c1, c1, 1)), vget_low_f32(vextq_f32(c3, c3, 1)))));
+
+    // Determinant products: b00*b11, b01*b10, b02*b09, b03*b08, b04*b07, b05*b06
+    vst1q_f32(p, vmulq_f32(lo, vcombine_f32(vrev64_f32(vget_high_f32(mid)), vrev64_f32(vget_high_f32(hi)))));
+    vst1q_f32(p + 4, vmulq_f32(mid, vcombine_f32(vrev64_f32(vget_low_f32(hi)), vget_low_f32(hi))));
+    float invDet = 1.0f/(p[0] - p[1] + p[2] + p[3] - p[4] + p[5]);
+
+    const float signs[4] = { 1.0f, -1.0f, 1.0f, -1.0f };
+    float32x4_t sign = vld1q_f32(signs);
+    float32x4_t det = vdupq_n_f32(invDet);
+    float32x4_t cols[4] = { c1, c0, c3, c2 };
+
+    for (int row = 0; row < 4; row++)
+    {
+        // b factors: { b11, b11, b10, b09 }, { b10, b08, b08, b07 }, { b09, b07, b06, b06 } (rows 0-1)
+        float32x2_t m = (row < 2)? vget_high_f32(mid) : vget_low_f32(mid);
+        float32x4_t base = (row < 2)? hi : lo;
+        float32x4_t b1 = vmulq_f32(vcombine_f32(vdup_lane_f32(m, 1), vset_lane_f32(vgetq_lane_f32(base, 3), m, 1)), sign);
+        float32x4_t b2 = vmulq_f32(vcombine_f32(vset_lane_f32(vgetq_lane_f32(base, 2), m, 1), vrev64_f32(vget_low_f32(vextq_f32(base, base, 1)))), sign);
+        float32x4_t b3 = vmulq_f32(vcombine_f32(vset_lane_f32(vgetq_lane_f32(base, 1), vrev64_f32(vget_high_f32(base)), 1), vdup_lane_f32(vget_low_f32(base), 0)), sign);
+
+        float32x4_t a = cols[row];
+        float32x4_t p1 = vmulq_f32(vsetq_lane_f32(vgetq_lane_f32(a, 1), vdupq_lane_f32(vget_low_f32(a), 0), 0), b1);
+        float32x4_t p2 = vmulq_f32(vcombine_f32(vdup_lane_f32(vget_high_f32(a), 0), vdup_lane_f32(vget_low_f32(a), 1)), b2);
+        float32x4_t p3 = vmulq_f32(vsetq_lane_f32(vgetq_lane_f32(a, 2), vdupq_lane_f32(vget_high_f32(a), 1), 3), b3);
+        float32x4_t sum = ((row%2) == 0)? vaddq_f32(vsubq_f32(p1, p2), p3) : vsubq_f32(vsubq_f32(p2, p1), p3);
+
+        vst1q_f32(res + row*4, vmulq_f32(sum, det));
+    }
+#else
+    __m128 c0 = _mm_loadu_ps(&mat.m0), c1 = _mm_loadu_ps(&mat.m1), c2 = _mm_loadu_ps(&mat.m2), c3 = _mm_loadu_ps(&mat.m3);
+    _MM_TRANSPOSE4_PS(c0, c1, c2, c3);      // Memory rows transposed into columns
+
+    __m128 lo = _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(c0, c0, _MM_SHUFFLE(1, 0, 0, 0)), _mm_shuffle_ps(c1, c1, _MM_SHUFFLE(2, 3, 2, 1))),
+                           _mm_mul_ps(_mm_shuffle_ps(c0, c0, _MM_SHUFFLE(2, 3, 2, 1)), _mm_shuffle_ps(c1, c1, _MM_SHUFFLE(1, 0, 0, 0))));
+    __m128 hi = _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(c2, c2, _MM_SHUFFLE(1, 0, 0, 0)), _mm_shuffle_ps(c3, c3, _MM_SHUFFLE(2, 3, 2, 1))),
+                           _mm_mul_ps(_mm_shuffle_ps(c2, c2, _MM_SHUFFLE(2, 3, 2, 1)), _mm_shuffle_ps(c3, c3, _MM_SHUFFLE(1, 0, 0, 0))));
+    __m128 mid = _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(c0, c2, _MM_SHUFFLE(2, 1, 2, 1)), _mm_shuffle_ps(c1, c3, _MM_SHUFFLE(3, 3, 3, 3))),
+                            _mm_mul_ps(_mm_shuffle_ps(c0, c2, _MM_SHUFFLE(3, 3, 3, 3)), _mm_shuffle_ps(c1, c3, _MM_SHUFFLE(2, 1, 2, 1))));
+
+    // Determinant products: b00*b11, b01*b10, b02*b09, b03*b08, b04*b07, b05*b06
+    _mm_storeu_ps(p, _mm_mul_ps(lo, _mm_shuffle_ps(mid, hi, _MM_SHUFFLE(2, 3, 2, 3))));
+    _mm_storeu_ps(p + 4, _mm_mul_ps(mid, _mm_shuffle_ps(hi, hi, _MM_SHUFFLE(0, 0, 0, 1))));
+    float invDet = 1.0f/(p[0] - p[1] + p[2] + p[3] - p[4] + p[5]);
+
+    __m128 sign = _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f);
+    __m128 det = _mm_set1_ps(invDet);
+
+    // Rows 0-1 b factors: { b11, b11, b10, b09 }, { b10, b08, b08, b07 }, { b09, b07, b06, b06 }
+    __m128 t1 = _mm_shuffle_ps(mid, hi, _MM_SHUFFLE(3, 1, 3, 2));
+    __m128 t2 = _mm_shuffle_ps(mid, hi, _MM_SHUFFLE(1, 2, 2, 2));
+    __m128 b1 = _mm_xor_ps(_mm_shuffle_ps(t1, t1, _MM_SHUFFLE(3, 0, 1, 1)), sign);
+    __m128 b2 = _mm_xor_ps(_mm_shuffle_ps(t2, t2, _MM_SHUFFLE(3, 2, 2, 0)), sign);
+    __m128 b3 = _mm_xor_ps(_mm_shuffle_ps(hi, hi, _MM_SHUFFLE(0, 0, 1, 3)), sign);
+
+    __m128 p1 = _mm_mul_ps(_mm_shuffle_ps(c1, c1, _MM_SHUFFLE(0, 0, 0, 1)), b1);
+    __m128 p2 = _mm_mul_ps(_mm_shuffle_ps(c1, c1, _MM_SHUFFLE(1, 1, 2, 2)), b2);
+    __m128 p3 = _mm_mul_ps(_mm_shuffle_ps(c1, c1, _MM_SHUFFLE(2, 3, 3, 3)), b3);
+    _mm_storeu_ps(res, _mm_mul_ps(_mm_add_ps(_mm_sub_ps(p1, p2), p3), det));
+
+    p1 = _mm_mul_ps(_mm_shuffle_ps(c0, c0, _MM_SHUFFLE(0, 0, 0, 1)), b1);
+    p2 = _mm_mul_ps(_mm_shuffle_ps(c0, c0, _MM_SHUFFLE(1, 1, 2, 2)), b2);
+    p3 = _mm_mul_ps(_mm_shuffle_ps(c0, c0, _MM_SHUFFLE(2, 3, 3, 3)), b3);
+    _mm_storeu_ps(res + 4, _mm_mul_ps(_mm_sub_ps(_mm_sub_ps(p2, p1), p3), det));
+
+    // Rows 2-3 b factors: { b05, b05, b04, b03 }, { b04, b02, b02, b01 }, { b03, b01, b00, b00 }
+    t1 = _mm_shuffle_ps(mid, lo, _MM_SHUFFLE(3, 3, 0, 1));
+    t2 = _mm_shuffle_ps(mid, lo, _MM_SHUFFLE(1, 2, 0, 0));
+    b1 = _mm_xor_ps(_mm_shuffle_ps(t1, t1, _MM_SHUFFLE(2, 1, 0, 0)), sign);
+    b2 = _mm_xor_ps(_mm_shuffle_ps(t2, t2, _MM_SHUFFLE(3, 2, 2, 0)), sign);
+    b3 = _mm_xor_ps(_mm_shuffle_ps(lo, lo, _MM_SHUFFLE(0, 0, 1, 3)), sign);
+
+    p1 = _mm_mul_ps(_mm_shuffle_ps(c3, c3, _MM_SHUFFLE(0, 0, 0, 1)), b1);
+    p2 = _mm_mul_ps(_mm_shuffle_ps(c3, c3, _MM_SHUFFLE(1, 1, 2, 2)), b2);
+    p3 = _mm_mul_ps(_mm_shuffle_ps(c3, c3, _MM_SHUFFLE(2, 3, 3, 3)), b3);
+    _mm_storeu_ps(res + 8, _mm_mul_ps(_mm_add_ps(_mm_sub_ps(p1, p2), p3), det));
+
+    p1 = _mm_mul_ps(_mm_shuffle_ps(c2, c2, _MM_SHUFFLE(0, 0, 0, 1)), b1);
+    p2 = _mm_mul_ps(_mm_shuffle_ps(c2, c2, _MM_SHUFFLE(1, 1, 2, 2)), b2);
+    p3 = _mm_mul_ps(_mm_shuffle_ps(c2, c2, _MM_SHUFFLE(2, 3, 3, 3)), b3);
+    _mm_storeu_ps(res + 12, _mm_mul_ps(_mm_sub_ps(_mm_sub_ps(p2, p1), p3), det));
+#endif
+#else
     // Cache the matrix values (speed optimization)
     float a00 = mat.m0, a01 = mat.m1, a02 = mat.m2, a03 = mat.m3;
     float a10 = mat.m4, a11 = mat.m5, a12 = mat.m6, a13 = mat.m7;
@@ -1237,6 +1475,7 @@ RMAPI Matrix MatrixInvert(Matrix mat)
     result.m13 = (a00*b09 - a01*b07 + a02*b06)*invDet;
     result.m14 = (-a30*b03 + a31*b01 - a32*b00)*invDet;
     result.m15 = (a20*b03 - a21*b01 + a22*b00)*invDet;
+#endif
 
     return result;
 }
@@ -1308,6 +1547,43 @@ RMAPI Matrix MatrixMultiply(Matrix left, Matrix right)
 {
     Matrix result = { 0 };
 
+#if defined(RAYMATH_SIMD_NEON) || defined(RAYMATH_SIMD_SSE)
+    // Every memory row of result is a combination of left memory rows,
+    // weighted by the matching memory row of right: row[r] = sum(right[r][k]*left[k])
+    const float *l = &left.m0;
+    const float *r = &right.m0;
+    float *res = &result.m0;
+
+#if defined(RAYMATH_SIMD_NEON)
+    float32x4_t l0 = vld1q_f32(l), l1 = vld1q_f32(l + 4), l2 = vld1q_f32(l + 8), l3 = vld1q_f32(l + 12);
+
+    for (int row = 0; row < 4; row++)
+    {
+        float32x4_t sum = vmulq_n_f32(l0, r[row*4]);
+        sum = vaddq_f32(sum, vmulq_n_f32(l1, r[row*4 + 1]));
+        sum = vaddq_f32(sum, vmulq_n_f32(l2, r[row*4 + 2]));
+        sum = vaddq_f32(sum, vmulq_n_f32(l3, r[row*4 + 3]));
+        vst1q_f32(res + row*4, sum);
+    }
+#else
+    __m128 l0 = _mm_loadu_ps(l), l1 = _mm_loadu_ps(l + 4), l2 = _mm_loadu_ps(l + 8), l3 = _mm_loadu_ps(l + 12);
+
+    // NOTE: Right rows are loaded as vectors and weights broadcast from lanes (no scalar loads)
+    #define RAYMATH_SSE_MULTIPLY_ROW(row) { \
+        __m128 w = _mm_loadu_ps(r + row*4); \
+        __m128 sum = _mm_mul_ps(l0, _mm_shuffle_ps(w, w, _MM_SHUFFLE(0, 0, 0, 0))); \
+        sum = _mm_add_ps(sum, _mm_mul_ps(l1, _mm_shuffle_ps(w, w, _MM_SHUFFLE(1, 1, 1, 1)))); \
+        sum = _mm_add_ps(sum, _mm_mul_ps(l2, _mm_shuffle_ps(w, w, _MM_SHUFFLE(2, 2, 2, 2)))); \
+        sum = _mm_add_ps(sum, _mm_mul_ps(l3, _mm_shuffle_ps(w, w, _MM_SHUFFLE(3, 3, 3, 3)))); \
+        _mm_storeu_ps(res + row*4, sum); }
+
+    RAYMATH_SSE_MULTIPLY_ROW(0)
+    RAYMATH_SSE_MULTIPLY_ROW(1)
+    RAYMATH_SSE_MULTIPLY_ROW(2)
+    RAYMATH_SSE_MULTIPLY_ROW(3)
+    #undef RAYMATH_SSE_MULTIPLY_ROW
+#endif
+#else
     result.m0 = left.m0*right.m0 + left.m1*right.m4 + left.m2*right.m8 + left.m3*right.m12;
     result.m1 = left.m0*right.m1 + left.m1*right.m5 + left.m2*right.m9 + left.m3*right.m13;
     result.m2 = left.m0*right.m2 + left.m1*right.m6 + left.m2*right.m10 + left.m3*right.m14;
@@ -1324,6 +1600,7 @@ RMAPI Matrix MatrixMultiply(Matrix left, Matrix right)
     result.m13 = left.m12*right.m1 + left.m13*right.m5 + left.m14*right.m9 + left.m15*right.m13;
     result.m14 = left.m12*right.m2 + left.m13*right.m6 + left.m14*right.m10 + left.m15*right.m14;
     result.m15 = left.m12*right.m3 + left.m13*right.m7 + left.m14*right.m11 + left.m15*right.m15;
+#endif
 
     return result;
 }
@@ -46,6 +46,8 @@
 *
 *       #define SUPPORT_GIF_RECORDING
 *           Allow automatic gif recording of current screen pressing CTRL+F12, defined in KeyCallback()
+*           Frames are read back asynchronously (if supported) and queued to an encoder thread,
+*           only the region changed from previous frame is encoded, frames are dropped if queue is full
 *
 *       #define SUPPORT_COMPRESSION_API
 *           Support CompressData() and DecompressData() functions, those functions use zlib implementation
@@ -122,6 +124,10 @@
     #include "external/msf_gif.h"   // GIF recording functionality
 #endif
 
+#if defined(SUPPORT_SCREEN_CAPTURE) || defined(SUPPORT_GIF_RECORDING)
+    #include <pthread.h>            // Required for: pthread_create(), pthread_cond_wait() [Used in screenshots export and GIF frames encoding]
+#endif
+
 #if defined(SUPPORT_COMPRESSION_API)
     #define SINFL_IMPLEMENTATION
     #define SINFL_NO_SIMD
@@ -229,6 +235,17 @@ __declspec(dllimport) int __stdcall WideCharToMultiByte(unsigned int cp, unsigne
     #define MAX_AUTOMATION_EVENTS      16384        // Maximum number of automation events to record
 #endif
 
+#ifndef MAX_SCREENSHOT_JOBS
+    #define MAX_SCREENSHOT_JOBS            4        // Maximum number of screenshots being exported, taking more waits for oldest one
+#endif
+
+#ifndef MAX_GIF_RECORD_QUEUE
+    #define MAX_GIF_RECORD_QUEUE           3        // Maximum number of GIF frames waiting to be encoded, more are dropped
+#endif
+#ifndef GIF_RECORD_FRAMERATE
+    #define GIF_RECORD_FRAMERATE          10        // GIF frame recorded every n game frames
+#endif
+
 // Flags operation macros
 #define FLAG_SET(n, f) ((n) |= (f))
 #define FLAG_CLEAR(n, f) ((n) &= ~(f))
@@ -351,12 +368,74 @@ CoreData CORE = { 0 };               // Global CORE state context
 
 #if defined(SUPPORT_SCREEN_CAPTURE)
 static int screenshotCounter = 0;    // Screenshots counter
+
+// Screenshot export job, screen pixels are encoded and saved on a worker thread
+typedef struct ScreenshotJob {
+    pthread_t thread;                // Export thread
+    Image image;                     // Screen pixels (RGBA, top-down)
+    char path[512];                  // File path, extension defined by encoder
+    int encoder;                     // Encoder (ScreenshotEncoder)
+    int compressionLevel;            // Compression level, PNG encoders only
+    ScreenshotCallback callback;     // Export finished callback, called on main thread
+    bool active;                     // Job in use, until callback is called
+    bool done;                       // Export finished (accessed under lock)
+    bool success;                    // File saved successfully
+    int dataSize;                    // Encoded file size
+    double encodeTime;               // Encoding time (seconds)
+} ScreenshotJob;
+
+static ScreenshotJob screenshotJobs[MAX_SCREENSHOT_JOBS] = { 0 };  // Screenshot export jobs
+static int screenshotJobNext = 0;    // Next job slot, slots are used in order so the next one is the oldest
+static pthread_mutex_t screenshotLock = PTHREAD_MUTEX_INITIALIZER;  // Jobs done state lock
+static int screenshotEncoder = SCREENSHOT_PNG_PARALLEL;    // Encoder used by TakeScreenshotAsync()
+static int screenshotCompressionLevel = 5;                 // Compression level used by TakeScreenshotAsync()
 #endif
 
 #if defined(SUPPORT_GIF_RECORDING)
 int gifFrameCounter = 0;             // GIF frames counter
 bool gifRecording = false;           // GIF recording state
 MsfGifState gifState = { 0 };        // MSGIF context state
+
+// GIF frame captured, waiting to be encoded
+typedef struct GifFrame {
+    unsigned char *data;             // Frame pixel data (RGBA, top-down)
+    int width;                       // Frame width
+    int height;                      // Frame height
+    double time;                     // Frame capture time (seconds)
+} GifFrame;
+
+// GIF frames encoder, msf_gif_frame() is called on a worker thread
+// NOTE: Frames pushed when queue is full are dropped, rendering never waits for encoding
+typedef struct GifEncoder {
+    pthread_t thread;                // Encoder thread
+    pthread_mutex_t lock;            // Frames queue lock
+    pthread_cond_t cond;             // Frames queue changed condition
+    GifFrame queue[MAX_GIF_RECORD_QUEUE];   // Frames waiting to be encoded (ring buffer)
+    int queueHead;                   // Oldest frame in queue
+    int queueCount;                  // Frames in queue
+    double readTime[RL_READBACK_BUFFERS];   // Capture time of frames being read back by GPU (ring buffer)
+    int readHead;                    // Oldest frame being read back
+    int readCount;                   // Frames being read back
+    bool active;                     // Encoder thread running, otherwise frames are encoded on calling thread
+    bool quit;                       // Encoder thread exit request
+
+    // Encoder state, only accessed by encoder thread while recording
+    unsigned char *previous;         // Previous frame pixel data, to get changed region
+    bool previousRegion;             // Previous encoded frame was a region (not full canvas)
+    double startTime;                // Recording start time (seconds)
+    int frameTime;                   // Last encoded frame time (centiseconds)
+    int lastTime;                    // Last received frame time (centiseconds)
+    int interval;                    // Last interval between received frames (centiseconds)
+
+    // Encoder stats
+    int framesEncoded;               // Frames encoded
+    int framesUnchanged;             // Frames skipped, equal to previous one
+    int framesDropped;               // Frames dropped, queue full or size changed
+    long long pixelsEncoded;         // Pixels encoded (changed regions)
+    double encodeTime;               // Time spent encoding (seconds)
+} GifEncoder;
+
+static GifEncoder gifEncoder = { 0 }; // GIF frames encoder
 #endif
 
 #if defined(SUPPORT_AUTOMATION_EVENTS)
@@ -457,6 +536,11 @@ extern void LoadFontDefault(void);      // [Module: text] Loads default font on
 extern void UnloadFontDefault(void);    // [Module: text] Unloads default font from GPU memory
 #endif
 
+#if defined(SUPPORT_MODULE_RTEXTURES)
+extern unsigned char *ExportImageToMemoryPNG(Image image, int compressionLevel, bool parallel, int *dataSize);   // [Module: textures] Export image as PNG, deflate optionally split in parallel chunks
+extern void CloseTextureLoader(void);   // [Module: textures] Close texture loader, loader threads joined and queues emptied
+#endif
+
 extern int InitPlatform(void);          // Initialize platform (graphics, inputs and more)
 extern void ClosePlatform(void);        // Close platform
 
@@ -471,6 +555,25 @@ static void ScanDirectoryFilesRecursively(const char *basePath, FilePathList *li
 static void RecordAutomationEvent(void); // Record frame events (to internal events array)
 #endif
 
+#if defined(SUPPORT_SCREEN_CAPTURE)
+static void ExportScreenshot(ScreenshotJob *job);           // Encode and save screenshot, callback not called
+static void FinishScreenshot(ScreenshotJob *job);           // Finish screenshot job once exported, callback called
+static void *ScreenshotThread(void *arg);                   // Screenshot export thread
+static void PollScreenshots(bool wait);                     // Finish exported screenshots jobs, callbacks called (optionally waiting for all of them)
+#endif
+
+#if defined(SUPPORT_GIF_RECORDING)
+static void StartGifEncoder(void);                          // Start GIF frames encoder thread
+static void StopGifEncoder(void);                           // Stop GIF frames encoder thread once queued frames are encoded, stats reported
+static void CaptureGifFrame(void);                          // Capture current screen frame (read back asynchronously if supported)
+static void PollGifFrames(bool wait);                       // Push frames already read back by GPU to encoder (optionally waiting for all of them)
+static void PushGifFrame(unsigned char *data, int width, int height, double time, bool wait);   // Push frame to encoder queue, data is freed once encoded
+static void *GifEncoderThread(void *arg);                   // GIF frames encoder thread
+static void EncodeGifFrame(GifFrame frame);                 // Encode frame region changed from previous frame
+static bool GetGifChangedRegion(const unsigned char *data, const unsigned char *previous, int width, int height, int *x, int *y, int *regionWidth, int *regionHeight);  // Get region changed between frames
+static void SetGifFrameDelay(int delay);                    // Set last encoded frame delay (centiseconds)
+#endif
+
 #if defined(_WIN32)
 // NOTE: We declare Sleep() function symbol to avoid including windows.h (kernel32.lib linkage required)
 void __stdcall Sleep(unsigned long msTimeout);              // Required for: WaitTime()
@@ -670,12 +773,23 @@ void CloseWindow(void)
 #if defined(SUPPORT_GIF_RECORDING)
     if (gifRecording)
     {
+        // Collect frames still being read back by GPU, pixel buffers must be released before GL context
+        PollGifFrames(true);
+        StopGifEncoder();
         MsfGifResult result = msf_gif_end(&gifState);
         msf_gif_free(result);
         gifRecording = false;
     }
 #endif
 
+#if defined(SUPPORT_SCREEN_CAPTURE)
+    PollScreenshots(true);      // Wait for screenshots being exported
+#endif
+
+#if defined(SUPPORT_MODULE_RTEXTURES)
+    CloseTextureLoader();       // Join texture loader threads, textures still loading are not uploaded
+#endif
+
 #if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_DEFAULT_FONT)
     UnloadFontDefault();        // WARNING: Module required: rtext
 #endif
@@ -838,20 +952,12 @@ void EndDrawing(void)
     // Draw record indicator
     if (gifRecording)
     {
-        #define GIF_RECORD_FRAMERATE    10
         gifFrameCounter++;
 
-        // NOTE: We record one gif frame every 10 game frames
-        if ((gifFrameCounter%GIF_RECORD_FRAMERATE) == 0)
-        {
-            // Get image data for the current frame (from backbuffer)
-            // NOTE: This process is quite slow... :(
-            Vector2 scale = GetWindowScaleDPI();
-            unsigned char *screenData = rlReadScreenPixels((int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y));
-            msf_gif_frame(&gifState, screenData, 10, 16, (int)((float)CORE.Window.render.width*scale.x)*4);
+        PollGifFrames(false);
 
-            RL_FREE(screenData);    // Free image data
-        }
+        // NOTE: We record one gif frame every GIF_RECORD_FRAMERATE game frames
+        if ((gifFrameCounter%GIF_RECORD_FRAMERATE) == 0) CaptureGifFrame();
 
     #if defined(SUPPORT_MODULE_RSHAPES) && defined(SUPPORT_MODULE_RTEXT)
         if (((gifFrameCounter/15)%2) == 1)
@@ -869,6 +975,12 @@ void EndDrawing(void)
     if (automationEventRecording) RecordAutomationEvent();    // Event recording
 #endif
 
+#if defined(SUPPORT_MODULE_RTEXTURES)
+    UpdateTextureUploads();              // Upload textures loaded asynchronously, within per frame budget
+#endif
+
+    rlEndFrameStats();                   // Frame boundary for rlgl statistics
+
 #if !defined(SUPPORT_CUSTOM_FRAME_CONTROL)
     SwapScreenBuffer();                  // Copy back buffer to front buffer (screen)
 
@@ -904,6 +1016,10 @@ void EndDrawing(void)
             {
                 gifRecording = false;
 
+                // Encode frames still being read back by GPU
+                PollGifFrames(true);
+                StopGifEncoder();
+
                 MsfGifResult result = msf_gif_end(&gifState);
 
                 SaveFileData(TextFormat("%s/screenrec%03i.gif", CORE.Storage.basePath, screenshotCounter), result.data, (unsigned int)result.dataSize);
@@ -918,6 +1034,7 @@ void EndDrawing(void)
 
                 Vector2 scale = GetWindowScaleDPI();
                 msf_gif_begin(&gifState, (int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y));
+                StartGifEncoder();
                 screenshotCounter++;
 
                 TRACELOG(LOG_INFO, "SYSTEM: Start animated GIF recording: %s", TextFormat("screenrec%03i.gif", screenshotCounter));
@@ -926,10 +1043,12 @@ void EndDrawing(void)
         else
 #endif  // SUPPORT_GIF_RECORDING
         {
-            TakeScreenshot(TextFormat("screenshot%03i.png", screenshotCounter));
+            TakeScreenshotAsync(TextFormat("screenshot%03i.png", screenshotCounter), NULL);
             screenshotCounter++;
         }
     }
+
+    PollScreenshots(false);     // Screenshots exported on worker threads, callbacks called
 #endif  // SUPPORT_SCREEN_CAPTURE
 
     CORE.Time.frameCounter++;
@@ -1791,6 +1910,74 @@ void TakeScreenshot(const char *fileName)
 #endif
 }
 
+// Takes a screenshot of current screen, encoded and saved on a worker thread
+// NOTE: File format is defined by screenshot encoder (fileName extension is replaced),
+// callback is called on main thread (EndDrawing()) once file is saved, it can be NULL
+void TakeScreenshotAsync(const char *fileName, ScreenshotCallback callback)
+{
+#if defined(SUPPORT_SCREEN_CAPTURE) && defined(SUPPORT_MODULE_RTEXTURES)
+    // Security check to (partially) avoid malicious code
+    if (strchr(fileName, '\'') != NULL) { TRACELOG(LOG_WARNING, "SYSTEM: Provided fileName could be potentially malicious, avoid [\'] character"); return; }
+
+    ScreenshotJob *job = &screenshotJobs[screenshotJobNext];
+
+    // All jobs in use, waiting for oldest one
+    if (job->active) FinishScreenshot(job);
+
+    Vector2 scale = GetWindowScaleDPI();
+    int width = (int)((float)CORE.Window.render.width*scale.x);
+    int height = (int)((float)CORE.Window.render.height*scale.y);
+
+    job->image = (Image){ rlReadScreenPixels(width, height), width, height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+    job->encoder = screenshotEncoder;
+    job->compressionLevel = screenshotCompressionLevel;
+    job->callback = callback;
+    job->done = false;
+    job->success = false;
+    job->dataSize = 0;
+    job->encodeTime = 0.0;
+
+    snprintf(job->path, sizeof(job->path), "%s/%s%s", CORE.Storage.basePath, GetFileNameWithoutExt(fileName), (job->encoder == SCREENSHOT_QOI)? ".qoi" : ".png");
+
+    if (pthread_create(&job->thread, NULL, ScreenshotThread, job) == 0)
+    {
+        job->active = true;
+        screenshotJobNext = (screenshotJobNext + 1)%MAX_SCREENSHOT_JOBS;
+    }
+    else
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: Failed to create screenshot export thread, exported on main thread");
+
+        ExportScreenshot(job);
+        RL_FREE(job->image.data);
+        job->image.data = NULL;
+
+        if (callback != NULL) callback(job->path, job->success);
+    }
+#else
+    // Worker threads not available, screenshot exported on calling thread
+    TakeScreenshot(fileName);
+
+    if (callback != NULL)
+    {
+        const char *path = TextFormat("%s/%s", CORE.Storage.basePath, GetFileName(fileName));
+        callback(path, FileExists(path));
+    }
+#endif
+}
+
+// Set encoder and compression level used by TakeScreenshotAsync()
+// NOTE: Compression level in range [0..8], only used by PNG encoders
+void SetScreenshotEncoder(int encoder, int compressionLevel)
+{
+#if defined(SUPPORT_SCREEN_CAPTURE)
+    if ((encoder < SCREENSHOT_PNG) || (encoder > SCREENSHOT_QOI)) { TRACELOG(LOG_WARNING, "SYSTEM: Screenshot encoder not supported"); return; }
+
+    screenshotEncoder = encoder;
+    screenshotCompressionLevel = compressionLevel;
+#endif
+}
+
 // Setup window configuration flags (view FLAGS)
 // NOTE: This function is expected to be called before window creation,
 // because it sets up some flags for the window creation process.
@@ -2634,7 +2821,7 @@ void PlayAutomationEvent(AutomationEvent event)
             // Custom event
             case ACTION_TAKE_SCREENSHOT:
             {
-                TakeScreenshot(TextFormat("screenshot%03i.png", screenshotCounter));
+                TakeScreenshotAsync(TextFormat("screenshot%03i.png", screenshotCounter), NULL);
                 screenshotCounter++;
             } break;
             case ACTION_SETTARGETFPS: SetTargetFPS(event.params[0]); break;
@@ -3537,6 +3724,371 @@ static void RecordAutomationEvent(void)
 }
 #endif
 
+#if defined(SUPPORT_SCREEN_CAPTURE)
+// Encode and save screenshot, callback not called
+// NOTE: Called from export thread, job is not accessed by main thread until done
+static void ExportScreenshot(ScreenshotJob *job)
+{
+#if defined(SUPPORT_MODULE_RTEXTURES)
+    static const char *encoderNames[3] = { "PNG", "PNG parallel", "QOI" };
+    unsigned char *fileData = NULL;
+    double startTime = GetTime();
+
+    if (job->encoder == SCREENSHOT_QOI) fileData = ExportImageToMemory(job->image, ".qoi", &job->dataSize);
+    else fileData = ExportImageToMemoryPNG(job->image, job->compressionLevel, (job->encoder == SCREENSHOT_PNG_PARALLEL), &job->dataSize);
+
+    job->encodeTime = GetTime() - startTime;
+
+    if (fileData != NULL) job->success = SaveFileData(job->path, fileData, job->dataSize);
+    RL_FREE(fileData);
+
+    if (job->success)
+    {
+        TRACELOG(LOG_INFO, "SYSTEM: [%s] Screenshot taken successfully (%s, level %i): %i KB, encoded in %.2f ms", job->path,
+            encoderNames[job->encoder], job->compressionLevel, job->dataSize/1024, job->encodeTime*1000.0);
+    }
+    else TRACELOG(LOG_WARNING, "SYSTEM: [%s] Screenshot could not be saved", job->path);
+#endif
+}
+
+// Finish screenshot job once exported, callback called
+static void FinishScreenshot(ScreenshotJob *job)
+{
+    pthread_join(job->thread, NULL);
+
+    RL_FREE(job->image.data);
+    job->image.data = NULL;
+    job->active = false;
+
+    if (job->callback != NULL) job->callback(job->path, job->success);
+}
+
+// Screenshot export thread
+static void *ScreenshotThread(void *arg)
+{
+    ScreenshotJob *job = (ScreenshotJob *)arg;
+
+    ExportScreenshot(job);
+
+    pthread_mutex_lock(&screenshotLock);
+    job->done = true;
+    pthread_mutex_unlock(&screenshotLock);
+
+    return NULL;
+}
+
+// Finish exported screenshots jobs, callbacks called (optionally waiting for all of them)
+// NOTE: Jobs are finished in the order they were started
+static void PollScreenshots(bool wait)
+{
+    for (int i = 0; i < MAX_SCREENSHOT_JOBS; i++)
+    {
+        ScreenshotJob *job = &screenshotJobs[(screenshotJobNext + i)%MAX_SCREENSHOT_JOBS];
+
+        if (!job->active) continue;
+
+        pthread_mutex_lock(&screenshotLock);
+        bool done = job->done;
+        pthread_mutex_unlock(&screenshotLock);
+
+        if (done || wait) FinishScreenshot(job);
+    }
+}
+#endif
+
+#if defined(SUPPORT_GIF_RECORDING)
+// Start GIF frames encoder thread
+static void StartGifEncoder(void)
+{
+    gifEncoder.queueHead = 0;
+    gifEncoder.queueCount = 0;
+    gifEncoder.readHead = 0;
+    gifEncoder.readCount = 0;
+    gifEncoder.quit = false;
+
+    gifEncoder.previous = NULL;
+    gifEncoder.previousRegion = false;
+    gifEncoder.startTime = GetTime();
+    gifEncoder.frameTime = 0;
+    gifEncoder.lastTime = 0;
+    gifEncoder.interval = 10;
+
+    gifEncoder.framesEncoded = 0;
+    gifEncoder.framesUnchanged = 0;
+    gifEncoder.framesDropped = 0;
+    gifEncoder.pixelsEncoded = 0;
+    gifEncoder.encodeTime = 0.0;
+
+    pthread_mutex_init(&gifEncoder.lock, NULL);
+    pthread_cond_init(&gifEncoder.cond, NULL);
+
+    gifEncoder.active = (pthread_create(&gifEncoder.thread, NULL, GifEncoderThread, NULL) == 0);
+    if (!gifEncoder.active) TRACELOG(LOG_WARNING, "SYSTEM: Failed to create GIF encoder thread, frames encoded on main thread");
+}
+
+// Stop GIF frames encoder thread once queued frames are encoded, stats reported
+static void StopGifEncoder(void)
+{
+    if (gifEncoder.active)
+    {
+        pthread_mutex_lock(&gifEncoder.lock);
+        gifEncoder.quit = true;
+        pthread_cond_signal(&gifEncoder.cond);
+        pthread_mutex_unlock(&gifEncoder.lock);
+
+        pthread_join(gifEncoder.thread, NULL);
+        gifEncoder.active = false;
+    }
+
+    pthread_cond_destroy(&gifEncoder.cond);
+    pthread_mutex_destroy(&gifEncoder.lock);
+
+    // Last frame is displayed for the time elapsed until last received frame, plus one capture interval
+    SetGifFrameDelay(gifEncoder.lastTime - gifEncoder.frameTime + gifEncoder.interval);
+
+    RL_FREE(gifEncoder.previous);
+    gifEncoder.previous = NULL;
+
+    TRACELOG(LOG_INFO, "SYSTEM: GIF frames: %i encoded, %i unchanged, %i dropped", gifEncoder.framesEncoded, gifEncoder.framesUnchanged, gifEncoder.framesDropped);
+    if (gifEncoder.encodeTime > 0.0)
+    {
+        TRACELOG(LOG_INFO, "SYSTEM: GIF encoding: %.2f ms per frame, %.2f Mpixels per second", gifEncoder.encodeTime*1000.0/(gifEncoder.framesEncoded + gifEncoder.framesUnchanged),
+            (double)gifEncoder.pixelsEncoded/gifEncoder.encodeTime/1000000.0);
+    }
+}
+
+// Capture current screen frame (read back asynchronously if supported)
+// NOTE: Capture time is kept until frame is available, to set frame delays properly
+static void CaptureGifFrame(void)
+{
+    Vector2 scale = GetWindowScaleDPI();
+    int width = (int)((float)CORE.Window.render.width*scale.x);
+    int height = (int)((float)CORE.Window.render.height*scale.y);
+    double time = GetTime();
+
+    if (rlReadScreenPixelsAsync(width, height))
+    {
+        gifEncoder.readTime[(gifEncoder.readHead + gifEncoder.readCount)%RL_READBACK_BUFFERS] = time;
+        gifEncoder.readCount++;
+    }
+    else if (gifEncoder.readCount == 0) PushGifFrame(rlReadScreenPixels(width, height), width, height, time, false);
+    else
+    {
+        // All pixel buffers in use, frame is dropped instead of waiting for GPU
+        pthread_mutex_lock(&gifEncoder.lock);
+        gifEncoder.framesDropped++;
+        pthread_mutex_unlock(&gifEncoder.lock);
+    }
+}
+
+// Push frames already read back by GPU to encoder (optionally waiting for all of them)
+static void PollGifFrames(bool wait)
+{
+    unsigned char *data = NULL;
+    int width = 0;
+    int height = 0;
+
+    while ((data = rlGetScreenPixelsAsync(&width, &height, wait)) != NULL)
+    {
+        double time = GetTime();
+
+        if (gifEncoder.readCount > 0)
+        {
+            time = gifEncoder.readTime[gifEncoder.readHead];
+            gifEncoder.readHead = (gifEncoder.readHead + 1)%RL_READBACK_BUFFERS;
+            gifEncoder.readCount--;
+        }
+
+        PushGifFrame(data, width, height, time, wait);
+    }
+}
+
+// Push frame to encoder queue, data is freed once encoded
+// NOTE: If queue is full, frame is dropped (unless wait is requested)
+static void PushGifFrame(unsigned char *data, int width, int height, double time, bool wait)
+{
+    if (data == NULL) return;
+
+    GifFrame frame = { data, width, height, time };
+
+    if (gifEncoder.active)
+    {
+        pthread_mutex_lock(&gifEncoder.lock);
+        while (wait && (gifEncoder.queueCount == MAX_GIF_RECORD_QUEUE)) pthread_cond_wait(&gifEncoder.cond, &gifEncoder.lock);
+
+        if (gifEncoder.queueCount < MAX_GIF_RECORD_QUEUE)
+        {
+            gifEncoder.queue[(gifEncoder.queueHead + gifEncoder.queueCount)%MAX_GIF_RECORD_QUEUE] = frame;
+            gifEncoder.queueCount++;
+            pthread_cond_signal(&gifEncoder.cond);
+        }
+        else
+        {
+            RL_FREE(data);
+            gifEncoder.framesDropped++;
+        }
+
+        pthread_mutex_unlock(&gifEncoder.lock);
+    }
+    else EncodeGifFrame(frame);
+}
+
+// GIF frames encoder thread
+// NOTE: gifState is only accessed by this thread while recording
+static void *GifEncoderThread(void *arg)
+{
+    pthread_mutex_lock(&gifEncoder.lock);
+
+    while (true)
+    {
+        while ((gifEncoder.queueCount == 0) && !gifEncoder.quit) pthread_cond_wait(&gifEncoder.cond, &gifEncoder.lock);
+
+        if (gifEncoder.queueCount == 0) break;      // Exit requested and no frame pending
+
+        GifFrame frame = gifEncoder.queue[gifEncoder.queueHead];
+        gifEncoder.queueHead = (gifEncoder.queueHead + 1)%MAX_GIF_RECORD_QUEUE;
+        gifEncoder.queueCount--;
+
+        // Frame taken, a producer could be waiting for space in queue
+        pthread_cond_signal(&gifEncoder.cond);
+        pthread_mutex_unlock(&gifEncoder.lock);
+
+        EncodeGifFrame(frame);
+
+        pthread_mutex_lock(&gifEncoder.lock);
+    }
+
+    pthread_mutex_unlock(&gifEncoder.lock);
+
+    return NULL;
+}
+
+// Encode frame region changed from previous frame
+// NOTE: msf_gif only encodes full canvas frames, so canvas size is set to region size while encoding
+// and region position is patched into image descriptor afterwards, previous frame palette is
+// invalidated when canvas changes to avoid msf_gif reusing (as transparent) pixels of a different layout
+static void EncodeGifFrame(GifFrame frame)
+{
+    double startTime = GetTime();
+    int time = (int)((frame.time - gifEncoder.startTime)*100.0 + 0.5);
+
+    if ((frame.width != gifState.width) || (frame.height != gifState.height))
+    {
+        // Screen size changed while recording, frame can not be encoded
+        RL_FREE(frame.data);
+
+        pthread_mutex_lock(&gifEncoder.lock);
+        gifEncoder.framesDropped++;
+        pthread_mutex_unlock(&gifEncoder.lock);
+        return;
+    }
+
+    int x = 0;
+    int y = 0;
+    int width = frame.width;
+    int height = frame.height;
+    bool changed = true;
+
+    if (gifEncoder.previous != NULL) changed = GetGifChangedRegion(frame.data, gifEncoder.previous, frame.width, frame.height, &x, &y, &width, &height);
+
+    if (changed)
+    {
+        // Previous frame is displayed until this one, including skipped unchanged frames
+        if (gifEncoder.framesEncoded > 0) SetGifFrameDelay(time - gifEncoder.frameTime);
+
+        bool region = ((width != frame.width) || (height != frame.height));
+        if (region || gifEncoder.previousRegion) gifState.previousFrame.rbits = -1;
+
+        gifState.width = width;
+        gifState.height = height;
+
+        int result = msf_gif_frame(&gifState, frame.data + (y*frame.width + x)*4, gifEncoder.interval, 16, frame.width*4);
+
+        gifState.width = frame.width;
+        gifState.height = frame.height;
+
+        if (result)
+        {
+            // Image descriptor position (left, top), after graphic control extension
+            unsigned char *descriptor = (unsigned char *)gifState.listTail->data + 8;
+            descriptor[1] = (unsigned char)(x & 0xff);
+            descriptor[2] = (unsigned char)(x >> 8);
+            descriptor[3] = (unsigned char)(y & 0xff);
+            descriptor[4] = (unsigned char)(y >> 8);
+        }
+
+        gifEncoder.previousRegion = region;
+        gifEncoder.frameTime = time;
+        gifEncoder.framesEncoded++;
+        gifEncoder.pixelsEncoded += width*height;
+
+        // Frame data is kept as previous frame, no copy required
+        RL_FREE(gifEncoder.previous);
+        gifEncoder.previous = frame.data;
+    }
+    else
+    {
+        gifEncoder.framesUnchanged++;
+        RL_FREE(frame.data);
+    }
+
+    if (gifEncoder.framesEncoded + gifEncoder.framesUnchanged > 1) gifEncoder.interval = time - gifEncoder.lastTime;
+    gifEncoder.lastTime = time;
+    gifEncoder.encodeTime += GetTime() - startTime;
+}
+
+// Get region changed between frames, returns false if frames are equal
+// NOTE: Region origin is aligned to 4 pixels, msf_gif dithering pattern is relative to it
+static bool GetGifChangedRegion(const unsigned char *data, const unsigned char *previous, int width, int height, int *x, int *y, int *regionWidth, int *regionHeight)
+{
+    int rowSize = width*4;
+    int top = 0;
+    int bottom = height - 1;
+
+    while ((top < height) && (memcmp(data + top*rowSize, previous + top*rowSize, rowSize) == 0)) top++;
+    if (top == height) return false;
+
+    while ((bottom > top) && (memcmp(data + bottom*rowSize, previous + bottom*rowSize, rowSize) == 0)) bottom--;
+
+    int left = width;
+    int right = -1;
+
+    for (int j = top; j <= bottom; j++)
+    {
+        const unsigned char *row = data + j*rowSize;
+        const unsigned char *previousRow = previous + j*rowSize;
+
+        for (int i = 0; i < left; i++) if (memcmp(row + i*4, previousRow + i*4, 4) != 0) { left = i; break; }
+        for (int i = width - 1; i > right; i--) if (memcmp(row + i*4, previousRow + i*4, 4) != 0) { right = i; break; }
+    }
+
+    left &= ~3;
+    top &= ~3;
+
+    *x = left;
+    *y = top;
+    *regionWidth = right + 1 - left;
+    *regionHeight = bottom + 1 - top;
+
+    return true;
+}
+
+// Set last encoded frame delay (centiseconds)
+// NOTE: Delay is stored in graphic control extension of last frame buffer
+static void SetGifFrameDelay(int delay)
+{
+    if ((gifState.listHead == NULL) || (gifState.framesSubmitted == 0)) return;
+
+    // NOTE: Most decoders replace delays under 2 centiseconds by 10 centiseconds
+    if (delay < 2) delay = 2;
+    if (delay > 65535) delay = 65535;
+
+    unsigned char *control = (unsigned char *)gifState.listTail->data;
+    control[4] = (unsigned char)(delay & 0xff);
+    control[5] = (unsigned char)(delay >> 8);
+}
+#endif
+
 #if !defined(SUPPORT_MODULE_RTEXT)
 // Formatting of text with variables to 'embed'
 // WARNING: String returned will expire after this function is called MAX_TEXTFORMAT_BUFFERS times
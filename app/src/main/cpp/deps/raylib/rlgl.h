@@ -17,6 +17,7 @@
 *          - Default batch (RLGL.defaultBatch): RenderBatch system to accumulate vertex data
 *          - Default texture (RLGL.defaultTextureId): 1x1 white pixel R8G8B8A8
 *          - Default shader (RLGL.State.defaultShaderId, RLGL.State.defaultShaderLocs)
+*          - SDF shapes batch (RLGL.ShapeBatch): One quad per rounded rectangle/circle/ring, shaded analytically
 *
 *       Internal buffer (and resources) must be manually unloaded calling rlglClose().
 *
@@ -46,6 +47,9 @@
 *       #define RLGL_ENABLE_OPENGL_DEBUG_CONTEXT
 *           Enable debug context (only available on OpenGL 4.3)
 *
+*       #define RLGL_DISABLE_SIMD
+*           Disable NEON/SSE kernels (bulk vertex transform), scalar code is used instead
+*
 *       rlgl capabilities could be customized just defining some internal
 *       values before library inclusion (default values listed):
 *
@@ -53,6 +57,9 @@
 *       #define RL_DEFAULT_BATCH_BUFFERS              1    // Default number of batch buffers (multi-buffering)
 *       #define RL_DEFAULT_BATCH_DRAWCALLS          256    // Default number of batch draw calls (by state changes: mode, texture)
 *       #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS    4    // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
+*       #define RL_DEFAULT_SHAPE_BATCH_INSTANCES   1024    // Default SDF shapes batch instances limit (rounded rectangles, circles, rings)
+*       #define RL_STATE_CACHE_TEXTURE_UNITS         16    // GL state cache: texture units tracked (binds on other units always issued)
+*       #define RL_RENDER_STATS_HISTORY             120    // Render stats history: frames kept in ring buffer
 *
 *       #define RL_MAX_MATRIX_STACK_SIZE             32    // Maximum size of internal Matrix stack
 *       #define RL_MAX_SHADER_LOCATIONS              32    // Maximum number of shader locations supported
@@ -217,6 +224,18 @@
 #ifndef RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS
     #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS       4      // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
 #endif
+#ifndef RL_DEFAULT_SHAPE_BATCH_INSTANCES
+    #define RL_DEFAULT_SHAPE_BATCH_INSTANCES      1024      // Default SDF shapes batch instances limit (rounded rectangles, circles, rings)
+#endif
+#ifndef RL_STATE_CACHE_TEXTURE_UNITS
+    #define RL_STATE_CACHE_TEXTURE_UNITS            16      // GL state cache: texture units tracked (binds on other units always issued)
+#endif
+#ifndef RL_RENDER_STATS_HISTORY
+    #define RL_RENDER_STATS_HISTORY                120      // Render stats history: frames kept in ring buffer
+#endif
+#ifndef RL_READBACK_BUFFERS
+    #define RL_READBACK_BUFFERS                      3      // Screen readback: pixel buffers in flight (asynchronous reads)
+#endif
 
 // Internal Matrix stack
 #ifndef RL_MAX_MATRIX_STACK_SIZE
@@ -384,6 +403,19 @@ typedef struct rlRenderBatch {
     float currentDepth;         // Current depth value for next draw
 } rlRenderBatch;
 
+// rlRenderStats type, GPU submission counters for one frame
+typedef struct rlRenderStats {
+    int drawCalls;              // GL draw calls issued (batch draws, SDF shapes and vertex arrays)
+    int vertices;               // Vertex submitted to internal render batch (rlVertex3f(), including alignment)
+    int flushes;                // Render batch flushes with vertex data
+    int batchOverflows;         // Flushes forced by batch limits (vertex buffer or draw calls full)
+    int textureSwitches;        // Texture binds issued for drawing (batch draws, rlEnableTexture()), texture loading/update binds not counted
+    int uploadedBytes;          // Bytes uploaded to GPU (vertex buffers and texture updates)
+    int stateCallsIssued;       // GL state calls issued by state cache
+    int stateCallsSkipped;      // GL state calls skipped by state cache (redundant)
+    int culled;                 // 2d primitives culled before tessellation (outside viewport or scissor area)
+} rlRenderStats;
+
 // OpenGL version
 typedef enum {
     RL_OPENGL_11 = 1,           // OpenGL 1.1
@@ -547,6 +579,12 @@ typedef enum {
     RL_CULL_FACE_BACK
 } rlCullMode;
 
+// Shader program binary cache callbacks
+// NOTE: Data loaded must be allocated with RL_MALLOC(), it is freed by rlgl
+typedef unsigned char *(*rlShaderCacheLoadCallback)(unsigned long long key, int *dataSize);        // Load cached program data for key
+typedef bool (*rlShaderCacheSaveCallback)(unsigned long long key, const unsigned char *data, int dataSize); // Save program data for key
+typedef double (*rlShaderCacheTimeCallback)(void);                                                 // Get current time in seconds (used to report time saved)
+
 //------------------------------------------------------------------------------------
 // Functions Declaration - Matrix operations
 //------------------------------------------------------------------------------------
@@ -580,6 +618,7 @@ RLAPI void rlNormal3f(float x, float y, float z);     // Define one vertex (norm
 RLAPI void rlColor4ub(unsigned char r, unsigned char g, unsigned char b, unsigned char a);  // Define one vertex (color) - 4 byte
 RLAPI void rlColor3f(float x, float y, float z);          // Define one vertex (color) - 3 float
 RLAPI void rlColor4f(float x, float y, float z, float w); // Define one vertex (color) - 4 float
+RLAPI void rlVertexArray2f(const float *positions, const float *texcoords, const unsigned char *colors, int count); // Define multiple vertex (position, texcoord and color arrays), NULL texcoords/colors use current ones
 
 //------------------------------------------------------------------------------------
 // Functions Declaration - OpenGL style functions (common to 1.1, 3.3+, ES2)
@@ -659,6 +698,11 @@ RLAPI void rlglInit(int width, int height);             // Initialize rlgl (buff
 RLAPI void rlglClose(void);                             // De-initialize rlgl (buffers, shaders, textures)
 RLAPI void rlLoadExtensions(void *loader);              // Load OpenGL extensions (loader function required)
 RLAPI int rlGetVersion(void);                           // Get current OpenGL version
+RLAPI void rlInvalidateStateCache(void);                // Invalidate GL state cache (required after direct GL calls changing bindings)
+RLAPI void rlGetStateCacheStats(int *callsIssued, int *callsSkipped);  // Get GL state calls issued and skipped (redundant) by state cache on last frame
+RLAPI void rlEndFrameStats(void);                       // End frame stats, current frame counters become last frame ones (called by EndDrawing())
+RLAPI rlRenderStats rlGetRenderStats(void);             // Get render stats of last frame
+RLAPI int rlGetRenderStatsHistory(rlRenderStats *stats, int count);   // Get render stats of last frames (oldest first), returns number of frames copied
 RLAPI void rlSetFramebufferWidth(int width);            // Set current framebuffer width
 RLAPI int rlGetFramebufferWidth(void);                  // Get default framebuffer width
 RLAPI void rlSetFramebufferHeight(int height);          // Set current framebuffer height
@@ -666,6 +710,7 @@ RLAPI int rlGetFramebufferHeight(void);                 // Get default framebuff
 
 RLAPI unsigned int rlGetTextureIdDefault(void);         // Get default texture id
 RLAPI unsigned int rlGetShaderIdDefault(void);          // Get default shader id
+RLAPI unsigned int rlGetShaderIdCurrent(void);          // Get current shader id (set by rlSetShader(), default shader if none)
 RLAPI int *rlGetShaderLocsDefault(void);                // Get default shader locations
 
 // Render batch management
@@ -677,6 +722,14 @@ RLAPI void rlDrawRenderBatch(rlRenderBatch *batch);                         // D
 RLAPI void rlSetRenderBatchActive(rlRenderBatch *batch);                    // Set the active render batch for rlgl (NULL for default internal)
 RLAPI void rlDrawRenderBatchActive(void);                                   // Update and draw internal render batch
 RLAPI bool rlCheckRenderBatchLimit(int vCount);                             // Check internal buffer overflow for a given number of vertex
+RLAPI bool rlCheckCulledRec(float x, float y, float width, float height);   // Check if 2d rectangle is outside viewport and scissor area (culled), current matrices considered
+RLAPI bool rlCheckVisibleRec(float x, float y, float width, float height);  // Check if 2d rectangle is fully inside viewport and scissor area, current matrices considered
+
+// SDF shapes batch management
+// NOTE: Rounded rectangles, circles and rings are accumulated as one instance per shape and
+// anti-aliased analytically in the fragment shader (signed distance), no tessellation or MSAA required
+RLAPI bool rlPushShapeInstance(float x, float y, float halfWidth, float halfHeight, float radius, float thickness, unsigned char r, unsigned char g, unsigned char b, unsigned char a); // Add SDF shape to batch (returns false if not supported)
+RLAPI void rlDrawShapeBatch(void);                                          // Draw pending SDF shapes batch
 
 RLAPI void rlSetTexture(unsigned int id);               // Set current texture for render batch and check buffers limits
 
@@ -709,6 +762,9 @@ RLAPI void rlUnloadTexture(unsigned int id);                              // Unl
 RLAPI void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int *mipmaps); // Generate mipmap data for selected texture
 RLAPI void *rlReadTexturePixels(unsigned int id, int width, int height, int format);              // Read texture pixel data
 RLAPI unsigned char *rlReadScreenPixels(int width, int height);           // Read screen pixel data (color buffer)
+RLAPI bool rlReadScreenPixelsAsync(int width, int height);                // Queue screen pixel data read into a pixel buffer, returns false if not supported or queue is full
+RLAPI unsigned char *rlGetScreenPixelsAsync(int *width, int *height, bool wait); // Get oldest queued screen pixel data, NULL if not available yet
+RLAPI void rlUnloadScreenPixelsAsync(void);                               // Discard queued screen pixel data reads and unload pixel buffers
 
 // Framebuffer management (fbo)
 RLAPI unsigned int rlLoadFramebuffer(int width, int height);              // Load an empty framebuffer
@@ -727,6 +783,8 @@ RLAPI void rlSetUniform(int locIndex, const void *value, int uniformType, int co
 RLAPI void rlSetUniformMatrix(int locIndex, Matrix mat);                        // Set shader value matrix
 RLAPI void rlSetUniformSampler(int locIndex, unsigned int textureId);           // Set shader value sampler
 RLAPI void rlSetShader(unsigned int id, int *locs);                             // Set shader currently active (id and locations)
+RLAPI void rlSetShaderCache(rlShaderCacheLoadCallback load, rlShaderCacheSaveCallback save, rlShaderCacheTimeCallback getTime); // Set shader program binary cache callbacks (before rlglInit())
+RLAPI void rlGetShaderCacheStats(int *hits, int *misses, float *timeSaved);     // Get shader program binary cache stats (time saved in milliseconds)
 
 // Compute shader management
 RLAPI unsigned int rlLoadComputeShaderProgram(unsigned int shaderId);           // Load compute shader program
@@ -830,8 +888,18 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #endif
 
 #include <stdlib.h>                     // Required for: malloc(), free()
-#include <string.h>                     // Required for: strcmp(), strlen() [Used in rlglInit(), on extensions loading]
-#include <math.h>                       // Required for: sqrtf(), sinf(), cosf(), floor(), log()
+#include <string.h>                     // Required for: strcmp(), strlen() [Used in rlglInit(), on extensions loading], memcmp()
+#include <math.h>                       // Required for: sqrtf(), sinf(), cosf(), floor(), log(), fabsf()
+
+#if !defined(RLGL_DISABLE_SIMD)
+    #if defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #include <arm_neon.h>           // Required for: NEON intrinsics [Used in rlVertexArray2f()]
+        #define RLGL_SIMD_NEON
+    #elif defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+        #include <xmmintrin.h>          // Required for: SSE intrinsics [Used in rlVertexArray2f()]
+        #define RLGL_SIMD_SSE
+    #endif
+#endif
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
@@ -962,6 +1030,19 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// SDF shape instance, one record per rounded rectangle/circle/ring
+typedef struct rlShapeInstance {
+    float rect[4];              // Shape center (x, y) and half size (width/2, height/2)
+    float params[3];            // Corner radius, outline thickness (0.0f for filled shapes) and depth
+    unsigned char color[4];     // Shape color (RGBA)
+} rlShapeInstance;
+
+// SDF shape vertex, used to expand instances when instancing is not supported
+typedef struct rlShapeVertex {
+    float corner[2];            // Quad corner, [-1..1] range
+    rlShapeInstance shape;      // Shape instance data (replicated for every vertex)
+} rlShapeVertex;
+
 typedef struct rlglData {
     rlRenderBatch *currentBatch;            // Current render batch
     rlRenderBatch defaultBatch;             // Default internal render batch
@@ -983,8 +1064,10 @@ typedef struct rlglData {
 
         unsigned int defaultTextureId;      // Default texture used on shapes/poly drawing (required by shader)
         unsigned int activeTextureId[RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS];    // Active texture ids to be enabled on batch drawing (0 active by default)
-        unsigned int defaultVShaderId;      // Default vertex shader id (used by default shader program)
-        unsigned int defaultFShaderId;      // Default fragment shader id (used by default shader program)
+        unsigned int defaultVShaderId;      // Default vertex shader id (used by default shader program, compiled on demand if program loaded from cache)
+        unsigned int defaultFShaderId;      // Default fragment shader id (used by default shader program, compiled on demand if program loaded from cache)
+        const char *defaultVShaderCode;     // Default vertex shader code
+        const char *defaultFShaderCode;     // Default fragment shader code
         unsigned int defaultShaderId;       // Default shader program id, supports vertex color and diffuse texture
         int *defaultShaderLocs;             // Default shader locations pointer to be used on rendering
         unsigned int currentShaderId;       // Current shader id to be used on rendering (by default, defaultShaderId)
@@ -1009,6 +1092,12 @@ typedef struct rlglData {
 
         int framebufferWidth;               // Current framebuffer width
         int framebufferHeight;              // Current framebuffer height
+        int viewportX;                      // Current viewport position X
+        int viewportY;                      // Current viewport position Y
+        int viewportWidth;                  // Current viewport width
+        int viewportHeight;                 // Current viewport height
+        bool scissorEnabled;                // Scissor test enabled flag
+        int scissor[4];                     // Current scissor area (x, y, width, height)
 
     } State;            // Renderer state
     struct {
@@ -1028,13 +1117,81 @@ typedef struct rlglData {
         bool texAnisoFilter;                // Anisotropic texture filtering support (GL_EXT_texture_filter_anisotropic)
         bool computeShader;                 // Compute shaders support (GL_ARB_compute_shader)
         bool ssbo;                          // Shader storage buffer object support (GL_ARB_shader_storage_buffer_object)
+        bool programBinary;                 // Program binary get/load support (GL_OES_get_program_binary)
+        bool pbo;                           // Pixel pack buffers and fence sync objects support (OpenGL ES 3.0 core)
 
         float maxAnisotropyLevel;           // Maximum anisotropy level supported (minimum is 2.0f)
         int maxDepthBits;                   // Maximum bits for depth component
 
     } ExtSupported;     // Extensions supported flags
+    struct {
+        rlShapeInstance *instances;         // Shape instances pending to be drawn
+        rlShapeVertex *vertices;            // Shape instances expanded to vertex (only if instancing not supported)
+        int instanceCount;                  // Shape instances counter
+        unsigned int cornerVboId;           // Unit quad corners buffer, shared by all instances
+        unsigned int vboId;                 // Shape instances buffer (or expanded vertex buffer)
+        unsigned int shaderId;              // SDF shapes shader program id
+        int locCorner;                      // Shader attribute location: quad corner
+        int locRect;                        // Shader attribute location: shape center and half size
+        int locParams;                      // Shader attribute location: radius, thickness and depth
+        int locColor;                       // Shader attribute location: shape color
+        int locMvp;                         // Shader uniform location: model-view-projection matrix
+        int locViewport;                    // Shader uniform location: viewport size
+    } ShapeBatch;       // SDF shapes batch
+    struct {
+        rlShaderCacheLoadCallback load;     // Load cached program data callback
+        rlShaderCacheSaveCallback save;     // Save program data callback
+        rlShaderCacheTimeCallback getTime;  // Time callback (optional)
+        int hits;                           // Programs loaded from cache
+        int misses;                         // Programs compiled from source (not in cache or rejected)
+        float timeSaved;                    // Compile time saved by cache hits (milliseconds)
+    } ShaderCache;      // Shader program binary cache
+    struct {
+        unsigned int programId;             // Shader program in use
+        unsigned int vertexArrayId;         // Vertex array bound (VAO)
+        unsigned int arrayBufferId;         // Vertex buffer bound to GL_ARRAY_BUFFER
+        int activeTextureUnit;              // Active texture unit (index from GL_TEXTURE0), -1 if unknown
+        unsigned int textureIds[RL_STATE_CACHE_TEXTURE_UNITS];  // Texture bound to GL_TEXTURE_2D per texture unit
+        unsigned int uniformShaderId;       // Shader program with batch uniforms cached (mvp, colDiffuse, texture0)
+        float uniformMvp[16];               // Batch mvp uniform value cached
+    } StateCache;       // GL state cache (shadow of GL bindings)
+    struct {
+        Matrix transform;                   // Transform matrix used to compute culling matrix
+        Matrix modelview;                   // Modelview matrix used to compute culling matrix
+        Matrix projection;                  // Projection matrix used to compute culling matrix
+        bool transformRequired;             // Transform matrix was considered
+        bool valid;                         // Culling matrix computed
+        Matrix matrix;                      // Culling matrix: transform, modelview and projection combined
+    } Cull;             // 2d culling state (cached matrix)
+    struct {
+        rlRenderStats current;              // Render stats of current frame
+        rlRenderStats last;                 // Render stats of last frame
+        rlRenderStats history[RL_RENDER_STATS_HISTORY]; // Render stats of last frames (ring buffer)
+        int historyIndex;                   // Next history entry to write
+        int historyCount;                   // History entries available
+    } Stats;            // Render stats
+    struct {
+        unsigned int pboId[RL_READBACK_BUFFERS];    // Pixel pack buffers ring
+        void *fence[RL_READBACK_BUFFERS];   // Fence sync objects (GLsync), signaled when read is completed
+        int width[RL_READBACK_BUFFERS];     // Queued read width
+        int height[RL_READBACK_BUFFERS];    // Queued read height
+        int size[RL_READBACK_BUFFERS];      // Pixel buffer storage size in bytes
+        int head;                           // Oldest queued read
+        int count;                          // Queued reads
+    } Readback;         // Asynchronous screen readback
 } rlglData;
 
+// Shader program binary cache entry header, followed by program binary
+typedef struct rlShaderCacheHeader {
+    unsigned int magic;                     // Cache entry identifier: RL_SHADER_CACHE_MAGIC
+    unsigned int format;                    // Program binary format (driver specific)
+    float compileTime;                      // Time to compile and link from source (milliseconds)
+    int size;                               // Program binary size in bytes
+} rlShaderCacheHeader;
+
+#define RL_SHADER_CACHE_MAGIC   0x43534c52  // "RLSC"
+#define RL_STATE_UNKNOWN        0xffffffff  // GL state cache: binding not known, next bind always issued
+
 typedef void *(*rlglLoadProc)(const char *name);   // OpenGL extension functions loader signature (same as GLADloadproc)
 
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
@@ -1044,6 +1201,9 @@ typedef void *(*rlglLoadProc)(const char *name);   // OpenGL extension functions
 //----------------------------------------------------------------------------------
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 static rlglData RLGL = { 0 };
+
+// SDF shapes quad corners (two triangles), CCW in screen space (y-down)
+static const float rlShapeQuadCorners[12] = { -1.0f, -1.0f, -1.0f, 1.0f, 1.0f, 1.0f, -1.0f, -1.0f, 1.0f, 1.0f, 1.0f, -1.0f };
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
 #if defined(GRAPHICS_API_OPENGL_ES2) && !defined(GRAPHICS_API_OPENGL_ES3)
@@ -1056,20 +1216,64 @@ static PFNGLDELETEVERTEXARRAYSOESPROC glDeleteVertexArrays = NULL;
 static PFNGLDRAWARRAYSINSTANCEDEXTPROC glDrawArraysInstanced = NULL;
 static PFNGLDRAWELEMENTSINSTANCEDEXTPROC glDrawElementsInstanced = NULL;
 static PFNGLVERTEXATTRIBDIVISOREXTPROC glVertexAttribDivisor = NULL;
+
+// NOTE: Program binary functionality is exposed through extension (OES)
+static PFNGLGETPROGRAMBINARYOESPROC glGetProgramBinary = NULL;
+static PFNGLPROGRAMBINARYOESPROC glProgramBinary = NULL;
+
+// NOTE: Pixel pack buffers and fence sync objects are OpenGL ES 3.0 core,
+// loaded only if the context provided is OpenGL ES 3.0 or higher
+static PFNGLFENCESYNCAPPLEPROC glFenceSync = NULL;
+static PFNGLCLIENTWAITSYNCAPPLEPROC glClientWaitSync = NULL;
+static PFNGLDELETESYNCAPPLEPROC glDeleteSync = NULL;
+static PFNGLMAPBUFFERRANGEEXTPROC glMapBufferRange = NULL;
+static PFNGLUNMAPBUFFEROESPROC glUnmapBuffer = NULL;
+
+#define GL_PIXEL_PACK_BUFFER                    0x88EB
+#define GL_STREAM_READ                          0x88E1
+#define GL_MAP_READ_BIT                         0x0001
+#define GL_SYNC_GPU_COMMANDS_COMPLETE           0x9117
+#define GL_SYNC_FLUSH_COMMANDS_BIT              0x0001
+#define GL_ALREADY_SIGNALED                     0x911A
+#define GL_TIMEOUT_EXPIRED                      0x911B
+#define GL_CONDITION_SATISFIED                  0x911C
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_ES2) && !defined(GL_PROGRAM_BINARY_LENGTH)
+    #define GL_PROGRAM_BINARY_LENGTH            GL_PROGRAM_BINARY_LENGTH_OES
+    #define GL_NUM_PROGRAM_BINARY_FORMATS       GL_NUM_PROGRAM_BINARY_FORMATS_OES
 #endif
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
+static bool rlStateBindTexture(unsigned int id);          // Bind texture to GL_TEXTURE_2D of active unit, skipped if already bound (returns true if issued)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static void rlStateUseProgram(unsigned int id);           // Use shader program, skipped if already in use
+static void rlStateBindVertexArray(unsigned int id);      // Bind vertex array (VAO), skipped if already bound
+static void rlStateBindArrayBuffer(unsigned int id);      // Bind vertex buffer to GL_ARRAY_BUFFER, skipped if already bound
+static void rlStateActiveTexture(unsigned int unit);      // Set active texture unit (GL_TEXTUREn), skipped if already active
+static void rlStateForgetTexture(unsigned int id);        // Remove deleted texture from state cache
+static void rlStateForgetBuffer(unsigned int id);         // Remove deleted buffer from state cache
+static void rlStateForgetVertexArray(unsigned int id);    // Remove deleted vertex array (VAO) from state cache
+static void rlStateForgetProgram(unsigned int id);        // Remove deleted program from state cache, unused first if in use
+static void rlTransformVertex2f(const float *positions, float *vertices, int count, float depth);  // Transform 2d positions into batch vertex (xyz), NEON/SSE when available
+static bool rlGetCullBounds(float x, float y, float width, float height, float *boundsMin, float *boundsMax, float *areaMin, float *areaMax);  // Get 2d rectangle and visible area bounds in NDC
 static void rlLoadShaderDefault(void);      // Load default shader
 static void rlUnloadShaderDefault(void);    // Unload default shader
+static void rlLoadShapeBatch(void);         // Load SDF shapes batch (shader and buffers)
+static void rlUnloadShapeBatch(void);       // Unload SDF shapes batch
+static unsigned int rlGetShaderDefaultObject(int type);     // Get default vertex/fragment shader, compiled on demand
+static unsigned long long rlGetShaderCacheKey(const char *vsCode, const char *fsCode);   // Get program cache key (code and driver hash)
+static unsigned int rlLoadShaderProgramCache(unsigned long long key);   // Load program from binary cache
+static void rlSaveShaderProgramCache(unsigned int id, unsigned long long key, float compileTime);   // Save program binary to cache
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 static const char *rlGetCompressedFormatName(int format); // Get compressed format official GL identifier name
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
 static int rlGetPixelDataSize(int width, int height, int format);   // Get pixel data size in bytes (image or texture)
+static void rlCopyPixelsOpaque(unsigned char *dst, const unsigned char *src, int count);  // Copy RGBA pixels setting alpha to 255, NEON/SSE when available
 
 // Auxiliar matrix math functions
 static Matrix rlMatrixIdentity(void);                       // Get identity matrix
@@ -1314,6 +1518,13 @@ void rlOrtho(double left, double right, double bottom, double top, double znear,
 void rlViewport(int x, int y, int width, int height)
 {
     glViewport(x, y, width, height);
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.viewportX = x;
+    RLGL.State.viewportY = y;
+    RLGL.State.viewportWidth = width;
+    RLGL.State.viewportHeight = height;
+#endif
 }
 
 //----------------------------------------------------------------------------------
@@ -1342,11 +1553,23 @@ void rlNormal3f(float x, float y, float z) { glNormal3f(x, y, z); }
 void rlColor4ub(unsigned char r, unsigned char g, unsigned char b, unsigned char a) { glColor4ub(r, g, b, a); }
 void rlColor3f(float x, float y, float z) { glColor3f(x, y, z); }
 void rlColor4f(float x, float y, float z, float w) { glColor4f(x, y, z, w); }
+void rlVertexArray2f(const float *positions, const float *texcoords, const unsigned char *colors, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        if (texcoords != NULL) glTexCoord2f(texcoords[2*i], texcoords[2*i + 1]);
+        if (colors != NULL) glColor4ub(colors[4*i], colors[4*i + 1], colors[4*i + 2], colors[4*i + 3]);
+        glVertex2f(positions[2*i], positions[2*i + 1]);
+    }
+}
 #endif
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 // Initialize drawing mode (how to organize vertex)
 void rlBegin(int mode)
 {
+    // Pending SDF shapes must be drawn before new vertex data to keep drawing order
+    if (RLGL.ShapeBatch.instanceCount > 0) rlDrawShapeBatch();
+
     // Draw mode can be RL_LINES, RL_TRIANGLES and RL_QUADS
     // NOTE: In all three cases, vertex are accumulated over default internal vertex buffer
     if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode != mode)
@@ -1369,7 +1592,11 @@ void rlBegin(int mode)
             }
         }
 
-        if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
+        if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS)
+        {
+            RLGL.Stats.current.batchOverflows++;
+            rlDrawRenderBatch(RLGL.currentBatch);
+        }
 
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = mode;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
@@ -1460,6 +1687,74 @@ void rlVertex2i(int x, int y)
     rlVertex3f((float)x, (float)y, RLGL.currentBatch->currentDepth);
 }
 
+// Define multiple vertex (position, texcoord and color arrays)
+// NOTE: Vertex are appended to batch with one capacity check, count must be a multiple of current
+// primitive vertex count (2 for lines, 3 for triangles, 4 for quads), primitives are never split
+// on batch overflow. If texcoords/colors are NULL, current texcoord/color are used for all vertex
+void rlVertexArray2f(const float *positions, const float *texcoords, const unsigned char *colors, int count)
+{
+    // Biggest chunk fitting an empty batch, aligned to lines, triangles and quads
+    int maxChunk = (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4 - 4)/12*12;
+
+    // Batches smaller than 4 quads can not hold an aligned chunk, vertex are defined one by one
+    // NOTE: Current texcoord and color are restored, as they are not changed by chunks
+    if (maxChunk < 12)
+    {
+        float texcoordx = RLGL.State.texcoordx;
+        float texcoordy = RLGL.State.texcoordy;
+        unsigned char color[4] = { RLGL.State.colorr, RLGL.State.colorg, RLGL.State.colorb, RLGL.State.colora };
+
+        for (int i = 0; i < count; i++)
+        {
+            if (texcoords != NULL) rlTexCoord2f(texcoords[2*i], texcoords[2*i + 1]);
+            if (colors != NULL) rlColor4ub(colors[4*i], colors[4*i + 1], colors[4*i + 2], colors[4*i + 3]);
+            rlVertex2f(positions[2*i], positions[2*i + 1]);
+        }
+
+        rlTexCoord2f(texcoordx, texcoordy);
+        rlColor4ub(color[0], color[1], color[2], color[3]);
+        return;
+    }
+
+    while (count > 0)
+    {
+        int chunk = (count < maxChunk)? count : maxChunk;
+
+        // NOTE: Batch could be flushed here, changing current vertex buffer (multi-buffering)
+        rlCheckRenderBatchLimit(chunk);
+
+        rlVertexBuffer *buffer = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer];
+        int offset = RLGL.State.vertexCounter;
+
+        rlTransformVertex2f(positions, buffer->vertices + 3*offset, chunk, RLGL.currentBatch->currentDepth);
+
+        if (texcoords != NULL) memcpy(buffer->texcoords + 2*offset, texcoords, 2*chunk*sizeof(float));
+        else
+        {
+            for (int i = 0; i < chunk; i++)
+            {
+                buffer->texcoords[2*(offset + i)] = RLGL.State.texcoordx;
+                buffer->texcoords[2*(offset + i) + 1] = RLGL.State.texcoordy;
+            }
+        }
+
+        if (colors != NULL) memcpy(buffer->colors + 4*offset, colors, 4*chunk*sizeof(unsigned char));
+        else
+        {
+            unsigned char color[4] = { RLGL.State.colorr, RLGL.State.colorg, RLGL.State.colorb, RLGL.State.colora };
+            for (int i = 0; i < chunk; i++) memcpy(buffer->colors + 4*(offset + i), color, 4);
+        }
+
+        RLGL.State.vertexCounter += chunk;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount += chunk;
+
+        positions += 2*chunk;
+        if (texcoords != NULL) texcoords += 2*chunk;
+        if (colors != NULL) colors += 4*chunk;
+        count -= chunk;
+    }
+}
+
 // Define one vertex (texture coordinate)
 // NOTE: Texture coordinates are limited to QUADS only
 void rlTexCoord2f(float x, float y)
@@ -1546,7 +1841,11 @@ void rlSetTexture(unsigned int id)
                 }
             }
 
-            if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
+            if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS)
+            {
+                RLGL.Stats.current.batchOverflows++;
+                rlDrawRenderBatch(RLGL.currentBatch);
+            }
 
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = id;
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
@@ -1559,7 +1858,7 @@ void rlSetTexture(unsigned int id)
 void rlActiveTextureSlot(int slot)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glActiveTexture(GL_TEXTURE0 + slot);
+    rlStateActiveTexture(GL_TEXTURE0 + slot);
 #endif
 }
 
@@ -1569,7 +1868,11 @@ void rlEnableTexture(unsigned int id)
 #if defined(GRAPHICS_API_OPENGL_11)
     glEnable(GL_TEXTURE_2D);
 #endif
-    glBindTexture(GL_TEXTURE_2D, id);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (rlStateBindTexture(id)) RLGL.Stats.current.textureSwitches++;
+#else
+    rlStateBindTexture(id);
+#endif
 }
 
 // Disable texture
@@ -1578,7 +1881,7 @@ void rlDisableTexture(void)
 #if defined(GRAPHICS_API_OPENGL_11)
     glDisable(GL_TEXTURE_2D);
 #endif
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlStateBindTexture(0);
 }
 
 // Enable texture cubemap
@@ -1600,7 +1903,7 @@ void rlDisableTextureCubemap(void)
 // Set texture parameters (wrap mode/filter mode)
 void rlTextureParameters(unsigned int id, int param, int value)
 {
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlStateBindTexture(id);
 
 #if !defined(GRAPHICS_API_OPENGL_11)
     // Reset anisotropy filter, in case it was set
@@ -1642,7 +1945,7 @@ void rlTextureParameters(unsigned int id, int param, int value)
         default: break;
     }
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlStateBindTexture(0);
 }
 
 // Set cubemap parameters (wrap mode/filter mode)
@@ -1693,7 +1996,7 @@ void rlCubemapParameters(unsigned int id, int param, int value)
 void rlEnableShader(unsigned int id)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
-    glUseProgram(id);
+    rlStateUseProgram(id);
 #endif
 }
 
@@ -1701,7 +2004,7 @@ void rlEnableShader(unsigned int id)
 void rlDisableShader(void)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
-    glUseProgram(0);
+    rlStateUseProgram(0);
 #endif
 }
 
@@ -1817,13 +2120,34 @@ void rlSetCullFace(int mode)
 }
 
 // Enable scissor test
-void rlEnableScissorTest(void) { glEnable(GL_SCISSOR_TEST); }
+void rlEnableScissorTest(void)
+{
+    glEnable(GL_SCISSOR_TEST);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.scissorEnabled = true;
+#endif
+}
 
 // Disable scissor test
-void rlDisableScissorTest(void) { glDisable(GL_SCISSOR_TEST); }
+void rlDisableScissorTest(void)
+{
+    glDisable(GL_SCISSOR_TEST);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.scissorEnabled = false;
+#endif
+}
 
 // Scissor test
-void rlScissor(int x, int y, int width, int height) { glScissor(x, y, width, height); }
+void rlScissor(int x, int y, int width, int height)
+{
+    glScissor(x, y, width, height);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.scissor[0] = x;
+    RLGL.State.scissor[1] = y;
+    RLGL.State.scissor[2] = width;
+    RLGL.State.scissor[3] = height;
+#endif
+}
 
 // Enable wire mode
 void rlEnableWireMode(void)
@@ -2108,6 +2432,10 @@ void rlglInit(int width, int height)
 #endif
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Init GL state cache, context could be a new one (i.e. Android context recreation)
+    rlInvalidateStateCache();
+    rlStateActiveTexture(GL_TEXTURE0);
+
     // Init default white texture
     unsigned char pixels[4] = { 255, 255, 255, 255 };   // 1 pixel RGBA (4 bytes)
     RLGL.State.defaultTextureId = rlLoadTexture(pixels, 1, 1, RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
@@ -2125,6 +2453,10 @@ void rlglInit(int width, int height)
     RLGL.defaultBatch = rlLoadRenderBatch(RL_DEFAULT_BATCH_BUFFERS, RL_DEFAULT_BATCH_BUFFER_ELEMENTS);
     RLGL.currentBatch = &RLGL.defaultBatch;
 
+    // Init SDF shapes batch
+    // NOTE: Requires extensions already loaded (instancing support check)
+    rlLoadShapeBatch();
+
     // Init stack matrices (emulating OpenGL 1.1)
     for (int i = 0; i < RL_MAX_MATRIX_STACK_SIZE; i++) RLGL.State.stack[i] = rlMatrixIdentity();
 
@@ -2166,6 +2498,8 @@ void rlglInit(int width, int height)
     // Store screen size into global variables
     RLGL.State.framebufferWidth = width;
     RLGL.State.framebufferHeight = height;
+    RLGL.State.viewportWidth = width;
+    RLGL.State.viewportHeight = height;
 
     TRACELOG(RL_LOG_INFO, "RLGL: Default OpenGL state initialized successfully");
     //----------------------------------------------------------
@@ -2182,9 +2516,12 @@ void rlglClose(void)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     rlUnloadRenderBatch(RLGL.defaultBatch);
+    rlUnloadShapeBatch();             // Unload SDF shapes batch
 
     rlUnloadShaderDefault();          // Unload default shader
+    rlUnloadScreenPixelsAsync();      // Unload screen readback buffers
 
+    rlStateForgetTexture(RLGL.State.defaultTextureId);
     glDeleteTextures(1, &RLGL.State.defaultTextureId); // Unload default texture
     TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Default texture unloaded successfully", RLGL.State.defaultTextureId);
 #endif
@@ -2235,6 +2572,7 @@ void rlLoadExtensions(void *loader)
     RLGL.ExtSupported.maxDepthBits = 32;
     RLGL.ExtSupported.texAnisoFilter = true;
     RLGL.ExtSupported.texMirrorClamp = true;
+    RLGL.ExtSupported.pbo = true;
 #endif
 
     // Optional OpenGL 3.3 extensions
@@ -2261,6 +2599,8 @@ void rlLoadExtensions(void *loader)
     RLGL.ExtSupported.maxDepthBits = 24;
     RLGL.ExtSupported.texAnisoFilter = true;
     RLGL.ExtSupported.texMirrorClamp = true;
+    RLGL.ExtSupported.programBinary = true;
+    RLGL.ExtSupported.pbo = true;
     // TODO: Check for additional OpenGL ES 3.0 supported extensions:
     //RLGL.ExtSupported.texCompDXT = true;
     //RLGL.ExtSupported.texCompETC1 = true;
@@ -2307,6 +2647,9 @@ void rlLoadExtensions(void *loader)
     for (int i = 0; i < numExt; i++) TRACELOG(RL_LOG_INFO, "    %s", extList[i]);
 #endif
 
+    bool extDrawInstanced = false;          // GL_EXT_draw_instanced found
+    bool extInstancedArrays = false;        // GL_EXT_instanced_arrays found
+
     // Check required extensions
     for (int i = 0; i < numExt; i++)
     {
@@ -2335,8 +2678,11 @@ void rlLoadExtensions(void *loader)
         }
         else
         {
-            if ((strcmp(extList[i], (const char *)"GL_EXT_draw_instanced") == 0) &&     // Standard EXT
-                (strcmp(extList[i], (const char *)"GL_EXT_instanced_arrays") == 0))
+            // NOTE: Standard EXT instancing requires both extensions, listed as separate entries
+            if (strcmp(extList[i], (const char *)"GL_EXT_draw_instanced") == 0) extDrawInstanced = true;
+            if (strcmp(extList[i], (const char *)"GL_EXT_instanced_arrays") == 0) extInstancedArrays = true;
+
+            if (extDrawInstanced && extInstancedArrays && !RLGL.ExtSupported.instancing)     // Standard EXT
             {
                 glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDEXTPROC)((rlglLoadProc)loader)("glDrawArraysInstancedEXT");
                 glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDEXTPROC)((rlglLoadProc)loader)("glDrawElementsInstancedEXT");
@@ -2385,6 +2731,38 @@ void rlLoadExtensions(void *loader)
 
         // Check clamp mirror wrap mode support
         if (strcmp(extList[i], (const char *)"GL_EXT_texture_mirror_clamp") == 0) RLGL.ExtSupported.texMirrorClamp = true;
+
+        // Check program binary support (used by shader program cache)
+        if (strcmp(extList[i], (const char *)"GL_OES_get_program_binary") == 0)
+        {
+            glGetProgramBinary = (PFNGLGETPROGRAMBINARYOESPROC)((rlglLoadProc)loader)("glGetProgramBinaryOES");
+            glProgramBinary = (PFNGLPROGRAMBINARYOESPROC)((rlglLoadProc)loader)("glProgramBinaryOES");
+
+            if ((glGetProgramBinary != NULL) && (glProgramBinary != NULL)) RLGL.ExtSupported.programBinary = true;
+        }
+    }
+
+    // Check pixel pack buffers and fence sync objects support
+    // NOTE: They are OpenGL ES 3.0 core, most drivers provide an OpenGL ES 3.x context even if 2.0 was requested
+    const char *version = (const char *)glGetString(GL_VERSION);
+    if ((version != NULL) && (strncmp(version, "OpenGL ES ", 10) == 0) && (version[10] >= '3'))
+    {
+        glFenceSync = (PFNGLFENCESYNCAPPLEPROC)((rlglLoadProc)loader)("glFenceSync");
+        glClientWaitSync = (PFNGLCLIENTWAITSYNCAPPLEPROC)((rlglLoadProc)loader)("glClientWaitSync");
+        glDeleteSync = (PFNGLDELETESYNCAPPLEPROC)((rlglLoadProc)loader)("glDeleteSync");
+        glMapBufferRange = (PFNGLMAPBUFFERRANGEEXTPROC)((rlglLoadProc)loader)("glMapBufferRange");
+        glUnmapBuffer = (PFNGLUNMAPBUFFEROESPROC)((rlglLoadProc)loader)("glUnmapBuffer");
+
+        if ((glFenceSync != NULL) && (glClientWaitSync != NULL) && (glDeleteSync != NULL) &&
+            (glMapBufferRange != NULL) && (glUnmapBuffer != NULL)) RLGL.ExtSupported.pbo = true;
+    }
+
+    // NOTE: Some drivers expose the extension with no binary formats available
+    if (RLGL.ExtSupported.programBinary)
+    {
+        GLint formatCount = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+        if (formatCount <= 0) RLGL.ExtSupported.programBinary = false;
     }
 
     // Free extensions pointers
@@ -2454,6 +2832,8 @@ void rlLoadExtensions(void *loader)
     if (RLGL.ExtSupported.texCompASTC) TRACELOG(RL_LOG_INFO, "GL: ASTC compressed textures supported");
     if (RLGL.ExtSupported.computeShader) TRACELOG(RL_LOG_INFO, "GL: Compute shaders supported");
     if (RLGL.ExtSupported.ssbo) TRACELOG(RL_LOG_INFO, "GL: Shader storage buffer objects supported");
+    if (RLGL.ExtSupported.programBinary) TRACELOG(RL_LOG_INFO, "GL: Program binaries supported, shader cache available");
+    if (RLGL.ExtSupported.pbo) TRACELOG(RL_LOG_INFO, "GL: Pixel pack buffers supported, asynchronous screen readback available");
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
 
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
@@ -2482,6 +2862,76 @@ int rlGetVersion(void)
     return glVersion;
 }
 
+// Invalidate GL state cache
+// NOTE: All bindings become unknown, next bind of each one is always issued
+void rlInvalidateStateCache(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.StateCache.programId = RL_STATE_UNKNOWN;
+    RLGL.StateCache.vertexArrayId = RL_STATE_UNKNOWN;
+    RLGL.StateCache.arrayBufferId = RL_STATE_UNKNOWN;
+    RLGL.StateCache.activeTextureUnit = -1;
+    for (int i = 0; i < RL_STATE_CACHE_TEXTURE_UNITS; i++) RLGL.StateCache.textureIds[i] = RL_STATE_UNKNOWN;
+    RLGL.StateCache.uniformShaderId = RL_STATE_UNKNOWN;
+#endif
+}
+
+// Get GL state calls issued and skipped (redundant) by state cache on last frame
+void rlGetStateCacheStats(int *callsIssued, int *callsSkipped)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (callsIssued != NULL) *callsIssued = RLGL.Stats.last.stateCallsIssued;
+    if (callsSkipped != NULL) *callsSkipped = RLGL.Stats.last.stateCallsSkipped;
+#else
+    if (callsIssued != NULL) *callsIssued = 0;
+    if (callsSkipped != NULL) *callsSkipped = 0;
+#endif
+}
+
+// End frame stats, current frame counters become last frame ones
+void rlEndFrameStats(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.Stats.last = RLGL.Stats.current;
+
+    RLGL.Stats.history[RLGL.Stats.historyIndex] = RLGL.Stats.current;
+    RLGL.Stats.historyIndex = (RLGL.Stats.historyIndex + 1)%RL_RENDER_STATS_HISTORY;
+    if (RLGL.Stats.historyCount < RL_RENDER_STATS_HISTORY) RLGL.Stats.historyCount++;
+
+    RLGL.Stats.current = (rlRenderStats){ 0 };
+#endif
+}
+
+// Get render stats of last frame
+rlRenderStats rlGetRenderStats(void)
+{
+    rlRenderStats stats = { 0 };
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    stats = RLGL.Stats.last;
+#endif
+
+    return stats;
+}
+
+// Get render stats of last frames (oldest first), returns number of frames copied
+int rlGetRenderStatsHistory(rlRenderStats *stats, int count)
+{
+    int copied = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((stats == NULL) || (count <= 0)) return 0;
+
+    copied = (count < RLGL.Stats.historyCount)? count : RLGL.Stats.historyCount;
+    int first = RLGL.Stats.historyIndex - copied;
+    if (first < 0) first += RL_RENDER_STATS_HISTORY;
+
+    for (int i = 0; i < copied; i++) stats[i] = RLGL.Stats.history[(first + i)%RL_RENDER_STATS_HISTORY];
+#endif
+
+    return copied;
+}
+
 // Set current framebuffer width
 void rlSetFramebufferWidth(int width)
 {
@@ -2539,6 +2989,16 @@ unsigned int rlGetShaderIdDefault(void)
     return id;
 }
 
+// Get current shader id
+unsigned int rlGetShaderIdCurrent(void)
+{
+    unsigned int id = 0;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    id = RLGL.State.currentShaderId;
+#endif
+    return id;
+}
+
 // Get default shader locs
 int *rlGetShaderLocsDefault(void)
 {
@@ -2608,27 +3068,27 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         {
             // Initialize Quads VAO
             glGenVertexArrays(1, &batch.vertexBuffer[i].vaoId);
-            glBindVertexArray(batch.vertexBuffer[i].vaoId);
+            rlStateBindVertexArray(batch.vertexBuffer[i].vaoId);
         }
 
         // Quads - Vertex buffers binding and attributes enable
         // Vertex position buffer (shader-location = 0)
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
+        rlStateBindArrayBuffer(batch.vertexBuffer[i].vboId[0]);
         glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].vertices, GL_DYNAMIC_DRAW);
         glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
         glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
 
         // Vertex texcoord buffer (shader-location = 1)
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[1]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[1]);
+        rlStateBindArrayBuffer(batch.vertexBuffer[i].vboId[1]);
         glBufferData(GL_ARRAY_BUFFER, bufferElements*2*4*sizeof(float), batch.vertexBuffer[i].texcoords, GL_DYNAMIC_DRAW);
         glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
         glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
 
         // Vertex color buffer (shader-location = 3)
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[2]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[2]);
+        rlStateBindArrayBuffer(batch.vertexBuffer[i].vboId[2]);
         glBufferData(GL_ARRAY_BUFFER, bufferElements*4*4*sizeof(unsigned char), batch.vertexBuffer[i].colors, GL_DYNAMIC_DRAW);
         glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
         glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
@@ -2647,7 +3107,7 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
     TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in VRAM (GPU)");
 
     // Unbind the current VAO
-    if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+    if (RLGL.ExtSupported.vao) rlStateBindVertexArray(0);
     //--------------------------------------------------------------------------------------------
 
     // Init draw calls tracking system
@@ -2680,7 +3140,7 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     // Unbind everything
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    rlStateBindArrayBuffer(0);
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 
     // Unload all vertex buffers data
@@ -2689,22 +3149,27 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
         // Unbind VAO attribs data
         if (RLGL.ExtSupported.vao)
         {
-            glBindVertexArray(batch.vertexBuffer[i].vaoId);
+            rlStateBindVertexArray(batch.vertexBuffer[i].vaoId);
             glDisableVertexAttribArray(0);
             glDisableVertexAttribArray(1);
             glDisableVertexAttribArray(2);
             glDisableVertexAttribArray(3);
-            glBindVertexArray(0);
+            rlStateBindVertexArray(0);
         }
 
         // Delete VBOs from GPU (VRAM)
+        for (int k = 0; k < 3; k++) rlStateForgetBuffer(batch.vertexBuffer[i].vboId[k]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[0]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[1]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[2]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[3]);
 
         // Delete VAOs from GPU (VRAM)
-        if (RLGL.ExtSupported.vao) glDeleteVertexArrays(1, &batch.vertexBuffer[i].vaoId);
+        if (RLGL.ExtSupported.vao)
+        {
+            rlStateForgetVertexArray(batch.vertexBuffer[i].vaoId);
+            glDeleteVertexArrays(1, &batch.vertexBuffer[i].vaoId);
+        }
 
         // Free vertex arrays memory from CPU (RAM)
         RL_FREE(batch.vertexBuffer[i].vertices);
@@ -2724,27 +3189,33 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
 void rlDrawRenderBatch(rlRenderBatch *batch)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Draw pending SDF shapes, they always precede batch vertex data (see rlPushShapeInstance())
+    rlDrawShapeBatch();
+
     // Update batch vertex buffers
     //------------------------------------------------------------------------------------------------------------
     // NOTE: If there is not vertex data, buffers doesn't need to be updated (vertexCount > 0)
     // TODO: If no data changed on the CPU arrays --> No need to re-update GPU arrays (use a change detector flag?)
     if (RLGL.State.vertexCounter > 0)
     {
-        // Activate elements VAO
-        if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
+        RLGL.Stats.current.flushes++;
+        RLGL.Stats.current.vertices += RLGL.State.vertexCounter;
+        RLGL.Stats.current.uploadedBytes += RLGL.State.vertexCounter*(3*sizeof(float) + 2*sizeof(float) + 4*sizeof(unsigned char));
+
+        // NOTE: GL_ARRAY_BUFFER binding is not part of VAO state, no need to bind elements VAO to update buffers
 
         // Vertex positions buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+        rlStateBindArrayBuffer(batch->vertexBuffer[batch->currentBuffer].vboId[0]);
         glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].vertices);
         //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].vertices, GL_DYNAMIC_DRAW);  // Update all buffer
 
         // Texture coordinates buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
+        rlStateBindArrayBuffer(batch->vertexBuffer[batch->currentBuffer].vboId[1]);
         glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*2*sizeof(float), batch->vertexBuffer[batch->currentBuffer].texcoords);
         //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].texcoords, GL_DYNAMIC_DRAW); // Update all buffer
 
         // Colors buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
+        rlStateBindArrayBuffer(batch->vertexBuffer[batch->currentBuffer].vboId[2]);
         glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*4*sizeof(unsigned char), batch->vertexBuffer[batch->currentBuffer].colors);
         //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].colors, GL_DYNAMIC_DRAW);    // Update all buffer
 
@@ -2762,9 +3233,6 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
             // Update vertex data
         // }
         // glUnmapBuffer(GL_ARRAY_BUFFER);
-
-        // Unbind the current VAO
-        if (RLGL.ExtSupported.vao) glBindVertexArray(0);
     }
     //------------------------------------------------------------------------------------------------------------
 
@@ -2793,7 +3261,7 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         if (RLGL.State.vertexCounter > 0)
         {
             // Set current shader and upload current MVP matrix
-            glUseProgram(RLGL.State.currentShaderId);
+            rlStateUseProgram(RLGL.State.currentShaderId);
 
             // Create modelview-projection matrix and upload to shader
             Matrix matMVP = rlMatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
@@ -2803,23 +3271,33 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
                 matMVP.m8, matMVP.m9, matMVP.m10, matMVP.m11,
                 matMVP.m12, matMVP.m13, matMVP.m14, matMVP.m15
             };
-            glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MVP], 1, false, matMVPfloat);
 
-            if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
+            // NOTE: Batch uniforms are only uploaded if shader or MVP changed since last upload
+            bool shaderChanged = (RLGL.StateCache.uniformShaderId != RLGL.State.currentShaderId);
+
+            if (shaderChanged || (memcmp(RLGL.StateCache.uniformMvp, matMVPfloat, sizeof(matMVPfloat)) != 0))
+            {
+                glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MVP], 1, false, matMVPfloat);
+                memcpy(RLGL.StateCache.uniformMvp, matMVPfloat, sizeof(matMVPfloat));
+                RLGL.Stats.current.stateCallsIssued++;
+            }
+            else RLGL.Stats.current.stateCallsSkipped++;
+
+            if (RLGL.ExtSupported.vao) rlStateBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
             else
             {
                 // Bind vertex attrib: position (shader-location = 0)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+                rlStateBindArrayBuffer(batch->vertexBuffer[batch->currentBuffer].vboId[0]);
                 glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
                 glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
 
                 // Bind vertex attrib: texcoord (shader-location = 1)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
+                rlStateBindArrayBuffer(batch->vertexBuffer[batch->currentBuffer].vboId[1]);
                 glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
                 glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
 
                 // Bind vertex attrib: color (shader-location = 3)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
+                rlStateBindArrayBuffer(batch->vertexBuffer[batch->currentBuffer].vboId[2]);
                 glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
                 glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
 
@@ -2827,8 +3305,14 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
             }
 
             // Setup some default shader values
-            glUniform4f(RLGL.State.currentShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE], 1.0f, 1.0f, 1.0f, 1.0f);
-            glUniform1i(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE], 0);  // Active default sampler2D: texture0
+            if (shaderChanged)
+            {
+                glUniform4f(RLGL.State.currentShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE], 1.0f, 1.0f, 1.0f, 1.0f);
+                glUniform1i(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE], 0);  // Active default sampler2D: texture0
+                RLGL.StateCache.uniformShaderId = RLGL.State.currentShaderId;
+                RLGL.Stats.current.stateCallsIssued += 2;
+            }
+            else RLGL.Stats.current.stateCallsSkipped += 2;
 
             // Activate additional sampler textures
             // Those additional textures will be common for all draw calls of the batch
@@ -2836,19 +3320,19 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
             {
                 if (RLGL.State.activeTextureId[i] > 0)
                 {
-                    glActiveTexture(GL_TEXTURE0 + 1 + i);
-                    glBindTexture(GL_TEXTURE_2D, RLGL.State.activeTextureId[i]);
+                    rlStateActiveTexture(GL_TEXTURE0 + 1 + i);
+                    if (rlStateBindTexture(RLGL.State.activeTextureId[i])) RLGL.Stats.current.textureSwitches++;
                 }
             }
 
             // Activate default sampler2D texture0 (one texture is always active for default batch shader)
             // NOTE: Batch system accumulates calls by texture0 changes, additional textures are enabled for all the draw calls
-            glActiveTexture(GL_TEXTURE0);
+            rlStateActiveTexture(GL_TEXTURE0);
 
             for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
             {
                 // Bind current draw call texture, activated as GL_TEXTURE0 and Bound to sampler2D texture0 by default
-                glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
+                if (rlStateBindTexture(batch->draws[i].textureId)) RLGL.Stats.current.textureSwitches++;
 
                 if ((batch->draws[i].mode == RL_LINES) || (batch->draws[i].mode == RL_TRIANGLES)) glDrawArrays(batch->draws[i].mode, vertexOffset, batch->draws[i].vertexCount);
                 else
@@ -2867,18 +3351,18 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
                 vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
             }
 
+            RLGL.Stats.current.drawCalls += batch->drawCounter;
+
             if (!RLGL.ExtSupported.vao)
             {
-                glBindBuffer(GL_ARRAY_BUFFER, 0);
+                rlStateBindArrayBuffer(0);
                 glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
             }
 
-            glBindTexture(GL_TEXTURE_2D, 0);    // Unbind textures
+            // NOTE: Textures and shader program are kept bound, state cache skips rebinding them on next batch
         }
 
-        if (RLGL.ExtSupported.vao) glBindVertexArray(0); // Unbind VAO
-
-        glUseProgram(0);    // Unbind shader program
+        if (RLGL.ExtSupported.vao) rlStateBindVertexArray(0); // Unbind VAO
     }
 
     // Restore viewport to default measures
@@ -2948,6 +3432,7 @@ bool rlCheckRenderBatchLimit(int vCount)
         (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4))
     {
         overflow = true;
+        RLGL.Stats.current.batchOverflows++;
 
         // Store current primitive drawing mode and texture id
         int currentMode = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode;
@@ -2964,6 +3449,215 @@ bool rlCheckRenderBatchLimit(int vCount)
     return overflow;
 }
 
+// Check if 2d rectangle is outside viewport and scissor area (culled)
+// NOTE: Rectangle is transformed by current transform, modelview and projection matrices,
+// culling is conservative: if it can not be decided (stereo, behind camera), it's not culled
+bool rlCheckCulledRec(float x, float y, float width, float height)
+{
+    bool culled = false;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    float boundsMin[2] = { 0 };
+    float boundsMax[2] = { 0 };
+    float areaMin[2] = { 0 };
+    float areaMax[2] = { 0 };
+
+    if (!rlGetCullBounds(x, y, width, height, boundsMin, boundsMax, areaMin, areaMax)) return false;
+
+    culled = ((boundsMax[0] < areaMin[0]) || (boundsMin[0] > areaMax[0]) ||
+              (boundsMax[1] < areaMin[1]) || (boundsMin[1] > areaMax[1]));
+
+    if (culled) RLGL.Stats.current.culled++;
+#endif
+
+    return culled;
+}
+
+// Check if 2d rectangle is fully inside viewport and scissor area
+// NOTE: Same transform as rlCheckCulledRec(), if it can not be decided it's not visible
+bool rlCheckVisibleRec(float x, float y, float width, float height)
+{
+    bool visible = false;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    float boundsMin[2] = { 0 };
+    float boundsMax[2] = { 0 };
+    float areaMin[2] = { 0 };
+    float areaMax[2] = { 0 };
+
+    if (!rlGetCullBounds(x, y, width, height, boundsMin, boundsMax, areaMin, areaMax)) return false;
+
+    visible = ((boundsMin[0] >= areaMin[0]) && (boundsMax[0] <= areaMax[0]) &&
+               (boundsMin[1] >= areaMin[1]) && (boundsMax[1] <= areaMax[1]));
+#endif
+
+    return visible;
+}
+
+// Add SDF shape instance to shapes batch: rounded box centered at (x, y), outline if thickness > 0
+// NOTE: Returns false if shape can not be represented (not supported or rotated transform),
+// in that case the caller is expected to draw the shape tessellated
+bool rlPushShapeInstance(float x, float y, float halfWidth, float halfHeight, float radius, float thickness, unsigned char r, unsigned char g, unsigned char b, unsigned char a)
+{
+    bool result = false;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.ShapeBatch.shaderId == 0) return result;
+
+    if (RLGL.State.transformRequired)
+    {
+        Matrix mat = RLGL.State.transform;
+
+        // Only translation and axis scaling can be represented by one instance
+        if ((mat.m1 != 0.0f) || (mat.m4 != 0.0f)) return result;
+
+        float scaleX = fabsf(mat.m0);
+        float scaleY = fabsf(mat.m5);
+        float scale = (scaleX < scaleY)? scaleX : scaleY;
+
+        x = mat.m0*x + mat.m12;
+        y = mat.m5*y + mat.m13;
+        halfWidth *= scaleX;
+        halfHeight *= scaleY;
+        radius *= scale;
+        thickness *= scale;
+    }
+
+    // Pending vertex data must be drawn before shapes to keep drawing order
+    if (RLGL.State.vertexCounter > 0) rlDrawRenderBatch(RLGL.currentBatch);
+    if (RLGL.ShapeBatch.instanceCount >= RL_DEFAULT_SHAPE_BATCH_INSTANCES) rlDrawShapeBatch();
+
+    float maxRadius = (halfWidth < halfHeight)? halfWidth : halfHeight;
+    if (radius > maxRadius) radius = maxRadius;
+    if (radius < 0.0f) radius = 0.0f;
+
+    rlShapeInstance *shape = &RLGL.ShapeBatch.instances[RLGL.ShapeBatch.instanceCount];
+    shape->rect[0] = x;
+    shape->rect[1] = y;
+    shape->rect[2] = halfWidth;
+    shape->rect[3] = halfHeight;
+    shape->params[0] = radius;
+    shape->params[1] = thickness;
+    shape->params[2] = RLGL.currentBatch->currentDepth;
+    shape->color[0] = r;
+    shape->color[1] = g;
+    shape->color[2] = b;
+    shape->color[3] = a;
+
+    RLGL.ShapeBatch.instanceCount++;
+
+    // Every shape is considered a new drawing element (same as rlEnd())
+    RLGL.currentBatch->currentDepth += (1.0f/20000.0f);
+
+    result = true;
+#endif
+
+    return result;
+}
+
+// Draw pending SDF shapes batch
+// NOTE: Shapes use current modelview/projection matrices, stereo rendering is not supported
+void rlDrawShapeBatch(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.ShapeBatch.instanceCount == 0) return;
+
+    int count = RLGL.ShapeBatch.instanceCount;
+
+    // Shape attributes are not stored in any VAO
+    if (RLGL.ExtSupported.vao) rlStateBindVertexArray(0);
+
+    rlStateUseProgram(RLGL.ShapeBatch.shaderId);
+
+    Matrix matMVP = rlMatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
+    float matMVPfloat[16] = {
+        matMVP.m0, matMVP.m1, matMVP.m2, matMVP.m3,
+        matMVP.m4, matMVP.m5, matMVP.m6, matMVP.m7,
+        matMVP.m8, matMVP.m9, matMVP.m10, matMVP.m11,
+        matMVP.m12, matMVP.m13, matMVP.m14, matMVP.m15
+    };
+    glUniformMatrix4fv(RLGL.ShapeBatch.locMvp, 1, false, matMVPfloat);
+    glUniform2f(RLGL.ShapeBatch.locViewport, (float)RLGL.State.viewportWidth, (float)RLGL.State.viewportHeight);
+
+    int stride = 0;
+    int offset = 0;
+    int divisor = 0;
+
+    if (RLGL.ExtSupported.instancing)
+    {
+        // Unit quad corners, shared by all instances
+        rlStateBindArrayBuffer(RLGL.ShapeBatch.cornerVboId);
+        glVertexAttribPointer(RLGL.ShapeBatch.locCorner, 2, GL_FLOAT, 0, 0, 0);
+        glEnableVertexAttribArray(RLGL.ShapeBatch.locCorner);
+
+        rlStateBindArrayBuffer(RLGL.ShapeBatch.vboId);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, count*sizeof(rlShapeInstance), RLGL.ShapeBatch.instances);
+        RLGL.Stats.current.uploadedBytes += count*sizeof(rlShapeInstance);
+
+        stride = sizeof(rlShapeInstance);
+        divisor = 1;
+    }
+    else
+    {
+        // Expand every shape into two triangles, shape data replicated per vertex
+        for (int i = 0; i < count; i++)
+        {
+            for (int v = 0; v < 6; v++)
+            {
+                rlShapeVertex *vertex = &RLGL.ShapeBatch.vertices[i*6 + v];
+                vertex->corner[0] = rlShapeQuadCorners[v*2];
+                vertex->corner[1] = rlShapeQuadCorners[v*2 + 1];
+                vertex->shape = RLGL.ShapeBatch.instances[i];
+            }
+        }
+
+        rlStateBindArrayBuffer(RLGL.ShapeBatch.vboId);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, count*6*sizeof(rlShapeVertex), RLGL.ShapeBatch.vertices);
+        RLGL.Stats.current.uploadedBytes += count*6*sizeof(rlShapeVertex);
+
+        stride = sizeof(rlShapeVertex);
+        offset = 2*sizeof(float);
+
+        glVertexAttribPointer(RLGL.ShapeBatch.locCorner, 2, GL_FLOAT, 0, stride, 0);
+        glEnableVertexAttribArray(RLGL.ShapeBatch.locCorner);
+    }
+
+    glVertexAttribPointer(RLGL.ShapeBatch.locRect, 4, GL_FLOAT, 0, stride, (void *)(size_t)offset);
+    glVertexAttribPointer(RLGL.ShapeBatch.locParams, 3, GL_FLOAT, 0, stride, (void *)(size_t)(offset + 4*sizeof(float)));
+    glVertexAttribPointer(RLGL.ShapeBatch.locColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride, (void *)(size_t)(offset + 7*sizeof(float)));
+    glEnableVertexAttribArray(RLGL.ShapeBatch.locRect);
+    glEnableVertexAttribArray(RLGL.ShapeBatch.locParams);
+    glEnableVertexAttribArray(RLGL.ShapeBatch.locColor);
+
+    if (RLGL.ExtSupported.instancing)
+    {
+        glVertexAttribDivisor(RLGL.ShapeBatch.locRect, divisor);
+        glVertexAttribDivisor(RLGL.ShapeBatch.locParams, divisor);
+        glVertexAttribDivisor(RLGL.ShapeBatch.locColor, divisor);
+
+        glDrawArraysInstanced(GL_TRIANGLES, 0, 6, count);
+
+        // Reset divisors, attribute locations could be shared with non-instanced drawing
+        glVertexAttribDivisor(RLGL.ShapeBatch.locRect, 0);
+        glVertexAttribDivisor(RLGL.ShapeBatch.locParams, 0);
+        glVertexAttribDivisor(RLGL.ShapeBatch.locColor, 0);
+    }
+    else glDrawArrays(GL_TRIANGLES, 0, count*6);
+
+    RLGL.Stats.current.drawCalls++;
+
+    glDisableVertexAttribArray(RLGL.ShapeBatch.locCorner);
+    glDisableVertexAttribArray(RLGL.ShapeBatch.locRect);
+    glDisableVertexAttribArray(RLGL.ShapeBatch.locParams);
+    glDisableVertexAttribArray(RLGL.ShapeBatch.locColor);
+
+    rlStateBindArrayBuffer(0);
+    rlStateUseProgram(0);
+
+    RLGL.ShapeBatch.instanceCount = 0;
+#endif
+}
+
 // Textures data management
 //-----------------------------------------------------------------------------------------
 // Convert image data to OpenGL texture (returns OpenGL valid Id)
@@ -2971,7 +3665,7 @@ unsigned int rlLoadTexture(const void *data, int width, int height, int format,
 {
     unsigned int id = 0;
 
-    glBindTexture(GL_TEXTURE_2D, 0);    // Free any old binding
+    rlStateBindTexture(0);    // Free any old binding
 
     // Check texture format support by OpenGL 1.1 (compressed textures not supported)
 #if defined(GRAPHICS_API_OPENGL_11)
@@ -3018,7 +3712,7 @@ unsigned int rlLoadTexture(const void *data, int width, int height, int format,
 
     glGenTextures(1, &id);              // Generate texture id
 
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlStateBindTexture(id);
 
     int mipWidth = width;
     int mipHeight = height;
@@ -3044,6 +3738,9 @@ unsigned int rlLoadTexture(const void *data, int width, int height, int format,
 #if !defined(GRAPHICS_API_OPENGL_11)
             else glCompressedTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, mipSize, dataPtr);
 #endif
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+            if (dataPtr != NULL) RLGL.Stats.current.uploadedBytes += mipSize;
+#endif
 
 #if defined(GRAPHICS_API_OPENGL_33)
             if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
@@ -3111,7 +3808,7 @@ unsigned int rlLoadTexture(const void *data, int width, int height, int format,
     // NOTE: If mipmaps were not in data, they are not generated automatically
 
     // Unbind current texture
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlStateBindTexture(0);
 
     if (id > 0) TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Texture loaded successfully (%ix%i | %s | %i mipmaps)", id, width, height, rlGetPixelFormatName(format), mipmapCount);
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: Failed to load texture");
@@ -3147,7 +3844,7 @@ unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer)
     if (!useRenderBuffer && RLGL.ExtSupported.texDepth)
     {
         glGenTextures(1, &id);
-        glBindTexture(GL_TEXTURE_2D, id);
+        rlStateBindTexture(id);
         glTexImage2D(GL_TEXTURE_2D, 0, glInternalFormat, width, height, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL);
 
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
@@ -3155,7 +3852,7 @@ unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer)
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
-        glBindTexture(GL_TEXTURE_2D, 0);
+        rlStateBindTexture(0);
 
         TRACELOG(RL_LOG_INFO, "TEXTURE: Depth texture loaded successfully");
     }
@@ -3255,7 +3952,7 @@ unsigned int rlLoadTextureCubemap(const void *data, int size, int format)
 // NOTE: We don't know safely if internal texture format is the expected one...
 void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data)
 {
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlStateBindTexture(id);
 
     unsigned int glInternalFormat, glFormat, glType;
     rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
@@ -3263,6 +3960,9 @@ void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int h
     if ((glInternalFormat != 0) && (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
     {
         glTexSubImage2D(GL_TEXTURE_2D, 0, offsetX, offsetY, width, height, glFormat, glType, data);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+        RLGL.Stats.current.uploadedBytes += rlGetPixelDataSize(width, height, format);
+#endif
     }
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to update for current texture format (%i)", id, format);
 }
@@ -3343,6 +4043,9 @@ void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned
 // Unload texture from GPU memory
 void rlUnloadTexture(unsigned int id)
 {
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlStateForgetTexture(id);
+#endif
     glDeleteTextures(1, &id);
 }
 
@@ -3351,7 +4054,7 @@ void rlUnloadTexture(unsigned int id)
 void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int *mipmaps)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlStateBindTexture(id);
 
     // Check if texture is power-of-two (POT)
     bool texIsPOT = false;
@@ -3372,7 +4075,7 @@ void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int
     }
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to generate mipmaps", id);
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlStateBindTexture(0);
 #else
     TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] GPU mipmap generation not supported", id);
 #endif
@@ -3385,7 +4088,7 @@ void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
     void *pixels = NULL;
 
 #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlStateBindTexture(id);
 
     // NOTE: Using texture id, we can retrieve some texture info (but not on OpenGL ES 2.0)
     // Possible texture info: GL_TEXTURE_RED_SIZE, GL_TEXTURE_GREEN_SIZE, GL_TEXTURE_BLUE_SIZE, GL_TEXTURE_ALPHA_SIZE
@@ -3411,7 +4114,7 @@ void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
     }
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Data retrieval not suported for pixel format (%i)", id, format);
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlStateBindTexture(0);
 #endif
 
 #if defined(GRAPHICS_API_OPENGL_ES2)
@@ -3425,7 +4128,7 @@ void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
     unsigned int fboId = rlLoadFramebuffer(width, height);
 
     glBindFramebuffer(GL_FRAMEBUFFER, fboId);
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlStateBindTexture(0);
 
     // Attach our texture to FBO
     glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, id, 0);
@@ -3446,50 +4149,169 @@ void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
 // Read screen pixel data (color buffer)
 unsigned char *rlReadScreenPixels(int width, int height)
 {
-    unsigned char *screenData = (unsigned char *)RL_CALLOC(width*height*4, sizeof(unsigned char));
+    int rowSize = width*4;
+    unsigned char *imgData = (unsigned char *)RL_MALLOC(height*rowSize*sizeof(unsigned char));
 
     // NOTE 1: glReadPixels returns image flipped vertically -> (0,0) is the bottom left corner of the framebuffer
     // NOTE 2: We are getting alpha channel! Be careful, it can be transparent if not cleared properly!
-    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, screenData);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, imgData);
 
-    // Flip image vertically!
-    unsigned char *imgData = (unsigned char *)RL_MALLOC(width*height*4*sizeof(unsigned char));
+    // Flip image vertically! Swapping rows in place, only one row of temporal storage required
+    // NOTE: Alpha value has already been applied to RGB in framebuffer, we don't need it!
+    unsigned char *rowData = (unsigned char *)RL_MALLOC(rowSize*sizeof(unsigned char));
 
-    for (int y = height - 1; y >= 0; y--)
+    for (int y = 0; y < height/2; y++)
     {
-        for (int x = 0; x < (width*4); x++)
-        {
-            imgData[((height - 1) - y)*width*4 + x] = screenData[(y*width*4) + x];  // Flip line
+        unsigned char *top = imgData + y*rowSize;
+        unsigned char *bottom = imgData + (height - 1 - y)*rowSize;
 
-            // Set alpha component value to 255 (no trasparent image retrieval)
-            // NOTE: Alpha value has already been applied to RGB in framebuffer, we don't need it!
-            if (((x + 1)%4) == 0) imgData[((height - 1) - y)*width*4 + x] = 255;
-        }
+        memcpy(rowData, top, rowSize);
+        rlCopyPixelsOpaque(top, bottom, width);
+        rlCopyPixelsOpaque(bottom, rowData, width);
     }
 
-    RL_FREE(screenData);
+    if ((height%2) == 1) rlCopyPixelsOpaque(imgData + (height/2)*rowSize, imgData + (height/2)*rowSize, width);
+
+    RL_FREE(rowData);
 
     return imgData;     // NOTE: image data should be freed
 }
 
-// Framebuffer management (fbo)
-//-----------------------------------------------------------------------------------------
-// Load a framebuffer to be used for rendering
-// NOTE: No textures attached
-unsigned int rlLoadFramebuffer(int width, int height)
+// Queue screen pixel data read (color buffer) into a pixel pack buffer
+// NOTE: glReadPixels() returns immediately, copy is done by the GPU and a fence is
+// inserted after it, data is retrieved with rlGetScreenPixelsAsync() some frames later
+bool rlReadScreenPixelsAsync(int width, int height)
 {
-    unsigned int fboId = 0;
+    bool result = false;
 
-#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
-    glGenFramebuffers(1, &fboId);       // Create the framebuffer object
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);   // Unbind any framebuffer
-#endif
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.ExtSupported.pbo && (RLGL.Readback.count < RL_READBACK_BUFFERS))
+    {
+        int index = (RLGL.Readback.head + RLGL.Readback.count)%RL_READBACK_BUFFERS;
+        int size = width*height*4;
 
-    return fboId;
-}
+        if (RLGL.Readback.pboId[index] == 0) glGenBuffers(1, &RLGL.Readback.pboId[index]);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, RLGL.Readback.pboId[index]);
 
-// Attach color buffer texture to an fbo (unloads previous attachment)
-// NOTE: Attach type: 0-Color, 1-Depth renderbuffer, 2-Depth texture
+        // Buffer storage is only reallocated if screen size changed
+        if (RLGL.Readback.size[index] != size)
+        {
+            glBufferData(GL_PIXEL_PACK_BUFFER, size, NULL, GL_STREAM_READ);
+            RLGL.Readback.size[index] = size;
+        }
+
+        glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        RLGL.Readback.fence[index] = (void *)glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        RLGL.Readback.width[index] = width;
+        RLGL.Readback.height[index] = height;
+        RLGL.Readback.count++;
+
+        result = true;
+    }
+#endif
+
+    return result;
+}
+
+// Get oldest queued screen pixel data, flipped vertically with alpha set to 255 (same as rlReadScreenPixels())
+// NOTE: Returns NULL if no read is queued or GPU has not completed it yet (unless wait is requested)
+unsigned char *rlGetScreenPixelsAsync(int *width, int *height, bool wait)
+{
+    unsigned char *imgData = NULL;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.Readback.count > 0)
+    {
+        int index = RLGL.Readback.head;
+        GLsync fence = (GLsync)RLGL.Readback.fence[index];
+
+        // Just poll the fence, commands have been already flushed by buffers swap
+        GLenum status = glClientWaitSync(fence, 0, 0);
+        while (wait && (status == GL_TIMEOUT_EXPIRED)) status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+
+        if ((status == GL_ALREADY_SIGNALED) || (status == GL_CONDITION_SATISFIED))
+        {
+            int imgWidth = RLGL.Readback.width[index];
+            int imgHeight = RLGL.Readback.height[index];
+            int rowSize = imgWidth*4;
+
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, RLGL.Readback.pboId[index]);
+            const unsigned char *pixels = (const unsigned char *)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, imgHeight*rowSize, GL_MAP_READ_BIT);
+
+            if (pixels != NULL)
+            {
+                imgData = (unsigned char *)RL_MALLOC(imgHeight*rowSize*sizeof(unsigned char));
+
+                // Flip image vertically while copying from mapped buffer
+                for (int y = 0; y < imgHeight; y++) rlCopyPixelsOpaque(imgData + (imgHeight - 1 - y)*rowSize, pixels + y*rowSize, imgWidth);
+
+                glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+
+                if (width != NULL) *width = imgWidth;
+                if (height != NULL) *height = imgHeight;
+            }
+            else TRACELOG(RL_LOG_WARNING, "GL: Failed to map screen readback buffer");
+
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        }
+
+        // Read is released once completed (or failed), pending reads are kept queued
+        if (status != GL_TIMEOUT_EXPIRED)
+        {
+            glDeleteSync(fence);
+            RLGL.Readback.fence[index] = NULL;
+            RLGL.Readback.head = (RLGL.Readback.head + 1)%RL_READBACK_BUFFERS;
+            RLGL.Readback.count--;
+        }
+    }
+#endif
+
+    return imgData;     // NOTE: image data should be freed
+}
+
+// Discard queued screen pixel data reads and unload pixel buffers
+void rlUnloadScreenPixelsAsync(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    for (int i = 0; i < RL_READBACK_BUFFERS; i++)
+    {
+        if (RLGL.Readback.fence[i] != NULL) glDeleteSync((GLsync)RLGL.Readback.fence[i]);
+        if (RLGL.Readback.pboId[i] != 0)
+        {
+            rlStateForgetBuffer(RLGL.Readback.pboId[i]);
+            glDeleteBuffers(1, &RLGL.Readback.pboId[i]);
+        }
+
+        RLGL.Readback.fence[i] = NULL;
+        RLGL.Readback.pboId[i] = 0;
+        RLGL.Readback.size[i] = 0;
+    }
+
+    RLGL.Readback.head = 0;
+    RLGL.Readback.count = 0;
+#endif
+}
+
+// Framebuffer management (fbo)
+//-----------------------------------------------------------------------------------------
+// Load a framebuffer to be used for rendering
+// NOTE: No textures attached
+unsigned int rlLoadFramebuffer(int width, int height)
+{
+    unsigned int fboId = 0;
+
+#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+    glGenFramebuffers(1, &fboId);       // Create the framebuffer object
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);   // Unbind any framebuffer
+#endif
+
+    return fboId;
+}
+
+// Attach color buffer texture to an fbo (unloads previous attachment)
+// NOTE: Attach type: 0-Color, 1-Depth renderbuffer, 2-Depth texture
 void rlFramebufferAttach(unsigned int fboId, unsigned int texId, int attachType, int texType, int mipLevel)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
@@ -3579,7 +4401,11 @@ void rlUnloadFramebuffer(unsigned int id)
 
     unsigned int depthIdU = (unsigned int)depthId;
     if (depthType == GL_RENDERBUFFER) glDeleteRenderbuffers(1, &depthIdU);
-    else if (depthType == GL_TEXTURE) glDeleteTextures(1, &depthIdU);
+    else if (depthType == GL_TEXTURE)
+    {
+        rlStateForgetTexture(depthIdU);
+        glDeleteTextures(1, &depthIdU);
+    }
 
     // NOTE: If a texture object is deleted while its image is attached to the *currently bound* framebuffer,
     // the texture image is automatically detached from the currently bound framebuffer.
@@ -3600,7 +4426,7 @@ unsigned int rlLoadVertexBuffer(const void *buffer, int size, bool dynamic)
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glGenBuffers(1, &id);
-    glBindBuffer(GL_ARRAY_BUFFER, id);
+    rlStateBindArrayBuffer(id);
     glBufferData(GL_ARRAY_BUFFER, size, buffer, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
 #endif
 
@@ -3625,7 +4451,7 @@ unsigned int rlLoadVertexBufferElement(const void *buffer, int size, bool dynami
 void rlEnableVertexBuffer(unsigned int id)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindBuffer(GL_ARRAY_BUFFER, id);
+    rlStateBindArrayBuffer(id);
 #endif
 }
 
@@ -3633,7 +4459,7 @@ void rlEnableVertexBuffer(unsigned int id)
 void rlDisableVertexBuffer(void)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    rlStateBindArrayBuffer(0);
 #endif
 }
 
@@ -3658,8 +4484,9 @@ void rlDisableVertexBufferElement(void)
 void rlUpdateVertexBuffer(unsigned int id, const void *data, int dataSize, int offset)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindBuffer(GL_ARRAY_BUFFER, id);
+    rlStateBindArrayBuffer(id);
     glBufferSubData(GL_ARRAY_BUFFER, offset, dataSize, data);
+    RLGL.Stats.current.uploadedBytes += dataSize;
 #endif
 }
 
@@ -3670,6 +4497,7 @@ void rlUpdateVertexBufferElements(unsigned int id, const void *data, int dataSiz
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
     glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, offset, dataSize, data);
+    RLGL.Stats.current.uploadedBytes += dataSize;
 #endif
 }
 
@@ -3680,7 +4508,7 @@ bool rlEnableVertexArray(unsigned int vaoId)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if (RLGL.ExtSupported.vao)
     {
-        glBindVertexArray(vaoId);
+        rlStateBindVertexArray(vaoId);
         result = true;
     }
 #endif
@@ -3691,7 +4519,7 @@ bool rlEnableVertexArray(unsigned int vaoId)
 void rlDisableVertexArray(void)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+    if (RLGL.ExtSupported.vao) rlStateBindVertexArray(0);
 #endif
 }
 
@@ -3715,6 +4543,9 @@ void rlDisableVertexAttribute(unsigned int index)
 void rlDrawVertexArray(int offset, int count)
 {
     glDrawArrays(GL_TRIANGLES, offset, count);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.Stats.current.drawCalls++;
+#endif
 }
 
 // Draw vertex array elements
@@ -3725,6 +4556,9 @@ void rlDrawVertexArrayElements(int offset, int count, const void *buffer)
     if (offset > 0) bufferPtr += offset;
 
     glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (const unsigned short *)bufferPtr);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.Stats.current.drawCalls++;
+#endif
 }
 
 // Draw vertex array instanced
@@ -3732,6 +4566,7 @@ void rlDrawVertexArrayInstanced(int offset, int count, int instances)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glDrawArraysInstanced(GL_TRIANGLES, 0, count, instances);
+    RLGL.Stats.current.drawCalls++;
 #endif
 }
 
@@ -3744,6 +4579,7 @@ void rlDrawVertexArrayElementsInstanced(int offset, int count, const void *buffe
     if (offset > 0) bufferPtr += offset;
 
     glDrawElementsInstanced(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (const unsigned short *)bufferPtr, instances);
+    RLGL.Stats.current.drawCalls++;
 #endif
 }
 
@@ -3805,7 +4641,7 @@ void rlUnloadVertexArray(unsigned int vaoId)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if (RLGL.ExtSupported.vao)
     {
-        glBindVertexArray(0);
+        rlStateForgetVertexArray(vaoId);
         glDeleteVertexArrays(1, &vaoId);
         TRACELOG(RL_LOG_INFO, "VAO: [ID %i] Unloaded vertex array data from VRAM (GPU)", vaoId);
     }
@@ -3816,6 +4652,7 @@ void rlUnloadVertexArray(unsigned int vaoId)
 void rlUnloadVertexBuffer(unsigned int vboId)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlStateForgetBuffer(vboId);
     glDeleteBuffers(1, &vboId);
     //TRACELOG(RL_LOG_INFO, "VBO: Unloaded vertex data from VRAM (GPU)");
 #endif
@@ -3825,23 +4662,39 @@ void rlUnloadVertexBuffer(unsigned int vboId)
 //-----------------------------------------------------------------------------------------------
 // Load shader from code strings
 // NOTE: If shader string is NULL, using default vertex/fragment shaders
+// NOTE: If shader cache is set, program is loaded from its binary when available, compiled from code otherwise
 unsigned int rlLoadShaderCode(const char *vsCode, const char *fsCode)
 {
     unsigned int id = 0;
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    unsigned long long cacheKey = 0;
+
+    if ((vsCode != NULL) || (fsCode != NULL))
+    {
+        cacheKey = rlGetShaderCacheKey((vsCode != NULL)? vsCode : RLGL.State.defaultVShaderCode, (fsCode != NULL)? fsCode : RLGL.State.defaultFShaderCode);
+
+        if (cacheKey != 0)
+        {
+            id = rlLoadShaderProgramCache(cacheKey);
+            if (id > 0) return id;
+        }
+    }
+
+    double startTime = (RLGL.ShaderCache.getTime != NULL)? RLGL.ShaderCache.getTime() : 0.0;
+
     unsigned int vertexShaderId = 0;
     unsigned int fragmentShaderId = 0;
 
     // Compile vertex shader (if provided)
     if (vsCode != NULL) vertexShaderId = rlCompileShader(vsCode, GL_VERTEX_SHADER);
     // In case no vertex shader was provided or compilation failed, we use default vertex shader
-    if (vertexShaderId == 0) vertexShaderId = RLGL.State.defaultVShaderId;
+    if (vertexShaderId == 0) vertexShaderId = rlGetShaderDefaultObject(GL_VERTEX_SHADER);
 
     // Compile fragment shader (if provided)
     if (fsCode != NULL) fragmentShaderId = rlCompileShader(fsCode, GL_FRAGMENT_SHADER);
     // In case no fragment shader was provided or compilation failed, we use default fragment shader
-    if (fragmentShaderId == 0) fragmentShaderId = RLGL.State.defaultFShaderId;
+    if (fragmentShaderId == 0) fragmentShaderId = rlGetShaderDefaultObject(GL_FRAGMENT_SHADER);
 
     // In case vertex and fragment shader are the default ones, no need to recompile, we can just assign the default shader program id
     if ((vertexShaderId == RLGL.State.defaultVShaderId) && (fragmentShaderId == RLGL.State.defaultFShaderId)) id = RLGL.State.defaultShaderId;
@@ -3872,6 +4725,12 @@ unsigned int rlLoadShaderCode(const char *vsCode, const char *fsCode)
             TRACELOG(RL_LOG_WARNING, "SHADER: Failed to load custom shader code, using default shader");
             id = RLGL.State.defaultShaderId;
         }
+        else if (cacheKey != 0)
+        {
+            // NOTE: Failed compilation makes linkage fail, only valid programs get cached
+            float compileTime = (RLGL.ShaderCache.getTime != NULL)? (float)((RLGL.ShaderCache.getTime() - startTime)*1000.0) : 0.0f;
+            rlSaveShaderProgramCache(id, cacheKey, compileTime);
+        }
         /*
         else
         {
@@ -4022,6 +4881,7 @@ unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
 void rlUnloadShaderProgram(unsigned int id)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlStateForgetProgram(id);
     glDeleteProgram(id);
 
     TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Unloaded shader program data from VRAM (GPU)", id);
@@ -4058,6 +4918,9 @@ int rlGetLocationAttrib(unsigned int shaderId, const char *attribName)
 void rlSetUniform(int locIndex, const void *value, int uniformType, int count)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: Uniform could be one of the batch uniforms of the program in use
+    RLGL.StateCache.uniformShaderId = RL_STATE_UNKNOWN;
+
     switch (uniformType)
     {
         case RL_SHADER_UNIFORM_FLOAT: glUniform1fv(locIndex, count, (float *)value); break;
@@ -4099,6 +4962,7 @@ void rlSetUniformMatrix(int locIndex, Matrix mat)
         mat.m8, mat.m9, mat.m10, mat.m11,
         mat.m12, mat.m13, mat.m14, mat.m15
     };
+    RLGL.StateCache.uniformShaderId = RL_STATE_UNKNOWN;     // Uniform could be batch mvp
     glUniformMatrix4fv(locIndex, 1, false, matfloat);
 #endif
 }
@@ -4118,6 +4982,7 @@ void rlSetUniformSampler(int locIndex, unsigned int textureId)
         {
             glUniform1i(locIndex, 1 + i);              // Activate new texture unit
             RLGL.State.activeTextureId[i] = textureId; // Save texture id for binding on drawing
+            RLGL.StateCache.uniformShaderId = RL_STATE_UNKNOWN;
             break;
         }
     }
@@ -4137,6 +5002,32 @@ void rlSetShader(unsigned int id, int *locs)
 #endif
 }
 
+// Set shader program binary cache callbacks
+// NOTE: Must be set before rlglInit() for default shader to be cached, cache keys
+// include shader code and GL renderer/version, so driver updates invalidate entries
+void rlSetShaderCache(rlShaderCacheLoadCallback load, rlShaderCacheSaveCallback save, rlShaderCacheTimeCallback getTime)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.ShaderCache.load = load;
+    RLGL.ShaderCache.save = save;
+    RLGL.ShaderCache.getTime = getTime;
+#endif
+}
+
+// Get shader program binary cache stats
+void rlGetShaderCacheStats(int *hits, int *misses, float *timeSaved)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (hits != NULL) *hits = RLGL.ShaderCache.hits;
+    if (misses != NULL) *misses = RLGL.ShaderCache.misses;
+    if (timeSaved != NULL) *timeSaved = RLGL.ShaderCache.timeSaved;
+#else
+    if (hits != NULL) *hits = 0;
+    if (misses != NULL) *misses = 0;
+    if (timeSaved != NULL) *timeSaved = 0.0f;
+#endif
+}
+
 // Load compute shader program
 unsigned int rlLoadComputeShaderProgram(unsigned int shaderId)
 {
@@ -4214,6 +5105,7 @@ unsigned int rlLoadShaderBuffer(unsigned int size, const void *data, int usageHi
 void rlUnloadShaderBuffer(unsigned int ssboId)
 {
 #if defined(GRAPHICS_API_OPENGL_43)
+    rlStateForgetBuffer(ssboId);
     glDeleteBuffers(1, &ssboId);
 #endif
 }
@@ -4423,11 +5315,11 @@ void rlLoadDrawQuad(void)
 
     // Gen VAO to contain VBO
     glGenVertexArrays(1, &quadVAO);
-    glBindVertexArray(quadVAO);
+    rlStateBindVertexArray(quadVAO);
 
     // Gen and fill vertex buffer (VBO)
     glGenBuffers(1, &quadVBO);
-    glBindBuffer(GL_ARRAY_BUFFER, quadVBO);
+    rlStateBindArrayBuffer(quadVBO);
     glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), &vertices, GL_STATIC_DRAW);
 
     // Bind vertex attributes (position, texcoords)
@@ -4437,11 +5329,13 @@ void rlLoadDrawQuad(void)
     glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5*sizeof(float), (void *)(3*sizeof(float))); // Texcoords
 
     // Draw quad
-    glBindVertexArray(quadVAO);
+    rlStateBindVertexArray(quadVAO);
     glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-    glBindVertexArray(0);
+    rlStateBindVertexArray(0);
 
     // Delete buffers (VBO and VAO)
+    rlStateForgetBuffer(quadVBO);
+    rlStateForgetVertexArray(quadVAO);
     glDeleteBuffers(1, &quadVBO);
     glDeleteVertexArrays(1, &quadVAO);
 #endif
@@ -4496,30 +5390,32 @@ void rlLoadDrawCube(void)
 
     // Gen VAO to contain VBO
     glGenVertexArrays(1, &cubeVAO);
-    glBindVertexArray(cubeVAO);
+    rlStateBindVertexArray(cubeVAO);
 
     // Gen and fill vertex buffer (VBO)
     glGenBuffers(1, &cubeVBO);
-    glBindBuffer(GL_ARRAY_BUFFER, cubeVBO);
+    rlStateBindArrayBuffer(cubeVBO);
     glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
 
     // Bind vertex attributes (position, normals, texcoords)
-    glBindVertexArray(cubeVAO);
+    rlStateBindVertexArray(cubeVAO);
     glEnableVertexAttribArray(0);
     glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)0); // Positions
     glEnableVertexAttribArray(1);
     glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)(3*sizeof(float))); // Normals
     glEnableVertexAttribArray(2);
     glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)(6*sizeof(float))); // Texcoords
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
+    rlStateBindArrayBuffer(0);
+    rlStateBindVertexArray(0);
 
     // Draw cube
-    glBindVertexArray(cubeVAO);
+    rlStateBindVertexArray(cubeVAO);
     glDrawArrays(GL_TRIANGLES, 0, 36);
-    glBindVertexArray(0);
+    rlStateBindVertexArray(0);
 
     // Delete VBO and VAO
+    rlStateForgetBuffer(cubeVBO);
+    rlStateForgetVertexArray(cubeVAO);
     glDeleteBuffers(1, &cubeVBO);
     glDeleteVertexArrays(1, &cubeVAO);
 #endif
@@ -4561,7 +5457,256 @@ const char *rlGetPixelFormatName(unsigned int format)
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
+// Bind texture to GL_TEXTURE_2D of active unit, skipped if already bound
+// NOTE: Returns true if bind was issued, draw paths count it as a texture switch
+static bool rlStateBindTexture(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    int unit = RLGL.StateCache.activeTextureUnit;
+
+    if ((unit >= 0) && (unit < RL_STATE_CACHE_TEXTURE_UNITS))
+    {
+        if (RLGL.StateCache.textureIds[unit] == id)
+        {
+            RLGL.Stats.current.stateCallsSkipped++;
+            return false;
+        }
+
+        RLGL.StateCache.textureIds[unit] = id;
+    }
+
+    RLGL.Stats.current.stateCallsIssued++;
+#endif
+    glBindTexture(GL_TEXTURE_2D, id);
+
+    return true;
+}
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Use shader program, skipped if already in use
+static void rlStateUseProgram(unsigned int id)
+{
+    if (RLGL.StateCache.programId == id) RLGL.Stats.current.stateCallsSkipped++;
+    else
+    {
+        glUseProgram(id);
+        RLGL.StateCache.programId = id;
+        RLGL.Stats.current.stateCallsIssued++;
+    }
+}
+
+// Bind vertex array (VAO), skipped if already bound
+static void rlStateBindVertexArray(unsigned int id)
+{
+    if (RLGL.StateCache.vertexArrayId == id) RLGL.Stats.current.stateCallsSkipped++;
+    else
+    {
+        glBindVertexArray(id);
+        RLGL.StateCache.vertexArrayId = id;
+        RLGL.Stats.current.stateCallsIssued++;
+    }
+}
+
+// Bind vertex buffer to GL_ARRAY_BUFFER, skipped if already bound
+static void rlStateBindArrayBuffer(unsigned int id)
+{
+    if (RLGL.StateCache.arrayBufferId == id) RLGL.Stats.current.stateCallsSkipped++;
+    else
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, id);
+        RLGL.StateCache.arrayBufferId = id;
+        RLGL.Stats.current.stateCallsIssued++;
+    }
+}
+
+// Set active texture unit (GL_TEXTUREn), skipped if already active
+static void rlStateActiveTexture(unsigned int unit)
+{
+    int index = (int)unit - GL_TEXTURE0;
+
+    if (RLGL.StateCache.activeTextureUnit == index) RLGL.Stats.current.stateCallsSkipped++;
+    else
+    {
+        glActiveTexture(unit);
+        RLGL.StateCache.activeTextureUnit = index;
+        RLGL.Stats.current.stateCallsIssued++;
+    }
+}
+
+// Remove deleted texture from state cache
+// NOTE: Deleting a bound texture reverts the binding to 0
+static void rlStateForgetTexture(unsigned int id)
+{
+    for (int i = 0; i < RL_STATE_CACHE_TEXTURE_UNITS; i++)
+    {
+        if (RLGL.StateCache.textureIds[i] == id) RLGL.StateCache.textureIds[i] = 0;
+    }
+}
+
+// Remove deleted buffer from state cache
+// NOTE: Deleting a bound buffer reverts the binding to 0, buffer names are reused by GL
+static void rlStateForgetBuffer(unsigned int id)
+{
+    if (RLGL.StateCache.arrayBufferId == id) RLGL.StateCache.arrayBufferId = 0;
+}
+
+// Remove deleted vertex array (VAO) from state cache
+// NOTE: Deleting the bound vertex array reverts the binding to 0
+static void rlStateForgetVertexArray(unsigned int id)
+{
+    if (RLGL.StateCache.vertexArrayId == id) RLGL.StateCache.vertexArrayId = 0;
+}
+
+// Remove deleted program from state cache, unused first if in use
+// NOTE: Program in use is only deleted once not in use anymore
+static void rlStateForgetProgram(unsigned int id)
+{
+    if (RLGL.StateCache.programId == id) rlStateUseProgram(0);
+    if (RLGL.StateCache.uniformShaderId == id) RLGL.StateCache.uniformShaderId = RL_STATE_UNKNOWN;
+}
+
+// Transform 2d positions (xy) into batch vertex (xyz) by current transform matrix (if required)
+// NOTE: Equivalent to rlVertex3f() transform for count vertex, positions and vertices can not overlap
+static void rlTransformVertex2f(const float *positions, float *vertices, int count, float depth)
+{
+    int i = 0;
+
+    if (RLGL.State.transformRequired)
+    {
+        Matrix mat = RLGL.State.transform;
+
+        // Translation and depth contribution are the same for all vertex
+        float tx = mat.m8*depth + mat.m12;
+        float ty = mat.m9*depth + mat.m13;
+        float tz = mat.m10*depth + mat.m14;
+
+#if defined(RLGL_SIMD_NEON)
+        float32x4_t m0 = vdupq_n_f32(mat.m0), m4 = vdupq_n_f32(mat.m4);
+        float32x4_t m1 = vdupq_n_f32(mat.m1), m5 = vdupq_n_f32(mat.m5);
+        float32x4_t m2 = vdupq_n_f32(mat.m2), m6 = vdupq_n_f32(mat.m6);
+        float32x4_t t0 = vdupq_n_f32(tx), t1 = vdupq_n_f32(ty), t2 = vdupq_n_f32(tz);
+
+        // Four vertex per iteration, deinterleaved on load (xy) and interleaved on store (xyz)
+        for (; (i + 4) <= count; i += 4)
+        {
+            float32x4x2_t xy = vld2q_f32(positions + 2*i);
+            float32x4x3_t xyz;
+
+            xyz.val[0] = vmlaq_f32(vmlaq_f32(t0, xy.val[0], m0), xy.val[1], m4);
+            xyz.val[1] = vmlaq_f32(vmlaq_f32(t1, xy.val[0], m1), xy.val[1], m5);
+            xyz.val[2] = vmlaq_f32(vmlaq_f32(t2, xy.val[0], m2), xy.val[1], m6);
+
+            vst3q_f32(vertices + 3*i, xyz);
+        }
+#elif defined(RLGL_SIMD_SSE)
+        __m128 col0 = _mm_setr_ps(mat.m0, mat.m1, mat.m2, 0.0f);
+        __m128 col1 = _mm_setr_ps(mat.m4, mat.m5, mat.m6, 0.0f);
+        __m128 col3 = _mm_setr_ps(tx, ty, tz, 0.0f);
+
+        // One vertex per iteration, 4 floats stored: 4th one is overwritten by next vertex,
+        // so last vertex is left to scalar code to avoid writing past the end
+        for (; (i + 1) < count; i++)
+        {
+            __m128 x = _mm_set1_ps(positions[2*i]);
+            __m128 y = _mm_set1_ps(positions[2*i + 1]);
+
+            _mm_storeu_ps(vertices + 3*i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(col0, x), _mm_mul_ps(col1, y)), col3));
+        }
+#endif
+        for (; i < count; i++)
+        {
+            float x = positions[2*i];
+            float y = positions[2*i + 1];
+
+            vertices[3*i] = mat.m0*x + mat.m4*y + tx;
+            vertices[3*i + 1] = mat.m1*x + mat.m5*y + ty;
+            vertices[3*i + 2] = mat.m2*x + mat.m6*y + tz;
+        }
+    }
+    else
+    {
+#if defined(RLGL_SIMD_NEON)
+        float32x4_t z = vdupq_n_f32(depth);
+
+        for (; (i + 4) <= count; i += 4)
+        {
+            float32x4x2_t xy = vld2q_f32(positions + 2*i);
+            float32x4x3_t xyz = {{ xy.val[0], xy.val[1], z }};
+
+            vst3q_f32(vertices + 3*i, xyz);
+        }
+#endif
+        for (; i < count; i++)
+        {
+            vertices[3*i] = positions[2*i];
+            vertices[3*i + 1] = positions[2*i + 1];
+            vertices[3*i + 2] = depth;
+        }
+    }
+}
+
+// Get 2d rectangle bounds and visible area (viewport intersected with scissor area) in NDC
+// NOTE: Returns false if it can not be decided (stereo, behind camera)
+static bool rlGetCullBounds(float x, float y, float width, float height, float *boundsMin, float *boundsMax, float *areaMin, float *areaMax)
+{
+    if (RLGL.State.stereoRender || (RLGL.State.viewportWidth <= 0) || (RLGL.State.viewportHeight <= 0)) return false;
+
+    // Culling matrix is only recomputed when any of the matrices changed
+    if (!RLGL.Cull.valid || (RLGL.Cull.transformRequired != RLGL.State.transformRequired) ||
+        (memcmp(&RLGL.Cull.modelview, &RLGL.State.modelview, sizeof(Matrix)) != 0) ||
+        (memcmp(&RLGL.Cull.projection, &RLGL.State.projection, sizeof(Matrix)) != 0) ||
+        (RLGL.State.transformRequired && (memcmp(&RLGL.Cull.transform, &RLGL.State.transform, sizeof(Matrix)) != 0)))
+    {
+        RLGL.Cull.matrix = rlMatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
+        if (RLGL.State.transformRequired) RLGL.Cull.matrix = rlMatrixMultiply(RLGL.State.transform, RLGL.Cull.matrix);
+
+        RLGL.Cull.transform = RLGL.State.transform;
+        RLGL.Cull.modelview = RLGL.State.modelview;
+        RLGL.Cull.projection = RLGL.State.projection;
+        RLGL.Cull.transformRequired = RLGL.State.transformRequired;
+        RLGL.Cull.valid = true;
+    }
+
+    // Visible area in normalized device coordinates, intersected with scissor area
+    areaMin[0] = -1.0f; areaMin[1] = -1.0f;
+    areaMax[0] = 1.0f; areaMax[1] = 1.0f;
+
+    if (RLGL.State.scissorEnabled)
+    {
+        float vx = (float)RLGL.State.viewportX, vy = (float)RLGL.State.viewportY;
+        float vw = (float)RLGL.State.viewportWidth, vh = (float)RLGL.State.viewportHeight;
+
+        areaMin[0] = fmaxf(areaMin[0], 2.0f*(RLGL.State.scissor[0] - vx)/vw - 1.0f);
+        areaMin[1] = fmaxf(areaMin[1], 2.0f*(RLGL.State.scissor[1] - vy)/vh - 1.0f);
+        areaMax[0] = fminf(areaMax[0], 2.0f*(RLGL.State.scissor[0] + RLGL.State.scissor[2] - vx)/vw - 1.0f);
+        areaMax[1] = fminf(areaMax[1], 2.0f*(RLGL.State.scissor[1] + RLGL.State.scissor[3] - vy)/vh - 1.0f);
+    }
+
+    // Rectangle bounds in normalized device coordinates
+    Matrix mat = RLGL.Cull.matrix;
+    float z = RLGL.currentBatch->currentDepth;
+    float corners[8] = { x, y, x + width, y, x, y + height, x + width, y + height };
+
+    for (int i = 0; i < 4; i++)
+    {
+        float px = corners[i*2];
+        float py = corners[i*2 + 1];
+        float w = mat.m3*px + mat.m7*py + mat.m11*z + mat.m15;
+
+        if (w <= 0.0f) return false;    // Behind camera, can not be decided
+
+        float ndcX = (mat.m0*px + mat.m4*py + mat.m8*z + mat.m12)/w;
+        float ndcY = (mat.m1*px + mat.m5*py + mat.m9*z + mat.m13)/w;
+
+        if ((i == 0) || (ndcX < boundsMin[0])) boundsMin[0] = ndcX;
+        if ((i == 0) || (ndcY < boundsMin[1])) boundsMin[1] = ndcY;
+        if ((i == 0) || (ndcX > boundsMax[0])) boundsMax[0] = ndcX;
+        if ((i == 0) || (ndcY > boundsMax[1])) boundsMax[1] = ndcY;
+    }
+
+    return true;
+}
+
 // Load default shader (just vertex positioning and texture coloring)
 // NOTE: This shader program is used for internal buffers
 // NOTE: Loaded: RLGL.State.defaultShaderId, RLGL.State.defaultShaderLocs
@@ -4646,12 +5791,33 @@ static void rlLoadShaderDefault(void)
     "}                                  \n";
 #endif
 
-    // NOTE: Compiled vertex/fragment shaders are not deleted,
-    // they are kept for re-use as default shaders in case some shader loading fails
-    RLGL.State.defaultVShaderId = rlCompileShader(defaultVShaderCode, GL_VERTEX_SHADER);     // Compile default vertex shader
-    RLGL.State.defaultFShaderId = rlCompileShader(defaultFShaderCode, GL_FRAGMENT_SHADER);   // Compile default fragment shader
+    // NOTE: Code is kept to compile default shaders on demand and to build cache keys
+    RLGL.State.defaultVShaderCode = defaultVShaderCode;
+    RLGL.State.defaultFShaderCode = defaultFShaderCode;
+    RLGL.State.defaultVShaderId = 0;
+    RLGL.State.defaultFShaderId = 0;
+
+    // Try loading default program from shader cache, vertex/fragment shaders are compiled on demand
+    unsigned long long cacheKey = rlGetShaderCacheKey(defaultVShaderCode, defaultFShaderCode);
+    if (cacheKey != 0) RLGL.State.defaultShaderId = rlLoadShaderProgramCache(cacheKey);
 
-    RLGL.State.defaultShaderId = rlLoadShaderProgram(RLGL.State.defaultVShaderId, RLGL.State.defaultFShaderId);
+    if (RLGL.State.defaultShaderId == 0)
+    {
+        double startTime = (RLGL.ShaderCache.getTime != NULL)? RLGL.ShaderCache.getTime() : 0.0;
+
+        // NOTE: Compiled vertex/fragment shaders are not deleted,
+        // they are kept for re-use as default shaders in case some shader loading fails
+        RLGL.State.defaultVShaderId = rlCompileShader(defaultVShaderCode, GL_VERTEX_SHADER);     // Compile default vertex shader
+        RLGL.State.defaultFShaderId = rlCompileShader(defaultFShaderCode, GL_FRAGMENT_SHADER);   // Compile default fragment shader
+
+        RLGL.State.defaultShaderId = rlLoadShaderProgram(RLGL.State.defaultVShaderId, RLGL.State.defaultFShaderId);
+
+        if ((RLGL.State.defaultShaderId > 0) && (cacheKey != 0))
+        {
+            float compileTime = (RLGL.ShaderCache.getTime != NULL)? (float)((RLGL.ShaderCache.getTime() - startTime)*1000.0) : 0.0f;
+            rlSaveShaderProgramCache(RLGL.State.defaultShaderId, cacheKey, compileTime);
+        }
+    }
 
     if (RLGL.State.defaultShaderId > 0)
     {
@@ -4674,12 +5840,19 @@ static void rlLoadShaderDefault(void)
 // NOTE: Unloads: RLGL.State.defaultShaderId, RLGL.State.defaultShaderLocs
 static void rlUnloadShaderDefault(void)
 {
-    glUseProgram(0);
+    rlStateForgetProgram(RLGL.State.defaultShaderId);
 
-    glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultVShaderId);
-    glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultFShaderId);
-    glDeleteShader(RLGL.State.defaultVShaderId);
-    glDeleteShader(RLGL.State.defaultFShaderId);
+    // NOTE: Default vertex/fragment shaders could not be compiled (program loaded from cache)
+    if (RLGL.State.defaultVShaderId > 0)
+    {
+        glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultVShaderId);
+        glDeleteShader(RLGL.State.defaultVShaderId);
+    }
+    if (RLGL.State.defaultFShaderId > 0)
+    {
+        glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultFShaderId);
+        glDeleteShader(RLGL.State.defaultFShaderId);
+    }
 
     glDeleteProgram(RLGL.State.defaultShaderId);
 
@@ -4688,6 +5861,300 @@ static void rlUnloadShaderDefault(void)
     TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default shader unloaded successfully", RLGL.State.defaultShaderId);
 }
 
+// Get default vertex/fragment shader, compiled on demand
+// NOTE: Default shaders are not compiled if default program was loaded from cache
+static unsigned int rlGetShaderDefaultObject(int type)
+{
+    if (type == GL_VERTEX_SHADER)
+    {
+        if (RLGL.State.defaultVShaderId == 0) RLGL.State.defaultVShaderId = rlCompileShader(RLGL.State.defaultVShaderCode, GL_VERTEX_SHADER);
+        return RLGL.State.defaultVShaderId;
+    }
+    else
+    {
+        if (RLGL.State.defaultFShaderId == 0) RLGL.State.defaultFShaderId = rlCompileShader(RLGL.State.defaultFShaderCode, GL_FRAGMENT_SHADER);
+        return RLGL.State.defaultFShaderId;
+    }
+}
+
+// Get program cache key, 64-bit FNV-1a hash of shaders code and GL renderer/version strings
+// NOTE: Returns 0 if shader cache is not set or program binaries are not supported
+static unsigned long long rlGetShaderCacheKey(const char *vsCode, const char *fsCode)
+{
+    if ((RLGL.ShaderCache.load == NULL) || !RLGL.ExtSupported.programBinary) return 0;
+
+    const char *strings[4] = { vsCode, fsCode, (const char *)glGetString(GL_RENDERER), (const char *)glGetString(GL_VERSION) };
+    unsigned long long hash = 14695981039346656037ULL;
+
+    for (int i = 0; i < 4; i++)
+    {
+        if (strings[i] != NULL)
+        {
+            for (const unsigned char *c = (const unsigned char *)strings[i]; *c != '\0'; c++)
+            {
+                hash ^= *c;
+                hash *= 1099511628211ULL;
+            }
+        }
+
+        // Separator, so code moved between strings changes the key
+        hash ^= 0xff;
+        hash *= 1099511628211ULL;
+    }
+
+    return (hash == 0)? 1 : hash;
+}
+
+// Load program from binary cache
+// NOTE: Returns 0 if binary is not cached or rejected by driver (i.e. driver update), program must be compiled from code
+static unsigned int rlLoadShaderProgramCache(unsigned long long key)
+{
+    unsigned int program = 0;
+
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    double startTime = (RLGL.ShaderCache.getTime != NULL)? RLGL.ShaderCache.getTime() : 0.0;
+    rlShaderCacheHeader header = { 0 };
+    int dataSize = 0;
+    unsigned char *data = RLGL.ShaderCache.load(key, &dataSize);
+
+    if (data != NULL)
+    {
+        if (dataSize > (int)sizeof(rlShaderCacheHeader)) memcpy(&header, data, sizeof(rlShaderCacheHeader));
+
+        if ((header.magic == RL_SHADER_CACHE_MAGIC) && (header.size == (dataSize - (int)sizeof(rlShaderCacheHeader))))
+        {
+            GLint success = 0;
+            program = glCreateProgram();
+            glProgramBinary(program, header.format, data + sizeof(rlShaderCacheHeader), header.size);
+            glGetProgramiv(program, GL_LINK_STATUS, &success);
+
+            if (success == GL_FALSE)
+            {
+                TRACELOG(RL_LOG_WARNING, "SHADER: [%016llx] Cached program binary rejected, compiling from code", key);
+                glDeleteProgram(program);
+                program = 0;
+            }
+        }
+        else TRACELOG(RL_LOG_WARNING, "SHADER: [%016llx] Cached program data not valid, compiling from code", key);
+
+        RL_FREE(data);
+    }
+
+    if (program > 0)
+    {
+        float loadTime = (RLGL.ShaderCache.getTime != NULL)? (float)((RLGL.ShaderCache.getTime() - startTime)*1000.0) : 0.0f;
+        float timeSaved = (header.compileTime > loadTime)? (header.compileTime - loadTime) : 0.0f;
+
+        RLGL.ShaderCache.hits++;
+        RLGL.ShaderCache.timeSaved += timeSaved;
+
+        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Program loaded from cache (%.2f ms, %.2f ms saved)", program, loadTime, timeSaved);
+    }
+    else RLGL.ShaderCache.misses++;
+#endif
+
+    return program;
+}
+
+// Save program binary to cache
+static void rlSaveShaderProgramCache(unsigned int id, unsigned long long key, float compileTime)
+{
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.ShaderCache.save == NULL) return;
+
+    GLint binarySize = 0;
+    glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &binarySize);
+
+    if (binarySize > 0)
+    {
+        unsigned char *data = (unsigned char *)RL_MALLOC(sizeof(rlShaderCacheHeader) + binarySize);
+        rlShaderCacheHeader header = { 0 };
+        GLsizei length = 0;
+        GLenum format = 0;
+
+        glGetProgramBinary(id, binarySize, &length, &format, data + sizeof(rlShaderCacheHeader));
+
+        header.magic = RL_SHADER_CACHE_MAGIC;
+        header.format = format;
+        header.compileTime = compileTime;
+        header.size = length;
+        memcpy(data, &header, sizeof(rlShaderCacheHeader));
+
+        if ((length > 0) && RLGL.ShaderCache.save(key, data, (int)sizeof(rlShaderCacheHeader) + length))
+        {
+            TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Program binary cached (%i bytes, %.2f ms compile)", id, length, compileTime);
+        }
+
+        RL_FREE(data);
+    }
+#endif
+}
+
+// Load SDF shapes batch (shader and buffers)
+// NOTE: Instanced drawing is used if supported, otherwise shapes are expanded to vertex on drawing
+// NOTE: Loaded: RLGL.ShapeBatch
+static void rlLoadShapeBatch(void)
+{
+    // Vertex shader: unit quad scaled to shape size, extended by one pixel for anti-aliasing
+    // NOTE: Pixel size is computed from mvp scale and viewport size (valid for 2D drawing)
+    const char *shapeVShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "attribute vec2 shapeCorner;        \n"
+    "attribute vec4 shapeRect;          \n"
+    "attribute vec3 shapeParams;        \n"
+    "attribute vec4 shapeColor;         \n"
+    "varying vec2 fragPosition;         \n"
+    "varying vec4 fragShape;            \n"
+    "varying float fragPixelSize;       \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 shapeCorner;               \n"
+    "in vec4 shapeRect;                 \n"
+    "in vec3 shapeParams;               \n"
+    "in vec4 shapeColor;                \n"
+    "out vec2 fragPosition;             \n"
+    "out vec4 fragShape;                \n"
+    "out float fragPixelSize;           \n"
+    "out vec4 fragColor;                \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision highp float;             \n"
+    "attribute vec2 shapeCorner;        \n"
+    "attribute vec4 shapeRect;          \n"
+    "attribute vec3 shapeParams;        \n"
+    "attribute vec4 shapeColor;         \n"
+    "varying vec2 fragPosition;         \n"
+    "varying vec4 fragShape;            \n"
+    "varying float fragPixelSize;       \n"
+    "varying vec4 fragColor;            \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "uniform vec2 viewport;             \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec2 scale = 0.5*viewport*vec2(length(mvp[0].xy), length(mvp[1].xy)); \n"
+    "    fragPixelSize = 1.0/max(min(scale.x, scale.y), 0.0001); \n"
+    "    fragPosition = shapeCorner*(shapeRect.zw + fragPixelSize); \n"
+    "    fragShape = vec4(shapeRect.zw, shapeParams.xy); \n"
+    "    fragColor = shapeColor;        \n"
+    "    gl_Position = mvp*vec4(shapeRect.xy + fragPosition, shapeParams.z, 1.0); \n"
+    "}                                  \n";
+
+    // Fragment shader: rounded box signed distance, outline if thickness > 0, coverage as alpha
+    const char *shapeFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "varying vec2 fragPosition;         \n"
+    "varying vec4 fragShape;            \n"
+    "varying float fragPixelSize;       \n"
+    "varying vec4 fragColor;            \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec2 q = abs(fragPosition) - fragShape.xy + fragShape.z; \n"
+    "    float dist = min(max(q.x, q.y), 0.0) + length(max(q, 0.0)) - fragShape.z; \n"
+    "    if (fragShape.w > 0.0) dist = abs(dist + 0.5*fragShape.w) - 0.5*fragShape.w; \n"
+    "    float coverage = clamp(0.5 - dist/fragPixelSize, 0.0, 1.0); \n"
+    "    gl_FragColor = vec4(fragColor.rgb, fragColor.a*coverage); \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 fragPosition;              \n"
+    "in vec4 fragShape;                 \n"
+    "in float fragPixelSize;            \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec2 q = abs(fragPosition) - fragShape.xy + fragShape.z; \n"
+    "    float dist = min(max(q.x, q.y), 0.0) + length(max(q, 0.0)) - fragShape.z; \n"
+    "    if (fragShape.w > 0.0) dist = abs(dist + 0.5*fragShape.w) - 0.5*fragShape.w; \n"
+    "    float coverage = clamp(0.5 - dist/fragPixelSize, 0.0, 1.0); \n"
+    "    finalColor = vec4(fragColor.rgb, fragColor.a*coverage); \n"
+    "}                                  \n";
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "#ifdef GL_FRAGMENT_PRECISION_HIGH  \n"
+    "precision highp float;             \n"     // Distances in pixels require more than mediump on big screens
+    "#else                              \n"
+    "precision mediump float;           \n"
+    "#endif                             \n"
+    "varying vec2 fragPosition;         \n"
+    "varying vec4 fragShape;            \n"
+    "varying float fragPixelSize;       \n"
+    "varying vec4 fragColor;            \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec2 q = abs(fragPosition) - fragShape.xy + fragShape.z; \n"
+    "    float dist = min(max(q.x, q.y), 0.0) + length(max(q, 0.0)) - fragShape.z; \n"
+    "    if (fragShape.w > 0.0) dist = abs(dist + 0.5*fragShape.w) - 0.5*fragShape.w; \n"
+    "    float coverage = clamp(0.5 - dist/fragPixelSize, 0.0, 1.0); \n"
+    "    gl_FragColor = vec4(fragColor.rgb, fragColor.a*coverage); \n"
+    "}                                  \n";
+#endif
+
+    unsigned int shaderId = rlLoadShaderCode(shapeVShaderCode, shapeFShaderCode);
+
+    // NOTE: On failure, rlLoadShaderCode() returns the default shader, not valid for SDF shapes
+    if ((shaderId == 0) || (shaderId == RLGL.State.defaultShaderId))
+    {
+        TRACELOG(RL_LOG_WARNING, "RLGL: Failed to load SDF shapes shader, shapes will be tessellated");
+        return;
+    }
+
+    RLGL.ShapeBatch.shaderId = shaderId;
+    RLGL.ShapeBatch.locCorner = glGetAttribLocation(shaderId, "shapeCorner");
+    RLGL.ShapeBatch.locRect = glGetAttribLocation(shaderId, "shapeRect");
+    RLGL.ShapeBatch.locParams = glGetAttribLocation(shaderId, "shapeParams");
+    RLGL.ShapeBatch.locColor = glGetAttribLocation(shaderId, "shapeColor");
+    RLGL.ShapeBatch.locMvp = glGetUniformLocation(shaderId, "mvp");
+    RLGL.ShapeBatch.locViewport = glGetUniformLocation(shaderId, "viewport");
+
+    RLGL.ShapeBatch.instances = (rlShapeInstance *)RL_MALLOC(RL_DEFAULT_SHAPE_BATCH_INSTANCES*sizeof(rlShapeInstance));
+    RLGL.ShapeBatch.instanceCount = 0;
+
+    if (RLGL.ExtSupported.instancing)
+    {
+        RLGL.ShapeBatch.cornerVboId = rlLoadVertexBuffer(rlShapeQuadCorners, sizeof(rlShapeQuadCorners), false);
+        RLGL.ShapeBatch.vboId = rlLoadVertexBuffer(NULL, RL_DEFAULT_SHAPE_BATCH_INSTANCES*sizeof(rlShapeInstance), true);
+    }
+    else
+    {
+        RLGL.ShapeBatch.vertices = (rlShapeVertex *)RL_MALLOC(RL_DEFAULT_SHAPE_BATCH_INSTANCES*6*sizeof(rlShapeVertex));
+        RLGL.ShapeBatch.vboId = rlLoadVertexBuffer(NULL, RL_DEFAULT_SHAPE_BATCH_INSTANCES*6*sizeof(rlShapeVertex), true);
+    }
+
+    rlStateBindArrayBuffer(0);
+
+    TRACELOG(RL_LOG_INFO, "RLGL: SDF shapes batch loaded successfully in RAM (CPU) and VRAM (GPU) (%s)", RLGL.ExtSupported.instancing? "instanced" : "expanded vertex");
+}
+
+// Unload SDF shapes batch
+// NOTE: Unloads: RLGL.ShapeBatch
+static void rlUnloadShapeBatch(void)
+{
+    if (RLGL.ShapeBatch.shaderId == 0) return;
+
+    rlStateForgetBuffer(RLGL.ShapeBatch.vboId);
+    rlStateForgetBuffer(RLGL.ShapeBatch.cornerVboId);
+    rlStateForgetProgram(RLGL.ShapeBatch.shaderId);
+
+    glDeleteBuffers(1, &RLGL.ShapeBatch.vboId);
+    if (RLGL.ShapeBatch.cornerVboId != 0) glDeleteBuffers(1, &RLGL.ShapeBatch.cornerVboId);
+    glDeleteProgram(RLGL.ShapeBatch.shaderId);
+
+    RL_FREE(RLGL.ShapeBatch.instances);
+    RL_FREE(RLGL.ShapeBatch.vertices);
+
+    RLGL.ShapeBatch.shaderId = 0;
+    RLGL.ShapeBatch.instanceCount = 0;
+
+    TRACELOG(RL_LOG_INFO, "RLGL: SDF shapes batch unloaded successfully from RAM (CPU) and VRAM (GPU)");
+}
+
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 // Get compressed format official GL identifier name
 static const char *rlGetCompressedFormatName(int format)
@@ -4815,6 +6282,33 @@ static int rlGetPixelDataSize(int width, int height, int format)
     return dataSize;
 }
 
+// Copy RGBA pixels setting alpha to 255, dst and src can be the same buffer
+static void rlCopyPixelsOpaque(unsigned char *dst, const unsigned char *src, int count)
+{
+    int i = 0;
+
+#if defined(RLGL_SIMD_NEON) || defined(RLGL_SIMD_SSE)
+    static const unsigned char alphaMask[16] = { 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0, 255 };
+#endif
+#if defined(RLGL_SIMD_NEON)
+    uint8x16_t alpha = vld1q_u8(alphaMask);
+
+    for (; (i + 4) <= count; i += 4) vst1q_u8(dst + 4*i, vorrq_u8(vld1q_u8(src + 4*i), alpha));
+#elif defined(RLGL_SIMD_SSE)
+    // NOTE: Float bitwise operations, no arithmetic involved so any bit pattern is preserved
+    __m128 alpha = _mm_loadu_ps((const float *)alphaMask);
+
+    for (; (i + 4) <= count; i += 4) _mm_storeu_ps((float *)(dst + 4*i), _mm_or_ps(_mm_loadu_ps((const float *)(src + 4*i)), alpha));
+#endif
+    for (; i < count; i++)
+    {
+        dst[4*i] = src[4*i];
+        dst[4*i + 1] = src[4*i + 1];
+        dst[4*i + 2] = src[4*i + 2];
+        dst[4*i + 3] = 255;
+    }
+}
+
 // Auxiliar math functions
 
 // Get identity matrix
@@ -132,6 +132,9 @@
 #ifndef MAX_MESH_VERTEX_BUFFERS
     #define MAX_MESH_VERTEX_BUFFERS  7    // Maximum vertex buffers (VBO) per mesh
 #endif
+#ifndef RAY_COLLISION_BATCH_TRIANGLES
+    #define RAY_COLLISION_BATCH_TRIANGLES  64   // Mesh triangles transformed per batch by GetRayCollisionMesh()
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -3772,36 +3775,32 @@ RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform)
     if (mesh.vertices != NULL)
     {
         int triangleCount = mesh.triangleCount;
+        Vector3 *vertdata = (Vector3 *)mesh.vertices;
+
+        // Triangles vertices are gathered and transformed in batches (Vector3TransformArray() is vectorized)
+        Vector3 vertices[RAY_COLLISION_BATCH_TRIANGLES*3] = { 0 };
 
         // Test against all triangles in mesh
-        for (int i = 0; i < triangleCount; i++)
+        for (int i = 0; i < triangleCount; i += RAY_COLLISION_BATCH_TRIANGLES)
         {
-            Vector3 a, b, c;
-            Vector3* vertdata = (Vector3*)mesh.vertices;
+            int count = ((triangleCount - i) < RAY_COLLISION_BATCH_TRIANGLES)? (triangleCount - i) : RAY_COLLISION_BATCH_TRIANGLES;
 
             if (mesh.indices)
             {
-                a = vertdata[mesh.indices[i*3 + 0]];
-                b = vertdata[mesh.indices[i*3 + 1]];
-                c = vertdata[mesh.indices[i*3 + 2]];
-            }
-            else
-            {
-                a = vertdata[i*3 + 0];
-                b = vertdata[i*3 + 1];
-                c = vertdata[i*3 + 2];
+                for (int k = 0; k < count*3; k++) vertices[k] = vertdata[mesh.indices[i*3 + k]];
+                Vector3TransformArray(vertices, vertices, count*3, transform);
             }
+            else Vector3TransformArray(vertdata + i*3, vertices, count*3, transform);
 
-            a = Vector3Transform(a, transform);
-            b = Vector3Transform(b, transform);
-            c = Vector3Transform(c, transform);
-
-            RayCollision triHitInfo = GetRayCollisionTriangle(ray, a, b, c);
-
-            if (triHitInfo.hit)
+            for (int k = 0; k < count; k++)
             {
-                // Save the closest hit triangle
-                if ((!collision.hit) || (collision.distance > triHitInfo.distance)) collision = triHitInfo;
+                RayCollision triHitInfo = GetRayCollisionTriangle(ray, vertices[k*3], vertices[k*3 + 1], vertices[k*3 + 2]);
+
+                if (triHitInfo.hit)
+                {
+                    // Save the closest hit triangle
+                    if ((!collision.hit) || (collision.distance > triHitInfo.distance)) collision = triHitInfo;
+                }
             }
         }
     }
@@ -4052,9 +4051,8 @@ static Model LoadIQM(const char *fileName)
     #define MESH_NAME_LENGTH    32          // Mesh name string length
     #define MATERIAL_NAME_LENGTH 32         // Material name string length
 
-    int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
-    unsigned char *fileDataPtr = fileData;
+    FileView view = LoadFileView(fileName);
+    const unsigned char *fileDataPtr = view.data;
 
     // IQM file structs
     //-----------------------------------------------------------------------------------
@@ -4157,17 +4155,19 @@ static Model LoadIQM(const char *fileName)
     if (fileDataPtr == NULL) return model;
 
     // Read IQM header
-    IQMHeader *iqmHeader = (IQMHeader *)fileDataPtr;
+    const IQMHeader *iqmHeader = (const IQMHeader *)fileDataPtr;
 
     if (memcmp(iqmHeader->magic, IQM_MAGIC, sizeof(IQM_MAGIC)) != 0)
     {
         TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file is not a valid model", fileName);
+        UnloadFileView(view);
         return model;
     }
 
     if (iqmHeader->version != IQM_VERSION)
     {
         TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file version not supported (%i)", fileName, iqmHeader->version);
+        UnloadFileView(view);
         return model;
     }
 
@@ -4397,7 +4397,7 @@ static Model LoadIQM(const char *fileName)
 
     BuildPoseFromParentJoints(model.bones, model.boneCount, model.bindPose);
 
-    RL_FREE(fileData);
+    UnloadFileView(view);
 
     RL_FREE(imesh);
     RL_FREE(tri);
@@ -4419,9 +4419,8 @@ static ModelAnimation *LoadModelAnimationsIQM(const char *fileName, int *animCou
     #define IQM_MAGIC       "INTERQUAKEMODEL"   // IQM file magic number
     #define IQM_VERSION     2                   // only IQM version 2 supported
 
-    int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
-    unsigned char *fileDataPtr = fileData;
+    FileView view = LoadFileView(fileName);
+    const unsigned char *fileDataPtr = view.data;
 
     typedef struct IQMHeader {
         char magic[16];
@@ -4464,17 +4463,19 @@ static ModelAnimation *LoadModelAnimationsIQM(const char *fileName, int *animCou
     if (fileDataPtr == NULL) return NULL;
 
     // Read IQM header
-    IQMHeader *iqmHeader = (IQMHeader *)fileDataPtr;
+    const IQMHeader *iqmHeader = (const IQMHeader *)fileDataPtr;
 
     if (memcmp(iqmHeader->magic, IQM_MAGIC, sizeof(IQM_MAGIC)) != 0)
     {
         TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file is not a valid model", fileName);
+        UnloadFileView(view);
         return NULL;
     }
 
     if (iqmHeader->version != IQM_VERSION)
     {
         TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file version not supported (%i)", fileName, iqmHeader->version);
+        UnloadFileView(view);
         return NULL;
     }
 
@@ -4629,7 +4630,7 @@ static ModelAnimation *LoadModelAnimationsIQM(const char *fileName, int *animCou
         }
     }
 
-    RL_FREE(fileData);
+    UnloadFileView(view);
 
     RL_FREE(joints);
     RL_FREE(framedata);
@@ -4785,16 +4786,16 @@ static Model LoadGLTF(const char *fileName)
 
     Model model = { 0 };
 
-    // glTF file loading
-    int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    // glTF file loading (memory-mapped, no copy)
+    // NOTE: glb binary chunk buffer is not copied, it points to file view data
+    FileView view = LoadFileView(fileName);
 
-    if (fileData == NULL) return model;
+    if (view.data == NULL) return model;
 
     // glTF data loading
     cgltf_options options = { 0 };
     cgltf_data *data = NULL;
-    cgltf_result result = cgltf_parse(&options, fileData, dataSize, &data);
+    cgltf_result result = cgltf_parse(&options, view.data, view.size, &data);
 
     if (result == cgltf_result_success)
     {
@@ -5204,7 +5205,7 @@ static Model LoadGLTF(const char *fileName)
     else TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load glTF data", fileName);
 
     // WARNING: cgltf requires the file pointer available while reading data
-    UnloadFileData(fileData);
+    UnloadFileView(view);
 
     return model;
 }
@@ -5268,20 +5269,20 @@ static bool GetPoseAtTimeGLTF(cgltf_accessor *input, cgltf_accessor *output, flo
 
 static ModelAnimation *LoadModelAnimationsGLTF(const char *fileName, int *animCount)
 {
-    // glTF file loading
-    int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    // glTF file loading (memory-mapped, no copy)
+    FileView view = LoadFileView(fileName);
 
     ModelAnimation *animations = NULL;
 
     // glTF data loading
     cgltf_options options = { 0 };
     cgltf_data *data = NULL;
-    cgltf_result result = cgltf_parse(&options, fileData, dataSize, &data);
+    cgltf_result result = cgltf_parse(&options, view.data, view.size, &data);
 
     if (result != cgltf_result_success)
     {
         TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load glTF data", fileName);
+        UnloadFileView(view);
         *animCount = 0;
         return NULL;
     }
@@ -5424,7 +5425,7 @@ static ModelAnimation *LoadModelAnimationsGLTF(const char *fileName, int *animCo
 
         cgltf_free(data);
     }
-    UnloadFileData(fileData);
+    UnloadFileView(view);
     return animations;
 }
 #endif
@@ -5438,11 +5439,10 @@ static Model LoadVOX(const char *fileName)
     int nbvertices = 0;
     int meshescount = 0;
 
-    // Read vox file into buffer
-    int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    // Read vox file view (memory-mapped, no copy)
+    FileView view = LoadFileView(fileName);
 
-    if (fileData == 0)
+    if (view.data == NULL)
     {
         TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load VOX file", fileName);
         return model;
@@ -5450,12 +5450,13 @@ static Model LoadVOX(const char *fileName)
 
     // Read and build voxarray description
     VoxArray3D voxarray = { 0 };
-    int ret = Vox_LoadFromMemory(fileData, dataSize, &voxarray);
+    // NOTE: VOX loader only reads file data
+    int ret = Vox_LoadFromMemory((unsigned char *)view.data, view.size, &voxarray);
 
     if (ret != VOX_SUCCESS)
     {
         // Error
-        UnloadFileData(fileData);
+        UnloadFileView(view);
 
         TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load VOX data", fileName);
         return model;
@@ -5527,7 +5528,7 @@ static Model LoadVOX(const char *fileName)
 
     // Free buffers
     Vox_FreeArrays(&voxarray);
-    UnloadFileData(fileData);
+    UnloadFileView(view);
 
     return model;
 }
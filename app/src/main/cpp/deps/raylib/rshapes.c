@@ -21,6 +21,14 @@
 *
 *       #define SUPPORT_QUADS_DRAW_MODE
 *           Use QUADS instead of TRIANGLES for drawing when possible. Lines-based shapes still use LINES
+*       #define SUPPORT_SDF_SHAPES
+*           Draw rounded rectangles, circles and rings with *SDF() functions as a single quad per shape,
+*           anti-aliased analytically in the fragment shader, no tessellation or MSAA required
+*       #define SUPPORT_SHAPES_CULLING
+*           Skip shapes completely outside viewport and scissor area before tessellation
+*       #define SUPPORT_SHAPES_FEATHER
+*           Anti-alias lines and splines with alpha-feathered edge strips, enabled with SetShapesFeather(),
+*           thick lines look smooth with no MSAA required
 *
 *
 *   LICENSE: zlib/libpng
@@ -55,7 +63,7 @@
 
 #include "rlgl.h"       // OpenGL abstraction layer to OpenGL 1.1, 2.1, 3.3+ or ES2
 
-#include <math.h>       // Required for: sinf(), asinf(), cosf(), acosf(), sqrtf(), fabsf()
+#include <math.h>       // Required for: sinf(), asinf(), cosf(), acosf(), sqrtf(), fabsf(), fmodf(), cos(), sin()
 #include <float.h>      // Required for: FLT_EPSILON
 #include <stdlib.h>     // Required for: RL_FREE
 
@@ -68,14 +76,69 @@
     #define SMOOTH_CIRCLE_ERROR_RATE    0.5f      // Circle error rate
 #endif
 #ifndef SPLINE_SEGMENT_DIVISIONS
-    #define SPLINE_SEGMENT_DIVISIONS      24      // Spline segment divisions
+    #define SPLINE_SEGMENT_DIVISIONS      24      // Spline segment divisions: DrawSplineBasis(), DrawLineBezier()
+#endif
+#ifndef TRIANGLE_STRIP_CHUNK_TRIANGLES
+    #define TRIANGLE_STRIP_CHUNK_TRIANGLES  64    // Triangles expanded per bulk vertex submission: DrawTriangleStrip()
+#endif
+#ifndef MAX_CIRCLE_SEGMENTS
+    #define MAX_CIRCLE_SEGMENTS         1024      // Maximum segments per circular arc
+#endif
+#ifndef CIRCLE_TABLE_CACHE_SIZE
+    #define CIRCLE_TABLE_CACHE_SIZE       16      // Maximum unit circle tables cached, keyed by segment count
+#endif
+#ifndef CIRCLE_TABLE_POOL_SIZE
+    #define CIRCLE_TABLE_POOL_SIZE      4096      // Vertex storage shared by all cached unit circle tables
+#endif
+#ifndef SPLINE_FLATTEN_TOLERANCE
+    #define SPLINE_FLATTEN_TOLERANCE    0.1f      // Curved splines flattening maximum distance to the curve
+#endif
+#ifndef SPLINE_SEGMENT_MAX_DIVISIONS
+    #define SPLINE_SEGMENT_MAX_DIVISIONS  128     // Curved splines maximum divisions per segment
+#endif
+#ifndef STROKE_CHUNK_VERTICES
+    #define STROKE_CHUNK_VERTICES        288      // Stroke vertex submitted per bulk submission (multiple of 3)
+#endif
+#ifndef STROKE_MITER_LIMIT
+    #define STROKE_MITER_LIMIT          4.0f      // Stroke joins miter length limit, relative to thickness
 #endif
 
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// Not here...
+// Unit circle tables cache, avoids per-vertex sinf()/cosf() on circular shapes tessellation
+typedef struct CircleCache {
+    int tableCount;                                 // Number of cached tables
+    int tableDivisions[CIRCLE_TABLE_CACHE_SIZE];    // Full circle divisions of every cached table
+    int tableOffset[CIRCLE_TABLE_CACHE_SIZE];       // Start of every cached table in pool
+    int poolUsed;                                   // Pool vertex used by cached tables
+    Vector2 pool[CIRCLE_TABLE_POOL_SIZE];           // Tables storage, every table covers two turns
+    Vector2 arc[MAX_CIRCLE_SEGMENTS + 1];           // Arc not aligned to any table divisions
+    bool segmentsReady;                             // Segments radius thresholds computed
+    float segmentsRadius[MAX_CIRCLE_SEGMENTS + 1];  // Maximum radius for a number of segments per full circle
+} CircleCache;
+
+// Stroke, polyline expanded into a joined strip, with two alpha-feathered edge strips if feathered
+// NOTE: Points are streamed, a segment is emitted once the join at its end is known
+typedef struct Stroke {
+    float innerWidth;               // Core half width, full alpha
+    float outerWidth;               // Feathered edge half width, zero alpha (equal to innerWidth if not feathered)
+    float feather;                  // Feather width, 0 for hard edges
+    bool roundCaps;                 // Round caps (or butt caps)
+    Color color;                    // Stroke color
+    unsigned char coreAlpha;        // Core alpha, reduced for strokes thinner than feather
+
+    int pointCount;                 // Points streamed, after removing duplicates
+    Vector2 start;                  // Current segment start point
+    Vector2 end;                    // Current segment end point
+    Vector2 direction;              // Current segment direction (normalized)
+    Vector2 startOffset;            // Current segment start join offset (unit width)
+
+    int vertexCount;                                // Vertex waiting for submission
+    float positions[STROKE_CHUNK_VERTICES*2];       // Vertex positions
+    unsigned char colors[STROKE_CHUNK_VERTICES*4];  // Vertex colors
+} Stroke;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -83,10 +146,31 @@
 Texture2D texShapes = { 1, 1, 1, 1, 7 };                // Texture used on shapes drawing (white pixel loaded by rlgl)
 Rectangle texShapesRec = { 0.0f, 0.0f, 1.0f, 1.0f };    // Texture source rectangle used on shapes drawing
 
+static CircleCache circleCache = { 0 };                 // Unit circle tables for circular shapes
+static float shapesFeather = 0.0f;                      // Lines and splines anti-aliasing feather width, 0 disables it
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 static float EaseCubicInOut(float t, float b, float c, float d);    // Cubic easing
+static int GetCircleSegments(float radius);                         // Get segments required by a full circle to keep SMOOTH_CIRCLE_ERROR_RATE
+static const Vector2 *GetCircleTable(int divisions);                // Get cached unit circle table for a number of divisions
+static const Vector2 *GetCircleArc(float startAngle, float endAngle, int segments);  // Get unit vectors of arc segments boundaries
+static void StrokeFlush(Stroke *stroke);                                            // Submit stroke vertex waiting in buffer
+static void StrokeTriangle(Stroke *stroke, Vector2 a, unsigned char alphaA, Vector2 b, unsigned char alphaB, Vector2 c, unsigned char alphaC);  // Add a triangle to stroke
+static void StrokeQuad(Stroke *stroke, Vector2 a, Vector2 b, unsigned char alphaAB, Vector2 c, Vector2 d, unsigned char alphaCD);             // Add a quad to stroke
+static void StrokeSegment(Stroke *stroke, Vector2 start, Vector2 startOffset, Vector2 end, Vector2 endOffset);  // Add stroke segment
+static void StrokeCap(Stroke *stroke, Vector2 point, Vector2 direction);            // Add stroke cap
+static void StrokeBevel(Stroke *stroke, Vector2 point, Vector2 fromOffset, Vector2 toOffset);  // Add stroke bevel join
+static void StrokeBegin(Stroke *stroke, float thick, float feather, bool roundCaps, Color color);  // Begin stroke
+static void StrokePoint(Stroke *stroke, Vector2 point);                             // Add point to stroke
+static void StrokeEnd(Stroke *stroke);                                              // End stroke, emitting last segment and caps
+static void StrokeBezierQuadratic(Stroke *stroke, Vector2 p1, Vector2 c2, Vector2 p3);             // Add quadratic Bezier to stroke, flattened adaptively
+static void StrokeBezierCubic(Stroke *stroke, Vector2 p1, Vector2 c2, Vector2 c3, Vector2 p4);     // Add cubic Bezier to stroke, flattened adaptively
+static void StrokeCatmullRom(Stroke *stroke, Vector2 p1, Vector2 p2, Vector2 p3, Vector2 p4);      // Add Catmull-Rom segment to stroke, flattened adaptively
+#if defined(SUPPORT_SHAPES_CULLING)
+static bool CheckCulledPoints(const Vector2 *points, int pointCount, float margin, float overshoot);  // Check if points bounds are culled
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -112,6 +196,16 @@ void SetShapesTexture(Texture2D texture, Rectangle source)
     }
 }
 
+// Set feather width for lines and splines anti-aliasing, 0 disables it (default)
+// NOTE: Feather is the width of the edge alpha ramp, in units of the current transform,
+// 1.0f gives smooth edges for 2d drawing at screen scale with no MSAA required
+void SetShapesFeather(float feather)
+{
+#if defined(SUPPORT_SHAPES_FEATHER)
+    shapesFeather = (feather > 0.0f)? feather : 0.0f;
+#endif
+}
+
 // Draw a pixel
 void DrawPixel(int posX, int posY, Color color)
 {
@@ -244,6 +338,18 @@ void DrawLineEx(Vector2 startPos, Vector2 endPos, float thick, Color color)
 
     if ((length > 0) && (thick > 0))
     {
+#if defined(SUPPORT_SHAPES_FEATHER)
+        if (shapesFeather > 0.0f)
+        {
+            Stroke stroke = { 0 };
+
+            StrokeBegin(&stroke, thick, shapesFeather, false, color);
+            StrokePoint(&stroke, startPos);
+            StrokePoint(&stroke, endPos);
+            StrokeEnd(&stroke);
+            return;
+        }
+#endif
         float scale = thick/(2*length);
 
         Vector2 radius = { -scale*delta.y, scale*delta.x };
@@ -276,6 +382,10 @@ void DrawCircleSector(Vector2 center, float radius, float startAngle, float endA
 {
     if (radius <= 0.0f) radius = 0.1f;  // Avoid div by zero
 
+#if defined(SUPPORT_SHAPES_CULLING)
+    if (rlCheckCulledRec(center.x - radius, center.y - radius, 2*radius, 2*radius)) return;
+#endif
+
     // Function expects (endAngle > startAngle)
     if (endAngle < startAngle)
     {
@@ -290,14 +400,14 @@ void DrawCircleSector(Vector2 center, float radius, float startAngle, float endA
     if (segments < minSegments)
     {
         // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
+        segments = (int)((endAngle - startAngle)*GetCircleSegments(radius)/360);
 
         if (segments <= 0) segments = minSegments;
     }
 
-    float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    if (segments > MAX_CIRCLE_SEGMENTS) segments = MAX_CIRCLE_SEGMENTS;
+
+    const Vector2 *arc = GetCircleArc(startAngle, endAngle, segments);
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlSetTexture(texShapes.id);
@@ -313,15 +423,13 @@ void DrawCircleSector(Vector2 center, float radius, float startAngle, float endA
             rlVertex2f(center.x, center.y);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength*2.0f))*radius, center.y + sinf(DEG2RAD*(angle + stepLength*2.0f))*radius);
+            rlVertex2f(center.x + arc[2*i + 2].x*radius, center.y + arc[2*i + 2].y*radius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
+            rlVertex2f(center.x + arc[2*i + 1].x*radius, center.y + arc[2*i + 1].y*radius);
 
             rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
-
-            angle += (stepLength*2.0f);
+            rlVertex2f(center.x + arc[2*i].x*radius, center.y + arc[2*i].y*radius);
         }
 
         // NOTE: In case number of segments is odd, we add one last piece to the cake
@@ -333,10 +441,10 @@ void DrawCircleSector(Vector2 center, float radius, float startAngle, float endA
             rlVertex2f(center.x, center.y);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
+            rlVertex2f(center.x + arc[segments].x*radius, center.y + arc[segments].y*radius);
 
             rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + arc[segments - 1].x*radius, center.y + arc[segments - 1].y*radius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
             rlVertex2f(center.x, center.y);
@@ -352,10 +460,8 @@ void DrawCircleSector(Vector2 center, float radius, float startAngle, float endA
             rlColor4ub(color.r, color.g, color.b, color.a);
 
             rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
-
-            angle += stepLength;
+            rlVertex2f(center.x + arc[i + 1].x*radius, center.y + arc[i + 1].y*radius);
+            rlVertex2f(center.x + arc[i].x*radius, center.y + arc[i].y*radius);
         }
     rlEnd();
 #endif
@@ -366,6 +472,10 @@ void DrawCircleSectorLines(Vector2 center, float radius, float startAngle, float
 {
     if (radius <= 0.0f) radius = 0.1f;  // Avoid div by zero issue
 
+#if defined(SUPPORT_SHAPES_CULLING)
+    if (rlCheckCulledRec(center.x - radius, center.y - radius, 2*radius, 2*radius)) return;
+#endif
+
     // Function expects (endAngle > startAngle)
     if (endAngle < startAngle)
     {
@@ -380,14 +490,14 @@ void DrawCircleSectorLines(Vector2 center, float radius, float startAngle, float
     if (segments < minSegments)
     {
         // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
+        segments = (int)((endAngle - startAngle)*GetCircleSegments(radius)/360);
 
         if (segments <= 0) segments = minSegments;
     }
 
-    float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    if (segments > MAX_CIRCLE_SEGMENTS) segments = MAX_CIRCLE_SEGMENTS;
+
+    const Vector2 *arc = GetCircleArc(startAngle, endAngle, segments);
     bool showCapLines = true;
 
     rlBegin(RL_LINES);
@@ -395,24 +505,22 @@ void DrawCircleSectorLines(Vector2 center, float radius, float startAngle, float
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
             rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + arc[0].x*radius, center.y + arc[0].y*radius);
         }
 
         for (int i = 0; i < segments; i++)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
 
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
-
-            angle += stepLength;
+            rlVertex2f(center.x + arc[i].x*radius, center.y + arc[i].y*radius);
+            rlVertex2f(center.x + arc[i + 1].x*radius, center.y + arc[i + 1].y*radius);
         }
 
         if (showCapLines)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
             rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + arc[segments].x*radius, center.y + arc[segments].y*radius);
         }
     rlEnd();
 }
@@ -421,15 +529,17 @@ void DrawCircleSectorLines(Vector2 center, float radius, float startAngle, float
 // NOTE: Gradient goes from center (color1) to border (color2)
 void DrawCircleGradient(int centerX, int centerY, float radius, Color color1, Color color2)
 {
+    const Vector2 *arc = GetCircleTable(36);
+
     rlBegin(RL_TRIANGLES);
-        for (int i = 0; i < 360; i += 10)
+        for (int i = 0; i < 36; i++)
         {
             rlColor4ub(color1.r, color1.g, color1.b, color1.a);
             rlVertex2f((float)centerX, (float)centerY);
             rlColor4ub(color2.r, color2.g, color2.b, color2.a);
-            rlVertex2f((float)centerX + cosf(DEG2RAD*(i + 10))*radius, (float)centerY + sinf(DEG2RAD*(i + 10))*radius);
+            rlVertex2f((float)centerX + arc[i + 1].x*radius, (float)centerY + arc[i + 1].y*radius);
             rlColor4ub(color2.r, color2.g, color2.b, color2.a);
-            rlVertex2f((float)centerX + cosf(DEG2RAD*i)*radius, (float)centerY + sinf(DEG2RAD*i)*radius);
+            rlVertex2f((float)centerX + arc[i].x*radius, (float)centerY + arc[i].y*radius);
         }
     rlEnd();
 }
@@ -443,14 +553,16 @@ void DrawCircleLines(int centerX, int centerY, float radius, Color color)
 // Draw circle outline (Vector version)
 void DrawCircleLinesV(Vector2 center, float radius, Color color)
 {
+    const Vector2 *arc = GetCircleTable(36);
+
     rlBegin(RL_LINES);
         rlColor4ub(color.r, color.g, color.b, color.a);
 
         // NOTE: Circle outline is drawn pixel by pixel every degree (0 to 360)
-        for (int i = 0; i < 360; i += 10)
+        for (int i = 0; i < 36; i++)
         {
-            rlVertex2f(center.x + cosf(DEG2RAD*i)*radius, center.y + sinf(DEG2RAD*i)*radius);
-            rlVertex2f(center.x + cosf(DEG2RAD*(i + 10))*radius, center.y + sinf(DEG2RAD*(i + 10))*radius);
+            rlVertex2f(center.x + arc[i].x*radius, center.y + arc[i].y*radius);
+            rlVertex2f(center.x + arc[i + 1].x*radius, center.y + arc[i + 1].y*radius);
         }
     rlEnd();
 }
@@ -458,13 +570,15 @@ void DrawCircleLinesV(Vector2 center, float radius, Color color)
 // Draw ellipse
 void DrawEllipse(int centerX, int centerY, float radiusH, float radiusV, Color color)
 {
+    const Vector2 *arc = GetCircleTable(36);
+
     rlBegin(RL_TRIANGLES);
-        for (int i = 0; i < 360; i += 10)
+        for (int i = 0; i < 36; i++)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
             rlVertex2f((float)centerX, (float)centerY);
-            rlVertex2f((float)centerX + cosf(DEG2RAD*(i + 10))*radiusH, (float)centerY + sinf(DEG2RAD*(i + 10))*radiusV);
-            rlVertex2f((float)centerX + cosf(DEG2RAD*i)*radiusH, (float)centerY + sinf(DEG2RAD*i)*radiusV);
+            rlVertex2f((float)centerX + arc[i + 1].x*radiusH, (float)centerY + arc[i + 1].y*radiusV);
+            rlVertex2f((float)centerX + arc[i].x*radiusH, (float)centerY + arc[i].y*radiusV);
         }
     rlEnd();
 }
@@ -472,12 +586,14 @@ void DrawEllipse(int centerX, int centerY, float radiusH, float radiusV, Color c
 // Draw ellipse outline
 void DrawEllipseLines(int centerX, int centerY, float radiusH, float radiusV, Color color)
 {
+    const Vector2 *arc = GetCircleTable(36);
+
     rlBegin(RL_LINES);
-        for (int i = 0; i < 360; i += 10)
+        for (int i = 0; i < 36; i++)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(centerX + cosf(DEG2RAD*(i + 10))*radiusH, centerY + sinf(DEG2RAD*(i + 10))*radiusV);
-            rlVertex2f(centerX + cosf(DEG2RAD*i)*radiusH, centerY + sinf(DEG2RAD*i)*radiusV);
+            rlVertex2f(centerX + arc[i + 1].x*radiusH, centerY + arc[i + 1].y*radiusV);
+            rlVertex2f(centerX + arc[i].x*radiusH, centerY + arc[i].y*radiusV);
         }
     rlEnd();
 }
@@ -511,8 +627,7 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startA
     if (segments < minSegments)
     {
         // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/outerRadius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
+        segments = (int)((endAngle - startAngle)*GetCircleSegments(outerRadius)/360);
 
         if (segments <= 0) segments = minSegments;
     }
@@ -524,8 +639,9 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startA
         return;
     }
 
-    float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    if (segments > MAX_CIRCLE_SEGMENTS) segments = MAX_CIRCLE_SEGMENTS;
+
+    const Vector2 *arc = GetCircleArc(startAngle, endAngle, segments);
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlSetTexture(texShapes.id);
@@ -536,18 +652,16 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startA
             rlColor4ub(color.r, color.g, color.b, color.a);
 
             rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
+            rlVertex2f(center.x + arc[i].x*outerRadius, center.y + arc[i].y*outerRadius);
 
             rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
+            rlVertex2f(center.x + arc[i].x*innerRadius, center.y + arc[i].y*innerRadius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
+            rlVertex2f(center.x + arc[i + 1].x*innerRadius, center.y + arc[i + 1].y*innerRadius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*outerRadius);
-
-            angle += stepLength;
+            rlVertex2f(center.x + arc[i + 1].x*outerRadius, center.y + arc[i + 1].y*outerRadius);
         }
     rlEnd();
 
@@ -558,15 +672,13 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startA
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
 
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
+            rlVertex2f(center.x + arc[i].x*innerRadius, center.y + arc[i].y*innerRadius);
+            rlVertex2f(center.x + arc[i + 1].x*innerRadius, center.y + arc[i + 1].y*innerRadius);
+            rlVertex2f(center.x + arc[i].x*outerRadius, center.y + arc[i].y*outerRadius);
 
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*outerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
-
-            angle += stepLength;
+            rlVertex2f(center.x + arc[i + 1].x*innerRadius, center.y + arc[i + 1].y*innerRadius);
+            rlVertex2f(center.x + arc[i + 1].x*outerRadius, center.y + arc[i + 1].y*outerRadius);
+            rlVertex2f(center.x + arc[i].x*outerRadius, center.y + arc[i].y*outerRadius);
         }
     rlEnd();
 #endif
@@ -601,8 +713,7 @@ void DrawRingLines(Vector2 center, float innerRadius, float outerRadius, float s
     if (segments < minSegments)
     {
         // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/outerRadius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
+        segments = (int)((endAngle - startAngle)*GetCircleSegments(outerRadius)/360);
 
         if (segments <= 0) segments = minSegments;
     }
@@ -613,36 +724,35 @@ void DrawRingLines(Vector2 center, float innerRadius, float outerRadius, float s
         return;
     }
 
-    float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    if (segments > MAX_CIRCLE_SEGMENTS) segments = MAX_CIRCLE_SEGMENTS;
+
+    const Vector2 *arc = GetCircleArc(startAngle, endAngle, segments);
     bool showCapLines = true;
 
     rlBegin(RL_LINES);
         if (showCapLines)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
+            rlVertex2f(center.x + arc[0].x*outerRadius, center.y + arc[0].y*outerRadius);
+            rlVertex2f(center.x + arc[0].x*innerRadius, center.y + arc[0].y*innerRadius);
         }
 
         for (int i = 0; i < segments; i++)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
 
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*outerRadius);
-
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
+            rlVertex2f(center.x + arc[i].x*outerRadius, center.y + arc[i].y*outerRadius);
+            rlVertex2f(center.x + arc[i + 1].x*outerRadius, center.y + arc[i + 1].y*outerRadius);
 
-            angle += stepLength;
+            rlVertex2f(center.x + arc[i].x*innerRadius, center.y + arc[i].y*innerRadius);
+            rlVertex2f(center.x + arc[i + 1].x*innerRadius, center.y + arc[i + 1].y*innerRadius);
         }
 
         if (showCapLines)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
+            rlVertex2f(center.x + arc[segments].x*outerRadius, center.y + arc[segments].y*outerRadius);
+            rlVertex2f(center.x + arc[segments].x*innerRadius, center.y + arc[segments].y*innerRadius);
         }
     rlEnd();
 }
@@ -707,40 +817,33 @@ void DrawRectanglePro(Rectangle rec, Vector2 origin, float rotation, Color color
     }
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
+    float u0 = texShapesRec.x/texShapes.width, v0 = texShapesRec.y/texShapes.height;
+    float u1 = (texShapesRec.x + texShapesRec.width)/texShapes.width, v1 = (texShapesRec.y + texShapesRec.height)/texShapes.height;
+
+    float positions[8] = { topLeft.x, topLeft.y, bottomLeft.x, bottomLeft.y, bottomRight.x, bottomRight.y, topRight.x, topRight.y };
+    float texcoords[8] = { u0, v0, u0, v1, u1, v1, u1, v0 };
+
     rlSetTexture(texShapes.id);
 
     rlBegin(RL_QUADS);
 
         rlNormal3f(0.0f, 0.0f, 1.0f);
         rlColor4ub(color.r, color.g, color.b, color.a);
-
-        rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-        rlVertex2f(topLeft.x, topLeft.y);
-
-        rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-        rlVertex2f(bottomLeft.x, bottomLeft.y);
-
-        rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-        rlVertex2f(bottomRight.x, bottomRight.y);
-
-        rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-        rlVertex2f(topRight.x, topRight.y);
+        rlVertexArray2f(positions, texcoords, NULL, 4);
 
     rlEnd();
 
     rlSetTexture(0);
 #else
+    float positions[12] = {
+        topLeft.x, topLeft.y, bottomLeft.x, bottomLeft.y, topRight.x, topRight.y,
+        topRight.x, topRight.y, bottomLeft.x, bottomLeft.y, bottomRight.x, bottomRight.y
+    };
+
     rlBegin(RL_TRIANGLES);
 
         rlColor4ub(color.r, color.g, color.b, color.a);
-
-        rlVertex2f(topLeft.x, topLeft.y);
-        rlVertex2f(bottomLeft.x, bottomLeft.y);
-        rlVertex2f(topRight.x, topRight.y);
-
-        rlVertex2f(topRight.x, topRight.y);
-        rlVertex2f(bottomLeft.x, bottomLeft.y);
-        rlVertex2f(bottomRight.x, bottomRight.y);
+        rlVertexArray2f(positions, NULL, NULL, 6);
 
     rlEnd();
 #endif
@@ -851,6 +954,10 @@ void DrawRectangleLinesEx(Rectangle rec, float lineThick, Color color)
 // Draw rectangle with rounded edges
 void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color color)
 {
+#if defined(SUPPORT_SHAPES_CULLING)
+    if (rlCheckCulledRec(rec.x, rec.y, rec.width, rec.height)) return;
+#endif
+
     // Not a rounded rectangle
     if ((roundness <= 0.0f) || (rec.width < 1) || (rec.height < 1 ))
     {
@@ -868,12 +975,11 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
     if (segments < 4)
     {
         // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)(ceilf(2*PI/th)/4.0f);
+        segments = (int)(GetCircleSegments(radius)/4.0f);
         if (segments <= 0) segments = 4;
     }
 
-    float stepLength = 90.0f/(float)segments;
+    if (segments > MAX_CIRCLE_SEGMENTS) segments = MAX_CIRCLE_SEGMENTS;
 
     /*
     Quick sketch to make sense of all of this,
@@ -910,7 +1016,7 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
         // Draw all the 4 corners: [1] Upper Left Corner, [3] Upper Right Corner, [5] Lower Right Corner, [7] Lower Left Corner
         for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
         {
-            float angle = angles[k];
+            const Vector2 *arc = GetCircleArc(angles[k], angles[k] + 90.0f, segments);
             const Vector2 center = centers[k];
 
             // NOTE: Every QUAD actually represents two segments
@@ -921,15 +1027,13 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
                 rlVertex2f(center.x, center.y);
 
                 rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-                rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength*2))*radius, center.y + sinf(DEG2RAD*(angle + stepLength*2))*radius);
+                rlVertex2f(center.x + arc[2*i + 2].x*radius, center.y + arc[2*i + 2].y*radius);
 
                 rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
+                rlVertex2f(center.x + arc[2*i + 1].x*radius, center.y + arc[2*i + 1].y*radius);
 
                 rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
-
-                angle += (stepLength*2);
+                rlVertex2f(center.x + arc[2*i].x*radius, center.y + arc[2*i].y*radius);
             }
 
             // NOTE: In case number of segments is odd, we add one last piece to the cake
@@ -940,10 +1044,10 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
                 rlVertex2f(center.x, center.y);
 
                 rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
+                rlVertex2f(center.x + arc[segments].x*radius, center.y + arc[segments].y*radius);
 
                 rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
+                rlVertex2f(center.x + arc[segments - 1].x*radius, center.y + arc[segments - 1].y*radius);
 
                 rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
                 rlVertex2f(center.x, center.y);
@@ -1013,15 +1117,14 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
         // Draw all of the 4 corners: [1] Upper Left Corner, [3] Upper Right Corner, [5] Lower Right Corner, [7] Lower Left Corner
         for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
         {
-            float angle = angles[k];
+            const Vector2 *arc = GetCircleArc(angles[k], angles[k] + 90.0f, segments);
             const Vector2 center = centers[k];
             for (int i = 0; i < segments; i++)
             {
                 rlColor4ub(color.r, color.g, color.b, color.a);
                 rlVertex2f(center.x, center.y);
-                rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
-                rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
-                angle += stepLength;
+                rlVertex2f(center.x + arc[i + 1].x*radius, center.y + arc[i + 1].y*radius);
+                rlVertex2f(center.x + arc[i].x*radius, center.y + arc[i].y*radius);
             }
         }
 
@@ -1078,6 +1181,10 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
 {
     if (lineThick < 0) lineThick = 0;
 
+#if defined(SUPPORT_SHAPES_CULLING)
+    if (rlCheckCulledRec(rec.x - lineThick, rec.y - lineThick, rec.width + 2*lineThick, rec.height + 2*lineThick)) return;
+#endif
+
     // Not a rounded rectangle
     if (roundness <= 0.0f)
     {
@@ -1095,12 +1202,11 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
     if (segments < 4)
     {
         // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)(ceilf(2*PI/th)/2.0f);
+        segments = (int)(GetCircleSegments(radius)/2.0f);
         if (segments <= 0) segments = 4;
     }
 
-    float stepLength = 90.0f/(float)segments;
+    if (segments > MAX_CIRCLE_SEGMENTS) segments = MAX_CIRCLE_SEGMENTS;
     const float outerRadius = radius + lineThick, innerRadius = radius;
 
     /*
@@ -1146,25 +1252,23 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
             // Draw all the 4 corners first: Upper Left Corner, Upper Right Corner, Lower Right Corner, Lower Left Corner
             for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
             {
-                float angle = angles[k];
+                const Vector2 *arc = GetCircleArc(angles[k], angles[k] + 90.0f, segments);
                 const Vector2 center = centers[k];
                 for (int i = 0; i < segments; i++)
                 {
                     rlColor4ub(color.r, color.g, color.b, color.a);
 
                     rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-                    rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
+                    rlVertex2f(center.x + arc[i].x*innerRadius, center.y + arc[i].y*innerRadius);
 
                     rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-                    rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
+                    rlVertex2f(center.x + arc[i + 1].x*innerRadius, center.y + arc[i + 1].y*innerRadius);
 
                     rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                    rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*outerRadius);
+                    rlVertex2f(center.x + arc[i + 1].x*outerRadius, center.y + arc[i + 1].y*outerRadius);
 
                     rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                    rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
-
-                    angle += stepLength;
+                    rlVertex2f(center.x + arc[i].x*outerRadius, center.y + arc[i].y*outerRadius);
                 }
             }
 
@@ -1220,22 +1324,20 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
             // Draw all of the 4 corners first: Upper Left Corner, Upper Right Corner, Lower Right Corner, Lower Left Corner
             for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
             {
-                float angle = angles[k];
+                const Vector2 *arc = GetCircleArc(angles[k], angles[k] + 90.0f, segments);
                 const Vector2 center = centers[k];
 
                 for (int i = 0; i < segments; i++)
                 {
                     rlColor4ub(color.r, color.g, color.b, color.a);
 
-                    rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
-                    rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
-                    rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
-
-                    rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
-                    rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*outerRadius);
-                    rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
+                    rlVertex2f(center.x + arc[i].x*innerRadius, center.y + arc[i].y*innerRadius);
+                    rlVertex2f(center.x + arc[i + 1].x*innerRadius, center.y + arc[i + 1].y*innerRadius);
+                    rlVertex2f(center.x + arc[i].x*outerRadius, center.y + arc[i].y*outerRadius);
 
-                    angle += stepLength;
+                    rlVertex2f(center.x + arc[i + 1].x*innerRadius, center.y + arc[i + 1].y*innerRadius);
+                    rlVertex2f(center.x + arc[i + 1].x*outerRadius, center.y + arc[i + 1].y*outerRadius);
+                    rlVertex2f(center.x + arc[i].x*outerRadius, center.y + arc[i].y*outerRadius);
                 }
             }
 
@@ -1285,15 +1387,14 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
             // Draw all the 4 corners first: Upper Left Corner, Upper Right Corner, Lower Right Corner, Lower Left Corner
             for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
             {
-                float angle = angles[k];
+                const Vector2 *arc = GetCircleArc(angles[k], angles[k] + 90.0f, segments);
                 const Vector2 center = centers[k];
 
                 for (int i = 0; i < segments; i++)
                 {
                     rlColor4ub(color.r, color.g, color.b, color.a);
-                    rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
-                    rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*outerRadius);
-                    angle += stepLength;
+                    rlVertex2f(center.x + arc[i].x*outerRadius, center.y + arc[i].y*outerRadius);
+                    rlVertex2f(center.x + arc[i + 1].x*outerRadius, center.y + arc[i + 1].y*outerRadius);
                 }
             }
 
@@ -1309,6 +1410,85 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
     }
 }
 
+// Draw rectangle with rounded edges, single quad anti-aliased by signed distance
+// NOTE: Falls back to DrawRectangleRounded() if SDF shapes not supported
+void DrawRectangleRoundedSDF(Rectangle rec, float roundness, Color color)
+{
+    if (roundness < 0.0f) roundness = 0.0f;
+    if (roundness >= 1.0f) roundness = 1.0f;
+
+    // Calculate corner radius
+    float radius = (rec.width > rec.height)? (rec.height*roundness)/2 : (rec.width*roundness)/2;
+
+#if defined(SUPPORT_SDF_SHAPES)
+    if (rlPushShapeInstance(rec.x + rec.width/2.0f, rec.y + rec.height/2.0f, rec.width/2.0f, rec.height/2.0f,
+        radius, 0.0f, color.r, color.g, color.b, color.a)) return;
+#endif
+
+    DrawRectangleRounded(rec, roundness, 0, color);
+}
+
+// Draw rectangle with rounded edges outline, single quad anti-aliased by signed distance
+// NOTE: Outline is drawn outside the rectangle, same as DrawRectangleRoundedLines()
+void DrawRectangleRoundedLinesSDF(Rectangle rec, float roundness, float lineThick, Color color)
+{
+    if (lineThick < 0) lineThick = 0;
+    if (roundness < 0.0f) roundness = 0.0f;
+    if (roundness >= 1.0f) roundness = 1.0f;
+
+    // Calculate corner radius
+    float radius = (rec.width > rec.height)? (rec.height*roundness)/2 : (rec.width*roundness)/2;
+
+#if defined(SUPPORT_SDF_SHAPES)
+    if ((lineThick > 0.0f) && rlPushShapeInstance(rec.x + rec.width/2.0f, rec.y + rec.height/2.0f, rec.width/2.0f + lineThick, rec.height/2.0f + lineThick,
+        (radius > 0.0f)? radius + lineThick : 0.0f, lineThick, color.r, color.g, color.b, color.a)) return;
+#endif
+
+    DrawRectangleRoundedLines(rec, roundness, 0, lineThick, color);
+}
+
+// Draw a color-filled circle, single quad anti-aliased by signed distance
+void DrawCircleSDF(Vector2 center, float radius, Color color)
+{
+#if defined(SUPPORT_SDF_SHAPES)
+    if (rlPushShapeInstance(center.x, center.y, radius, radius, radius, 0.0f, color.r, color.g, color.b, color.a)) return;
+#endif
+
+    DrawCircleV(center, radius, color);
+}
+
+// Draw circle outline (1 pixel width), single quad anti-aliased by signed distance
+void DrawCircleLinesSDF(Vector2 center, float radius, Color color)
+{
+#if defined(SUPPORT_SDF_SHAPES)
+    if (rlPushShapeInstance(center.x, center.y, radius + 0.5f, radius + 0.5f, radius + 0.5f, 1.0f, color.r, color.g, color.b, color.a)) return;
+#endif
+
+    DrawCircleLinesV(center, radius, color);
+}
+
+// Draw ring (full circle), single quad anti-aliased by signed distance
+void DrawRingSDF(Vector2 center, float innerRadius, float outerRadius, Color color)
+{
+    if (innerRadius > outerRadius)
+    {
+        float tmp = outerRadius;
+        outerRadius = innerRadius;
+        innerRadius = tmp;
+    }
+
+    if (innerRadius < 0.0f) innerRadius = 0.0f;
+
+#if defined(SUPPORT_SDF_SHAPES)
+    // NOTE: Ring with no inner radius is a filled circle
+    float thickness = (innerRadius > 0.0f)? (outerRadius - innerRadius) : 0.0f;
+
+    if (rlPushShapeInstance(center.x, center.y, outerRadius, outerRadius, outerRadius, thickness, color.r, color.g, color.b, color.a)) return;
+#endif
+
+    DrawRing(center, innerRadius, outerRadius, 0.0f, 360.0f, 0, color);
+}
+
 // Draw a triangle
 // NOTE: Vertex must be provided in counter-clockwise order
 void DrawTriangle(Vector2 v1, Vector2 v2, Vector2 v3, Color color)
@@ -1396,22 +1576,32 @@ void DrawTriangleStrip(Vector2 *points, int pointCount, Color color)
 {
     if (pointCount >= 3)
     {
+        // Strip is expanded into triangles in chunks and submitted in bulk
+        float positions[TRIANGLE_STRIP_CHUNK_TRIANGLES*6] = { 0 };
+        int triangleCount = 0;
+
         rlBegin(RL_TRIANGLES);
             rlColor4ub(color.r, color.g, color.b, color.a);
 
             for (int i = 2; i < pointCount; i++)
             {
-                if ((i%2) == 0)
+                // Keep triangles winding: every odd triangle has its last two vertex swapped
+                Vector2 b = ((i%2) == 0)? points[i - 2] : points[i - 1];
+                Vector2 c = ((i%2) == 0)? points[i - 1] : points[i - 2];
+                float *triangle = &positions[triangleCount*6];
+
+                triangle[0] = points[i].x;
+                triangle[1] = points[i].y;
+                triangle[2] = b.x;
+                triangle[3] = b.y;
+                triangle[4] = c.x;
+                triangle[5] = c.y;
+                triangleCount++;
+
+                if ((triangleCount == TRIANGLE_STRIP_CHUNK_TRIANGLES) || (i == (pointCount - 1)))
                 {
-                    rlVertex2f(points[i].x, points[i].y);
-                    rlVertex2f(points[i - 2].x, points[i - 2].y);
-                    rlVertex2f(points[i - 1].x, points[i - 1].y);
-                }
-                else
-                {
-                    rlVertex2f(points[i].x, points[i].y);
-                    rlVertex2f(points[i - 1].x, points[i - 1].y);
-                    rlVertex2f(points[i - 2].x, points[i - 2].y);
+                    rlVertexArray2f(positions, NULL, NULL, triangleCount*3);
+                    triangleCount = 0;
                 }
             }
         rlEnd();
@@ -1546,6 +1736,22 @@ void DrawPolyLinesEx(Vector2 center, int sides, float radius, float rotation, fl
 // Draw spline: linear, minimum 2 points
 void DrawSplineLinear(Vector2 *points, int pointCount, float thick, Color color)
 {
+#if defined(SUPPORT_SHAPES_FEATHER)
+    // NOTE: Feathered spline is a single stroke, segments are connected with miter joins
+    if ((shapesFeather > 0.0f) && (pointCount >= 2))
+    {
+#if defined(SUPPORT_SHAPES_CULLING)
+        if (CheckCulledPoints(points, pointCount, thick/2.0f + shapesFeather, 0.0f)) return;
+#endif
+        Stroke stroke = { 0 };
+
+        StrokeBegin(&stroke, thick, shapesFeather, false, color);
+        for (int i = 0; i < pointCount; i++) StrokePoint(&stroke, points[i]);
+        StrokeEnd(&stroke);
+        return;
+    }
+#endif
+
     Vector2 delta = { 0 };
     float length = 0.0f;
     float scale = 0.0f;
@@ -1565,6 +1771,9 @@ void DrawSplineLinear(Vector2 *points, int pointCount, float thick, Color color)
             { points[i + 1].x + radius.x, points[i + 1].y + radius.y }
         };
 
+#if defined(SUPPORT_SHAPES_CULLING)
+        if (CheckCulledPoints(strip, 4, 0.0f, 0.0f)) continue;
+#endif
         DrawTriangleStrip(strip, 4, color);
     }
 #if defined(SUPPORT_SPLINE_SEGMENT_CAPS)
@@ -1577,6 +1786,11 @@ void DrawSplineBasis(Vector2 *points, int pointCount, float thick, Color color)
 {
     if (pointCount < 4) return;
 
+    // NOTE: B-Spline is contained in control points convex hull
+#if defined(SUPPORT_SHAPES_CULLING)
+    if (CheckCulledPoints(points, pointCount, thick/2.0f, 0.0f)) return;
+#endif
+
     float a[4] = { 0 };
     float b[4] = { 0 };
     float dy = 0.0f;
@@ -1653,92 +1867,72 @@ void DrawSplineCatmullRom(Vector2 *points, int pointCount, float thick, Color co
 {
     if (pointCount < 4) return;
 
-    float dy = 0.0f;
-    float dx = 0.0f;
-    float size = 0.0f;
-
-    Vector2 currentPoint = points[1];
-    Vector2 nextPoint = { 0 };
-    Vector2 vertices[2*SPLINE_SEGMENT_DIVISIONS + 2] = { 0 };
-
-    DrawCircleV(currentPoint, thick/2.0f, color);   // Draw init line circle-cap
-
-    for (int i = 0; i < (pointCount - 3); i++)
-    {
-        float t = 0.0f;
-        Vector2 p1 = points[i], p2 = points[i + 1], p3 = points[i + 2], p4 = points[i + 3];
-
-        if (i > 0)
-        {
-            vertices[0].x = currentPoint.x + dy*size;
-            vertices[0].y = currentPoint.y - dx*size;
-            vertices[1].x = currentPoint.x - dy*size;
-            vertices[1].y = currentPoint.y + dx*size;
-        }
-
-        for (int j = 1; j <= SPLINE_SEGMENT_DIVISIONS; j++)
-        {
-            t = ((float)j)/((float)SPLINE_SEGMENT_DIVISIONS);
-
-            float q0 = (-1.0f*t*t*t) + (2.0f*t*t) + (-1.0f*t);
-            float q1 = (3.0f*t*t*t) + (-5.0f*t*t) + 2.0f;
-            float q2 = (-3.0f*t*t*t) + (4.0f*t*t) + t;
-            float q3 = t*t*t - t*t;
+    // NOTE: Catmull-Rom spline could overshoot control points bounds up to ~15% of its size
+#if defined(SUPPORT_SHAPES_CULLING)
+    if (CheckCulledPoints(points, pointCount, thick/2.0f + shapesFeather, 0.25f)) return;
+#endif
 
-            nextPoint.x = 0.5f*((p1.x*q0) + (p2.x*q1) + (p3.x*q2) + (p4.x*q3));
-            nextPoint.y = 0.5f*((p1.y*q0) + (p2.y*q1) + (p3.y*q2) + (p4.y*q3));
+    // NOTE: Spline is a single stroke, segments flattened adaptively and connected with joins
+    Stroke stroke = { 0 };
 
-            dy = nextPoint.y - currentPoint.y;
-            dx = nextPoint.x - currentPoint.x;
-            size = (0.5f*thick)/sqrtf(dx*dx + dy*dy);
+    StrokeBegin(&stroke, thick, shapesFeather, true, color);
+    StrokePoint(&stroke, points[1]);
 
-            if ((i == 0) && (j == 1))
-            {
-                vertices[0].x = currentPoint.x + dy*size;
-                vertices[0].y = currentPoint.y - dx*size;
-                vertices[1].x = currentPoint.x - dy*size;
-                vertices[1].y = currentPoint.y + dx*size;
-            }
+    for (int i = 0; i < (pointCount - 3); i++) StrokeCatmullRom(&stroke, points[i], points[i + 1], points[i + 2], points[i + 3]);
 
-            vertices[2*j + 1].x = nextPoint.x - dy*size;
-            vertices[2*j + 1].y = nextPoint.y + dx*size;
-            vertices[2*j].x = nextPoint.x + dy*size;
-            vertices[2*j].y = nextPoint.y - dx*size;
-
-            currentPoint = nextPoint;
-        }
-
-        DrawTriangleStrip(vertices, 2*SPLINE_SEGMENT_DIVISIONS + 2, color);
-    }
-
-    DrawCircleV(currentPoint, thick/2.0f, color);   // Draw end line circle-cap
+    StrokeEnd(&stroke);
 }
 
 // Draw spline: Quadratic Bezier, minimum 3 points (1 control point): [p1, c2, p3, c4...]
 void DrawSplineBezierQuadratic(Vector2 *points, int pointCount, float thick, Color color)
 {
     if (pointCount < 3) return;
-    
-    for (int i = 0; i < pointCount - 2; i++)
-    {
-        DrawSplineSegmentBezierQuadratic(points[i], points[i + 1], points[i + 2], thick, color);
-    }
+
+    // NOTE: Quadratic Bezier is contained in control points convex hull
+#if defined(SUPPORT_SHAPES_CULLING)
+    if (CheckCulledPoints(points, pointCount, thick/2.0f + shapesFeather, 0.0f)) return;
+#endif
+
+    // NOTE: Spline is a single stroke, segments flattened adaptively and connected with joins
+    Stroke stroke = { 0 };
+
+    StrokeBegin(&stroke, thick, shapesFeather, false, color);
+    StrokePoint(&stroke, points[0]);
+
+    for (int i = 0; i < (pointCount - 2); i += 2) StrokeBezierQuadratic(&stroke, points[i], points[i + 1], points[i + 2]);
+
+    StrokeEnd(&stroke);
 }
 
 // Draw spline: Cubic Bezier, minimum 4 points (2 control points): [p1, c2, c3, p4, c5, c6...]
 void DrawSplineBezierCubic(Vector2 *points, int pointCount, float thick, Color color)
 {
     if (pointCount < 4) return;
-    
-    for (int i = 0; i < pointCount - 3; i++)
-    {
-        DrawSplineSegmentBezierCubic(points[i], points[i + 1], points[i + 2], points[i + 3], thick, color);
-    }
+
+    // NOTE: Cubic Bezier is contained in control points convex hull
+#if defined(SUPPORT_SHAPES_CULLING)
+    if (CheckCulledPoints(points, pointCount, thick/2.0f + shapesFeather, 0.0f)) return;
+#endif
+
+    // NOTE: Spline is a single stroke, segments flattened adaptively and connected with joins
+    Stroke stroke = { 0 };
+
+    StrokeBegin(&stroke, thick, shapesFeather, false, color);
+    StrokePoint(&stroke, points[0]);
+
+    for (int i = 0; i < (pointCount - 3); i += 3) StrokeBezierCubic(&stroke, points[i], points[i + 1], points[i + 2], points[i + 3]);
+
+    StrokeEnd(&stroke);
 }
 
 // Draw spline segment: Linear, 2 points
 void DrawSplineSegmentLinear(Vector2 p1, Vector2 p2, float thick, Color color)
 {
+#if defined(SUPPORT_SHAPES_CULLING)
+    Vector2 hull[2] = { p1, p2 };
+    if (CheckCulledPoints(hull, 2, thick/2.0f, 0.0f)) return;
+#endif
+
     // NOTE: For the linear spline we don't use subdivisions, just a single quad
     
     Vector2 delta = { p2.x - p1.x, p2.y - p1.y };
@@ -1763,6 +1957,11 @@ void DrawSplineSegmentLinear(Vector2 p1, Vector2 p2, float thick, Color color)
 // Draw spline segment: B-Spline, 4 points
 void DrawSplineSegmentBasis(Vector2 p1, Vector2 p2, Vector2 p3, Vector2 p4, float thick, Color color)
 {
+#if defined(SUPPORT_SHAPES_CULLING)
+    Vector2 hull[4] = { p1, p2, p3, p4 };
+    if (CheckCulledPoints(hull, 4, thick/2.0f, 0.0f)) return;
+#endif
+
     const float step = 1.0f/SPLINE_SEGMENT_DIVISIONS;
 
     Vector2 currentPoint = { 0 };
@@ -1820,139 +2019,49 @@ void DrawSplineSegmentBasis(Vector2 p1, Vector2 p2, Vector2 p3, Vector2 p4, floa
 // Draw spline segment: Catmull-Rom, 4 points
 void DrawSplineSegmentCatmullRom(Vector2 p1, Vector2 p2, Vector2 p3, Vector2 p4, float thick, Color color)
 {
-    const float step = 1.0f/SPLINE_SEGMENT_DIVISIONS;
-
-    Vector2 currentPoint = p1;
-    Vector2 nextPoint = { 0 };
-    float t = 0.0f;
-    
-    Vector2 points[2*SPLINE_SEGMENT_DIVISIONS + 2] = { 0 };
-
-    for (int i = 0; i <= SPLINE_SEGMENT_DIVISIONS; i++)
-    {
-        t = step*(float)i;
-
-        float q0 = (-1*t*t*t) + (2*t*t) + (-1*t);
-        float q1 = (3*t*t*t) + (-5*t*t) + 2;
-        float q2 = (-3*t*t*t) + (4*t*t) + t;
-        float q3 = t*t*t - t*t;
-
-        nextPoint.x = 0.5f*((p1.x*q0) + (p2.x*q1) + (p3.x*q2) + (p4.x*q3));
-        nextPoint.y = 0.5f*((p1.y*q0) + (p2.y*q1) + (p3.y*q2) + (p4.y*q3));
-
-        float dy = nextPoint.y - currentPoint.y;
-        float dx = nextPoint.x - currentPoint.x;
-        float size = (0.5f*thick)/sqrtf(dx*dx + dy*dy);
-
-        if (i == 1)
-        {
-            points[0].x = currentPoint.x + dy*size;
-            points[0].y = currentPoint.y - dx*size;
-            points[1].x = currentPoint.x - dy*size;
-            points[1].y = currentPoint.y + dx*size;
-        }
-
-        points[2*i + 1].x = nextPoint.x - dy*size;
-        points[2*i + 1].y = nextPoint.y + dx*size;
-        points[2*i].x = nextPoint.x + dy*size;
-        points[2*i].y = nextPoint.y - dx*size;
+#if defined(SUPPORT_SHAPES_CULLING)
+    Vector2 hull[4] = { p1, p2, p3, p4 };
+    if (CheckCulledPoints(hull, 4, thick/2.0f + shapesFeather, 0.25f)) return;
+#endif
 
-        currentPoint = nextPoint;
-    }
+    Stroke stroke = { 0 };
 
-    DrawTriangleStrip(points, 2*SPLINE_SEGMENT_DIVISIONS + 2, color);
+    StrokeBegin(&stroke, thick, shapesFeather, false, color);
+    StrokePoint(&stroke, p2);
+    StrokeCatmullRom(&stroke, p1, p2, p3, p4);
+    StrokeEnd(&stroke);
 }
 
 // Draw spline segment: Quadratic Bezier, 2 points, 1 control point
 void DrawSplineSegmentBezierQuadratic(Vector2 p1, Vector2 c2, Vector2 p3, float thick, Color color)
 {
-    const float step = 1.0f/SPLINE_SEGMENT_DIVISIONS;
-
-    Vector2 previous = p1;
-    Vector2 current = { 0 };
-    float t = 0.0f;
-
-    Vector2 points[2*SPLINE_SEGMENT_DIVISIONS + 2] = { 0 };
-
-    for (int i = 1; i <= SPLINE_SEGMENT_DIVISIONS; i++)
-    {
-        t = step*(float)i;
-
-        float a = powf(1.0f - t, 2);
-        float b = 2.0f*(1.0f - t)*t;
-        float c = powf(t, 2);
-
-        // NOTE: The easing functions aren't suitable here because they don't take a control point
-        current.y = a*p1.y + b*c2.y + c*p3.y;
-        current.x = a*p1.x + b*c2.x + c*p3.x;
-
-        float dy = current.y - previous.y;
-        float dx = current.x - previous.x;
-        float size = 0.5f*thick/sqrtf(dx*dx+dy*dy);
-
-        if (i == 1)
-        {
-            points[0].x = previous.x + dy*size;
-            points[0].y = previous.y - dx*size;
-            points[1].x = previous.x - dy*size;
-            points[1].y = previous.y + dx*size;
-        }
-
-        points[2*i + 1].x = current.x - dy*size;
-        points[2*i + 1].y = current.y + dx*size;
-        points[2*i].x = current.x + dy*size;
-        points[2*i].y = current.y - dx*size;
+#if defined(SUPPORT_SHAPES_CULLING)
+    Vector2 hull[3] = { p1, c2, p3 };
+    if (CheckCulledPoints(hull, 3, thick/2.0f + shapesFeather, 0.0f)) return;
+#endif
 
-        previous = current;
-    }
+    Stroke stroke = { 0 };
 
-    DrawTriangleStrip(points, 2*SPLINE_SEGMENT_DIVISIONS + 2, color);
+    StrokeBegin(&stroke, thick, shapesFeather, false, color);
+    StrokePoint(&stroke, p1);
+    StrokeBezierQuadratic(&stroke, p1, c2, p3);
+    StrokeEnd(&stroke);
 }
 
 // Draw spline segment: Cubic Bezier, 2 points, 2 control points
 void DrawSplineSegmentBezierCubic(Vector2 p1, Vector2 c2, Vector2 c3, Vector2 p4, float thick, Color color)
 {
-    const float step = 1.0f/SPLINE_SEGMENT_DIVISIONS;
-
-    Vector2 previous = p1;
-    Vector2 current = { 0 };
-    float t = 0.0f;
-
-    Vector2 points[2*SPLINE_SEGMENT_DIVISIONS + 2] = { 0 };
-
-    for (int i = 1; i <= SPLINE_SEGMENT_DIVISIONS; i++)
-    {
-        t = step*(float)i;
-
-        float a = powf(1.0f - t, 3);
-        float b = 3.0f*powf(1.0f - t, 2)*t;
-        float c = 3.0f*(1.0f - t)*powf(t, 2);
-        float d = powf(t, 3);
-
-        current.y = a*p1.y + b*c2.y + c*c3.y + d*p4.y;
-        current.x = a*p1.x + b*c2.x + c*c3.x + d*p4.x;
-
-        float dy = current.y - previous.y;
-        float dx = current.x - previous.x;
-        float size = 0.5f*thick/sqrtf(dx*dx+dy*dy);
-
-        if (i == 1)
-        {
-            points[0].x = previous.x + dy*size;
-            points[0].y = previous.y - dx*size;
-            points[1].x = previous.x - dy*size;
-            points[1].y = previous.y + dx*size;
-        }
-
-        points[2*i + 1].x = current.x - dy*size;
-        points[2*i + 1].y = current.y + dx*size;
-        points[2*i].x = current.x + dy*size;
-        points[2*i].y = current.y - dx*size;
+#if defined(SUPPORT_SHAPES_CULLING)
+    Vector2 hull[4] = { p1, c2, c3, p4 };
+    if (CheckCulledPoints(hull, 4, thick/2.0f + shapesFeather, 0.0f)) return;
+#endif
 
-        previous = current;
-    }
+    Stroke stroke = { 0 };
 
-    DrawTriangleStrip(points, 2*SPLINE_SEGMENT_DIVISIONS + 2, color);
+    StrokeBegin(&stroke, thick, shapesFeather, false, color);
+    StrokePoint(&stroke, p1);
+    StrokeBezierCubic(&stroke, p1, c2, c3, p4);
+    StrokeEnd(&stroke);
 }
 
 // Get spline point for a given t [0.0f .. 1.0f], Linear
@@ -2241,4 +2350,469 @@ static float EaseCubicInOut(float t, float b, float c, float d)
     return 0.5f*c*(t*t*t + 2.0f) + b;
 }
 
+// Get segments required by a full circle to keep SMOOTH_CIRCLE_ERROR_RATE
+// NOTE: Equivalent to ceilf(2*PI/acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1)),
+// a circle needs n segments while radius <= SMOOTH_CIRCLE_ERROR_RATE/(1 - cos(PI/n)),
+// those radius thresholds are computed once and searched
+static int GetCircleSegments(float radius)
+{
+    float *thresholds = circleCache.segmentsRadius;
+
+    if (!circleCache.segmentsReady)
+    {
+        thresholds[0] = thresholds[1] = 0.0f;
+        for (int n = 2; n <= MAX_CIRCLE_SEGMENTS; n++) thresholds[n] = (float)(SMOOTH_CIRCLE_ERROR_RATE/(1.0 - cos(PI/n)));
+        circleCache.segmentsReady = true;
+    }
+
+    // Radius under error rate or out of table range, compute it
+    if ((radius <= SMOOTH_CIRCLE_ERROR_RATE) || (radius > thresholds[MAX_CIRCLE_SEGMENTS]))
+    {
+        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
+        return (int)ceilf(2*PI/th);
+    }
+
+    // Binary search first threshold not lower than radius
+    int low = 3;
+    int high = MAX_CIRCLE_SEGMENTS;
+
+    while (low < high)
+    {
+        int mid = (low + high)/2;
+
+        if (radius <= thresholds[mid]) high = mid;
+        else low = mid + 1;
+    }
+
+    return low;
+}
+
+// Get cached unit circle table for a number of divisions
+// NOTE: Table contains (2*divisions + 1) vectors covering two turns, so any arc
+// starting on a division and not longer than a full turn is contiguous in it.
+// Returned pointer is valid until next call, cache is reset when full
+static const Vector2 *GetCircleTable(int divisions)
+{
+    int size = 2*divisions + 1;
+
+    if ((divisions <= 0) || (size > CIRCLE_TABLE_POOL_SIZE)) return NULL;
+
+    for (int i = 0; i < circleCache.tableCount; i++)
+    {
+        if (circleCache.tableDivisions[i] == divisions) return circleCache.pool + circleCache.tableOffset[i];
+    }
+
+    if ((circleCache.tableCount == CIRCLE_TABLE_CACHE_SIZE) || ((circleCache.poolUsed + size) > CIRCLE_TABLE_POOL_SIZE))
+    {
+        circleCache.tableCount = 0;
+        circleCache.poolUsed = 0;
+    }
+
+    Vector2 *table = circleCache.pool + circleCache.poolUsed;
+
+    for (int i = 0; i < size; i++)
+    {
+        double angle = 2.0*PI*(double)i/(double)divisions;
+        table[i] = (Vector2){ (float)cos(angle), (float)sin(angle) };
+    }
+
+    circleCache.tableDivisions[circleCache.tableCount] = divisions;
+    circleCache.tableOffset[circleCache.tableCount] = circleCache.poolUsed;
+    circleCache.tableCount++;
+    circleCache.poolUsed += size;
+
+    return table;
+}
+
+// Get unit vectors of arc segments boundaries, (segments + 1) vectors from startAngle to endAngle
+// NOTE: Arcs starting and stepping on full circle divisions are a slice of a cached table,
+// any other arc is generated by rotation. Returned pointer is valid until next call
+static const Vector2 *GetCircleArc(float startAngle, float endAngle, int segments)
+{
+    if (segments > MAX_CIRCLE_SEGMENTS) segments = MAX_CIRCLE_SEGMENTS;
+
+    float stepLength = (endAngle - startAngle)/(float)segments;
+
+    if ((stepLength > 0.0f) && ((endAngle - startAngle) <= 360.0f) && ((360.0f/stepLength) <= CIRCLE_TABLE_POOL_SIZE))
+    {
+        float divisions = 360.0f/stepLength;
+        float start = fmodf(startAngle, 360.0f);
+        if (start < 0.0f) start += 360.0f;
+        float offset = start/stepLength;
+
+        int tableDivisions = (int)(divisions + 0.5f);
+        int tableOffset = (int)(offset + 0.5f);
+
+        if ((fabsf(divisions - tableDivisions) < 0.001f) && (fabsf(offset - tableOffset) < 0.001f))
+        {
+            const Vector2 *table = GetCircleTable(tableDivisions);
+            if (table != NULL) return table + (tableOffset%tableDivisions);
+        }
+    }
+
+    // Not aligned to a table, rotate start vector by step angle
+    double stepCos = cos(DEG2RAD*(double)stepLength);
+    double stepSin = sin(DEG2RAD*(double)stepLength);
+    double x = cos(DEG2RAD*(double)startAngle);
+    double y = sin(DEG2RAD*(double)startAngle);
+
+    for (int i = 0; i <= segments; i++)
+    {
+        circleCache.arc[i] = (Vector2){ (float)x, (float)y };
+
+        double rx = x*stepCos - y*stepSin;
+        y = x*stepSin + y*stepCos;
+        x = rx;
+    }
+
+    return circleCache.arc;
+}
+
+#if defined(SUPPORT_SHAPES_CULLING)
+// Check if points bounds, expanded by margin, are outside viewport and scissor area
+// NOTE: overshoot expands bounds by a factor of its size, for curves not contained in points convex hull
+static bool CheckCulledPoints(const Vector2 *points, int pointCount, float margin, float overshoot)
+{
+    Vector2 min = points[0];
+    Vector2 max = points[0];
+
+    for (int i = 1; i < pointCount; i++)
+    {
+        if (points[i].x < min.x) min.x = points[i].x;
+        if (points[i].y < min.y) min.y = points[i].y;
+        if (points[i].x > max.x) max.x = points[i].x;
+        if (points[i].y > max.y) max.y = points[i].y;
+    }
+
+    float marginX = margin + overshoot*(max.x - min.x);
+    float marginY = margin + overshoot*(max.y - min.y);
+
+    return rlCheckCulledRec(min.x - marginX, min.y - marginY, (max.x - min.x) + 2*marginX, (max.y - min.y) + 2*marginY);
+}
+#endif
+
+// Submit stroke vertex waiting in buffer
+static void StrokeFlush(Stroke *stroke)
+{
+    // NOTE: Hard edged strokes use current color, set at StrokeBegin()
+    if (stroke->vertexCount > 0) rlVertexArray2f(stroke->positions, NULL, (stroke->feather > 0.0f)? stroke->colors : NULL, stroke->vertexCount);
+    stroke->vertexCount = 0;
+}
+
+// Add a triangle to stroke, every vertex with its own alpha
+// NOTE: Winding is fixed to counter-clockwise on screen, required with backface culling
+static void StrokeTriangle(Stroke *stroke, Vector2 a, unsigned char alphaA, Vector2 b, unsigned char alphaB, Vector2 c, unsigned char alphaC)
+{
+    if ((b.x - a.x)*(c.y - a.y) - (b.y - a.y)*(c.x - a.x) > 0.0f)
+    {
+        Vector2 tmp = b; b = c; c = tmp;
+        unsigned char tmpAlpha = alphaB; alphaB = alphaC; alphaC = tmpAlpha;
+    }
+
+    if ((stroke->vertexCount + 3) > STROKE_CHUNK_VERTICES) StrokeFlush(stroke);
+
+    const Vector2 vertex[3] = { a, b, c };
+    const unsigned char alpha[3] = { alphaA, alphaB, alphaC };
+
+    for (int i = 0; i < 3; i++)
+    {
+        float *position = &stroke->positions[stroke->vertexCount*2];
+
+        position[0] = vertex[i].x;
+        position[1] = vertex[i].y;
+
+        if (stroke->feather > 0.0f)
+        {
+            unsigned char *color = &stroke->colors[stroke->vertexCount*4];
+
+            color[0] = stroke->color.r;
+            color[1] = stroke->color.g;
+            color[2] = stroke->color.b;
+            color[3] = alpha[i];
+        }
+
+        stroke->vertexCount++;
+    }
+}
+
+// Add a quad to stroke, vertex a and b share alphaAB, c and d share alphaCD
+static void StrokeQuad(Stroke *stroke, Vector2 a, Vector2 b, unsigned char alphaAB, Vector2 c, Vector2 d, unsigned char alphaCD)
+{
+    StrokeTriangle(stroke, a, alphaAB, b, alphaAB, c, alphaCD);
+    StrokeTriangle(stroke, a, alphaAB, c, alphaCD, d, alphaCD);
+}
+
+// Add stroke segment, between start and end points with their join offsets
+static void StrokeSegment(Stroke *stroke, Vector2 start, Vector2 startOffset, Vector2 end, Vector2 endOffset)
+{
+    float inner = stroke->innerWidth;
+    float outer = stroke->outerWidth;
+
+    Vector2 startInnerLeft = { start.x + startOffset.x*inner, start.y + startOffset.y*inner };
+    Vector2 startInnerRight = { start.x - startOffset.x*inner, start.y - startOffset.y*inner };
+    Vector2 startOuterLeft = { start.x + startOffset.x*outer, start.y + startOffset.y*outer };
+    Vector2 startOuterRight = { start.x - startOffset.x*outer, start.y - startOffset.y*outer };
+    Vector2 endInnerLeft = { end.x + endOffset.x*inner, end.y + endOffset.y*inner };
+    Vector2 endInnerRight = { end.x - endOffset.x*inner, end.y - endOffset.y*inner };
+    Vector2 endOuterLeft = { end.x + endOffset.x*outer, end.y + endOffset.y*outer };
+    Vector2 endOuterRight = { end.x - endOffset.x*outer, end.y - endOffset.y*outer };
+
+    if (inner > 0.0f) StrokeQuad(stroke, startInnerLeft, startInnerRight, stroke->coreAlpha, endInnerRight, endInnerLeft, stroke->coreAlpha);
+    if (outer <= inner) return;
+
+    StrokeTriangle(stroke, startOuterLeft, 0, startInnerLeft, stroke->coreAlpha, endInnerLeft, stroke->coreAlpha);
+    StrokeTriangle(stroke, startOuterLeft, 0, endInnerLeft, stroke->coreAlpha, endOuterLeft, 0);
+    StrokeTriangle(stroke, startInnerRight, stroke->coreAlpha, startOuterRight, 0, endOuterRight, 0);
+    StrokeTriangle(stroke, startInnerRight, stroke->coreAlpha, endOuterRight, 0, endInnerRight, stroke->coreAlpha);
+}
+
+// Add stroke cap at point, facing direction (normalized)
+// NOTE: Round caps are a half disc, with a feathered rim if feathered,
+// butt caps end at point, only feathered ones add a ramp across the end
+static void StrokeCap(Stroke *stroke, Vector2 point, Vector2 direction)
+{
+    float inner = stroke->innerWidth;
+    float outer = stroke->outerWidth;
+    Vector2 normal = { -direction.y, direction.x };
+
+    if (stroke->roundCaps)
+    {
+        // Half circle from -normal to normal, through direction
+        float angle = atan2f(normal.y, normal.x)*RAD2DEG;
+        int segments = GetCircleSegments(outer)/2;
+        if (segments < 4) segments = 4;
+        if (segments > MAX_CIRCLE_SEGMENTS) segments = MAX_CIRCLE_SEGMENTS;
+
+        const Vector2 *arc = GetCircleArc(angle - 180.0f, angle, segments);
+
+        for (int i = 0; i < segments; i++)
+        {
+            Vector2 innerA = { point.x + arc[i].x*inner, point.y + arc[i].y*inner };
+            Vector2 innerB = { point.x + arc[i + 1].x*inner, point.y + arc[i + 1].y*inner };
+            Vector2 outerA = { point.x + arc[i].x*outer, point.y + arc[i].y*outer };
+            Vector2 outerB = { point.x + arc[i + 1].x*outer, point.y + arc[i + 1].y*outer };
+
+            if (inner > 0.0f) StrokeTriangle(stroke, point, stroke->coreAlpha, innerA, stroke->coreAlpha, innerB, stroke->coreAlpha);
+            if (outer > inner) StrokeQuad(stroke, innerA, innerB, stroke->coreAlpha, outerB, outerA, 0);
+        }
+    }
+    else if (stroke->feather > 0.0f)
+    {
+        // Stroke end was moved back by half feather, ramp reaches zero half feather past the end
+        Vector2 ramp = { direction.x*stroke->feather, direction.y*stroke->feather };
+
+        Vector2 innerLeft = { point.x + normal.x*inner, point.y + normal.y*inner };
+        Vector2 innerRight = { point.x - normal.x*inner, point.y - normal.y*inner };
+        Vector2 outerLeft = { point.x + normal.x*outer, point.y + normal.y*outer };
+        Vector2 outerRight = { point.x - normal.x*outer, point.y - normal.y*outer };
+
+        if (inner > 0.0f) StrokeQuad(stroke, innerLeft, innerRight, stroke->coreAlpha, (Vector2){ innerRight.x + ramp.x, innerRight.y + ramp.y }, (Vector2){ innerLeft.x + ramp.x, innerLeft.y + ramp.y }, 0);
+
+        StrokeTriangle(stroke, innerLeft, stroke->coreAlpha, outerLeft, 0, (Vector2){ outerLeft.x + ramp.x, outerLeft.y + ramp.y }, 0);
+        StrokeTriangle(stroke, innerLeft, stroke->coreAlpha, (Vector2){ outerLeft.x + ramp.x, outerLeft.y + ramp.y }, 0, (Vector2){ innerLeft.x + ramp.x, innerLeft.y + ramp.y }, 0);
+        StrokeTriangle(stroke, innerRight, stroke->coreAlpha, outerRight, 0, (Vector2){ outerRight.x + ramp.x, outerRight.y + ramp.y }, 0);
+        StrokeTriangle(stroke, innerRight, stroke->coreAlpha, (Vector2){ outerRight.x + ramp.x, outerRight.y + ramp.y }, 0, (Vector2){ innerRight.x + ramp.x, innerRight.y + ramp.y }, 0);
+    }
+}
+
+// Add stroke bevel join at point, filling the outer gap between segment offsets (unit width)
+// NOTE: Inner side of the join is covered by the overlapping segments
+static void StrokeBevel(Stroke *stroke, Vector2 point, Vector2 fromOffset, Vector2 toOffset)
+{
+    // Outer side is opposite to the turn direction
+    float side = ((fromOffset.x*toOffset.y - fromOffset.y*toOffset.x) > 0.0f)? -1.0f : 1.0f;
+    float inner = side*stroke->innerWidth;
+    float outer = side*stroke->outerWidth;
+
+    Vector2 innerA = { point.x + fromOffset.x*inner, point.y + fromOffset.y*inner };
+    Vector2 innerB = { point.x + toOffset.x*inner, point.y + toOffset.y*inner };
+    Vector2 outerA = { point.x + fromOffset.x*outer, point.y + fromOffset.y*outer };
+    Vector2 outerB = { point.x + toOffset.x*outer, point.y + toOffset.y*outer };
+
+    if (stroke->innerWidth > 0.0f) StrokeTriangle(stroke, point, stroke->coreAlpha, innerA, stroke->coreAlpha, innerB, stroke->coreAlpha);
+    if (stroke->outerWidth > stroke->innerWidth) StrokeQuad(stroke, innerA, innerB, stroke->coreAlpha, outerB, outerA, 0);
+}
+
+// Begin stroke, feathered if feather > 0
+// NOTE: Feather ramp is centered on stroke edges, strokes thinner than feather
+// keep a feather wide ramp and fade their alpha instead
+static void StrokeBegin(Stroke *stroke, float thick, float feather, bool roundCaps, Color color)
+{
+    if (feather < 0.0f) feather = 0.0f;
+
+    stroke->feather = feather;
+    stroke->roundCaps = roundCaps;
+    stroke->color = color;
+    stroke->pointCount = 0;
+    stroke->vertexCount = 0;
+
+    if ((feather == 0.0f) || (thick >= feather))
+    {
+        stroke->innerWidth = (thick - feather)/2.0f;
+        stroke->outerWidth = (thick + feather)/2.0f;
+        stroke->coreAlpha = color.a;
+    }
+    else
+    {
+        stroke->innerWidth = 0.0f;
+        stroke->outerWidth = (thick + feather)/2.0f;
+        stroke->coreAlpha = (unsigned char)(color.a*thick/feather);
+    }
+
+    rlBegin(RL_TRIANGLES);
+    rlColor4ub(color.r, color.g, color.b, color.a);
+}
+
+// Add point to stroke
+// NOTE: Segment ending in previous point is emitted, now its end join is known
+static void StrokePoint(Stroke *stroke, Vector2 point)
+{
+    if (stroke->pointCount == 0)
+    {
+        stroke->end = point;
+        stroke->pointCount = 1;
+        return;
+    }
+
+    Vector2 delta = { point.x - stroke->end.x, point.y - stroke->end.y };
+    float length = sqrtf(delta.x*delta.x + delta.y*delta.y);
+
+    if (length < 0.0001f) return;   // Skip duplicated points
+
+    Vector2 direction = { delta.x/length, delta.y/length };
+    Vector2 normal = { -direction.y, direction.x };
+
+    if (stroke->pointCount == 1)
+    {
+        stroke->start = stroke->end;
+        stroke->startOffset = normal;
+
+        if (!stroke->roundCaps)
+        {
+            // Butt cap ramp is centered on stroke start
+            float shift = fminf(stroke->feather/2.0f, length/2.0f);
+            stroke->start.x += direction.x*shift;
+            stroke->start.y += direction.y*shift;
+        }
+
+        StrokeCap(stroke, stroke->start, (Vector2){ -direction.x, -direction.y });
+    }
+    else
+    {
+        // NOTE: Sum of both normals is the join bisector, its length is 2*cos(turn angle/2)
+        // and the miter length (relative to width) is its inverse: 2/miterLength
+        Vector2 previousNormal = { -stroke->direction.y, stroke->direction.x };
+        Vector2 miter = { previousNormal.x + normal.x, previousNormal.y + normal.y };
+        float miterLength = sqrtf(miter.x*miter.x + miter.y*miter.y);
+
+        if (miterLength*STROKE_MITER_LIMIT >= 2.0f)
+        {
+            // Miter join, bisector scaled to keep width
+            Vector2 joinOffset = { 2.0f*miter.x/(miterLength*miterLength), 2.0f*miter.y/(miterLength*miterLength) };
+
+            StrokeSegment(stroke, stroke->start, stroke->startOffset, stroke->end, joinOffset);
+            stroke->startOffset = joinOffset;
+        }
+        else
+        {
+            // Previous segment ends square, next one starts square
+            StrokeSegment(stroke, stroke->start, stroke->startOffset, stroke->end, previousNormal);
+            stroke->startOffset = normal;
+
+            // Sharp corners beyond miter limit get a bevel join, an exact reversal has no
+            // outer side to bevel and gets a cap instead, pointing to the previous direction
+            if (miterLength > 0.0001f) StrokeBevel(stroke, stroke->end, previousNormal, normal);
+            else StrokeCap(stroke, stroke->end, stroke->direction);
+        }
+
+        stroke->start = stroke->end;
+    }
+
+    stroke->end = point;
+    stroke->direction = direction;
+    stroke->pointCount++;
+}
+
+// End stroke, emitting last segment and caps
+static void StrokeEnd(Stroke *stroke)
+{
+    if (stroke->pointCount >= 2)
+    {
+        Vector2 direction = stroke->direction;
+        Vector2 normal = { -direction.y, direction.x };
+        Vector2 end = stroke->end;
+
+        if (!stroke->roundCaps)
+        {
+            Vector2 delta = { end.x - stroke->start.x, end.y - stroke->start.y };
+            float shift = fminf(stroke->feather/2.0f, sqrtf(delta.x*delta.x + delta.y*delta.y)/2.0f);
+            end.x -= direction.x*shift;
+            end.y -= direction.y*shift;
+        }
+
+        StrokeSegment(stroke, stroke->start, stroke->startOffset, end, normal);
+        StrokeCap(stroke, end, direction);
+    }
+
+    StrokeFlush(stroke);
+    rlEnd();
+}
+
+// Add quadratic Bezier to stroke, start point excluded
+// NOTE: Divisions are given by Wang's formula, the smallest uniform division keeping
+// every point within SPLINE_FLATTEN_TOLERANCE of the curve: sqrt(n*(n - 1)/8*|max second difference|/tolerance)
+static void StrokeBezierQuadratic(Stroke *stroke, Vector2 p1, Vector2 c2, Vector2 p3)
+{
+    Vector2 a = { p1.x - 2.0f*c2.x + p3.x, p1.y - 2.0f*c2.y + p3.y };
+    Vector2 b = { 2.0f*(c2.x - p1.x), 2.0f*(c2.y - p1.y) };
+
+    int divisions = (int)ceilf(sqrtf(0.25f*sqrtf(a.x*a.x + a.y*a.y)/SPLINE_FLATTEN_TOLERANCE));
+    if (divisions < 1) divisions = 1;
+    if (divisions > SPLINE_SEGMENT_MAX_DIVISIONS) divisions = SPLINE_SEGMENT_MAX_DIVISIONS;
+
+    for (int i = 1; i < divisions; i++)
+    {
+        float t = (float)i/(float)divisions;
+        StrokePoint(stroke, (Vector2){ p1.x + t*(b.x + t*a.x), p1.y + t*(b.y + t*a.y) });
+    }
+
+    StrokePoint(stroke, p3);
+}
+
+// Add cubic Bezier to stroke, start point excluded
+// NOTE: Divisions are given by Wang's formula, see StrokeBezierQuadratic()
+static void StrokeBezierCubic(Stroke *stroke, Vector2 p1, Vector2 c2, Vector2 c3, Vector2 p4)
+{
+    Vector2 d1 = { p1.x - 2.0f*c2.x + c3.x, p1.y - 2.0f*c2.y + c3.y };
+    Vector2 d2 = { c2.x - 2.0f*c3.x + p4.x, c2.y - 2.0f*c3.y + p4.y };
+    float curvature = sqrtf(fmaxf(d1.x*d1.x + d1.y*d1.y, d2.x*d2.x + d2.y*d2.y));
+
+    int divisions = (int)ceilf(sqrtf(0.75f*curvature/SPLINE_FLATTEN_TOLERANCE));
+    if (divisions < 1) divisions = 1;
+    if (divisions > SPLINE_SEGMENT_MAX_DIVISIONS) divisions = SPLINE_SEGMENT_MAX_DIVISIONS;
+
+    // Power basis coefficients, evaluated with Horner's method
+    Vector2 a = { p4.x - p1.x + 3.0f*(c2.x - c3.x), p4.y - p1.y + 3.0f*(c2.y - c3.y) };
+    Vector2 b = { 3.0f*d1.x, 3.0f*d1.y };
+    Vector2 c = { 3.0f*(c2.x - p1.x), 3.0f*(c2.y - p1.y) };
+
+    for (int i = 1; i < divisions; i++)
+    {
+        float t = (float)i/(float)divisions;
+        StrokePoint(stroke, (Vector2){ p1.x + t*(c.x + t*(b.x + t*a.x)), p1.y + t*(c.y + t*(b.y + t*a.y)) });
+    }
+
+    StrokePoint(stroke, p4);
+}
+
+// Add Catmull-Rom segment to stroke, curve from p2 to p3, start point excluded
+// NOTE: Uniform Catmull-Rom segment is the cubic Bezier with control points p2 + (p3 - p1)/6 and p3 - (p4 - p2)/6
+static void StrokeCatmullRom(Stroke *stroke, Vector2 p1, Vector2 p2, Vector2 p3, Vector2 p4)
+{
+    Vector2 c2 = { p2.x + (p3.x - p1.x)/6.0f, p2.y + (p3.y - p1.y)/6.0f };
+    Vector2 c3 = { p3.x - (p4.x - p2.x)/6.0f, p3.y - (p4.y - p2.y)/6.0f };
+
+    StrokeBezierCubic(stroke, p2, c2, c3, p3);
+}
+
 #endif      // SUPPORT_MODULE_RSHAPES
@@ -20,6 +20,9 @@
 *           at the bottom-right corner of the atlas. It can be useful to for shapes drawing, to allow
 *           drawing text and shapes with a single draw call [SetShapesTexture()].
 *
+*       #define SUPPORT_TEXT_CULLING
+*           Skip text completely outside viewport and scissor area before generating glyph quads
+*
 *       #define TEXTSPLIT_MAX_TEXT_BUFFER_LENGTH
 *           TextSplit() function static buffer max size
 *
@@ -69,6 +72,7 @@
 #include <string.h>         // Required for: strcmp(), strstr(), strcpy(), strncpy() [Used in TextReplace()], sscanf() [Used in LoadBMFont()]
 #include <stdarg.h>         // Required for: va_list, va_start(), vsprintf(), va_end() [Used in TextFormat()]
 #include <ctype.h>          // Required for: toupper(), tolower() [Used in TextToUpper(), TextToLower()]
+#include <math.h>           // Required for: sqrtf() [Used in GenFontSDF()]
 
 #if defined(SUPPORT_FILEFORMAT_TTF)
     #if defined(__GNUC__) // GCC and Clang
@@ -101,11 +105,38 @@
 #ifndef MAX_TEXTSPLIT_COUNT
     #define MAX_TEXTSPLIT_COUNT                  128        // Maximum number of substrings to split: TextSplit()
 #endif
+// NOTE: Using some SDF generation default values,
+// trades off precision with ability to handle *smaller* sizes
+#ifndef FONT_SDF_CHAR_PADDING
+    #define FONT_SDF_CHAR_PADDING                  4        // SDF font generation char padding
+#endif
+#ifndef FONT_SDF_ON_EDGE_VALUE
+    #define FONT_SDF_ON_EDGE_VALUE               128        // SDF font generation on edge value
+#endif
+#ifndef FONT_SDF_PIXEL_DIST_SCALE
+    #define FONT_SDF_PIXEL_DIST_SCALE          64.0f        // SDF font generation pixel distance scale
+#endif
+#ifndef FONT_GLYPH_LOOKUP_DIRECT
+    #define FONT_GLYPH_LOOKUP_DIRECT           0x250        // Codepoints with direct-mapped glyph lookup: Basic Latin to Latin Extended-B
+#endif
+#ifndef TEXT_LAYOUT_CHUNK_QUADS
+    #define TEXT_LAYOUT_CHUNK_QUADS               64        // Glyph quads expanded per bulk vertex submission: DrawTextLayout()
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Glyphs lookup index, codepoint to glyph index
+// NOTE: Direct-mapped table for Latin codepoints, open addressing hash table for the rest,
+// missing codepoints are resolved to fallback glyph ('?') on building
+struct rGlyphLookup {
+    int direct[FONT_GLYPH_LOOKUP_DIRECT];   // Glyph index for codepoints [0..FONT_GLYPH_LOOKUP_DIRECT - 1]
+    int fallback;                           // Glyph index for codepoints not in font
+    int hashMask;                           // Hash table size minus one (size is power of two), -1 if no hash table
+    int *hashKeys;                          // Hash table codepoints (-1 for empty slots)
+    int *hashValues;                        // Hash table glyph indices
+    float maxAdvance;                       // Widest glyph advance in font base size pixels (advanceX, or rec width if 0)
+};
 
 //----------------------------------------------------------------------------------
 // Global variables
@@ -116,6 +147,13 @@
 static Font defaultFont = { 0 };
 #endif
 
+// Built-in SDF shader, used to draw FONT_SDF fonts
+// NOTE: Shader is loaded on first SDF font loading and disposed on CloseWindow() [module: core]
+static Shader textShaderSDF = { 0 };
+static int textShaderSDFLocs[3] = { -1, -1, -1 };   // Uniform locations: smoothing, outlineWidth, outlineColor
+static float textOutlineSize = 0.0f;                // SDF text outline size in pixels (0.0f for no outline)
+static Color textOutlineColor = { 0, 0, 0, 255 };   // SDF text outline color
+
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
 //----------------------------------------------------------------------------------
@@ -127,6 +165,14 @@ static Font defaultFont = { 0 };
 #if defined(SUPPORT_FILEFORMAT_FNT)
 static Font LoadBMFont(const char *fileName);   // Load a BMFont file (AngelCode font file)
 #endif
+static rGlyphLookup *LoadGlyphLookup(const GlyphInfo *glyphs, const Rectangle *recs, int glyphCount);  // Load glyphs lookup index
+static void UnloadGlyphLookup(rGlyphLookup *lookup);                            // Unload glyphs lookup index
+#if defined(SUPPORT_TEXT_CULLING)
+static bool CheckTextCulled(Font font, const char *text, int size, Vector2 position, float fontSize, float spacing);  // Check if text is outside viewport and scissor area
+#endif
+static unsigned int GlyphLookupHash(int codepoint);                             // Get glyphs lookup hash for codepoint
+static void LoadFontTextureSDF(Font *font, int packMethod);                     // Load SDF font atlas texture, glyph images and lookup from SDF glyphs
+static void LoadTextShaderSDF(void);                                            // Load built-in SDF shader (if not loaded)
 static int textLineSpacing = 15;                // Text vertical line spacing in pixels
 
 #if defined(SUPPORT_DEFAULT_FONT)
@@ -283,6 +329,7 @@ extern void LoadFontDefault(void)
     UnloadImage(imFont);
 
     defaultFont.baseSize = (int)defaultFont.recs[0].height;
+    defaultFont.glyphLookup = LoadGlyphLookup(defaultFont.glyphs, defaultFont.recs, defaultFont.glyphCount);
 
     TRACELOG(LOG_INFO, "FONT: Default font loaded successfully (%i glyphs)", defaultFont.glyphCount);
 }
@@ -294,6 +341,11 @@ extern void UnloadFontDefault(void)
     UnloadTexture(defaultFont.texture);
     RL_FREE(defaultFont.glyphs);
     RL_FREE(defaultFont.recs);
+    UnloadGlyphLookup(defaultFont.glyphLookup);
+
+    // Built-in SDF shader lifetime is tied to default font (CloseWindow())
+    if (textShaderSDF.id > 0) UnloadShader(textShaderSDF);
+    textShaderSDF = (Shader){ 0 };
 }
 #endif      // SUPPORT_DEFAULT_FONT
 
@@ -362,16 +414,15 @@ Font LoadFontEx(const char *fileName, int fontSize, int *codepoints, int codepoi
 {
     Font font = { 0 };
 
-    // Loading file to memory
-    int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    // Loading file view (memory-mapped, no copy)
+    FileView view = LoadFileView(fileName);
 
-    if (fileData != NULL)
+    if (view.data != NULL)
     {
         // Loading font from memory data
-        font = LoadFontFromMemory(GetFileExtension(fileName), fileData, dataSize, fontSize, codepoints, codepointCount);
+        font = LoadFontFromMemory(GetFileExtension(fileName), view.data, view.size, fontSize, codepoints, codepointCount);
 
-        UnloadFileData(fileData);
+        UnloadFileView(view);
     }
     else font = GetFontDefault();
 
@@ -499,6 +550,7 @@ Font LoadFontFromImage(Image image, Color key, int firstChar)
     UnloadImage(fontClear);     // Unload processed image once converted to texture
 
     font.baseSize = (int)font.recs[0].height;
+    font.glyphLookup = LoadGlyphLookup(font.glyphs, font.recs, font.glyphCount);
 
     return font;
 }
@@ -536,6 +588,8 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
 
             UnloadImage(atlas);
 
+            font.glyphLookup = LoadGlyphLookup(font.glyphs, font.recs, font.glyphCount);
+
             TRACELOG(LOG_INFO, "FONT: Data loaded successfully (%i pixel size | %i glyphs)", font.baseSize, font.glyphCount);
         }
         else font = GetFontDefault();
@@ -547,6 +601,132 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
     return font;
 }
 
+// Load SDF font from TTF/OTF file, all sizes drawn from one atlas
+// NOTE: Font atlas uses bilinear filtering, DrawTextEx() selects the built-in SDF shader for it
+Font LoadFontSDF(const char *fileName, int fontSize, int *codepoints, int codepointCount)
+{
+    Font font = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    FileView view = LoadFileView(fileName);
+
+    if (view.data != NULL)
+    {
+        font.baseSize = fontSize;
+        font.glyphCount = (codepointCount > 0)? codepointCount : 95;
+        font.glyphPadding = 0;      // NOTE: SDF glyph images already include FONT_SDF_CHAR_PADDING
+        font.glyphs = LoadFontData(view.data, view.size, font.baseSize, codepoints, font.glyphCount, FONT_SDF);
+
+        UnloadFileView(view);
+
+        if (font.glyphs != NULL)
+        {
+            LoadFontTextureSDF(&font, 1);
+
+            TRACELOG(LOG_INFO, "FONT: [%s] SDF font loaded successfully (%i pixel size | %i glyphs)", fileName, font.baseSize, font.glyphCount);
+        }
+        else font = GetFontDefault();
+    }
+    else font = GetFontDefault();
+#else
+    font = GetFontDefault();
+#endif
+
+    return font;
+}
+
+// Generate SDF font from bitmap font glyphs, upscaled by scale factor
+// NOTE: Useful to draw pixel fonts (i.e. default font) crisp at any size, glyphs are upscaled
+// (nearest) and the distance to the nearest texel of opposite coverage is computed per texel,
+// search is limited to the distance range representable with FONT_SDF_PIXEL_DIST_SCALE
+Font GenFontSDF(Font font, int scale)
+{
+    Font sdf = { 0 };
+
+    if ((font.glyphs == NULL) || (font.glyphCount <= 0) || (scale <= 0))
+    {
+        TRACELOG(LOG_WARNING, "FONT: Provided font not valid for SDF generation");
+        return sdf;
+    }
+
+    const int padding = FONT_SDF_CHAR_PADDING;
+    const int radius = (int)(FONT_SDF_ON_EDGE_VALUE/FONT_SDF_PIXEL_DIST_SCALE) + 1;
+
+    sdf.baseSize = font.baseSize*scale;
+    sdf.glyphCount = font.glyphCount;
+    sdf.glyphPadding = 0;           // NOTE: SDF glyph images already include FONT_SDF_CHAR_PADDING
+    sdf.glyphs = (GlyphInfo *)RL_CALLOC(sdf.glyphCount, sizeof(GlyphInfo));
+
+    for (int i = 0; i < font.glyphCount; i++)
+    {
+        const GlyphInfo *glyph = &font.glyphs[i];
+        int maskWidth = glyph->image.width*scale;
+        int maskHeight = glyph->image.height*scale;
+        int width = maskWidth + 2*padding;
+        int height = maskHeight + 2*padding;
+
+        // Upscaled glyph coverage mask
+        unsigned char *mask = (unsigned char *)RL_CALLOC((maskWidth > 0)? maskWidth*maskHeight : 1, 1);
+
+        if (maskWidth > 0)
+        {
+            Color *pixels = LoadImageColors(glyph->image);
+
+            for (int y = 0; y < maskHeight; y++)
+            {
+                for (int x = 0; x < maskWidth; x++) mask[y*maskWidth + x] = (pixels[(y/scale)*glyph->image.width + x/scale].a >= 128);
+            }
+
+            UnloadImageColors(pixels);
+        }
+
+        unsigned char *data = (unsigned char *)RL_CALLOC(width*height, 1);
+
+        for (int y = 0; y < height; y++)
+        {
+            for (int x = 0; x < width; x++)
+            {
+                int mx = x - padding;
+                int my = y - padding;
+                bool inside = (mx >= 0) && (my >= 0) && (mx < maskWidth) && (my < maskHeight) && mask[my*maskWidth + mx];
+                int minDistSq = radius*radius;
+
+                for (int dy = -radius; dy <= radius; dy++)
+                {
+                    for (int dx = -radius; dx <= radius; dx++)
+                    {
+                        int sx = mx + dx;
+                        int sy = my + dy;
+                        bool sampleInside = (sx >= 0) && (sy >= 0) && (sx < maskWidth) && (sy < maskHeight) && mask[sy*maskWidth + sx];
+
+                        if ((sampleInside != inside) && ((dx*dx + dy*dy) < minDistSq)) minDistSq = dx*dx + dy*dy;
+                    }
+                }
+
+                // Edge lies halfway between texel centers
+                float distance = sqrtf((float)minDistSq) - 0.5f;
+                float value = FONT_SDF_ON_EDGE_VALUE + (inside? distance : -distance)*FONT_SDF_PIXEL_DIST_SCALE;
+
+                data[y*width + x] = (unsigned char)((value < 0.0f)? 0.0f : (value > 255.0f)? 255.0f : value);
+            }
+        }
+
+        RL_FREE(mask);
+
+        sdf.glyphs[i].value = glyph->value;
+        sdf.glyphs[i].offsetX = glyph->offsetX*scale - padding;
+        sdf.glyphs[i].offsetY = glyph->offsetY*scale - padding;
+        sdf.glyphs[i].advanceX = ((glyph->advanceX == 0)? glyph->image.width : glyph->advanceX)*scale;
+        sdf.glyphs[i].image = (Image){ data, width, height, 1, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE };
+    }
+
+    LoadFontTextureSDF(&sdf, 0);
+
+    TRACELOG(LOG_INFO, "FONT: SDF font generated successfully (%i pixel size | %i glyphs)", sdf.baseSize, sdf.glyphCount);
+
+    return sdf;
+}
+
 // Check if a font is ready
 bool IsFontReady(Font font)
 {
@@ -564,17 +744,6 @@ bool IsFontReady(Font font)
 // NOTE: Requires TTF font memory data and can generate SDF data
 GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount, int type)
 {
-    // NOTE: Using some SDF generation default values,
-    // trades off precision with ability to handle *smaller* sizes
-#ifndef FONT_SDF_CHAR_PADDING
-    #define FONT_SDF_CHAR_PADDING            4      // SDF font generation char padding
-#endif
-#ifndef FONT_SDF_ON_EDGE_VALUE
-    #define FONT_SDF_ON_EDGE_VALUE         128      // SDF font generation on edge value
-#endif
-#ifndef FONT_SDF_PIXEL_DIST_SCALE
-    #define FONT_SDF_PIXEL_DIST_SCALE     64.0f     // SDF font generation pixel distance scale
-#endif
 #ifndef FONT_BITMAP_ALPHA_THRESHOLD
     #define FONT_BITMAP_ALPHA_THRESHOLD     80      // Bitmap (B&W) font generation alpha threshold
 #endif
@@ -905,6 +1074,7 @@ void UnloadFont(Font font)
         UnloadFontData(font.glyphs, font.glyphCount);
         UnloadTexture(font.texture);
         RL_FREE(font.recs);
+        UnloadGlyphLookup(font.glyphLookup);
 
         TRACELOGD("FONT: Unloaded font data from RAM and VRAM");
     }
@@ -1078,6 +1248,18 @@ void DrawFPS(int posX, int posY)
     DrawText(TextFormat("%2i FPS", fps), posX, posY, 20, color);
 }
 
+// Draw render stats of last frame
+// NOTE: Drawing the stats adds some draw calls and vertex to next frame stats
+void DrawRenderStats(int posX, int posY)
+{
+    rlRenderStats stats = rlGetRenderStats();
+    Color color = (stats.batchOverflows > 0)? ORANGE : LIME;    // Batch overflows should be avoided
+
+    DrawText(TextFormat("DRAWS: %i  FLUSHES: %i  OVERFLOWS: %i", stats.drawCalls, stats.flushes, stats.batchOverflows), posX, posY, 20, color);
+    DrawText(TextFormat("VERTEX: %i  TEX SWITCHES: %i  CULLED: %i", stats.vertices, stats.textureSwitches, stats.culled), posX, posY + 22, 20, LIME);
+    DrawText(TextFormat("UPLOAD: %.1f KB  STATE: %i/%i", (float)stats.uploadedBytes/1024.0f, stats.stateCallsIssued, stats.stateCallsIssued + stats.stateCallsSkipped), posX, posY + 44, 20, LIME);
+}
+
 // Draw text (using default font)
 // NOTE: fontSize work like in any drawing program but if fontSize is lower than font-base-size, then font-base-size is used
 // NOTE: chars spacing is proportional to fontSize
@@ -1104,11 +1286,20 @@ void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, f
 
     int size = TextLength(text);    // Total size in bytes of the text, scanned by codepoints in loop
 
+#if defined(SUPPORT_TEXT_CULLING)
+    if (CheckTextCulled(font, text, size, position, fontSize, spacing)) return;
+#endif
+
     int textOffsetY = 0;            // Offset between lines (on linebreak '\n')
     float textOffsetX = 0.0f;       // Offset X to next character to draw
 
     float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
 
+    // NOTE: SDF fonts are drawn with built-in SDF shader, set up for fontSize, unless
+    // a custom shader is already set by caller (BeginShaderMode()), it is kept active
+    bool sdf = (font.type == FONT_SDF) && (rlGetShaderIdCurrent() == rlGetShaderIdDefault());
+    if (sdf) BeginShaderMode(GetFontShader(font, fontSize));
+
     for (int i = 0; i < size;)
     {
         // Get next codepoint from byte string and glyph index in font
@@ -1135,6 +1326,8 @@ void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, f
 
         i += codepointByteCount;   // Move text bytes counter to next codepoint
     }
+
+    if (sdf) EndShaderMode();
 }
 
 // Draw text using Font and pro parameters (rotation)
@@ -1152,8 +1345,12 @@ void DrawTextPro(Font font, const char *text, Vector2 position, Vector2 origin,
 }
 
 // Draw one character (codepoint)
+// NOTE: SDF fonts require the shader returned by GetFontShader(), DrawTextEx() sets it up
 void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint)
 {
+    // Check if font texture is valid
+    if (font.texture.id == 0) return;
+
     // Character index position in sprite font
     // NOTE: In case a codepoint is not available in the font, index returned points to '?'
     int index = GetGlyphIndex(font, codepoint);
@@ -1172,7 +1369,26 @@ void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSiz
                          font.recs[index].width + 2.0f*font.glyphPadding, font.recs[index].height + 2.0f*font.glyphPadding };
 
     // Draw the character texture on the screen
-    DrawTexturePro(font.texture, srcRec, dstRec, (Vector2){ 0, 0 }, 0.0f, tint);
+    // NOTE: Same quad as DrawTexturePro() (no rotation, no flip), submitted in bulk
+    float width = (float)font.texture.width;
+    float height = (float)font.texture.height;
+    float u0 = srcRec.x/width, v0 = srcRec.y/height;
+    float u1 = (srcRec.x + srcRec.width)/width, v1 = (srcRec.y + srcRec.height)/height;
+
+    // Vertex order: top-left, bottom-left, bottom-right, top-right
+    float positions[8] = { dstRec.x, dstRec.y, dstRec.x, dstRec.y + dstRec.height,
+                           dstRec.x + dstRec.width, dstRec.y + dstRec.height, dstRec.x + dstRec.width, dstRec.y };
+    float texcoords[8] = { u0, v0, u0, v1, u1, v1, u1, v0 };
+
+    rlSetTexture(font.texture.id);
+    rlBegin(RL_QUADS);
+
+        rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+        rlNormal3f(0.0f, 0.0f, 1.0f);                      // Normal vector pointing towards viewer
+        rlVertexArray2f(positions, texcoords, NULL, 4);
+
+    rlEnd();
+    rlSetTexture(0);
 }
 
 // Draw multiple character (codepoints)
@@ -1183,6 +1399,9 @@ void DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Ve
 
     float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
 
+    bool sdf = (font.type == FONT_SDF) && (rlGetShaderIdCurrent() == rlGetShaderIdDefault());
+    if (sdf) BeginShaderMode(GetFontShader(font, fontSize));
+
     for (int i = 0; i < codepointCount; i++)
     {
         int index = GetGlyphIndex(font, codepoints[i]);
@@ -1204,6 +1423,163 @@ void DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Ve
             else textOffsetX += ((float)font.glyphs[index].advanceX*scaleFactor + spacing);
         }
     }
+
+    if (sdf) EndShaderMode();
+}
+
+// Load text layout, text shaped into glyph quads
+// NOTE: Glyph quads are computed same way as DrawTextEx(), using current line spacing
+TextLayout LoadTextLayout(Font font, const char *text, float fontSize, float spacing)
+{
+    TextLayout layout = { 0 };
+
+    if (font.texture.id == 0) font = GetFontDefault();  // Security check in case of not valid font
+    if ((text == NULL) || (font.texture.id == 0)) return layout;
+
+    int size = TextLength(text);    // Total size in bytes of the text, scanned by codepoints in loop
+
+    layout.font = font;
+    layout.fontSize = fontSize;
+    layout.spacing = spacing;
+    layout.text = (char *)RL_CALLOC(size + 1, sizeof(char));
+    memcpy(layout.text, text, size);
+
+    // NOTE: Codepoints count is not known in advance, glyph quads count is bounded by bytes count
+    layout.quads = (float *)RL_MALLOC(size*8*sizeof(float));
+
+    int textOffsetY = 0;            // Offset between lines (on linebreak '\n')
+    float textOffsetX = 0.0f;       // Offset X to next character to draw
+
+    float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
+    float width = (float)font.texture.width;
+    float height = (float)font.texture.height;
+    float padding = (float)font.glyphPadding;
+
+    for (int i = 0; i < size;)
+    {
+        // Get next codepoint from byte string and glyph index in font
+        int codepointByteCount = 0;
+        int codepoint = GetCodepointNext(&text[i], &codepointByteCount);
+        int index = GetGlyphIndex(font, codepoint);
+
+        if (codepoint == '\n')
+        {
+            // NOTE: Line spacing is a global variable, use SetTextLineSpacing() to setup
+            textOffsetY += textLineSpacing;
+            textOffsetX = 0.0f;
+        }
+        else
+        {
+            if ((codepoint != ' ') && (codepoint != '\t'))
+            {
+                // Same quad as DrawTextCodepoint(), glyph padding considered
+                Rectangle rec = font.recs[index];
+                float *quad = &layout.quads[layout.quadCount*8];
+
+                quad[0] = textOffsetX + font.glyphs[index].offsetX*scaleFactor - padding*scaleFactor;
+                quad[1] = textOffsetY + font.glyphs[index].offsetY*scaleFactor - padding*scaleFactor;
+                quad[2] = quad[0] + (rec.width + 2.0f*padding)*scaleFactor;
+                quad[3] = quad[1] + (rec.height + 2.0f*padding)*scaleFactor;
+                quad[4] = (rec.x - padding)/width;
+                quad[5] = (rec.y - padding)/height;
+                quad[6] = (rec.x + rec.width + padding)/width;
+                quad[7] = (rec.y + rec.height + padding)/height;
+
+                layout.quadCount++;
+            }
+
+            if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
+            else textOffsetX += ((float)font.glyphs[index].advanceX*scaleFactor + spacing);
+        }
+
+        i += codepointByteCount;   // Move text bytes counter to next codepoint
+    }
+
+    layout.size = MeasureTextEx(font, text, fontSize, spacing);
+
+    return layout;
+}
+
+// Unload text layout from memory (RAM)
+void UnloadTextLayout(TextLayout layout)
+{
+    RL_FREE(layout.text);
+    RL_FREE(layout.quads);
+}
+
+// Update text layout, re-shaped only if font, text or size changed
+// NOTE: Font is compared by texture and glyphs data, returns true if layout was re-shaped
+bool UpdateTextLayout(TextLayout *layout, Font font, const char *text, float fontSize, float spacing)
+{
+    bool reshaped = false;
+
+    if (font.texture.id == 0) font = GetFontDefault();  // Same font check as LoadTextLayout()
+
+    if ((layout->text == NULL) || (text == NULL) ||
+        (layout->font.texture.id != font.texture.id) || (layout->font.glyphs != font.glyphs) ||
+        (layout->fontSize != fontSize) || (layout->spacing != spacing) || !TextIsEqual(layout->text, text))
+    {
+        UnloadTextLayout(*layout);
+        *layout = LoadTextLayout(font, text, fontSize, spacing);
+        reshaped = true;
+    }
+
+    return reshaped;
+}
+
+// Draw text layout, all glyph quads appended to batch at once
+void DrawTextLayout(TextLayout layout, Vector2 position, Color tint)
+{
+    if (layout.quadCount <= 0) return;
+
+#if defined(SUPPORT_TEXT_CULLING)
+    // NOTE: Layout size is already known, culling is almost free
+    float margin = layout.fontSize/2.0f;
+    if (rlCheckCulledRec(position.x - margin, position.y - margin, layout.size.x + 2*margin, layout.size.y + 2*margin)) return;
+#endif
+
+    bool sdf = (layout.font.type == FONT_SDF) && (rlGetShaderIdCurrent() == rlGetShaderIdDefault());
+    if (sdf) BeginShaderMode(GetFontShader(layout.font, layout.fontSize));
+
+    // Quads are expanded in chunks and submitted in bulk
+    float positions[TEXT_LAYOUT_CHUNK_QUADS*8] = { 0 };
+    float texcoords[TEXT_LAYOUT_CHUNK_QUADS*8] = { 0 };
+
+    rlSetTexture(layout.font.texture.id);
+    rlBegin(RL_QUADS);
+
+        rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+        rlNormal3f(0.0f, 0.0f, 1.0f);                      // Normal vector pointing towards viewer
+
+        for (int i = 0; i < layout.quadCount; i += TEXT_LAYOUT_CHUNK_QUADS)
+        {
+            int count = layout.quadCount - i;
+            if (count > TEXT_LAYOUT_CHUNK_QUADS) count = TEXT_LAYOUT_CHUNK_QUADS;
+
+            for (int q = 0; q < count; q++)
+            {
+                const float *quad = &layout.quads[(i + q)*8];
+                float x0 = position.x + quad[0];
+                float y0 = position.y + quad[1];
+                float x1 = position.x + quad[2];
+                float y1 = position.y + quad[3];
+                float *pos = &positions[q*8];
+                float *uv = &texcoords[q*8];
+
+                // Same vertex order as DrawTexturePro(): top-left, bottom-left, bottom-right, top-right
+                pos[0] = x0; pos[1] = y0; uv[0] = quad[4]; uv[1] = quad[5];
+                pos[2] = x0; pos[3] = y1; uv[2] = quad[4]; uv[3] = quad[7];
+                pos[4] = x1; pos[5] = y1; uv[4] = quad[6]; uv[5] = quad[7];
+                pos[6] = x1; pos[7] = y0; uv[6] = quad[6]; uv[7] = quad[5];
+            }
+
+            rlVertexArray2f(positions, texcoords, NULL, count*4);
+        }
+
+    rlEnd();
+    rlSetTexture(0);
+
+    if (sdf) EndShaderMode();
 }
 
 // Set vertical line spacing when drawing with line-breaks
@@ -1212,6 +1588,40 @@ void SetTextLineSpacing(int spacing)
     textLineSpacing = spacing;
 }
 
+// Set outline for SDF fonts drawing
+// NOTE: Outline size is limited by the distance range stored in the atlas (FONT_SDF_PIXEL_DIST_SCALE)
+void SetTextOutlineSDF(float size, Color color)
+{
+    textOutlineSize = (size > 0.0f)? size : 0.0f;
+    textOutlineColor = color;
+}
+
+// Get shader to draw font at size
+// NOTE: For FONT_SDF fonts returns built-in SDF shader with smoothing and outline set for fontSize,
+// for bitmap fonts (or if SDF shader is not available) returns default shader
+Shader GetFontShader(Font font, float fontSize)
+{
+    Shader shader = { rlGetShaderIdDefault(), rlGetShaderLocsDefault() };
+
+    if ((font.type != FONT_SDF) || (textShaderSDF.id == 0) || (fontSize <= 0.0f)) return shader;
+
+    // Distance range covered by one screen pixel, distance is stored normalized [0..1] in atlas
+    float pixelDistance = (FONT_SDF_PIXEL_DIST_SCALE/255.0f)*((float)font.baseSize/fontSize);
+    float smoothing = 0.5f*pixelDistance;
+    float outlineWidth = textOutlineSize*pixelDistance;
+    float outlineMax = 0.5f - smoothing;
+
+    if (outlineWidth > outlineMax) outlineWidth = (outlineMax > 0.0f)? outlineMax : 0.0f;
+
+    float outlineColor[4] = { textOutlineColor.r/255.0f, textOutlineColor.g/255.0f, textOutlineColor.b/255.0f, textOutlineColor.a/255.0f };
+
+    SetShaderValue(textShaderSDF, textShaderSDFLocs[0], &smoothing, SHADER_UNIFORM_FLOAT);
+    SetShaderValue(textShaderSDF, textShaderSDFLocs[1], &outlineWidth, SHADER_UNIFORM_FLOAT);
+    SetShaderValue(textShaderSDF, textShaderSDFLocs[2], outlineColor, SHADER_UNIFORM_VEC4);
+
+    return textShaderSDF;
+}
+
 // Measure string width for default font
 int MeasureText(const char *text, int fontSize)
 {
@@ -1292,26 +1702,57 @@ int GetGlyphIndex(Font font, int codepoint)
 {
     int index = 0;
 
-#define SUPPORT_UNORDERED_CHARSET
-#if defined(SUPPORT_UNORDERED_CHARSET)
-    int fallbackIndex = 0;      // Get index of fallback glyph '?'
-
-    // Look for character index in the unordered charset
-    for (int i = 0; i < font.glyphCount; i++)
+    if (font.glyphLookup != NULL)
     {
-        if (font.glyphs[i].value == 63) fallbackIndex = i;
+        const rGlyphLookup *lookup = font.glyphLookup;
 
-        if (font.glyphs[i].value == codepoint)
+        if ((codepoint >= 0) && (codepoint < FONT_GLYPH_LOOKUP_DIRECT)) index = lookup->direct[codepoint];
+        else
         {
-            index = i;
-            break;
+            index = lookup->fallback;
+
+            if (lookup->hashMask >= 0)
+            {
+                unsigned int slot = GlyphLookupHash(codepoint) & lookup->hashMask;
+
+                // Linear probing until codepoint or empty slot found
+                while (lookup->hashKeys[slot] != -1)
+                {
+                    if (lookup->hashKeys[slot] == codepoint)
+                    {
+                        index = lookup->hashValues[slot];
+                        break;
+                    }
+
+                    slot = (slot + 1) & lookup->hashMask;
+                }
+            }
         }
     }
+    else
+    {
+        // Font without lookup index (i.e. font data filled by user or exported as code)
+#define SUPPORT_UNORDERED_CHARSET
+#if defined(SUPPORT_UNORDERED_CHARSET)
+        int fallbackIndex = 0;      // Get index of fallback glyph '?'
+
+        // Look for character index in the unordered charset
+        for (int i = 0; i < font.glyphCount; i++)
+        {
+            if (font.glyphs[i].value == 63) fallbackIndex = i;
 
-    if ((index == 0) && (font.glyphs[0].value != codepoint)) index = fallbackIndex;
+            if (font.glyphs[i].value == codepoint)
+            {
+                index = i;
+                break;
+            }
+        }
+
+        if ((index == 0) && (font.glyphs[0].value != codepoint)) index = fallbackIndex;
 #else
-    index = codepoint - 32;
+        index = codepoint - 32;
 #endif
+    }
 
     return index;
 }
@@ -2148,6 +2589,8 @@ static Font LoadBMFont(const char *fileName)
     UnloadImage(imFont);
     UnloadFileText(fileText);
 
+    font.glyphLookup = LoadGlyphLookup(font.glyphs, font.recs, font.glyphCount);
+
     if (font.texture.id == 0)
     {
         UnloadFont(font);
@@ -2160,4 +2603,233 @@ static Font LoadBMFont(const char *fileName)
 }
 #endif
 
+// Load glyphs lookup index, codepoint to glyph index
+// NOTE: First glyph is used for duplicated codepoints and fallback glyph '?' is resolved once,
+// same results as an ordered search over the glyphs array
+static rGlyphLookup *LoadGlyphLookup(const GlyphInfo *glyphs, const Rectangle *recs, int glyphCount)
+{
+    if ((glyphs == NULL) || (glyphCount <= 0)) return NULL;
+
+    rGlyphLookup *lookup = (rGlyphLookup *)RL_CALLOC(1, sizeof(rGlyphLookup));
+
+    // Get index of fallback glyph '?'
+    for (int i = 0; i < glyphCount; i++)
+    {
+        if (glyphs[i].value == 63)
+        {
+            lookup->fallback = i;
+            break;
+        }
+    }
+
+    // Get widest glyph advance, used for text culling bounds
+    for (int i = 0; i < glyphCount; i++)
+    {
+        float advance = (float)glyphs[i].advanceX;
+        if ((advance == 0) && (recs != NULL)) advance = recs[i].width;
+        if (advance > lookup->maxAdvance) lookup->maxAdvance = advance;
+    }
+
+    // Fill direct-mapped table, count codepoints out of range
+    int hashCount = 0;
+    for (int i = 0; i < FONT_GLYPH_LOOKUP_DIRECT; i++) lookup->direct[i] = -1;
+
+    for (int i = 0; i < glyphCount; i++)
+    {
+        int codepoint = glyphs[i].value;
+
+        if ((codepoint >= 0) && (codepoint < FONT_GLYPH_LOOKUP_DIRECT))
+        {
+            if (lookup->direct[codepoint] == -1) lookup->direct[codepoint] = i;
+        }
+        else hashCount++;
+    }
+
+    for (int i = 0; i < FONT_GLYPH_LOOKUP_DIRECT; i++) if (lookup->direct[i] == -1) lookup->direct[i] = lookup->fallback;
+
+    // Fill hash table, sized to keep load factor under 0.5
+    lookup->hashMask = -1;
+
+    if (hashCount > 0)
+    {
+        int hashSize = 8;
+        while (hashSize < 2*hashCount) hashSize *= 2;
+
+        lookup->hashMask = hashSize - 1;
+        lookup->hashKeys = (int *)RL_MALLOC(2*hashSize*sizeof(int));
+        lookup->hashValues = lookup->hashKeys + hashSize;
+
+        for (int i = 0; i < hashSize; i++) lookup->hashKeys[i] = -1;
+
+        for (int i = 0; i < glyphCount; i++)
+        {
+            int codepoint = glyphs[i].value;
+
+            if ((codepoint >= 0) && (codepoint < FONT_GLYPH_LOOKUP_DIRECT)) continue;
+
+            unsigned int slot = GlyphLookupHash(codepoint) & lookup->hashMask;
+
+            while ((lookup->hashKeys[slot] != -1) && (lookup->hashKeys[slot] != codepoint)) slot = (slot + 1) & lookup->hashMask;
+
+            if (lookup->hashKeys[slot] == -1)
+            {
+                lookup->hashKeys[slot] = codepoint;
+                lookup->hashValues[slot] = i;
+            }
+        }
+    }
+
+    return lookup;
+}
+
+// Unload glyphs lookup index
+static void UnloadGlyphLookup(rGlyphLookup *lookup)
+{
+    if (lookup != NULL)
+    {
+        RL_FREE(lookup->hashKeys);      // NOTE: hashValues share the same allocation
+        RL_FREE(lookup);
+    }
+}
+
+// Get glyphs lookup hash for codepoint (multiplicative hashing)
+static unsigned int GlyphLookupHash(int codepoint)
+{
+    unsigned int hash = (unsigned int)codepoint*2654435761u;
+
+    return hash ^ (hash >> 16);
+}
+
+// Load SDF font atlas texture, glyph images and lookup from SDF glyphs
+// NOTE: Glyph images are expected grayscale with FONT_SDF_CHAR_PADDING included
+static void LoadFontTextureSDF(Font *font, int packMethod)
+{
+    font->type = FONT_SDF;
+
+    Image atlas = GenImageFontAtlas(font->glyphs, &font->recs, font->glyphCount, font->baseSize, 0, packMethod);
+    font->texture = LoadTextureFromImage(atlas);
+
+    // NOTE: Distance field requires bilinear filtering to be interpolated
+    SetTextureFilter(font->texture, TEXTURE_FILTER_BILINEAR);
+
+    // Update glyphs[i].image to use alpha, same as LoadFontFromMemory()
+    for (int i = 0; i < font->glyphCount; i++)
+    {
+        UnloadImage(font->glyphs[i].image);
+        font->glyphs[i].image = ImageFromImage(atlas, font->recs[i]);
+    }
+
+    UnloadImage(atlas);
+
+    font->glyphLookup = LoadGlyphLookup(font->glyphs, font->recs, font->glyphCount);
+
+    LoadTextShaderSDF();
+}
+
+// Load built-in SDF shader (if not loaded)
+// NOTE: Distance is read from atlas alpha, edge at 0.5, smoothing set per font size by GetFontShader()
+static void LoadTextShaderSDF(void)
+{
+    if (textShaderSDF.id > 0) return;
+
+    static const char *fsCode100 =
+        "varying vec2 fragTexCoord;                 \n"
+        "varying vec4 fragColor;                    \n"
+        "uniform sampler2D texture0;                \n"
+        "uniform vec4 colDiffuse;                   \n"
+        "uniform float smoothing;                   \n"
+        "uniform float outlineWidth;                \n"
+        "uniform vec4 outlineColor;                 \n"
+        "void main()                                \n"
+        "{                                          \n"
+        "    float dist = texture2D(texture0, fragTexCoord).a; \n"
+        "    vec4 color = fragColor*colDiffuse;     \n"
+        "    float alpha = smoothstep(0.5 - smoothing, 0.5 + smoothing, dist); \n"
+        "    if (outlineWidth > 0.0)                \n"
+        "    {                                      \n"
+        "        color = mix(outlineColor, color, alpha); \n"
+        "        alpha = smoothstep(0.5 - outlineWidth - smoothing, 0.5 - outlineWidth + smoothing, dist); \n"
+        "    }                                      \n"
+        "    gl_FragColor = vec4(color.rgb, color.a*alpha); \n"
+        "}                                          \n";
+
+    static const char *fsCode330 =
+        "#version 330                               \n"
+        "in vec2 fragTexCoord;                      \n"
+        "in vec4 fragColor;                         \n"
+        "out vec4 finalColor;                       \n"
+        "uniform sampler2D texture0;                \n"
+        "uniform vec4 colDiffuse;                   \n"
+        "uniform float smoothing;                   \n"
+        "uniform float outlineWidth;                \n"
+        "uniform vec4 outlineColor;                 \n"
+        "void main()                                \n"
+        "{                                          \n"
+        "    float dist = texture(texture0, fragTexCoord).a; \n"
+        "    vec4 color = fragColor*colDiffuse;     \n"
+        "    float alpha = smoothstep(0.5 - smoothing, 0.5 + smoothing, dist); \n"
+        "    if (outlineWidth > 0.0)                \n"
+        "    {                                      \n"
+        "        color = mix(outlineColor, color, alpha); \n"
+        "        alpha = smoothstep(0.5 - outlineWidth - smoothing, 0.5 - outlineWidth + smoothing, dist); \n"
+        "    }                                      \n"
+        "    finalColor = vec4(color.rgb, color.a*alpha); \n"
+        "}                                          \n";
+
+    char fsCode[2048] = { 0 };
+    int version = rlGetVersion();
+
+    // NOTE: Default vertex shader is used (NULL), it provides fragTexCoord and fragColor
+    if ((version == RL_OPENGL_ES_20) || (version == RL_OPENGL_ES_30)) snprintf(fsCode, sizeof(fsCode), "#version 100\nprecision mediump float;\n%s", fsCode100);
+    else if (version == RL_OPENGL_21) snprintf(fsCode, sizeof(fsCode), "#version 120\n%s", fsCode100);
+    else if ((version == RL_OPENGL_33) || (version == RL_OPENGL_43)) snprintf(fsCode, sizeof(fsCode), "%s", fsCode330);
+    else
+    {
+        TRACELOG(LOG_WARNING, "FONT: SDF shader not supported, SDF fonts drawn without shader");
+        return;
+    }
+
+    textShaderSDF = LoadShaderFromMemory(NULL, fsCode);
+
+    if ((textShaderSDF.id > 0) && (textShaderSDF.id != rlGetShaderIdDefault()))
+    {
+        textShaderSDFLocs[0] = GetShaderLocation(textShaderSDF, "smoothing");
+        textShaderSDFLocs[1] = GetShaderLocation(textShaderSDF, "outlineWidth");
+        textShaderSDFLocs[2] = GetShaderLocation(textShaderSDF, "outlineColor");
+
+        TRACELOG(LOG_INFO, "FONT: SDF shader loaded successfully");
+    }
+    else textShaderSDF = (Shader){ 0 };     // NOTE: Failed shaders fall back to default shader id, not to be unloaded
+}
+
+#if defined(SUPPORT_TEXT_CULLING)
+// Check if text is outside viewport and scissor area (culled)
+// NOTE: A conservative bound is checked first, every byte advancing by the widest glyph and every
+// '\n' by the line spacing, text is only measured when that bound is partly visible.
+// Bounds are expanded by half the font size for glyphs offsets and padding
+static bool CheckTextCulled(Font font, const char *text, int size, Vector2 position, float fontSize, float spacing)
+{
+    float margin = fontSize/2.0f;
+
+    if (font.glyphLookup != NULL)
+    {
+        int lineCount = 1;
+        for (int i = 0; i < size; i++) if (text[i] == '\n') lineCount++;
+
+        float scaleFactor = fontSize/font.baseSize;
+        float width = size*(font.glyphLookup->maxAdvance*scaleFactor + fmaxf(spacing, 0.0f));
+        float linesOffset = (float)((lineCount - 1)*textLineSpacing);
+        float y = position.y + fminf(linesOffset, 0.0f);
+        float height = fabsf(linesOffset) + fontSize;
+
+        if (rlCheckCulledRec(position.x - margin, y - margin, width + 2*margin, height + 2*margin)) return true;
+        if (rlCheckVisibleRec(position.x - margin, y - margin, width + 2*margin, height + 2*margin)) return false;
+    }
+
+    Vector2 textSize = MeasureTextEx(font, text, fontSize, spacing);
+
+    return rlCheckCulledRec(position.x - margin, position.y - margin, textSize.x + 2*margin, textSize.y + 2*margin);
+}
+#endif
+
 #endif      // SUPPORT_MODULE_RTEXT
@@ -34,6 +34,10 @@
 *       #define SUPPORT_IMAGE_GENERATION
 *           Support procedural image generation functionality (gradient, spot, perlin-noise, cellular)
 *
+*       #define SUPPORT_IMAGE_THREADS
+*           Support a pool of worker threads for heavy image processing, like ImageBlurGaussian() or ImageResize(),
+*           requires pthreads, results are identical to single-threaded processing
+*
 *   DEPENDENCIES:
 *       stb_image        - Multiple image formats loading (JPEG, PNG, BMP, TGA, PSD, GIF, PIC)
 *                          NOTE: stb_image has been slightly modified to support Android platform.
@@ -78,6 +82,24 @@
 #include <math.h>               // Required for: fabsf() [Used in DrawTextureRec()]
 #include <stdio.h>              // Required for: sprintf() [Used in ExportImageAsCode()]
 
+#if defined(SUPPORT_IMAGE_THREADS)
+    #include <pthread.h>        // Required for: pthread_create(), pthread_cond_wait()
+    #include <sched.h>          // Required for: sched_yield() [Used in ImageDither()]
+    #include <unistd.h>         // Required for: sysconf()
+#endif
+
+// SIMD code paths, selected at compile time
+// NOTE: SIMD functions compute exactly the same results than scalar ones
+#if !defined(RTEXTURES_DISABLE_SIMD)
+    #if defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #include <arm_neon.h>       // Required for: NEON intrinsics [Used in PackPixelsRGBA8(), UnpackPixelsRGBA8()]
+        #define RTEXTURES_SIMD_NEON
+    #elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #include <emmintrin.h>      // Required for: SSE2 intrinsics [Used in PackPixelsRGBA8(), UnpackPixelsRGBA8()]
+        #define RTEXTURES_SIMD_SSE2
+    #endif
+#endif
+
 // Support only desired texture formats on stb_image
 #if !defined(SUPPORT_FILEFORMAT_BMP)
     #define STBI_NO_BMP
@@ -203,6 +225,11 @@
 
     #define STB_IMAGE_WRITE_IMPLEMENTATION
     #include "external/stb_image_write.h"   // Required for: stbi_write_*()
+
+    #if defined(SUPPORT_FILEFORMAT_PNG) && defined(SUPPORT_COMPRESSION_API)
+        #include "external/sdefl.h"         // Required for: sdeflate_part() [Used in ExportImageToMemoryPNG()]
+                                            // NOTE: Implementation is included by rcore module (compression API)
+    #endif
 #endif
 
 #if defined(SUPPORT_IMAGE_GENERATION)
@@ -210,10 +237,23 @@
     #include "external/stb_perlin.h"        // Required for: stb_perlin_fbm_noise3
 #endif
 
+#if defined(__GNUC__) // GCC and Clang
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wunused-function"
+#endif
+
+#define STBRP_STATIC
+#define STB_RECT_PACK_IMPLEMENTATION
+#include "external/stb_rect_pack.h"     // Required for: stbrp_pack_rects() [Used in AddTextureAtlasImage()]
+
+#if defined(__GNUC__) // GCC and Clang
+    #pragma GCC diagnostic pop
+#endif
+
 #define STBIR_MALLOC(size,c) ((void)(c), RL_MALLOC(size))
 #define STBIR_FREE(ptr,c) ((void)(c), RL_FREE(ptr))
 #define STB_IMAGE_RESIZE_IMPLEMENTATION
-#include "external/stb_image_resize2.h"  // Required for: stbir_resize_uint8_linear() [ImageResize()]
+#include "external/stb_image_resize2.h"  // Required for: stbir_resize_extended_split() [ImageResize()]
 
 #if defined(SUPPORT_FILEFORMAT_SVG)
 	#define NANOSVG_IMPLEMENTATION	// Expands implementation
@@ -230,19 +270,235 @@
     #define PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD  50    // Threshold over 255 to set alpha as 0
 #endif
 
+#ifndef PIXELFORMAT_CONVERSION_CHUNK_SIZE
+    #define PIXELFORMAT_CONVERSION_CHUNK_SIZE  256    // Pixels converted per pass when an intermediate format is required
+#endif
+
 #ifndef GAUSSIAN_BLUR_ITERATIONS
     #define GAUSSIAN_BLUR_ITERATIONS  4    // Number of box blur iterations to approximate gaussian blur
 #endif
+#ifndef GAUSSIAN_BLUR_TILE_COLUMNS
+    #define GAUSSIAN_BLUR_TILE_COLUMNS  1024    // Columns blurred together, window sums must fit in cache
+#endif
+
+#ifndef PNG_DEFLATE_CHUNK_SIZE
+    #define PNG_DEFLATE_CHUNK_SIZE  (256*1024)  // Filtered bytes per deflate chunk, chunks are compressed independently
+#endif
+
+#ifndef MAX_TEXTURE_ATLAS_IMAGES
+    #define MAX_TEXTURE_ATLAS_IMAGES  65536     // Maximum number of images in a texture atlas, handles index range
+#endif
+
+#ifndef TEXTURE_LOADER_THREADS
+    #define TEXTURE_LOADER_THREADS     2    // Number of threads reading and decoding textures loaded asynchronously
+#endif
+#ifndef TEXTURE_UPLOAD_BUDGET_BYTES
+    #define TEXTURE_UPLOAD_BUDGET_BYTES  (4*1024*1024)  // Maximum texture data uploaded per frame (at least one texture is uploaded)
+#endif
+#ifndef TEXTURE_UPLOAD_BUDGET_TIME
+    #define TEXTURE_UPLOAD_BUDGET_TIME   4.0    // Maximum time uploading textures per frame (milliseconds)
+#endif
+
+#ifndef IMAGE_THREADS_MAX
+    #define IMAGE_THREADS_MAX          8    // Maximum number of threads used for image processing, one per big core
+#endif
+#ifndef IMAGE_THREADS_COUNT
+    #define IMAGE_THREADS_COUNT        0    // Number of threads used for image processing (up to IMAGE_THREADS_MAX), 0: one per big core
+#endif
+#ifndef IMAGE_THREADS_MIN_PIXELS
+    #define IMAGE_THREADS_MIN_PIXELS   65536    // Minimum number of pixels processed to use worker threads
+#endif
+
+#ifndef MIN
+    #define MIN(a,b) (((a)<(b))?(a):(b))
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Image rows processing function, processes rows in range [rowStart, rowEnd)
+typedef void (*ImageRowsCallback)(void *data, int rowStart, int rowEnd);
+
+// Blur pass data, source RGBA8 pixels are processed into destination
+typedef struct BlurPass {
+    const unsigned char *src;       // Source RGBA8 pixels, width*height
+    unsigned char *dst;             // Destination RGBA8 pixels, same size than source
+    int width;                      // Source width
+    int height;                     // Source height
+    int radius;                     // Box radius, window size is 2*radius + 1 (clipped by image borders)
+    const unsigned int *inverse;    // Window size inverses: round(2^24/size)
+} BlurPass;
+
+// Color adjustment pass data, RGBA8 pixels are modified in place
+typedef struct ColorPass {
+    Color *pixels;                  // RGBA8 pixels
+    int width;                      // Image width
+    Color color;                    // Tint color [Used in ImageColorTint()]
+    int brightness;                 // Brightness offset [Used in ImageColorBrightness()]
+} ColorPass;
+
+// Rotation pass data, source pixels are sampled into destination rows
+typedef struct RotatePass {
+    const unsigned char *src;       // Source pixels, srcWidth*srcHeight
+    unsigned char *dst;             // Destination pixels, width*height
+    int srcWidth;                   // Source width
+    int srcHeight;                  // Source height
+    int width;                      // Destination width
+    int height;                     // Destination height
+    int bytesPerPixel;              // Bytes per pixel, same for source and destination
+    float sinRadius;                // Rotation angle sine
+    float cosRadius;                // Rotation angle cosine
+} RotatePass;
+
+// Dithering pass data, rows are interleaved between lanes
+typedef struct DitherPass {
+    Color *pixels;                  // RGBA8 pixels, error is diffused into them
+    unsigned short *output;         // Dithered pixels
+    int width;                      // Image width
+    int height;                     // Image height
+    int rBpp, gBpp, bBpp, aBpp;     // Bits per channel
+    int lanes;                      // Number of lanes, row y is processed in lane y%lanes
+    int *progress;                  // Pixels processed per row
+} DitherPass;
+
+// Image generation pass data, parameters used depend on generator
+typedef struct GeneratorPass {
+    Color *pixels;                  // RGBA8 pixels
+    int width;                      // Image width
+    int height;                     // Image height
+    Color colors[2];                // Gradient start/end, inner/outer or checked colors
+    float cosDir, sinDir;           // Gradient direction [Used in GenImageGradientLinear()]
+    float density;                  // Gradient density [Used in GenImageGradientRadial(), GenImageGradientSquare()]
+    int checksX, checksY;           // Checks size [Used in GenImageChecked()]
+    int offsetX, offsetY;           // Noise offset [Used in GenImagePerlinNoise()]
+    float scale;                    // Noise scale [Used in GenImagePerlinNoise()]
+    int tileSize;                   // Cells size [Used in GenImageCellular()]
+    int seedsPerRow, seedsPerCol;   // Cells count [Used in GenImageCellular()]
+    const Vector2 *seeds;           // Cells seeds [Used in GenImageCellular()]
+} GeneratorPass;
+
+// Texture loaded asynchronously, file is read and decoded on a loader thread and uploaded on GL thread
+// NOTE: Texture is the first member, its address is the handle returned to user
+typedef struct TextureRequest {
+    Texture2D texture;              // Texture, id is 0 until uploaded
+    char *fileName;                 // Texture file name
+    Image image;                    // Decoded image, waiting for upload
+    bool uploaded;                  // Upload done (or failed), request owned by user
+    bool cancelled;                 // Unloaded by user before upload, request freed by loader
+    struct TextureRequest *next;    // Next request in queue
+} TextureRequest;
+
+// Textures loader, requests go through decode and upload queues
+typedef struct TextureLoader {
+#if defined(SUPPORT_IMAGE_THREADS)
+    pthread_mutex_t lock;           // Queues lock
+    pthread_cond_t requestReady;    // Signaled when a request is queued for decoding (or on close)
+    pthread_t threads[TEXTURE_LOADER_THREADS];  // Loader threads, joined on close
+    int threadCount;                // Loader threads running
+    bool ready;                     // Loader threads have been created
+    bool quit;                      // Loader threads exit requested
+#endif
+    TextureRequest *decodeHead;     // Requests waiting to be decoded (oldest)
+    TextureRequest *decodeTail;     // Requests waiting to be decoded (newest)
+    TextureRequest *uploadHead;     // Requests decoded, waiting to be uploaded (oldest)
+    TextureRequest *uploadTail;     // Requests decoded, waiting to be uploaded (newest)
+    int budgetBytes;                // Maximum texture data uploaded per frame
+    double budgetTime;              // Maximum time uploading per frame (seconds)
+    UploadTextureCallback upload;   // Upload function, LoadTextureFromImage() by default
+} TextureLoader;
+
+// Texture atlas image, packed into a page with padding around it
+typedef struct AtlasImage {
+    int page;                       // Page index, -1 if image slot is free
+    int x;                          // Packed rectangle position X (padding included)
+    int y;                          // Packed rectangle position Y (padding included)
+    int width;                      // Image width (padding excluded)
+    int height;                     // Image height (padding excluded)
+    unsigned int generation;        // Slot generation, increased when image is removed (stale handles detection)
+    unsigned int lastUse;           // Last use stamp, least recently used images are evicted first
+} AtlasImage;
+
+// Texture atlas page, images are packed with skyline algorithm
+// NOTE: Skyline can not reuse space of removed images, page is repacked (defragmented) to reclaim it
+typedef struct AtlasPage {
+    Texture2D texture;              // Page texture (RGBA8)
+    unsigned char *pixels;          // Page pixels copy (RGBA8), required to repack page
+    stbrp_context context;          // Skyline packing context
+    stbrp_node *nodes;              // Skyline nodes, one per page column
+    int packedArea;                 // Area used by skyline, removed images included
+    int usedArea;                   // Area used by images in page
+    int imageCount;                 // Number of images in page
+} AtlasPage;
+
+// Texture atlas, images packed at runtime into shared texture pages
+struct TextureAtlas {
+    int pageWidth;                  // Pages width
+    int pageHeight;                 // Pages height
+    int padding;                    // Padding around images, filled extruding image edges
+    int maxPages;                   // Maximum number of pages, least recently used images are evicted when full
+    int pageCount;                  // Number of pages
+    AtlasPage *pages;               // Pages
+    int imageCapacity;              // Number of image slots
+    AtlasImage *images;             // Images slots, handle is slot index plus slot generation
+    unsigned int useCounter;        // Use stamps counter
+};
+
+#if defined(SUPPORT_IMAGE_EXPORT) && defined(SUPPORT_FILEFORMAT_PNG) && defined(SUPPORT_COMPRESSION_API)
+// PNG encoding pass data, rows are filtered and filtered data is deflated in independent chunks
+typedef struct PngPass {
+    const unsigned char *pixels;    // Source pixels, 8 bit per channel
+    unsigned char *filtered;        // Filtered rows, filter type byte followed by row data
+    int width;                      // Image width
+    int height;                     // Image height
+    int channels;                   // Channels per pixel
+    int level;                      // Deflate compression level
+    int chunkSize;                  // Filtered bytes per chunk
+    int chunkCount;                 // Number of chunks
+    unsigned char **chunks;         // Compressed chunks, every chunk is written as an IDAT chunk
+    int *chunkSizes;                // Compressed chunks size, IDAT length, type and CRC included
+    unsigned int *adlers;           // Filtered data checksum (Adler-32) per chunk
+} PngPass;
+#endif
+
+#if defined(SUPPORT_IMAGE_THREADS)
+// Image processing threads pool
+// NOTE: Workers sleep until a job is submitted, every thread processes one contiguous rows range of the job
+typedef struct ImageThreadPool {
+    pthread_mutex_t dispatch;       // Held while a job is processed, overlapping jobs are processed on calling thread
+    pthread_mutex_t lock;           // Job state lock
+    pthread_cond_t jobReady;        // Signaled when a job is submitted
+    pthread_cond_t jobDone;         // Signaled when workers have processed their rows ranges
+    int threadCount;                // Number of threads, calling thread included
+    unsigned int jobId;             // Current job id, increased for every job
+    ImageRowsCallback callback;     // Current job rows processing function
+    void *data;                     // Current job data
+    int rows;                       // Current job rows count
+    int ranges;                     // Current job rows ranges count, one per thread
+    int pending;                    // Current job rows ranges not processed yet by workers
+} ImageThreadPool;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// It's lonely here...
+#if defined(SUPPORT_IMAGE_THREADS)
+static ImageThreadPool imageThreads = {
+    .dispatch = PTHREAD_MUTEX_INITIALIZER,
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .jobReady = PTHREAD_COND_INITIALIZER,
+    .jobDone = PTHREAD_COND_INITIALIZER
+};
+static pthread_once_t imageThreadsOnce = PTHREAD_ONCE_INIT;     // Image threads pool is initialized on first use
+#endif
+
+static TextureLoader textureLoader = {
+#if defined(SUPPORT_IMAGE_THREADS)
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .requestReady = PTHREAD_COND_INITIALIZER,
+#endif
+    .budgetBytes = TEXTURE_UPLOAD_BUDGET_BYTES,
+    .budgetTime = TEXTURE_UPLOAD_BUDGET_TIME/1000.0
+};
 
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
@@ -254,7 +510,49 @@ extern void LoadFontDefault(void);          // [Module: text] Loads default font
 //----------------------------------------------------------------------------------
 static float HalfToFloat(unsigned short x);
 static unsigned short FloatToHalf(float x);
-static Vector4 *LoadImageDataNormalized(Image image);       // Load pixel data from image as Vector4 array (float normalized)
+static void UnpackPixelsRGBA8(const void *src, int format, int count, unsigned char *dst);     // Unpack pixels to RGBA8, only formats up to 8 bit per channel
+static void PackPixelsRGBA8(const unsigned char *src, int count, int format, void *dst);        // Pack RGBA8 pixels, only formats up to 8 bit per channel
+static void UnpackPixelsNormalized(const void *src, int format, int count, Vector4 *dst);       // Unpack pixels as Vector4 (float normalized), only 16 and 32 bit per channel formats
+static void PackPixelsNormalized(const Vector4 *src, int count, int format, void *dst);         // Pack Vector4 (float normalized) pixels, only 16 and 32 bit per channel formats
+static void ConvertPixels(const void *src, int srcFormat, int count, void *dst, int dstFormat); // Convert pixels between uncompressed formats
+static void BlendPixelsRGBA8(const void *src, int srcFormat, unsigned char *dst, int count, Color tint); // Blend pixels over RGBA8 pixels, only 8 bit per channel source formats [Used in ImageDraw()]
+static void CompleteTextureRequest(TextureRequest *request, Image image);                       // Queue decoded request for upload, cancelled requests are freed (called under loader lock)
+#if defined(SUPPORT_IMAGE_THREADS)
+static void InitTextureLoader(void);                                                            // Init texture loader threads (called under loader lock)
+static void *TextureLoaderThread(void *arg);                                                    // Texture loader thread, reads and decodes queued requests
+#endif
+static int GetAtlasImageIndex(TextureAtlas *atlas, int handle);                                 // Get atlas image slot index from handle, -1 if handle is not valid
+static bool PackAtlasImage(TextureAtlas *atlas, int page, int width, int height, int *x, int *y); // Pack rectangle into atlas page skyline
+static void RepackAtlasPage(TextureAtlas *atlas, int page);                                     // Repack atlas page images, reclaiming space of removed images
+static void RemoveAtlasImage(TextureAtlas *atlas, int index);                                   // Remove image from atlas page, page skyline reset when empty
+static int GetImageThreadCount(void);                                                            // Get number of threads used for image processing
+static void ProcessImageRows(ImageRowsCallback callback, void *data, int rows, int rowSize);    // Process image rows, split across worker threads
+static void ResizeSplits(void *data, int splitStart, int splitEnd);                              // Resize output pixels splits [Used in ResizePixels()]
+static void ResizePixels(const unsigned char *input, int width, int height, unsigned char *output, int newWidth, int newHeight, int channels); // Resize 8 bit per channel pixels [Used in ImageResize()]
+static void BlurBoxColumns(void *data, int columnStart, int columnEnd);                         // Box blur columns [Used in ImageBlurGaussian()]
+static void TransposeRows(void *data, int rowStart, int rowEnd);                                // Transpose RGBA8 rows into columns [Used in ImageBlurGaussian()]
+static void AlphaPremultiplyRows(void *data, int rowStart, int rowEnd);                         // Premultiply alpha of RGBA8 rows [Used in ImageBlurGaussian()]
+static void AlphaUnpremultiplyRows(void *data, int rowStart, int rowEnd);                       // Reverse alpha premultiply of RGBA8 rows [Used in ImageBlurGaussian()]
+#if defined(SUPPORT_IMAGE_EXPORT) && defined(SUPPORT_FILEFORMAT_PNG) && defined(SUPPORT_COMPRESSION_API)
+static void FilterPngRows(void *data, int rowStart, int rowEnd);                                // Filter PNG rows, best filter estimated per row [Used in ExportImageToMemoryPNG()]
+static void CompressPngChunks(void *data, int chunkStart, int chunkEnd);                        // Deflate filtered data chunks into IDAT chunks [Used in ExportImageToMemoryPNG()]
+static unsigned int ComputeAdler32(const unsigned char *data, int dataSize);                    // Compute Adler-32 checksum [Used in ExportImageToMemoryPNG()]
+static unsigned int CombineAdler32(unsigned int adler1, unsigned int adler2, int dataSize2);   // Combine Adler-32 checksums of consecutive data [Used in ExportImageToMemoryPNG()]
+#endif
+#if defined(SUPPORT_IMAGE_GENERATION)
+static void GenGradientLinearRows(void *data, int rowStart, int rowEnd);                        // Generate linear gradient rows [Used in GenImageGradientLinear()]
+static void GenGradientRadialRows(void *data, int rowStart, int rowEnd);                        // Generate radial gradient rows [Used in GenImageGradientRadial()]
+static void GenGradientSquareRows(void *data, int rowStart, int rowEnd);                        // Generate square gradient rows [Used in GenImageGradientSquare()]
+static void GenCheckedRows(void *data, int rowStart, int rowEnd);                               // Generate checked rows [Used in GenImageChecked()]
+static void GenPerlinNoiseRows(void *data, int rowStart, int rowEnd);                           // Generate perlin noise rows [Used in GenImagePerlinNoise()]
+static void GenCellularRows(void *data, int rowStart, int rowEnd);                              // Generate cellular rows [Used in GenImageCellular()]
+#endif
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+static void DitherRows(void *data, int laneStart, int laneEnd);                                 // Dither RGBA8 rows lanes [Used in ImageDither()]
+static void RotateRows(void *data, int rowStart, int rowEnd);                                   // Rotate image rows [Used in ImageRotate()]
+static void ColorTintRows(void *data, int rowStart, int rowEnd);                                // Tint RGBA8 rows [Used in ImageColorTint()]
+static void ColorBrightnessRows(void *data, int rowStart, int rowEnd);                          // Change brightness of RGBA8 rows [Used in ImageColorBrightness()]
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -278,14 +576,16 @@ Image LoadImage(const char *fileName)
     #define STBI_REQUIRED
 #endif
 
-    // Loading file to memory
-    int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    // Loading file view (memory-mapped, no copy)
+    FileView view = LoadFileView(fileName);
+
+    // NOTE: Images could be stored as QOI in asset packs, whatever the file extension
+    const char *fileType = (view.type == FILE_VIEW_PACKED_QOI)? ".qoi" : GetFileExtension(fileName);
 
     // Loading image from memory data
-    if (fileData != NULL) image = LoadImageFromMemory(GetFileExtension(fileName), fileData, dataSize);
+    if (view.data != NULL) image = LoadImageFromMemory(fileType, view.data, view.size);
 
-    RL_FREE(fileData);
+    UnloadFileView(view);
 
     return image;
 }
@@ -295,24 +595,28 @@ Image LoadImageRaw(const char *fileName, int width, int height, int format, int
 {
     Image image = { 0 };
 
-    int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    FileView view = LoadFileView(fileName);
 
-    if (fileData != NULL)
+    if (view.data != NULL)
     {
-        unsigned char *dataPtr = fileData;
+        const unsigned char *dataPtr = view.data;
         unsigned int size = GetPixelDataSize(width, height, format);
 
         if (headerSize > 0) dataPtr += headerSize;
 
-        image.data = RL_MALLOC(size);      // Allocate required memory in bytes
-        memcpy(image.data, dataPtr, size); // Copy required data to image
-        image.width = width;
-        image.height = height;
-        image.mipmaps = 1;
-        image.format = format;
+        // NOTE: Reading past the end of a memory-mapped file is not allowed
+        if (((long long)headerSize + size) <= view.size)
+        {
+            image.data = RL_MALLOC(size);      // Allocate required memory in bytes
+            memcpy(image.data, dataPtr, size); // Copy required data to image
+            image.width = width;
+            image.height = height;
+            image.mipmaps = 1;
+            image.format = format;
+        }
+        else TRACELOG(LOG_WARNING, "IMAGE: [%s] RAW image data size is smaller than expected", fileName);
 
-        RL_FREE(fileData);
+        UnloadFileView(view);
     }
 
     return image;
@@ -409,19 +713,18 @@ Image LoadImageAnim(const char *fileName, int *frames)
 #if defined(SUPPORT_FILEFORMAT_GIF)
     if (IsFileExtension(fileName, ".gif"))
     {
-        int dataSize = 0;
-        unsigned char *fileData = LoadFileData(fileName, &dataSize);
+        FileView view = LoadFileView(fileName);
 
-        if (fileData != NULL)
+        if (view.data != NULL)
         {
             int comp = 0;
             int *delays = NULL;
-            image.data = stbi_load_gif_from_memory(fileData, dataSize, &delays, &image.width, &image.height, &frameCount, &comp, 4);
+            image.data = stbi_load_gif_from_memory(view.data, view.size, &delays, &image.width, &image.height, &frameCount, &comp, 4);
 
             image.mipmaps = 1;
             image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
 
-            RL_FREE(fileData);
+            UnloadFileView(view);
             RL_FREE(delays);        // NOTE: Frames delays are discarded
         }
     }
@@ -444,6 +747,12 @@ Image LoadImageFromMemory(const char *fileType, const unsigned char *fileData, i
 {
     Image image = { 0 };
 
+#if defined(SUPPORT_FILEFORMAT_QOI)
+    // NOTE: Images stored as QOI in asset packs keep their file name (i.e. LoadFileData() data),
+    // they are recognized by QOI magic whatever the file type provided
+    if ((fileData != NULL) && (dataSize >= 14) && (memcmp(fileData, "qoif", 4) == 0)) fileType = ".qoi";
+#endif
+
     if ((false)
 #if defined(SUPPORT_FILEFORMAT_PNG)
         || (strcmp(fileType, ".png") == 0) || (strcmp(fileType, ".PNG") == 0)
@@ -769,7 +1078,147 @@ unsigned char *ExportImageToMemory(Image image, const char *fileType, int *dataS
         fileData = stbi_write_png_to_mem((const unsigned char *)image.data, image.width*channels, image.width, image.height, channels, dataSize);
     }
 #endif
+#if defined(SUPPORT_FILEFORMAT_QOI)
+    if ((strcmp(fileType, ".qoi") == 0) || (strcmp(fileType, ".QOI") == 0))
+    {
+        if ((image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) || (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+        {
+            qoi_desc desc = { 0 };
+            desc.width = image.width;
+            desc.height = image.height;
+            desc.channels = channels;
+            desc.colorspace = QOI_SRGB;
+
+            fileData = (unsigned char *)qoi_encode(image.data, &desc, dataSize);
+        }
+        else TRACELOG(LOG_WARNING, "IMAGE: Image pixel format must be R8G8B8 or R8G8B8A8");
+    }
+#endif
+
+#endif
+
+    return fileData;
+}
+
+// Export image to memory buffer as PNG, compression level in range [0..8]
+// NOTE: Deflate stream can be split in chunks compressed independently in parallel,
+// files are slightly bigger (no matches across chunks) but encoding scales with threads
+unsigned char *ExportImageToMemoryPNG(Image image, int compressionLevel, bool parallel, int *dataSize)
+{
+    unsigned char *fileData = NULL;
+    *dataSize = 0;
+
+    if ((image.width == 0) || (image.height == 0) || (image.data == NULL)) return NULL;
+
+#if defined(SUPPORT_IMAGE_EXPORT) && defined(SUPPORT_FILEFORMAT_PNG)
+    int channels = 4;
+    bool allocatedData = false;
+    unsigned char *imgData = (unsigned char *)image.data;
+
+    if (image.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) channels = 1;
+    else if (image.format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) channels = 2;
+    else if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) channels = 3;
+    else if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) channels = 4;
+    else
+    {
+        // NOTE: Getting Color array as RGBA unsigned char values
+        imgData = (unsigned char *)LoadImageColors(image);
+        allocatedData = true;
+    }
+
+#if defined(SUPPORT_COMPRESSION_API)
+    if (compressionLevel < SDEFL_LVL_MIN) compressionLevel = SDEFL_LVL_MIN;
+    if (compressionLevel > SDEFL_LVL_MAX) compressionLevel = SDEFL_LVL_MAX;
+
+    PngPass pass = { 0 };
+    pass.pixels = imgData;
+    pass.width = image.width;
+    pass.height = image.height;
+    pass.channels = channels;
+    pass.level = compressionLevel;
+
+    int filteredSize = image.height*(image.width*channels + 1);
+    pass.filtered = (unsigned char *)RL_MALLOC(filteredSize);
+    pass.chunkSize = parallel? PNG_DEFLATE_CHUNK_SIZE : filteredSize;
+    pass.chunkCount = (filteredSize + pass.chunkSize - 1)/pass.chunkSize;
+    pass.chunks = (unsigned char **)RL_CALLOC(pass.chunkCount, sizeof(unsigned char *));
+    pass.chunkSizes = (int *)RL_CALLOC(pass.chunkCount, sizeof(int));
+    pass.adlers = (unsigned int *)RL_CALLOC(pass.chunkCount, sizeof(unsigned int));
+
+    if (parallel)
+    {
+        ProcessImageRows(FilterPngRows, &pass, image.height, image.width);
+        ProcessImageRows(CompressPngChunks, &pass, pass.chunkCount, pass.chunkSize/4);
+    }
+    else
+    {
+        FilterPngRows(&pass, 0, image.height);
+        CompressPngChunks(&pass, 0, pass.chunkCount);
+    }
+
+    // Filtered data checksum, appended to zlib stream in its own IDAT chunk
+    unsigned int adler = pass.adlers[0];
+    int size = 8 + 25 + 16 + 12;    // Signature, IHDR, checksum IDAT and IEND
+    bool success = true;
+
+    for (int i = 0; i < pass.chunkCount; i++)
+    {
+        if (pass.chunks[i] == NULL) success = false;
+        if (i > 0) adler = CombineAdler32(adler, pass.adlers[i], MIN(pass.chunkSize, filteredSize - i*pass.chunkSize));
+        size += pass.chunkSizes[i];
+    }
+
+    if (success) fileData = (unsigned char *)RL_MALLOC(size);
+
+    if (fileData != NULL)
+    {
+        static const unsigned char signature[8] = { 137, 80, 78, 71, 13, 10, 26, 10 };
+        static const unsigned char colorType[5] = { 0, 0, 4, 2, 6 };
+        unsigned char *output = fileData;
+
+        memcpy(output, signature, 8);
+        output += 8;
+
+        stbiw__wp32(output, 13);
+        stbiw__wptag(output, "IHDR");
+        stbiw__wp32(output, image.width);
+        stbiw__wp32(output, image.height);
+        *output++ = 8;                  // Bit depth
+        *output++ = colorType[channels];
+        *output++ = 0;                  // Compression method: deflate
+        *output++ = 0;                  // Filter method: adaptive
+        *output++ = 0;                  // Interlace method: none
+        stbiw__wpcrc(&output, 13);
+
+        for (int i = 0; i < pass.chunkCount; i++)
+        {
+            memcpy(output, pass.chunks[i], pass.chunkSizes[i]);
+            output += pass.chunkSizes[i];
+        }
+
+        stbiw__wp32(output, 4);
+        stbiw__wptag(output, "IDAT");
+        stbiw__wp32(output, adler);
+        stbiw__wpcrc(&output, 4);
+
+        stbiw__wp32(output, 0);
+        stbiw__wptag(output, "IEND");
+        stbiw__wpcrc(&output, 0);
+
+        *dataSize = size;
+    }
+
+    for (int i = 0; i < pass.chunkCount; i++) RL_FREE(pass.chunks[i]);
+    RL_FREE(pass.chunks);
+    RL_FREE(pass.chunkSizes);
+    RL_FREE(pass.adlers);
+    RL_FREE(pass.filtered);
+#else
+    // Compression API not available, stb_image_write compressor used (single thread)
+    fileData = stbi_write_png_to_mem((const unsigned char *)imgData, image.width*channels, image.width, image.height, channels, dataSize);
+#endif
 
+    if (allocatedData) RL_FREE(imgData);
 #endif
 
     return fileData;
@@ -863,27 +1312,12 @@ Image GenImageGradientLinear(int width, int height, int direction, Color start,
     Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
 
     float radianDirection = (float)(90 - direction)/180.f*3.14159f;
-    float cosDir = cosf(radianDirection);
-    float sinDir = sinf(radianDirection);
-
-    for (int i = 0; i < width; i++)
-    {
-        for (int j = 0; j < height; j++)
-        {
-            // Calculate the relative position of the pixel along the gradient direction
-            float pos = (i*cosDir + j*sinDir)/(width*cosDir + height*sinDir);
 
-            float factor = pos;
-            factor = (factor > 1.0f)? 1.0f : factor;  // Clamp to [0,1]
-            factor = (factor < 0.0f)? 0.0f : factor;  // Clamp to [0,1]
+    GeneratorPass pass = { .pixels = pixels, .width = width, .height = height, .colors = { start, end } };
+    pass.cosDir = cosf(radianDirection);
+    pass.sinDir = sinf(radianDirection);
 
-            // Generate the color for this pixel
-            pixels[j*width + i].r = (int)((float)end.r*factor + (float)start.r*(1.0f - factor));
-            pixels[j*width + i].g = (int)((float)end.g*factor + (float)start.g*(1.0f - factor));
-            pixels[j*width + i].b = (int)((float)end.b*factor + (float)start.b*(1.0f - factor));
-            pixels[j*width + i].a = (int)((float)end.a*factor + (float)start.a*(1.0f - factor));
-        }
-    }
+    ProcessImageRows(GenGradientLinearRows, &pass, height, width);
 
     Image image = {
         .data = pixels,
@@ -900,27 +1334,9 @@ Image GenImageGradientLinear(int width, int height, int direction, Color start,
 Image GenImageGradientRadial(int width, int height, float density, Color inner, Color outer)
 {
     Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
-    float radius = (width < height)? (float)width/2.0f : (float)height/2.0f;
-
-    float centerX = (float)width/2.0f;
-    float centerY = (float)height/2.0f;
-
-    for (int y = 0; y < height; y++)
-    {
-        for (int x = 0; x < width; x++)
-        {
-            float dist = hypotf((float)x - centerX, (float)y - centerY);
-            float factor = (dist - radius*density)/(radius*(1.0f - density));
 
-            factor = (float)fmax(factor, 0.0f);
-            factor = (float)fmin(factor, 1.f); // dist can be bigger than radius, so we have to check
-
-            pixels[y*width + x].r = (int)((float)outer.r*factor + (float)inner.r*(1.0f - factor));
-            pixels[y*width + x].g = (int)((float)outer.g*factor + (float)inner.g*(1.0f - factor));
-            pixels[y*width + x].b = (int)((float)outer.b*factor + (float)inner.b*(1.0f - factor));
-            pixels[y*width + x].a = (int)((float)outer.a*factor + (float)inner.a*(1.0f - factor));
-        }
-    }
+    GeneratorPass pass = { .pixels = pixels, .width = width, .height = height, .colors = { inner, outer }, .density = density };
+    ProcessImageRows(GenGradientRadialRows, &pass, height, width);
 
     Image image = {
         .data = pixels,
@@ -938,38 +1354,8 @@ Image GenImageGradientSquare(int width, int height, float density, Color inner,
 {
     Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
 
-    float centerX = (float)width/2.0f;
-    float centerY = (float)height/2.0f;
-
-    for (int y = 0; y < height; y++)
-    {
-        for (int x = 0; x < width; x++)
-        {
-            // Calculate the Manhattan distance from the center
-            float distX = fabsf(x - centerX);
-            float distY = fabsf(y - centerY);
-
-            // Normalize the distances by the dimensions of the gradient rectangle
-            float normalizedDistX = distX / centerX;
-            float normalizedDistY = distY / centerY;
-
-            // Calculate the total normalized Manhattan distance
-            float manhattanDist = fmaxf(normalizedDistX, normalizedDistY);
-
-            // Subtract the density from the manhattanDist, then divide by (1 - density)
-            // This makes the gradient start from the center when density is 0, and from the edge when density is 1
-            float factor = (manhattanDist - density)/(1.0f - density);
-
-            // Clamp the factor between 0 and 1
-            factor = fminf(fmaxf(factor, 0.0f), 1.0f);
-
-            // Blend the colors based on the calculated factor
-            pixels[y*width + x].r = (int)((float)outer.r*factor + (float)inner.r*(1.0f - factor));
-            pixels[y*width + x].g = (int)((float)outer.g*factor + (float)inner.g*(1.0f - factor));
-            pixels[y*width + x].b = (int)((float)outer.b*factor + (float)inner.b*(1.0f - factor));
-            pixels[y*width + x].a = (int)((float)outer.a*factor + (float)inner.a*(1.0f - factor));
-        }
-    }
+    GeneratorPass pass = { .pixels = pixels, .width = width, .height = height, .colors = { inner, outer }, .density = density };
+    ProcessImageRows(GenGradientSquareRows, &pass, height, width);
 
     Image image = {
         .data = pixels,
@@ -987,14 +1373,8 @@ Image GenImageChecked(int width, int height, int checksX, int checksY, Color col
 {
     Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
 
-    for (int y = 0; y < height; y++)
-    {
-        for (int x = 0; x < width; x++)
-        {
-            if ((x/checksX + y/checksY)%2 == 0) pixels[y*width + x] = col1;
-            else pixels[y*width + x] = col2;
-        }
-    }
+    GeneratorPass pass = { .pixels = pixels, .width = width, .height = height, .colors = { col1, col2 }, .checksX = checksX, .checksY = checksY };
+    ProcessImageRows(GenCheckedRows, &pass, height, width);
 
     Image image = {
         .data = pixels,
@@ -1034,34 +1414,10 @@ Image GenImagePerlinNoise(int width, int height, int offsetX, int offsetY, float
 {
     Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
 
-    for (int y = 0; y < height; y++)
-    {
-        for (int x = 0; x < width; x++)
-        {
-            float nx = (float)(x + offsetX)*(scale/(float)width);
-            float ny = (float)(y + offsetY)*(scale/(float)height);
-
-            // Basic perlin noise implementation (not used)
-            //float p = (stb_perlin_noise3(nx, ny, 0.0f, 0, 0, 0);
-
-            // Calculate a better perlin noise using fbm (fractal brownian motion)
-            // Typical values to start playing with:
-            //   lacunarity = ~2.0   -- spacing between successive octaves (use exactly 2.0 for wrapping output)
-            //   gain       =  0.5   -- relative weighting applied to each successive octave
-            //   octaves    =  6     -- number of "octaves" of noise3() to sum
-            float p = stb_perlin_fbm_noise3(nx, ny, 1.0f, 2.0f, 0.5f, 6);
-
-            // Clamp between -1.0f and 1.0f
-            if (p < -1.0f) p = -1.0f;
-            if (p > 1.0f) p = 1.0f;
-
-            // We need to normalize the data from [-1..1] to [0..1]
-            float np = (p + 1.0f)/2.0f;
+    GeneratorPass pass = { .pixels = pixels, .width = width, .height = height, .offsetX = offsetX, .offsetY = offsetY, .scale = scale };
 
-            int intensity = (int)(np*255.0f);
-            pixels[y*width + x] = (Color){ intensity, intensity, intensity, 255 };
-        }
-    }
+    // NOTE: Noise is computed per pixel, rows are generated in parallel
+    ProcessImageRows(GenPerlinNoiseRows, &pass, height, width);
 
     Image image = {
         .data = pixels,
@@ -1092,39 +1448,13 @@ Image GenImageCellular(int width, int height, int tileSize)
         seeds[i] = (Vector2){ (float)x, (float)y };
     }
 
-    for (int y = 0; y < height; y++)
-    {
-        int tileY = y/tileSize;
-
-        for (int x = 0; x < width; x++)
-        {
-            int tileX = x/tileSize;
-
-            float minDistance = 65536.0f; //(float)strtod("Inf", NULL);
-
-            // Check all adjacent tiles
-            for (int i = -1; i < 2; i++)
-            {
-                if ((tileX + i < 0) || (tileX + i >= seedsPerRow)) continue;
-
-                for (int j = -1; j < 2; j++)
-                {
-                    if ((tileY + j < 0) || (tileY + j >= seedsPerCol)) continue;
-
-                    Vector2 neighborSeed = seeds[(tileY + j)*seedsPerRow + tileX + i];
-
-                    float dist = (float)hypot(x - (int)neighborSeed.x, y - (int)neighborSeed.y);
-                    minDistance = (float)fmin(minDistance, dist);
-                }
-            }
-
-            // I made this up, but it seems to give good results at all tile sizes
-            int intensity = (int)(minDistance*256.0f/tileSize);
-            if (intensity > 255) intensity = 255;
+    // NOTE: Seeds are generated first in the same order, random values sequence does not change
+    GeneratorPass pass = { .pixels = pixels, .width = width, .height = height, .tileSize = tileSize };
+    pass.seedsPerRow = seedsPerRow;
+    pass.seedsPerCol = seedsPerCol;
+    pass.seeds = seeds;
 
-            pixels[y*width + x] = (Color){ intensity, intensity, intensity, 255 };
-        }
-    }
+    ProcessImageRows(GenCellularRows, &pass, height, width);
 
     RL_FREE(seeds);
 
@@ -1273,6 +1603,7 @@ void ImageCrop(Image *image, Rectangle crop)
 }
 
 // Convert image data to desired format
+// NOTE: All mipmap levels are converted, custom mipmaps are preserved
 void ImageFormat(Image *image, int newFormat)
 {
     // Security check to avoid program crash
@@ -1282,199 +1613,43 @@ void ImageFormat(Image *image, int newFormat)
     {
         if ((image->format < PIXELFORMAT_COMPRESSED_DXT1_RGB) && (newFormat < PIXELFORMAT_COMPRESSED_DXT1_RGB))
         {
-            Vector4 *pixels = LoadImageDataNormalized(*image);     // Supports 8 to 32 bit per channel
+            int dataSize = 0;
+            int mipWidth = image->width;
+            int mipHeight = image->height;
 
-            RL_FREE(image->data);      // WARNING! We loose mipmaps data --> Regenerated at the end...
-            image->data = NULL;
-            image->format = newFormat;
-
-            switch (image->format)
+            for (int i = 0; i < image->mipmaps; i++)
             {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*sizeof(unsigned char));
+                dataSize += GetPixelDataSize(mipWidth, mipHeight, newFormat);
 
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)((pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f)*255.0f);
-                    }
+                mipWidth /= 2;
+                mipHeight /= 2;
+                if (mipWidth < 1) mipWidth = 1;
+                if (mipHeight < 1) mipHeight = 1;
+            }
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*2*sizeof(unsigned char));
+            unsigned char *data = (unsigned char *)RL_MALLOC(dataSize);
+            int srcOffset = 0;
+            int dstOffset = 0;
 
-                    for (int i = 0, k = 0; i < image->width*image->height*2; i += 2, k++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)((pixels[k].x*0.299f + (float)pixels[k].y*0.587f + (float)pixels[k].z*0.114f)*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].w*255.0f);
-                    }
+            mipWidth = image->width;
+            mipHeight = image->height;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
-
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
-
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        r = (unsigned char)(round(pixels[i].x*31.0f));
-                        g = (unsigned char)(round(pixels[i].y*63.0f));
-                        b = (unsigned char)(round(pixels[i].z*31.0f));
-
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
-                    }
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned char));
-
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
-                        ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
-
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
-                    unsigned char a = 0;
-
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        r = (unsigned char)(round(pixels[i].x*31.0f));
-                        g = (unsigned char)(round(pixels[i].y*31.0f));
-                        b = (unsigned char)(round(pixels[i].z*31.0f));
-                        a = (pixels[i].w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
-
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
-                    }
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
-
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
-                    unsigned char a = 0;
-
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        r = (unsigned char)(round(pixels[i].x*15.0f));
-                        g = (unsigned char)(round(pixels[i].y*15.0f));
-                        b = (unsigned char)(round(pixels[i].z*15.0f));
-                        a = (unsigned char)(round(pixels[i].w*15.0f));
-
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
-                    }
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned char));
-
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
-                        ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
-                        ((unsigned char *)image->data)[i + 3] = (unsigned char)(pixels[k].w*255.0f);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32:
-                {
-                    // WARNING: Image is converted to GRAYSCALE equivalent 32bit
-
-                    image->data = (float *)RL_MALLOC(image->width*image->height*sizeof(float));
-
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        ((float *)image->data)[i] = (float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-                {
-                    image->data = (float *)RL_MALLOC(image->width*image->height*3*sizeof(float));
-
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
-                    {
-                        ((float *)image->data)[i] = pixels[k].x;
-                        ((float *)image->data)[i + 1] = pixels[k].y;
-                        ((float *)image->data)[i + 2] = pixels[k].z;
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-                {
-                    image->data = (float *)RL_MALLOC(image->width*image->height*4*sizeof(float));
-
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
-                    {
-                        ((float *)image->data)[i] = pixels[k].x;
-                        ((float *)image->data)[i + 1] = pixels[k].y;
-                        ((float *)image->data)[i + 2] = pixels[k].z;
-                        ((float *)image->data)[i + 3] = pixels[k].w;
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16:
-                {
-                    // WARNING: Image is converted to GRAYSCALE equivalent 16bit
-
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
-
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        ((unsigned short *)image->data)[i] = FloatToHalf((float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f));
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned short));
+            for (int i = 0; i < image->mipmaps; i++)
+            {
+                ConvertPixels((unsigned char *)image->data + srcOffset, image->format, mipWidth*mipHeight, data + dstOffset, newFormat);
 
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
-                    {
-                        ((unsigned short *)image->data)[i] = FloatToHalf(pixels[k].x);
-                        ((unsigned short *)image->data)[i + 1] = FloatToHalf(pixels[k].y);
-                        ((unsigned short *)image->data)[i + 2] = FloatToHalf(pixels[k].z);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned short));
+                srcOffset += GetPixelDataSize(mipWidth, mipHeight, image->format);
+                dstOffset += GetPixelDataSize(mipWidth, mipHeight, newFormat);
 
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
-                    {
-                        ((unsigned short *)image->data)[i] = FloatToHalf(pixels[k].x);
-                        ((unsigned short *)image->data)[i + 1] = FloatToHalf(pixels[k].y);
-                        ((unsigned short *)image->data)[i + 2] = FloatToHalf(pixels[k].z);
-                        ((unsigned short *)image->data)[i + 3] = FloatToHalf(pixels[k].w);
-                    }
-                } break;
-                default: break;
+                mipWidth /= 2;
+                mipHeight /= 2;
+                if (mipWidth < 1) mipWidth = 1;
+                if (mipHeight < 1) mipHeight = 1;
             }
 
-            RL_FREE(pixels);
-            pixels = NULL;
-
-            // In case original image had mipmaps, generate mipmaps for formatted image
-            // NOTE: Original mipmaps are replaced by new ones, if custom mipmaps were used, they are lost
-            if (image->mipmaps > 1)
-            {
-                image->mipmaps = 1;
-            #if defined(SUPPORT_IMAGE_MANIPULATION)
-                if (image->data != NULL) ImageMipmaps(image);
-            #endif
-            }
+            RL_FREE(image->data);
+            image->data = data;
+            image->format = newFormat;
         }
         else TRACELOG(LOG_WARNING, "IMAGE: Data format is compressed, can not be converted");
     }
@@ -1587,6 +1762,7 @@ void ImageResizeNN(Image *image,int newWidth,int newHeight)
     }
 
     int format = image->format;
+    int mipmaps = image->mipmaps;
 
     RL_FREE(image->data);
 
@@ -1594,8 +1770,10 @@ void ImageResizeNN(Image *image,int newWidth,int newHeight)
     image->width = newWidth;
     image->height = newHeight;
     image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    image->mipmaps = 1;
 
     ImageFormat(image, format);  // Reformat 32bit RGBA image to original format
+    if (mipmaps > 1) ImageMipmaps(image);   // Regenerate mipmaps for new size
 
     UnloadImageColors(pixels);
 }
@@ -1610,6 +1788,8 @@ void ImageResize(Image *image, int newWidth, int newHeight)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
+    int mipmaps = image->mipmaps;
+
     // Check if we can use a fast path on image scaling
     // It can be for 8 bit per channel images with 1 to 4 channels per pixel
     if ((image->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) ||
@@ -1620,19 +1800,14 @@ void ImageResize(Image *image, int newWidth, int newHeight)
         int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
         unsigned char *output = (unsigned char *)RL_MALLOC(newWidth*newHeight*bytesPerPixel);
 
-        switch (image->format)
-        {
-            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)1); break;
-            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)2); break;
-            case PIXELFORMAT_UNCOMPRESSED_R8G8B8: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)3); break;
-            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)4); break;
-            default: break;
-        }
+        // NOTE: Number of channels matches pixel bytes for these formats
+        ResizePixels((unsigned char *)image->data, image->width, image->height, output, newWidth, newHeight, bytesPerPixel);
 
         RL_FREE(image->data);
         image->data = output;
         image->width = newWidth;
         image->height = newHeight;
+        image->mipmaps = 1;
     }
     else
     {
@@ -1641,7 +1816,7 @@ void ImageResize(Image *image, int newWidth, int newHeight)
         Color *output = (Color *)RL_MALLOC(newWidth*newHeight*sizeof(Color));
 
         // NOTE: Color data is cast to (unsigned char *), there shouldn't been any problem...
-        stbir_resize_uint8_linear((unsigned char *)pixels, image->width, image->height, 0, (unsigned char *)output, newWidth, newHeight, 0, (stbir_pixel_layout)4);
+        ResizePixels((unsigned char *)pixels, image->width, image->height, (unsigned char *)output, newWidth, newHeight, 4);
 
         int format = image->format;
 
@@ -1652,9 +1827,12 @@ void ImageResize(Image *image, int newWidth, int newHeight)
         image->width = newWidth;
         image->height = newHeight;
         image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+        image->mipmaps = 1;
 
         ImageFormat(image, format);  // Reformat 32bit RGBA image to original format
     }
+
+    if (mipmaps > 1) ImageMipmaps(image);   // Regenerate mipmaps for new size
 }
 
 // Resize canvas and fill with color
@@ -1924,162 +2102,88 @@ void ImageAlphaPremultiply(Image *image)
     RL_FREE(image->data);
 
     int format = image->format;
+    int mipmaps = image->mipmaps;
     image->data = pixels;
     image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    image->mipmaps = 1;
 
     ImageFormat(image, format);
+    if (mipmaps > 1) ImageMipmaps(image);   // Regenerate mipmaps from modified base level
 }
 
 // Apply box blur
-void ImageBlurGaussian(Image *image, int blurSize) {
+void ImageBlurGaussian(Image *image, int blurSize)
+{
     // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
-
-    ImageAlphaPremultiply(image);
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0) || (blurSize <= 0)) return;
 
-    Color *pixels = LoadImageColors(*image);
+    // NOTE: Window size is limited so fixed point sums can not overflow
+    if (blurSize > 16383) blurSize = 16383;
 
-    // Loop switches between pixelsCopy1 and pixelsCopy2
-    Vector4 *pixelsCopy1 = RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
-    Vector4 *pixelsCopy2 = RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
+    int format = image->format;
+    int mipmaps = image->mipmaps;
+    int width = image->width;
+    int height = image->height;
 
-    for (int i = 0; i < (image->height)*(image->width); i++) {
-        pixelsCopy1[i].x = pixels[i].r;
-        pixelsCopy1[i].y = pixels[i].g;
-        pixelsCopy1[i].z = pixels[i].b;
-        pixelsCopy1[i].w = pixels[i].a;
-    }
+    // RGBA8 images are blurred in place, passes alternate between pixels and one extra image
+    unsigned char *pixels = (format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)? (unsigned char *)image->data : (unsigned char *)LoadImageColors(*image);
+    unsigned char *buffers[2] = { pixels, (unsigned char *)RL_MALLOC(width*height*4*sizeof(unsigned char)) };
 
-    // Repeated convolution of rectangular window signal by itself converges to a gaussian distribution
-    for (int j = 0; j < GAUSSIAN_BLUR_ITERATIONS; j++) {
-        // Horizontal motion blur
-        for (int row = 0; row < image->height; row++)
-        {
-            float avgR = 0.0f;
-            float avgG = 0.0f;
-            float avgB = 0.0f;
-            float avgAlpha = 0.0f;
-            int convolutionSize = blurSize+1;
+    int maxSize = 2*blurSize + 1;
+    if (maxSize > ((width > height)? width : height)) maxSize = (width > height)? width : height;
+    unsigned int *inverse = (unsigned int *)RL_MALLOC((maxSize + 1)*sizeof(unsigned int));
+    inverse[0] = 0;
+    for (int i = 1; i <= maxSize; i++) inverse[i] = ((1u << 24) + i/2)/i;
 
-            for (int i = 0; i < blurSize+1; i++)
-            {
-                avgR += pixelsCopy1[row*image->width + i].x;
-                avgG += pixelsCopy1[row*image->width + i].y;
-                avgB += pixelsCopy1[row*image->width + i].z;
-                avgAlpha += pixelsCopy1[row*image->width + i].w;
-            }
+    BlurPass premultiply = { pixels, pixels, width, height, 0, NULL };
+    ProcessImageRows(AlphaPremultiplyRows, &premultiply, height, width);
 
-            pixelsCopy2[row*image->width].x = avgR/convolutionSize;
-            pixelsCopy2[row*image->width].y = avgG/convolutionSize;
-            pixelsCopy2[row*image->width].z = avgB/convolutionSize;
-            pixelsCopy2[row*image->width].w = avgAlpha/convolutionSize;
+    // Repeated convolution of rectangular window signal by itself converges to a gaussian distribution
+    // NOTE: Vertical and horizontal passes commute, all vertical passes are done first, then the image is
+    // transposed and horizontal passes are done as vertical ones, so every pass reads and writes whole rows
+    int current = 0;
 
-            for (int x = 1; x < image->width; x++)
-            {
-                if (x-blurSize >= 0)
-                {
-                    avgR -= pixelsCopy1[row*image->width + x-blurSize].x;
-                    avgG -= pixelsCopy1[row*image->width + x-blurSize].y;
-                    avgB -= pixelsCopy1[row*image->width + x-blurSize].z;
-                    avgAlpha -= pixelsCopy1[row*image->width + x-blurSize].w;
-                    convolutionSize--;
-                }
+    for (int direction = 0; direction < 2; direction++)
+    {
+        int passWidth = (direction == 0)? width : height;
+        int passHeight = (direction == 0)? height : width;
 
-                if (x+blurSize < image->width)
-                {
-                    avgR += pixelsCopy1[row*image->width + x+blurSize].x;
-                    avgG += pixelsCopy1[row*image->width + x+blurSize].y;
-                    avgB += pixelsCopy1[row*image->width + x+blurSize].z;
-                    avgAlpha += pixelsCopy1[row*image->width + x+blurSize].w;
-                    convolutionSize++;
-                }
+        for (int j = 0; j < GAUSSIAN_BLUR_ITERATIONS; j++)
+        {
+            BlurPass pass = { buffers[current], buffers[1 - current], passWidth, passHeight, blurSize, inverse };
+            ProcessImageRows(BlurBoxColumns, &pass, passWidth, passHeight);
+            current = 1 - current;
+        }
 
-                pixelsCopy2[row*image->width + x].x = avgR/convolutionSize;
-                pixelsCopy2[row*image->width + x].y = avgG/convolutionSize;
-                pixelsCopy2[row*image->width + x].z = avgB/convolutionSize;
-                pixelsCopy2[row*image->width + x].w = avgAlpha/convolutionSize;
-            }
-                }
+        BlurPass transpose = { buffers[current], buffers[1 - current], passWidth, passHeight, 0, NULL };
+        ProcessImageRows(TransposeRows, &transpose, passHeight, passWidth);
+        current = 1 - current;
+    }
 
-        // Vertical motion blur
-        for (int col = 0; col < image->width; col++)
-        {
-            float avgR = 0.0f;
-            float avgG = 0.0f;
-            float avgB = 0.0f;
-            float avgAlpha = 0.0f;
-            int convolutionSize = blurSize+1;
+    // NOTE: Passes count is always even, result is back in pixels
+    ProcessImageRows(AlphaUnpremultiplyRows, &premultiply, height, width);
 
-            for (int i = 0; i < blurSize+1; i++)
-            {
-                avgR += pixelsCopy2[i*image->width + col].x;
-                avgG += pixelsCopy2[i*image->width + col].y;
-                avgB += pixelsCopy2[i*image->width + col].z;
-                avgAlpha += pixelsCopy2[i*image->width + col].w;
-            }
+    RL_FREE(inverse);
+    RL_FREE(buffers[1]);
 
-            pixelsCopy1[col].x = (unsigned char) (avgR/convolutionSize);
-            pixelsCopy1[col].y = (unsigned char) (avgG/convolutionSize);
-            pixelsCopy1[col].z = (unsigned char) (avgB/convolutionSize);
-            pixelsCopy1[col].w = (unsigned char) (avgAlpha/convolutionSize);
+    if (format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+    {
+        RL_FREE(image->data);
 
-            for (int y = 1; y < image->height; y++)
-            {
-                if (y-blurSize >= 0)
-                {
-                    avgR -= pixelsCopy2[(y-blurSize)*image->width + col].x;
-                    avgG -= pixelsCopy2[(y-blurSize)*image->width + col].y;
-                    avgB -= pixelsCopy2[(y-blurSize)*image->width + col].z;
-                    avgAlpha -= pixelsCopy2[(y-blurSize)*image->width + col].w;
-                    convolutionSize--;
-                }
-                if (y+blurSize < image->height)
-                {
-                    avgR += pixelsCopy2[(y+blurSize)*image->width + col].x;
-                    avgG += pixelsCopy2[(y+blurSize)*image->width + col].y;
-                    avgB += pixelsCopy2[(y+blurSize)*image->width + col].z;
-                    avgAlpha += pixelsCopy2[(y+blurSize)*image->width + col].w;
-                    convolutionSize++;
-                }
+        image->data = pixels;
+        image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+        image->mipmaps = 1;
 
-                pixelsCopy1[y*image->width + col].x = (unsigned char) (avgR/convolutionSize);
-                pixelsCopy1[y*image->width + col].y = (unsigned char) (avgG/convolutionSize);
-                pixelsCopy1[y*image->width + col].z = (unsigned char) (avgB/convolutionSize);
-                pixelsCopy1[y*image->width + col].w = (unsigned char) (avgAlpha/convolutionSize);
-            }
-        }
+        ImageFormat(image, format);
     }
 
-
-    // Reverse premultiply
-    for (int i = 0; i < (image->width)*(image->height); i++)
+    // Mipmaps are regenerated from blurred base level
+    // NOTE: RGBA8 images data keeps previous mipmaps, they are overwritten
+    if (mipmaps > 1)
     {
-        if (pixelsCopy1[i].w == 0.0f)
-        {
-            pixels[i].r = 0;
-            pixels[i].g = 0;
-            pixels[i].b = 0;
-            pixels[i].a = 0;
-        }
-        else if (pixelsCopy1[i].w <= 255.0f)
-        {
-            float alpha = (float)pixelsCopy1[i].w/255.0f;
-            pixels[i].r = (unsigned char)((float)pixelsCopy1[i].x/alpha);
-            pixels[i].g = (unsigned char)((float)pixelsCopy1[i].y/alpha);
-            pixels[i].b = (unsigned char)((float)pixelsCopy1[i].z/alpha);
-            pixels[i].a = (unsigned char) pixelsCopy1[i].w;
-        }
+        image->mipmaps = 1;
+        ImageMipmaps(image);
     }
-
-    int format = image->format;
-    RL_FREE(image->data);
-    RL_FREE(pixelsCopy1);
-    RL_FREE(pixelsCopy2);
-
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    ImageFormat(image, format);
 }
 
 // Generate all mipmap levels for a provided image
@@ -2194,72 +2298,14 @@ void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp)
         // NOTE: We will store the dithered data as unsigned short (16bpp)
         image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
 
-        Color oldPixel = WHITE;
-        Color newPixel = WHITE;
-
-        int rError, gError, bError;
-        unsigned short rPixel, gPixel, bPixel, aPixel;   // Used for 16bit pixel composition
-
-        #define MIN(a,b) (((a)<(b))?(a):(b))
-
-        for (int y = 0; y < image->height; y++)
-        {
-            for (int x = 0; x < image->width; x++)
-            {
-                oldPixel = pixels[y*image->width + x];
-
-                // NOTE: New pixel obtained by bits truncate, it would be better to round values (check ImageFormat())
-                newPixel.r = oldPixel.r >> (8 - rBpp);     // R bits
-                newPixel.g = oldPixel.g >> (8 - gBpp);     // G bits
-                newPixel.b = oldPixel.b >> (8 - bBpp);     // B bits
-                newPixel.a = oldPixel.a >> (8 - aBpp);     // A bits (not used on dithering)
-
-                // NOTE: Error must be computed between new and old pixel but using same number of bits!
-                // We want to know how much color precision we have lost...
-                rError = (int)oldPixel.r - (int)(newPixel.r << (8 - rBpp));
-                gError = (int)oldPixel.g - (int)(newPixel.g << (8 - gBpp));
-                bError = (int)oldPixel.b - (int)(newPixel.b << (8 - bBpp));
-
-                pixels[y*image->width + x] = newPixel;
-
-                // NOTE: Some cases are out of the array and should be ignored
-                if (x < (image->width - 1))
-                {
-                    pixels[y*image->width + x+1].r = MIN((int)pixels[y*image->width + x+1].r + (int)((float)rError*7.0f/16), 0xff);
-                    pixels[y*image->width + x+1].g = MIN((int)pixels[y*image->width + x+1].g + (int)((float)gError*7.0f/16), 0xff);
-                    pixels[y*image->width + x+1].b = MIN((int)pixels[y*image->width + x+1].b + (int)((float)bError*7.0f/16), 0xff);
-                }
-
-                if ((x > 0) && (y < (image->height - 1)))
-                {
-                    pixels[(y+1)*image->width + x-1].r = MIN((int)pixels[(y+1)*image->width + x-1].r + (int)((float)rError*3.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x-1].g = MIN((int)pixels[(y+1)*image->width + x-1].g + (int)((float)gError*3.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x-1].b = MIN((int)pixels[(y+1)*image->width + x-1].b + (int)((float)bError*3.0f/16), 0xff);
-                }
-
-                if (y < (image->height - 1))
-                {
-                    pixels[(y+1)*image->width + x].r = MIN((int)pixels[(y+1)*image->width + x].r + (int)((float)rError*5.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x].g = MIN((int)pixels[(y+1)*image->width + x].g + (int)((float)gError*5.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x].b = MIN((int)pixels[(y+1)*image->width + x].b + (int)((float)bError*5.0f/16), 0xff);
-                }
-
-                if ((x < (image->width - 1)) && (y < (image->height - 1)))
-                {
-                    pixels[(y+1)*image->width + x+1].r = MIN((int)pixels[(y+1)*image->width + x+1].r + (int)((float)rError*1.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x+1].g = MIN((int)pixels[(y+1)*image->width + x+1].g + (int)((float)gError*1.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x+1].b = MIN((int)pixels[(y+1)*image->width + x+1].b + (int)((float)bError*1.0f/16), 0xff);
-                }
-
-                rPixel = (unsigned short)newPixel.r;
-                gPixel = (unsigned short)newPixel.g;
-                bPixel = (unsigned short)newPixel.b;
-                aPixel = (unsigned short)newPixel.a;
+        // Rows are interleaved in one lane per thread, every row waits for the previous one progress
+        DitherPass pass = { pixels, (unsigned short *)image->data, image->width, image->height, rBpp, gBpp, bBpp, aBpp, 1, NULL };
+        if ((image->width*image->height) >= IMAGE_THREADS_MIN_PIXELS) pass.lanes = GetImageThreadCount();
+        pass.progress = (int *)RL_CALLOC(image->height, sizeof(int));
 
-                ((unsigned short *)image->data)[y*image->width + x] = (rPixel << (gBpp + bBpp + aBpp)) | (gPixel << (bBpp + aBpp)) | (bPixel << aBpp) | aPixel;
-            }
-        }
+        ProcessImageRows(DitherRows, &pass, pass.lanes, image->width*image->height/pass.lanes);
 
+        RL_FREE(pass.progress);
         UnloadImageColors(pixels);
     }
 }
@@ -2353,37 +2399,8 @@ void ImageRotate(Image *image, int degrees)
         int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
         unsigned char *rotatedData = (unsigned char *)RL_CALLOC(width*height, bytesPerPixel);
 
-        for (int y = 0; y < height; y++)
-        {
-            for (int x = 0; x < width; x++)
-            {
-                float oldX = ((x - width/2.0f)*cosRadius + (y - height/2.0f)*sinRadius) + image->width/2.0f;
-                float oldY = ((y - height/2.0f)*cosRadius - (x - width/2.0f)*sinRadius) + image->height/2.0f;
-
-                if ((oldX >= 0) && (oldX < image->width) && (oldY >= 0) && (oldY < image->height))
-                {
-                    int x1 = (int)floorf(oldX);
-                    int y1 = (int)floorf(oldY);
-                    int x2 = MIN(x1 + 1, image->width - 1);
-                    int y2 = MIN(y1 + 1, image->height - 1);
-
-                    float px = oldX - x1;
-                    float py = oldY - y1;
-
-                    for (int i = 0; i < bytesPerPixel; i++)
-                    {
-                        float f1 = ((unsigned char *)image->data)[(y1*image->width + x1)*bytesPerPixel + i];
-                        float f2 = ((unsigned char *)image->data)[(y1*image->width + x2)*bytesPerPixel + i];
-                        float f3 = ((unsigned char *)image->data)[(y2*image->width + x1)*bytesPerPixel + i];
-                        float f4 = ((unsigned char *)image->data)[(y2*image->width + x2)*bytesPerPixel + i];
-
-                        float val = f1*(1 - px)*(1 - py) + f2*px*(1 - py) + f3*(1 - px)*py + f4*px*py;
-
-                        rotatedData[(y*width + x)*bytesPerPixel + i] = (unsigned char)val;
-                    }
-                }
-            }
-        }
+        RotatePass pass = { (unsigned char *)image->data, rotatedData, image->width, image->height, width, height, bytesPerPixel, sinRadius, cosRadius };
+        ProcessImageRows(RotateRows, &pass, height, width);
 
         RL_FREE(image->data);
         image->data = rotatedData;
@@ -2464,35 +2481,19 @@ void ImageColorTint(Image *image, Color color)
 
     Color *pixels = LoadImageColors(*image);
 
-    float cR = (float)color.r/255;
-    float cG = (float)color.g/255;
-    float cB = (float)color.b/255;
-    float cA = (float)color.a/255;
-
-    for (int y = 0; y < image->height; y++)
-    {
-        for (int x = 0; x < image->width; x++)
-        {
-            int index = y*image->width + x;
-            unsigned char r = (unsigned char)(((float)pixels[index].r/255*cR)*255.0f);
-            unsigned char g = (unsigned char)(((float)pixels[index].g/255*cG)*255.0f);
-            unsigned char b = (unsigned char)(((float)pixels[index].b/255*cB)*255.0f);
-            unsigned char a = (unsigned char)(((float)pixels[index].a/255*cA)*255.0f);
-
-            pixels[index].r = r;
-            pixels[index].g = g;
-            pixels[index].b = b;
-            pixels[index].a = a;
-        }
-    }
+    ColorPass pass = { .pixels = pixels, .width = image->width, .color = color };
+    ProcessImageRows(ColorTintRows, &pass, image->height, image->width);
 
     int format = image->format;
+    int mipmaps = image->mipmaps;
     RL_FREE(image->data);
 
     image->data = pixels;
     image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    image->mipmaps = 1;
 
     ImageFormat(image, format);
+    if (mipmaps > 1) ImageMipmaps(image);   // Regenerate mipmaps from modified base level
 }
 
 // Modify image color: invert
@@ -2514,12 +2515,15 @@ void ImageColorInvert(Image *image)
     }
 
     int format = image->format;
+    int mipmaps = image->mipmaps;
     RL_FREE(image->data);
 
     image->data = pixels;
     image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    image->mipmaps = 1;
 
     ImageFormat(image, format);
+    if (mipmaps > 1) ImageMipmaps(image);   // Regenerate mipmaps from modified base level
 }
 
 // Modify image color: grayscale
@@ -2578,12 +2582,15 @@ void ImageColorContrast(Image *image, float contrast)
     }
 
     int format = image->format;
+    int mipmaps = image->mipmaps;
     RL_FREE(image->data);
 
     image->data = pixels;
     image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    image->mipmaps = 1;
 
     ImageFormat(image, format);
+    if (mipmaps > 1) ImageMipmaps(image);   // Regenerate mipmaps from modified base level
 }
 
 // Modify image color: brightness
@@ -2598,36 +2605,19 @@ void ImageColorBrightness(Image *image, int brightness)
 
     Color *pixels = LoadImageColors(*image);
 
-    for (int y = 0; y < image->height; y++)
-    {
-        for (int x = 0; x < image->width; x++)
-        {
-            int cR = pixels[y*image->width + x].r + brightness;
-            int cG = pixels[y*image->width + x].g + brightness;
-            int cB = pixels[y*image->width + x].b + brightness;
-
-            if (cR < 0) cR = 1;
-            if (cR > 255) cR = 255;
-
-            if (cG < 0) cG = 1;
-            if (cG > 255) cG = 255;
-
-            if (cB < 0) cB = 1;
-            if (cB > 255) cB = 255;
-
-            pixels[y*image->width + x].r = (unsigned char)cR;
-            pixels[y*image->width + x].g = (unsigned char)cG;
-            pixels[y*image->width + x].b = (unsigned char)cB;
-        }
-    }
+    ColorPass pass = { .pixels = pixels, .width = image->width, .brightness = brightness };
+    ProcessImageRows(ColorBrightnessRows, &pass, image->height, image->width);
 
     int format = image->format;
+    int mipmaps = image->mipmaps;
     RL_FREE(image->data);
 
     image->data = pixels;
     image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    image->mipmaps = 1;
 
     ImageFormat(image, format);
+    if (mipmaps > 1) ImageMipmaps(image);   // Regenerate mipmaps from modified base level
 }
 
 // Modify image color: replace color
@@ -2656,12 +2646,15 @@ void ImageColorReplace(Image *image, Color color, Color replace)
     }
 
     int format = image->format;
+    int mipmaps = image->mipmaps;
     RL_FREE(image->data);
 
     image->data = pixels;
     image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    image->mipmaps = 1;
 
     ImageFormat(image, format);
+    if (mipmaps > 1) ImageMipmaps(image);   // Regenerate mipmaps from modified base level
 }
 #endif      // SUPPORT_IMAGE_MANIPULATION
 
@@ -3509,6 +3502,7 @@ void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color
         //    [x] Consider fast path: no alpha blending required cases (src has no alpha)
         //    [x] Consider fast path: same src/dst format with no alpha -> direct line copy
         //    [-] GetPixelColor(): Get Vector4 instead of Color, easier for ColorAlphaBlend()
+        //    [x] Consider fast path: 8 bit per channel source over RGBA8 -> SIMD line blend (BlendPixelsRGBA8())
         //    [ ] Support f32bit channels drawing
 
         // TODO: Support PIXELFORMAT_UNCOMPRESSED_R32, PIXELFORMAT_UNCOMPRESSED_R32G32B32, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32 and 16-bit equivalents
@@ -3525,6 +3519,15 @@ void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color
         int strideSrc = GetPixelDataSize(srcPtr->width, 1, srcPtr->format);
         int bytesPerPixelSrc = strideSrc/(srcPtr->width);
 
+        // Fast paths selected once, for 8 bit per channel sources over RGBA8 destination lines are
+        // expanded or blended at once, with exactly the same results than the per pixel path
+        bool copyLines = !blendRequired && (srcPtr->format == dst->format);
+        bool lineFormats = (dst->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) &&
+            ((srcPtr->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) ||
+             (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) || (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8));
+        bool expandLines = !blendRequired && lineFormats;
+        bool blendLines = blendRequired && lineFormats;
+
         unsigned char *pSrcBase = (unsigned char *)srcPtr->data + ((int)srcRec.y*srcPtr->width + (int)srcRec.x)*bytesPerPixelSrc;
         unsigned char *pDstBase = (unsigned char *)dst->data + ((int)dstRec.y*dst->width + (int)dstRec.x)*bytesPerPixelDst;
 
@@ -3534,7 +3537,9 @@ void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color
             unsigned char *pDst = pDstBase;
 
             // Fast path: Avoid moving pixel by pixel if no blend required and same format
-            if (!blendRequired && (srcPtr->format == dst->format)) memcpy(pDst, pSrc, (int)(srcRec.width)*bytesPerPixelSrc);
+            if (copyLines) memcpy(pDst, pSrc, (int)(srcRec.width)*bytesPerPixelSrc);
+            else if (expandLines) UnpackPixelsRGBA8(pSrc, srcPtr->format, (int)srcRec.width, pDst);
+            else if (blendLines) BlendPixelsRGBA8(pSrc, srcPtr->format, pDst, (int)srcRec.width, tint);
             else
             {
                 for (int x = 0; x < (int)srcRec.width; x++)
@@ -3927,35 +3932,477 @@ void SetTextureWrap(Texture2D texture, int wrap)
 }
 
 //------------------------------------------------------------------------------------
-// Texture drawing functions
+// Texture asynchronous loading functions
 //------------------------------------------------------------------------------------
-// Draw a texture
-void DrawTexture(Texture2D texture, int posX, int posY, Color tint)
+// Load texture asynchronously, file is read and decoded on a loader thread
+// NOTE: Returned texture id is 0 until uploaded by UpdateTextureUploads(), called by EndDrawing()
+Texture2D *LoadTextureAsync(const char *fileName)
 {
-    DrawTextureEx(texture, (Vector2){ (float)posX, (float)posY }, 0.0f, 1.0f, tint);
-}
+    TextureRequest *request = (TextureRequest *)RL_CALLOC(1, sizeof(TextureRequest));
+    request->fileName = (char *)RL_MALLOC(strlen(fileName) + 1);
+    strcpy(request->fileName, fileName);
 
-// Draw a texture with position defined as Vector2
-void DrawTextureV(Texture2D texture, Vector2 position, Color tint)
-{
-    DrawTextureEx(texture, position, 0, 1.0f, tint);
-}
+#if defined(SUPPORT_IMAGE_THREADS)
+    pthread_mutex_lock(&textureLoader.lock);
 
-// Draw a texture with extended parameters
-void DrawTextureEx(Texture2D texture, Vector2 position, float rotation, float scale, Color tint)
-{
-    Rectangle source = { 0.0f, 0.0f, (float)texture.width, (float)texture.height };
-    Rectangle dest = { position.x, position.y, (float)texture.width*scale, (float)texture.height*scale };
-    Vector2 origin = { 0.0f, 0.0f };
+    // NOTE: Loader threads are created on first use, and again after CloseTextureLoader()
+    if (!textureLoader.ready) InitTextureLoader();
 
-    DrawTexturePro(texture, source, dest, origin, rotation, tint);
-}
+    if (textureLoader.threadCount > 0)
+    {
+        if (textureLoader.decodeTail != NULL) textureLoader.decodeTail->next = request;
+        else textureLoader.decodeHead = request;
+        textureLoader.decodeTail = request;
+        pthread_cond_signal(&textureLoader.requestReady);
+        pthread_mutex_unlock(&textureLoader.lock);
 
-// Draw a part of a texture (defined by a rectangle)
-void DrawTextureRec(Texture2D texture, Rectangle source, Vector2 position, Color tint)
-{
-    Rectangle dest = { position.x, position.y, fabsf(source.width), fabsf(source.height) };
-    Vector2 origin = { 0.0f, 0.0f };
+        return &request->texture;
+    }
+
+    pthread_mutex_unlock(&textureLoader.lock);
+#endif
+    // Loader threads not available, image decoded on calling thread, upload is still deferred
+    Image image = LoadImage(fileName);
+#if defined(SUPPORT_IMAGE_THREADS)
+    pthread_mutex_lock(&textureLoader.lock);
+#endif
+    CompleteTextureRequest(request, image);
+#if defined(SUPPORT_IMAGE_THREADS)
+    pthread_mutex_unlock(&textureLoader.lock);
+#endif
+
+    return &request->texture;
+}
+
+// Unload texture loaded asynchronously, loading is cancelled if not uploaded yet
+void UnloadTextureAsync(Texture2D *texture)
+{
+    if (texture == NULL) return;
+
+    TextureRequest *request = (TextureRequest *)texture;
+
+    if (request->uploaded)
+    {
+        if (request->texture.id > 0) UnloadTexture(request->texture);
+        RL_FREE(request->fileName);
+        RL_FREE(request);
+    }
+    else
+    {
+#if defined(SUPPORT_IMAGE_THREADS)
+        pthread_mutex_lock(&textureLoader.lock);
+#endif
+        // Request still in a queue, it is freed when dequeued
+        request->cancelled = true;
+#if defined(SUPPORT_IMAGE_THREADS)
+        pthread_mutex_unlock(&textureLoader.lock);
+#endif
+    }
+}
+
+// Check if a texture loaded asynchronously has been uploaded (it could have failed, texture id is 0)
+bool IsTextureAsyncDone(const Texture2D *texture)
+{
+    return ((texture != NULL) && ((const TextureRequest *)texture)->uploaded);
+}
+
+// Upload textures decoded by loader threads, within per frame budget
+// NOTE: Called by EndDrawing(), at least one texture is uploaded per call if available
+void UpdateTextureUploads(void)
+{
+    int uploadedBytes = 0;
+    double startTime = GetTime();
+
+    while (true)
+    {
+#if defined(SUPPORT_IMAGE_THREADS)
+        pthread_mutex_lock(&textureLoader.lock);
+#endif
+        TextureRequest *request = textureLoader.uploadHead;
+
+        if (request != NULL)
+        {
+            int size = GetPixelDataSize(request->image.width, request->image.height, request->image.format);
+
+            if (request->cancelled || (uploadedBytes == 0) || (uploadedBytes + size <= textureLoader.budgetBytes))
+            {
+                textureLoader.uploadHead = request->next;
+                if (textureLoader.uploadHead == NULL) textureLoader.uploadTail = NULL;
+                request->next = NULL;
+            }
+            else request = NULL;    // Bytes budget exceeded
+        }
+#if defined(SUPPORT_IMAGE_THREADS)
+        pthread_mutex_unlock(&textureLoader.lock);
+#endif
+        if (request == NULL) break;
+
+        // NOTE: Requests are only cancelled from this thread, no lock required once dequeued
+        if (request->cancelled)
+        {
+            UnloadImage(request->image);
+            RL_FREE(request->fileName);
+            RL_FREE(request);
+            continue;
+        }
+
+        if (request->image.data != NULL)
+        {
+            request->texture = (textureLoader.upload != NULL)? textureLoader.upload(request->image) : LoadTextureFromImage(request->image);
+            uploadedBytes += GetPixelDataSize(request->image.width, request->image.height, request->image.format);
+            UnloadImage(request->image);
+        }
+        else TRACELOG(LOG_WARNING, "TEXTURE: [%s] Failed to load texture asynchronously", request->fileName);
+
+        request->image = (Image){ 0 };
+        request->uploaded = true;
+
+        if ((GetTime() - startTime) >= textureLoader.budgetTime) break;
+    }
+}
+
+// Set per frame budget uploading textures loaded asynchronously (bytes and milliseconds)
+void SetTextureUploadBudget(int bytes, float milliseconds)
+{
+#if defined(SUPPORT_IMAGE_THREADS)
+    pthread_mutex_lock(&textureLoader.lock);
+#endif
+    textureLoader.budgetBytes = bytes;
+    textureLoader.budgetTime = milliseconds/1000.0;
+#if defined(SUPPORT_IMAGE_THREADS)
+    pthread_mutex_unlock(&textureLoader.lock);
+#endif
+}
+
+// Set custom texture upload function, used by UpdateTextureUploads()
+// NOTE: Useful to check textures loading without GPU access, NULL sets default upload
+void SetUploadTextureCallback(UploadTextureCallback callback)
+{
+    textureLoader.upload = callback;
+}
+
+// Close texture loader, loader threads are joined and queues emptied
+// NOTE: Requests still queued are completed as failed (texture id 0) and remain owned by user,
+// cancelled requests are freed. Called by CloseWindow(), loader restarts on next LoadTextureAsync()
+void CloseTextureLoader(void)
+{
+#if defined(SUPPORT_IMAGE_THREADS)
+    pthread_mutex_lock(&textureLoader.lock);
+    textureLoader.quit = true;
+    pthread_cond_broadcast(&textureLoader.requestReady);
+    pthread_mutex_unlock(&textureLoader.lock);
+
+    // NOTE: A thread decoding an image finishes it before exiting
+    for (int i = 0; i < textureLoader.threadCount; i++) pthread_join(textureLoader.threads[i], NULL);
+
+    textureLoader.threadCount = 0;
+    textureLoader.ready = false;
+    textureLoader.quit = false;
+#endif
+
+    TextureRequest *queues[2] = { textureLoader.decodeHead, textureLoader.uploadHead };
+
+    for (int i = 0; i < 2; i++)
+    {
+        TextureRequest *request = queues[i];
+
+        while (request != NULL)
+        {
+            TextureRequest *next = request->next;
+
+            UnloadImage(request->image);
+
+            if (request->cancelled)
+            {
+                RL_FREE(request->fileName);
+                RL_FREE(request);
+            }
+            else
+            {
+                request->image = (Image){ 0 };
+                request->next = NULL;
+                request->uploaded = true;
+            }
+
+            request = next;
+        }
+    }
+
+    textureLoader.decodeHead = NULL;
+    textureLoader.decodeTail = NULL;
+    textureLoader.uploadHead = NULL;
+    textureLoader.uploadTail = NULL;
+}
+
+//------------------------------------------------------------------------------------
+// Texture atlas functions
+//------------------------------------------------------------------------------------
+// Load texture atlas, images are packed at runtime into shared pages (RGBA8)
+// NOTE: Pages are created on demand up to maxPages, then least recently used images are evicted
+TextureAtlas *LoadTextureAtlas(int pageWidth, int pageHeight, int padding, int maxPages)
+{
+    if ((pageWidth <= 0) || (pageHeight <= 0) || (padding < 0)) return NULL;
+    if (maxPages < 1) maxPages = 1;
+
+    TextureAtlas *atlas = (TextureAtlas *)RL_CALLOC(1, sizeof(TextureAtlas));
+
+    atlas->pageWidth = pageWidth;
+    atlas->pageHeight = pageHeight;
+    atlas->padding = padding;
+    atlas->maxPages = maxPages;
+    atlas->pages = (AtlasPage *)RL_CALLOC(maxPages, sizeof(AtlasPage));
+
+    return atlas;
+}
+
+// Unload texture atlas pages from GPU memory (VRAM) and atlas data
+void UnloadTextureAtlas(TextureAtlas *atlas)
+{
+    if (atlas == NULL) return;
+
+    for (int i = 0; i < atlas->pageCount; i++)
+    {
+        UnloadTexture(atlas->pages[i].texture);
+        RL_FREE(atlas->pages[i].pixels);
+        RL_FREE(atlas->pages[i].nodes);
+    }
+
+    RL_FREE(atlas->pages);
+    RL_FREE(atlas->images);
+    RL_FREE(atlas);
+}
+
+// Add image to texture atlas, returns image handle (-1 on failure)
+// NOTE: Image edges are extruded into padding, so bilinear filtering does not sample neighbour images
+int AddTextureAtlasImage(TextureAtlas *atlas, Image image)
+{
+    if ((atlas == NULL) || (image.data == NULL) || (image.width <= 0) || (image.height <= 0)) return -1;
+
+    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: Compressed image formats can not be added to atlas");
+        return -1;
+    }
+
+    int padding = atlas->padding;
+    int width = image.width + 2*padding;
+    int height = image.height + 2*padding;
+
+    if ((width > atlas->pageWidth) || (height > atlas->pageHeight))
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: Image (%ix%i) does not fit in atlas page (%ix%i)", image.width, image.height, atlas->pageWidth, atlas->pageHeight);
+        return -1;
+    }
+
+    // Get a free image slot, slots array grows as required
+    int index = -1;
+    for (int i = 0; i < atlas->imageCapacity; i++) if (atlas->images[i].page == -1) { index = i; break; }
+
+    if (index == -1)
+    {
+        if (atlas->imageCapacity == MAX_TEXTURE_ATLAS_IMAGES)
+        {
+            TRACELOG(LOG_WARNING, "TEXTURE: Atlas images limit reached (%i)", MAX_TEXTURE_ATLAS_IMAGES);
+            return -1;
+        }
+
+        int capacity = (atlas->imageCapacity == 0)? 64 : MIN(2*atlas->imageCapacity, MAX_TEXTURE_ATLAS_IMAGES);
+        atlas->images = (AtlasImage *)RL_REALLOC(atlas->images, capacity*sizeof(AtlasImage));
+
+        for (int i = atlas->imageCapacity; i < capacity; i++) atlas->images[i] = (AtlasImage){ .page = -1 };
+
+        index = atlas->imageCapacity;
+        atlas->imageCapacity = capacity;
+    }
+
+    int page = -1;
+    int x = 0;
+    int y = 0;
+
+    // Try pages in use, then pages with space of removed images once repacked
+    for (int i = 0; (i < atlas->pageCount) && (page == -1); i++) if (PackAtlasImage(atlas, i, width, height, &x, &y)) page = i;
+
+    for (int i = 0; (i < atlas->pageCount) && (page == -1); i++)
+    {
+        AtlasPage *atlasPage = &atlas->pages[i];
+
+        if ((atlasPage->packedArea > atlasPage->usedArea) && (atlas->pageWidth*atlas->pageHeight - atlasPage->usedArea >= width*height))
+        {
+            RepackAtlasPage(atlas, i);
+            if (PackAtlasImage(atlas, i, width, height, &x, &y)) page = i;
+        }
+    }
+
+    // Create a new page
+    if ((page == -1) && (atlas->pageCount < atlas->maxPages))
+    {
+        AtlasPage *atlasPage = &atlas->pages[atlas->pageCount];
+
+        atlasPage->pixels = (unsigned char *)RL_CALLOC(atlas->pageWidth*atlas->pageHeight*4, 1);
+        atlasPage->texture.id = rlLoadTexture(atlasPage->pixels, atlas->pageWidth, atlas->pageHeight, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
+        atlasPage->texture.width = atlas->pageWidth;
+        atlasPage->texture.height = atlas->pageHeight;
+        atlasPage->texture.mipmaps = 1;
+        atlasPage->texture.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+        atlasPage->nodes = (stbrp_node *)RL_MALLOC(atlas->pageWidth*sizeof(stbrp_node));
+
+        stbrp_init_target(&atlasPage->context, atlas->pageWidth, atlas->pageHeight, atlasPage->nodes, atlas->pageWidth);
+        stbrp_setup_heuristic(&atlasPage->context, STBRP_HEURISTIC_Skyline_BF_sortHeight);
+
+        atlas->pageCount++;
+
+        if (atlasPage->texture.id == 0) TRACELOG(LOG_WARNING, "TEXTURE: Failed to load atlas page texture");
+        if (PackAtlasImage(atlas, atlas->pageCount - 1, width, height, &x, &y)) page = atlas->pageCount - 1;
+    }
+
+    // Evict least recently used images, until there is enough space in one page
+    while (page == -1)
+    {
+        int oldest = -1;
+
+        for (int i = 0; i < atlas->imageCapacity; i++)
+        {
+            if ((atlas->images[i].page != -1) && ((oldest == -1) || (atlas->images[i].lastUse < atlas->images[oldest].lastUse))) oldest = i;
+        }
+
+        if (oldest == -1) break;
+
+        int evictedPage = atlas->images[oldest].page;
+        AtlasPage *atlasPage = &atlas->pages[evictedPage];
+
+        RemoveAtlasImage(atlas, oldest);
+
+        if (atlas->pageWidth*atlas->pageHeight - atlasPage->usedArea >= width*height)
+        {
+            if (atlasPage->packedArea > atlasPage->usedArea) RepackAtlasPage(atlas, evictedPage);
+            if (PackAtlasImage(atlas, evictedPage, width, height, &x, &y)) page = evictedPage;
+        }
+    }
+
+    if (page == -1)
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: Image (%ix%i) could not be packed into atlas", image.width, image.height);
+        return -1;
+    }
+
+    // Image copied to page pixels, edges extruded into padding
+    Image source = image;
+    if (image.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+    {
+        source = ImageCopy(image);
+        ImageFormat(&source, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    }
+
+    AtlasPage *atlasPage = &atlas->pages[page];
+    int pageRowSize = atlas->pageWidth*4;
+    int imageRowSize = image.width*4;
+
+    for (int j = 0; j < height; j++)
+    {
+        int sourceY = (j < padding)? 0 : ((j >= padding + image.height)? image.height - 1 : j - padding);
+        const unsigned char *sourceRow = (const unsigned char *)source.data + sourceY*imageRowSize;
+        unsigned char *row = atlasPage->pixels + (y + j)*pageRowSize + x*4;
+
+        for (int i = 0; i < padding; i++)
+        {
+            memcpy(row + i*4, sourceRow, 4);
+            memcpy(row + (padding + image.width + i)*4, sourceRow + imageRowSize - 4, 4);
+        }
+
+        memcpy(row + padding*4, sourceRow, imageRowSize);
+    }
+
+    if (source.data != image.data) UnloadImage(source);
+
+    // Packed rectangle uploaded, page rows are not contiguous
+    unsigned char *pixels = (unsigned char *)RL_MALLOC(width*height*4);
+    for (int j = 0; j < height; j++) memcpy(pixels + j*width*4, atlasPage->pixels + (y + j)*pageRowSize + x*4, width*4);
+    UpdateTextureRec(atlasPage->texture, (Rectangle){ (float)x, (float)y, (float)width, (float)height }, pixels);
+    RL_FREE(pixels);
+
+    AtlasImage *atlasImage = &atlas->images[index];
+    atlasImage->page = page;
+    atlasImage->x = x;
+    atlasImage->y = y;
+    atlasImage->width = image.width;
+    atlasImage->height = image.height;
+    atlasImage->lastUse = atlas->useCounter++;
+
+    atlasPage->usedArea += width*height;
+    atlasPage->imageCount++;
+
+    return (int)(((atlasImage->generation & 0x7fff) << 16) | (unsigned int)index);
+}
+
+// Remove image from texture atlas, its handle is not valid anymore
+void RemoveTextureAtlasImage(TextureAtlas *atlas, int handle)
+{
+    int index = GetAtlasImageIndex(atlas, handle);
+
+    if (index != -1) RemoveAtlasImage(atlas, index);
+}
+
+// Get texture atlas image region, to be drawn with DrawTextureRec() or DrawTexturePro()
+// NOTE: Returned texture id is 0 if image was removed or evicted, region could change when pages are repacked
+AtlasRegion GetTextureAtlasRegion(TextureAtlas *atlas, int handle)
+{
+    AtlasRegion region = { 0 };
+    int index = GetAtlasImageIndex(atlas, handle);
+
+    if (index != -1)
+    {
+        AtlasImage *atlasImage = &atlas->images[index];
+        atlasImage->lastUse = atlas->useCounter++;
+
+        region.texture = atlas->pages[atlasImage->page].texture;
+        region.source = (Rectangle){ (float)(atlasImage->x + atlas->padding), (float)(atlasImage->y + atlas->padding), (float)atlasImage->width, (float)atlasImage->height };
+    }
+
+    return region;
+}
+
+// Defragment texture atlas, pages are repacked to reclaim space of removed images
+// NOTE: Images regions change, they should be retrieved again with GetTextureAtlasRegion()
+void DefragTextureAtlas(TextureAtlas *atlas)
+{
+    if (atlas == NULL) return;
+
+    for (int i = 0; i < atlas->pageCount; i++)
+    {
+        if (atlas->pages[i].packedArea > atlas->pages[i].usedArea) RepackAtlasPage(atlas, i);
+    }
+}
+
+//------------------------------------------------------------------------------------
+// Texture drawing functions
+//------------------------------------------------------------------------------------
+// Draw a texture
+void DrawTexture(Texture2D texture, int posX, int posY, Color tint)
+{
+    DrawTextureEx(texture, (Vector2){ (float)posX, (float)posY }, 0.0f, 1.0f, tint);
+}
+
+// Draw a texture with position defined as Vector2
+void DrawTextureV(Texture2D texture, Vector2 position, Color tint)
+{
+    DrawTextureEx(texture, position, 0, 1.0f, tint);
+}
+
+// Draw a texture with extended parameters
+void DrawTextureEx(Texture2D texture, Vector2 position, float rotation, float scale, Color tint)
+{
+    Rectangle source = { 0.0f, 0.0f, (float)texture.width, (float)texture.height };
+    Rectangle dest = { position.x, position.y, (float)texture.width*scale, (float)texture.height*scale };
+    Vector2 origin = { 0.0f, 0.0f };
+
+    DrawTexturePro(texture, source, dest, origin, rotation, tint);
+}
+
+// Draw a part of a texture (defined by a rectangle)
+void DrawTextureRec(Texture2D texture, Rectangle source, Vector2 position, Color tint)
+{
+    Rectangle dest = { position.x, position.y, fabsf(source.width), fabsf(source.height) };
+    Vector2 origin = { 0.0f, 0.0f };
 
     DrawTexturePro(texture, source, dest, origin, 0.0f, tint);
 }
@@ -4831,140 +5278,1751 @@ static unsigned short FloatToHalf(float x) {
     return (b&0x80000000)>>16 | (e>112)*((((e-112)<<10)&0x7C00)|m>>13) | ((e<113)&(e>101))*((((0x007FF000+m)>>(125-e))+1)>>1) | (e>143)*0x7FFF; // sign : normalized : denormalized : saturate
 }
 
-// Get pixel data from image as Vector4 array (float normalized)
-static Vector4 *LoadImageDataNormalized(Image image)
+// Unpack pixels to RGBA8, only formats up to 8 bit per channel
+// NOTE: Channels are expanded to 8 bit rounding to nearest: round(value*255/(2^bits - 1))
+static void UnpackPixelsRGBA8(const void *src, int format, int count, unsigned char *dst)
 {
-    Vector4 *pixels = (Vector4 *)RL_MALLOC(image.width*image.height*sizeof(Vector4));
+    int i = 0;
 
-    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
-    else
+    switch (format)
     {
-        for (int i = 0, k = 0; i < image.width*image.height; i++)
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
         {
-            switch (image.format)
+            const unsigned char *pixels = (const unsigned char *)src;
+        #if defined(RTEXTURES_SIMD_NEON)
+            for (; i + 16 <= count; i += 16)
             {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].w = 1.0f;
+                uint8x16x4_t color;
+                color.val[0] = vld1q_u8(pixels + i);
+                color.val[1] = color.val[0];
+                color.val[2] = color.val[0];
+                color.val[3] = vdupq_n_u8(255);
+                vst4q_u8(dst + i*4, color);
+            }
+        #elif defined(RTEXTURES_SIMD_SSE2)
+            for (; i + 8 <= count; i += 8)
+            {
+                __m128i gray = _mm_loadl_epi64((const __m128i *)(pixels + i));
+                __m128i gg = _mm_unpacklo_epi8(gray, gray);
+                __m128i ga = _mm_unpacklo_epi8(gray, _mm_set1_epi8((char)255));
+                _mm_storeu_si128((__m128i *)(dst + i*4), _mm_unpacklo_epi16(gg, ga));
+                _mm_storeu_si128((__m128i *)(dst + i*4 + 16), _mm_unpackhi_epi16(gg, ga));
+            }
+        #endif
+            for (; i < count; i++)
+            {
+                dst[i*4] = pixels[i];
+                dst[i*4 + 1] = pixels[i];
+                dst[i*4 + 2] = pixels[i];
+                dst[i*4 + 3] = 255;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        {
+            const unsigned char *pixels = (const unsigned char *)src;
+        #if defined(RTEXTURES_SIMD_NEON)
+            for (; i + 16 <= count; i += 16)
+            {
+                uint8x16x2_t pixel = vld2q_u8(pixels + i*2);
+                uint8x16x4_t color;
+                color.val[0] = pixel.val[0];
+                color.val[1] = pixel.val[0];
+                color.val[2] = pixel.val[0];
+                color.val[3] = pixel.val[1];
+                vst4q_u8(dst + i*4, color);
+            }
+        #elif defined(RTEXTURES_SIMD_SSE2)
+            for (; i + 8 <= count; i += 8)
+            {
+                __m128i ga = _mm_loadu_si128((const __m128i *)(pixels + i*2));
+                __m128i gray = _mm_and_si128(ga, _mm_set1_epi16(0xff));
+                __m128i gg = _mm_or_si128(gray, _mm_slli_epi16(gray, 8));
+                _mm_storeu_si128((__m128i *)(dst + i*4), _mm_unpacklo_epi16(gg, ga));
+                _mm_storeu_si128((__m128i *)(dst + i*4 + 16), _mm_unpackhi_epi16(gg, ga));
+            }
+        #endif
+            for (; i < count; i++)
+            {
+                dst[i*4] = pixels[i*2];
+                dst[i*4 + 1] = pixels[i*2];
+                dst[i*4 + 2] = pixels[i*2];
+                dst[i*4 + 3] = pixels[i*2 + 1];
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        {
+            const unsigned short *pixels = (const unsigned short *)src;
+        #if defined(RTEXTURES_SIMD_NEON)
+            for (; i + 8 <= count; i += 8)
+            {
+                uint16x8_t pixel = vld1q_u16(pixels + i);
+                uint8x8x4_t color;
+                color.val[0] = vmovn_u16(vshrq_n_u16(vmlaq_n_u16(vdupq_n_u16(23), vshrq_n_u16(pixel, 11), 527), 6));
+                color.val[1] = vmovn_u16(vshrq_n_u16(vmlaq_n_u16(vdupq_n_u16(33), vandq_u16(vshrq_n_u16(pixel, 5), vdupq_n_u16(0x3f)), 259), 6));
+                color.val[2] = vmovn_u16(vshrq_n_u16(vmlaq_n_u16(vdupq_n_u16(23), vandq_u16(pixel, vdupq_n_u16(0x1f)), 527), 6));
+                color.val[3] = vdup_n_u8(255);
+                vst4_u8(dst + i*4, color);
+            }
+        #elif defined(RTEXTURES_SIMD_SSE2)
+            for (; i + 8 <= count; i += 8)
+            {
+                __m128i pixel = _mm_loadu_si128((const __m128i *)(pixels + i));
+                __m128i r = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_srli_epi16(pixel, 11), _mm_set1_epi16(527)), _mm_set1_epi16(23)), 6);
+                __m128i g = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi16(pixel, 5), _mm_set1_epi16(0x3f)), _mm_set1_epi16(259)), _mm_set1_epi16(33)), 6);
+                __m128i b = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_and_si128(pixel, _mm_set1_epi16(0x1f)), _mm_set1_epi16(527)), _mm_set1_epi16(23)), 6);
+                __m128i rg = _mm_or_si128(r, _mm_slli_epi16(g, 8));
+                __m128i ba = _mm_or_si128(b, _mm_set1_epi16((short)0xff00));
+                _mm_storeu_si128((__m128i *)(dst + i*4), _mm_unpacklo_epi16(rg, ba));
+                _mm_storeu_si128((__m128i *)(dst + i*4 + 16), _mm_unpackhi_epi16(rg, ba));
+            }
+        #endif
+            for (; i < count; i++)
+            {
+                unsigned short pixel = pixels[i];
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].w = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+                dst[i*4] = (unsigned char)(((pixel >> 11)*527 + 23) >> 6);
+                dst[i*4 + 1] = (unsigned char)((((pixel >> 5) & 0x3f)*259 + 33) >> 6);
+                dst[i*4 + 2] = (unsigned char)(((pixel & 0x1f)*527 + 23) >> 6);
+                dst[i*4 + 3] = 255;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        {
+            const unsigned char *pixels = (const unsigned char *)src;
+        #if defined(RTEXTURES_SIMD_NEON)
+            for (; i + 16 <= count; i += 16)
+            {
+                uint8x16x3_t pixel = vld3q_u8(pixels + i*3);
+                uint8x16x4_t color;
+                color.val[0] = pixel.val[0];
+                color.val[1] = pixel.val[1];
+                color.val[2] = pixel.val[2];
+                color.val[3] = vdupq_n_u8(255);
+                vst4q_u8(dst + i*4, color);
+            }
+        #endif
+            for (; i < count; i++)
+            {
+                dst[i*4] = pixels[i*3];
+                dst[i*4 + 1] = pixels[i*3 + 1];
+                dst[i*4 + 2] = pixels[i*3 + 2];
+                dst[i*4 + 3] = 255;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        {
+            const unsigned short *pixels = (const unsigned short *)src;
+        #if defined(RTEXTURES_SIMD_NEON)
+            for (; i + 8 <= count; i += 8)
+            {
+                uint16x8_t pixel = vld1q_u16(pixels + i);
+                uint8x8x4_t color;
+                color.val[0] = vmovn_u16(vshrq_n_u16(vmlaq_n_u16(vdupq_n_u16(23), vshrq_n_u16(pixel, 11), 527), 6));
+                color.val[1] = vmovn_u16(vshrq_n_u16(vmlaq_n_u16(vdupq_n_u16(23), vandq_u16(vshrq_n_u16(pixel, 6), vdupq_n_u16(0x1f)), 527), 6));
+                color.val[2] = vmovn_u16(vshrq_n_u16(vmlaq_n_u16(vdupq_n_u16(23), vandq_u16(vshrq_n_u16(pixel, 1), vdupq_n_u16(0x1f)), 527), 6));
+                color.val[3] = vmovn_u16(vmulq_n_u16(vandq_u16(pixel, vdupq_n_u16(1)), 255));
+                vst4_u8(dst + i*4, color);
+            }
+        #elif defined(RTEXTURES_SIMD_SSE2)
+            for (; i + 8 <= count; i += 8)
+            {
+                __m128i pixel = _mm_loadu_si128((const __m128i *)(pixels + i));
+                __m128i r = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_srli_epi16(pixel, 11), _mm_set1_epi16(527)), _mm_set1_epi16(23)), 6);
+                __m128i g = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi16(pixel, 6), _mm_set1_epi16(0x1f)), _mm_set1_epi16(527)), _mm_set1_epi16(23)), 6);
+                __m128i b = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi16(pixel, 1), _mm_set1_epi16(0x1f)), _mm_set1_epi16(527)), _mm_set1_epi16(23)), 6);
+                __m128i a = _mm_mullo_epi16(_mm_and_si128(pixel, _mm_set1_epi16(1)), _mm_set1_epi16(255));
+                __m128i rg = _mm_or_si128(r, _mm_slli_epi16(g, 8));
+                __m128i ba = _mm_or_si128(b, _mm_slli_epi16(a, 8));
+                _mm_storeu_si128((__m128i *)(dst + i*4), _mm_unpacklo_epi16(rg, ba));
+                _mm_storeu_si128((__m128i *)(dst + i*4 + 16), _mm_unpackhi_epi16(rg, ba));
+            }
+        #endif
+            for (; i < count; i++)
+            {
+                unsigned short pixel = pixels[i];
 
-                    k += 2;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+                dst[i*4] = (unsigned char)(((pixel >> 11)*527 + 23) >> 6);
+                dst[i*4 + 1] = (unsigned char)((((pixel >> 6) & 0x1f)*527 + 23) >> 6);
+                dst[i*4 + 2] = (unsigned char)((((pixel >> 1) & 0x1f)*527 + 23) >> 6);
+                dst[i*4 + 3] = (pixel & 0x1)*255;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        {
+            const unsigned short *pixels = (const unsigned short *)src;
+        #if defined(RTEXTURES_SIMD_NEON)
+            for (; i + 8 <= count; i += 8)
+            {
+                uint16x8_t pixel = vld1q_u16(pixels + i);
+                uint8x8x4_t color;
+                color.val[0] = vmovn_u16(vmulq_n_u16(vshrq_n_u16(pixel, 12), 17));
+                color.val[1] = vmovn_u16(vmulq_n_u16(vandq_u16(vshrq_n_u16(pixel, 8), vdupq_n_u16(0xf)), 17));
+                color.val[2] = vmovn_u16(vmulq_n_u16(vandq_u16(vshrq_n_u16(pixel, 4), vdupq_n_u16(0xf)), 17));
+                color.val[3] = vmovn_u16(vmulq_n_u16(vandq_u16(pixel, vdupq_n_u16(0xf)), 17));
+                vst4_u8(dst + i*4, color);
+            }
+        #elif defined(RTEXTURES_SIMD_SSE2)
+            for (; i + 8 <= count; i += 8)
+            {
+                __m128i pixel = _mm_loadu_si128((const __m128i *)(pixels + i));
+                __m128i r = _mm_mullo_epi16(_mm_srli_epi16(pixel, 12), _mm_set1_epi16(17));
+                __m128i g = _mm_mullo_epi16(_mm_and_si128(_mm_srli_epi16(pixel, 8), _mm_set1_epi16(0xf)), _mm_set1_epi16(17));
+                __m128i b = _mm_mullo_epi16(_mm_and_si128(_mm_srli_epi16(pixel, 4), _mm_set1_epi16(0xf)), _mm_set1_epi16(17));
+                __m128i a = _mm_mullo_epi16(_mm_and_si128(pixel, _mm_set1_epi16(0xf)), _mm_set1_epi16(17));
+                __m128i rg = _mm_or_si128(r, _mm_slli_epi16(g, 8));
+                __m128i ba = _mm_or_si128(b, _mm_slli_epi16(a, 8));
+                _mm_storeu_si128((__m128i *)(dst + i*4), _mm_unpacklo_epi16(rg, ba));
+                _mm_storeu_si128((__m128i *)(dst + i*4 + 16), _mm_unpackhi_epi16(rg, ba));
+            }
+        #endif
+            for (; i < count; i++)
+            {
+                unsigned short pixel = pixels[i];
+
+                dst[i*4] = (unsigned char)((pixel >> 12)*17);
+                dst[i*4 + 1] = (unsigned char)(((pixel >> 8) & 0xf)*17);
+                dst[i*4 + 2] = (unsigned char)(((pixel >> 4) & 0xf)*17);
+                dst[i*4 + 3] = (unsigned char)((pixel & 0xf)*17);
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: memcpy(dst, src, count*4); break;
+        default: break;
+    }
+}
+
+// Pack RGBA8 pixels, only formats up to 8 bit per channel
+// NOTE: Channels are reduced rounding to nearest: round(value*(2^bits - 1)/255), computed as (t + (t >> 8)) >> 8 with t = value*(2^bits - 1) + 128,
+// grayscale uses luminance weights 0.299, 0.587, 0.114 in 8 bit fixed point: (77*r + 150*g + 29*b + 128) >> 8
+static void PackPixelsRGBA8(const unsigned char *src, int count, int format, void *dst)
+{
+    int i = 0;
+
+    switch (format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        {
+            unsigned char *pixels = (unsigned char *)dst;
+            int channels = (format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)? 2 : 1;
+        #if defined(RTEXTURES_SIMD_NEON)
+            for (; i + 16 <= count; i += 16)
+            {
+                uint8x16x4_t color = vld4q_u8(src + i*4);
+                uint16x8_t low = vmull_u8(vget_low_u8(color.val[0]), vdup_n_u8(77));
+                uint16x8_t high = vmull_u8(vget_high_u8(color.val[0]), vdup_n_u8(77));
+                low = vmlal_u8(low, vget_low_u8(color.val[1]), vdup_n_u8(150));
+                high = vmlal_u8(high, vget_high_u8(color.val[1]), vdup_n_u8(150));
+                low = vmlal_u8(low, vget_low_u8(color.val[2]), vdup_n_u8(29));
+                high = vmlal_u8(high, vget_high_u8(color.val[2]), vdup_n_u8(29));
+                uint8x16_t gray = vcombine_u8(vrshrn_n_u16(low, 8), vrshrn_n_u16(high, 8));
+
+                if (channels == 1) vst1q_u8(pixels + i, gray);
+                else
+                {
+                    uint8x16x2_t pixel;
+                    pixel.val[0] = gray;
+                    pixel.val[1] = color.val[3];
+                    vst2q_u8(pixels + i*2, pixel);
+                }
+            }
+        #elif defined(RTEXTURES_SIMD_SSE2)
+            for (; i + 8 <= count; i += 8)
+            {
+                __m128i color0 = _mm_loadu_si128((const __m128i *)(src + i*4));
+                __m128i color1 = _mm_loadu_si128((const __m128i *)(src + i*4 + 16));
+                __m128i mask = _mm_set1_epi32(0xff);
+                __m128i r = _mm_packs_epi32(_mm_and_si128(color0, mask), _mm_and_si128(color1, mask));
+                __m128i g = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(color0, 8), mask), _mm_and_si128(_mm_srli_epi32(color1, 8), mask));
+                __m128i b = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(color0, 16), mask), _mm_and_si128(_mm_srli_epi32(color1, 16), mask));
+                __m128i gray = _mm_add_epi16(_mm_mullo_epi16(r, _mm_set1_epi16(77)), _mm_mullo_epi16(g, _mm_set1_epi16(150)));
+                gray = _mm_add_epi16(gray, _mm_mullo_epi16(b, _mm_set1_epi16(29)));
+                gray = _mm_srli_epi16(_mm_add_epi16(gray, _mm_set1_epi16(128)), 8);
+
+                if (channels == 1) _mm_storel_epi64((__m128i *)(pixels + i), _mm_packus_epi16(gray, gray));
+                else
+                {
+                    __m128i a = _mm_packs_epi32(_mm_srli_epi32(color0, 24), _mm_srli_epi32(color1, 24));
+                    _mm_storeu_si128((__m128i *)(pixels + i*2), _mm_or_si128(gray, _mm_slli_epi16(a, 8)));
+                }
+            }
+        #endif
+            for (; i < count; i++)
+            {
+                pixels[i*channels] = (unsigned char)((77*src[i*4] + 150*src[i*4 + 1] + 29*src[i*4 + 2] + 128) >> 8);
+                if (channels == 2) pixels[i*2 + 1] = src[i*4 + 3];
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        {
+            unsigned short *pixels = (unsigned short *)dst;
+
+            // Channel maximum values and shifts for every 16 bit format
+            int rMax = 31, gMax = 63, bMax = 31;
+            int rShift = 11, gShift = 5, bShift = 0;
+            if (format == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1) { gMax = 31; gShift = 6; bShift = 1; }
+            else if (format == PIXELFORMAT_UNCOMPRESSED_R4G4B4A4) { rMax = 15; gMax = 15; bMax = 15; rShift = 12; gShift = 8; bShift = 4; }
+
+        #if defined(RTEXTURES_SIMD_NEON)
+            for (; i + 8 <= count; i += 8)
+            {
+                uint8x8x4_t color = vld4_u8(src + i*4);
+                uint16x8_t r = vmlal_u8(vdupq_n_u16(128), color.val[0], vdup_n_u8((uint8_t)rMax));
+                uint16x8_t g = vmlal_u8(vdupq_n_u16(128), color.val[1], vdup_n_u8((uint8_t)gMax));
+                uint16x8_t b = vmlal_u8(vdupq_n_u16(128), color.val[2], vdup_n_u8((uint8_t)bMax));
+                r = vshrq_n_u16(vsraq_n_u16(r, r, 8), 8);
+                g = vshrq_n_u16(vsraq_n_u16(g, g, 8), 8);
+                b = vshrq_n_u16(vsraq_n_u16(b, b, 8), 8);
+                uint16x8_t pixel = vorrq_u16(vshlq_u16(r, vdupq_n_s16((int16_t)rShift)), vorrq_u16(vshlq_u16(g, vdupq_n_s16((int16_t)gShift)), vshlq_u16(b, vdupq_n_s16((int16_t)bShift))));
+
+                if (format == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1) pixel = vorrq_u16(pixel, vmovl_u8(vshr_n_u8(vcgt_u8(color.val[3], vdup_n_u8(PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD)), 7)));
+                else if (format == PIXELFORMAT_UNCOMPRESSED_R4G4B4A4)
+                {
+                    uint16x8_t a = vmlal_u8(vdupq_n_u16(128), color.val[3], vdup_n_u8(15));
+                    pixel = vorrq_u16(pixel, vshrq_n_u16(vsraq_n_u16(a, a, 8), 8));
+                }
+
+                vst1q_u16(pixels + i, pixel);
+            }
+        #elif defined(RTEXTURES_SIMD_SSE2)
+            for (; i + 8 <= count; i += 8)
+            {
+                __m128i color0 = _mm_loadu_si128((const __m128i *)(src + i*4));
+                __m128i color1 = _mm_loadu_si128((const __m128i *)(src + i*4 + 16));
+                __m128i mask = _mm_set1_epi32(0xff);
+                __m128i r = _mm_packs_epi32(_mm_and_si128(color0, mask), _mm_and_si128(color1, mask));
+                __m128i g = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(color0, 8), mask), _mm_and_si128(_mm_srli_epi32(color1, 8), mask));
+                __m128i b = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(color0, 16), mask), _mm_and_si128(_mm_srli_epi32(color1, 16), mask));
+                __m128i a = _mm_packs_epi32(_mm_srli_epi32(color0, 24), _mm_srli_epi32(color1, 24));
+                r = _mm_add_epi16(_mm_mullo_epi16(r, _mm_set1_epi16((short)rMax)), _mm_set1_epi16(128));
+                g = _mm_add_epi16(_mm_mullo_epi16(g, _mm_set1_epi16((short)gMax)), _mm_set1_epi16(128));
+                b = _mm_add_epi16(_mm_mullo_epi16(b, _mm_set1_epi16((short)bMax)), _mm_set1_epi16(128));
+                r = _mm_srli_epi16(_mm_add_epi16(r, _mm_srli_epi16(r, 8)), 8);
+                g = _mm_srli_epi16(_mm_add_epi16(g, _mm_srli_epi16(g, 8)), 8);
+                b = _mm_srli_epi16(_mm_add_epi16(b, _mm_srli_epi16(b, 8)), 8);
+                __m128i pixel = _mm_or_si128(_mm_sll_epi16(r, _mm_cvtsi32_si128(rShift)), _mm_or_si128(_mm_sll_epi16(g, _mm_cvtsi32_si128(gShift)), _mm_sll_epi16(b, _mm_cvtsi32_si128(bShift))));
+
+                if (format == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1) pixel = _mm_or_si128(pixel, _mm_srli_epi16(_mm_cmpgt_epi16(a, _mm_set1_epi16(PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD)), 15));
+                else if (format == PIXELFORMAT_UNCOMPRESSED_R4G4B4A4)
+                {
+                    a = _mm_add_epi16(_mm_mullo_epi16(a, _mm_set1_epi16(15)), _mm_set1_epi16(128));
+                    pixel = _mm_or_si128(pixel, _mm_srli_epi16(_mm_add_epi16(a, _mm_srli_epi16(a, 8)), 8));
+                }
+
+                _mm_storeu_si128((__m128i *)(pixels + i), pixel);
+            }
+        #endif
+            for (; i < count; i++)
+            {
+                unsigned int r = src[i*4]*rMax + 128;
+                unsigned int g = src[i*4 + 1]*gMax + 128;
+                unsigned int b = src[i*4 + 2]*bMax + 128;
+                unsigned int a = src[i*4 + 3]*15 + 128;
+                unsigned short pixel = (unsigned short)((((r + (r >> 8)) >> 8) << rShift) | (((g + (g >> 8)) >> 8) << gShift) | (((b + (b >> 8)) >> 8) << bShift));
+
+                if (format == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1) pixel |= (src[i*4 + 3] > PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD)? 1 : 0;
+                else if (format == PIXELFORMAT_UNCOMPRESSED_R4G4B4A4) pixel |= (unsigned short)((a + (a >> 8)) >> 8);
+
+                pixels[i] = pixel;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        {
+            unsigned char *pixels = (unsigned char *)dst;
+        #if defined(RTEXTURES_SIMD_NEON)
+            for (; i + 16 <= count; i += 16)
+            {
+                uint8x16x4_t color = vld4q_u8(src + i*4);
+                uint8x16x3_t pixel;
+                pixel.val[0] = color.val[0];
+                pixel.val[1] = color.val[1];
+                pixel.val[2] = color.val[2];
+                vst3q_u8(pixels + i*3, pixel);
+            }
+        #endif
+            for (; i < count; i++)
+            {
+                pixels[i*3] = src[i*4];
+                pixels[i*3 + 1] = src[i*4 + 1];
+                pixels[i*3 + 2] = src[i*4 + 2];
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: memcpy(dst, src, count*4); break;
+        default: break;
+    }
+}
+
+// Unpack pixels as Vector4 (float normalized), only 16 and 32 bit per channel formats
+static void UnpackPixelsNormalized(const void *src, int format, int count, Vector4 *dst)
+{
+    const float *data32 = (const float *)src;
+    const unsigned short *data16 = (const unsigned short *)src;
+
+    for (int i = 0; i < count; i++)
+    {
+        switch (format)
+        {
+            case PIXELFORMAT_UNCOMPRESSED_R32: dst[i] = (Vector4){ data32[i], 0.0f, 0.0f, 1.0f }; break;
+            case PIXELFORMAT_UNCOMPRESSED_R32G32B32: dst[i] = (Vector4){ data32[i*3], data32[i*3 + 1], data32[i*3 + 2], 1.0f }; break;
+            case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: dst[i] = (Vector4){ data32[i*4], data32[i*4 + 1], data32[i*4 + 2], data32[i*4 + 3] }; break;
+            case PIXELFORMAT_UNCOMPRESSED_R16: dst[i] = (Vector4){ HalfToFloat(data16[i]), 0.0f, 0.0f, 1.0f }; break;
+            case PIXELFORMAT_UNCOMPRESSED_R16G16B16: dst[i] = (Vector4){ HalfToFloat(data16[i*3]), HalfToFloat(data16[i*3 + 1]), HalfToFloat(data16[i*3 + 2]), 1.0f }; break;
+            case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: dst[i] = (Vector4){ HalfToFloat(data16[i*4]), HalfToFloat(data16[i*4 + 1]), HalfToFloat(data16[i*4 + 2]), HalfToFloat(data16[i*4 + 3]) }; break;
+            default: break;
+        }
+    }
+}
+
+// Pack Vector4 (float normalized) pixels, only 16 and 32 bit per channel formats
+// NOTE: Single channel formats are converted to grayscale equivalent
+static void PackPixelsNormalized(const Vector4 *src, int count, int format, void *dst)
+{
+    float *data32 = (float *)dst;
+    unsigned short *data16 = (unsigned short *)dst;
+
+    for (int i = 0; i < count; i++)
+    {
+        switch (format)
+        {
+            case PIXELFORMAT_UNCOMPRESSED_R32: data32[i] = src[i].x*0.299f + src[i].y*0.587f + src[i].z*0.114f; break;
+            case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+            {
+                data32[i*3] = src[i].x;
+                data32[i*3 + 1] = src[i].y;
+                data32[i*3 + 2] = src[i].z;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+            {
+                data32[i*4] = src[i].x;
+                data32[i*4 + 1] = src[i].y;
+                data32[i*4 + 2] = src[i].z;
+                data32[i*4 + 3] = src[i].w;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R16: data16[i] = FloatToHalf(src[i].x*0.299f + src[i].y*0.587f + src[i].z*0.114f); break;
+            case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+            {
+                data16[i*3] = FloatToHalf(src[i].x);
+                data16[i*3 + 1] = FloatToHalf(src[i].y);
+                data16[i*3 + 2] = FloatToHalf(src[i].z);
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+            {
+                data16[i*4] = FloatToHalf(src[i].x);
+                data16[i*4 + 1] = FloatToHalf(src[i].y);
+                data16[i*4 + 2] = FloatToHalf(src[i].z);
+                data16[i*4 + 3] = FloatToHalf(src[i].w);
+            } break;
+            default: break;
+        }
+    }
+}
+
+// Convert pixels between uncompressed formats
+// NOTE: Formats up to 8 bit per channel are converted with integer kernels, RGBA8 is used as intermediate format
+// and it's lossless for them, formats with 16 or 32 bit per channel are converted through float normalized values
+static void ConvertPixels(const void *src, int srcFormat, int count, void *dst, int dstFormat)
+{
+    const unsigned char *srcData = (const unsigned char *)src;
+    unsigned char *dstData = (unsigned char *)dst;
+    int srcPixelSize = GetPixelDataSize(1, 1, srcFormat);
+    int dstPixelSize = GetPixelDataSize(1, 1, dstFormat);
+
+    if ((srcFormat <= PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) && (dstFormat <= PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+    {
+        if (srcFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) PackPixelsRGBA8(srcData, count, dstFormat, dstData);
+        else if (dstFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) UnpackPixelsRGBA8(srcData, srcFormat, count, dstData);
+        else
+        {
+            unsigned char colors[PIXELFORMAT_CONVERSION_CHUNK_SIZE*4];
+
+            for (int i = 0; i < count; i += PIXELFORMAT_CONVERSION_CHUNK_SIZE)
+            {
+                int chunk = ((count - i) < PIXELFORMAT_CONVERSION_CHUNK_SIZE)? (count - i) : PIXELFORMAT_CONVERSION_CHUNK_SIZE;
+
+                UnpackPixelsRGBA8(srcData + i*srcPixelSize, srcFormat, chunk, colors);
+                PackPixelsRGBA8(colors, chunk, dstFormat, dstData + i*dstPixelSize);
+            }
+        }
+    }
+    else
+    {
+        unsigned char colors[PIXELFORMAT_CONVERSION_CHUNK_SIZE*4];
+        Vector4 pixels[PIXELFORMAT_CONVERSION_CHUNK_SIZE];
+
+        for (int i = 0; i < count; i += PIXELFORMAT_CONVERSION_CHUNK_SIZE)
+        {
+            int chunk = ((count - i) < PIXELFORMAT_CONVERSION_CHUNK_SIZE)? (count - i) : PIXELFORMAT_CONVERSION_CHUNK_SIZE;
+
+            if (srcFormat <= PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+            {
+                UnpackPixelsRGBA8(srcData + i*srcPixelSize, srcFormat, chunk, colors);
+
+                for (int k = 0; k < chunk*4; k++) ((float *)pixels)[k] = (float)colors[k]/255.0f;
+            }
+            else UnpackPixelsNormalized(srcData + i*srcPixelSize, srcFormat, chunk, pixels);
+
+            if (dstFormat <= PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+            {
+                // NOTE: Values out of [0..1] range are clamped
+                for (int k = 0; k < chunk*4; k++)
+                {
+                    float value = ((float *)pixels)[k];
+                    colors[k] = (value > 0.0f)? ((value < 1.0f)? (unsigned char)(value*255.0f + 0.5f) : 255) : 0;
+                }
+
+                PackPixelsRGBA8(colors, chunk, dstFormat, dstData + i*dstPixelSize);
+            }
+            else PackPixelsNormalized(pixels, chunk, dstFormat, dstData + i*dstPixelSize);
+        }
+    }
+}
+
+// Blend pixels over RGBA8 pixels, source is tinted and alpha blended like ColorAlphaBlend()
+// NOTE: Only 8 bit per channel source formats supported, results are exactly the same than ColorAlphaBlend(),
+// SIMD paths divide by output alpha as (numerator + 0.5f)*(1.0f/out.a), exact for numerators below 2^17
+static void BlendPixelsRGBA8(const void *src, int srcFormat, unsigned char *dst, int count, Color tint)
+{
+    unsigned char colors[PIXELFORMAT_CONVERSION_CHUNK_SIZE*4];
+    int srcPixelSize = GetPixelDataSize(1, 1, srcFormat);
+    bool tinted = (tint.r < 255) || (tint.g < 255) || (tint.b < 255) || (tint.a < 255);
+
+    for (int i = 0; i < count; i += PIXELFORMAT_CONVERSION_CHUNK_SIZE)
+    {
+        int chunk = ((count - i) < PIXELFORMAT_CONVERSION_CHUNK_SIZE)? (count - i) : PIXELFORMAT_CONVERSION_CHUNK_SIZE;
+        const unsigned char *srcColors = (const unsigned char *)src + i*srcPixelSize;
+        unsigned char *dstColors = dst + i*4;
+
+        // Source pixels are expanded to RGBA8 first, same values than GetPixelColor()
+        if (srcFormat != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+        {
+            UnpackPixelsRGBA8(srcColors, srcFormat, chunk, colors);
+            srcColors = colors;
+        }
+
+        int k = 0;
+
+    #if defined(RTEXTURES_SIMD_NEON)
+        const uint16_t tintValues[8] = { tint.r + 1, tint.g + 1, tint.b + 1, tint.a + 1, tint.r + 1, tint.g + 1, tint.b + 1, tint.a + 1 };
+        uint16x8_t tintFactor = vld1q_u16(tintValues);
+        uint32x4_t alphaMask = vdupq_n_u32(0xff000000);
+
+        for (; k + 4 <= chunk; k += 4)
+        {
+            uint8x16_t source = vld1q_u8(srcColors + k*4);
+            uint8x16_t target = vld1q_u8(dstColors + k*4);
+
+            // Tint: (src*(tint + 1)) >> 8
+            if (tinted)
+            {
+                uint16x8_t low = vshrq_n_u16(vmulq_u16(vmovl_u8(vget_low_u8(source)), tintFactor), 8);
+                uint16x8_t high = vshrq_n_u16(vmulq_u16(vmovl_u8(vget_high_u8(source)), tintFactor), 8);
+                source = vcombine_u8(vmovn_u16(low), vmovn_u16(high));
+            }
+
+            uint32x4_t sourceAlpha = vandq_u32(vreinterpretq_u32_u8(source), alphaMask);
+            uint32x4_t transparent = vceqq_u32(sourceAlpha, vdupq_n_u32(0));
+            uint32x4_t opaque = vceqq_u32(sourceAlpha, alphaMask);
+            uint32x4_t resolved = vorrq_u32(transparent, opaque);
+            uint32x2_t resolvedPairs = vand_u32(vget_low_u32(resolved), vget_high_u32(resolved));
+
+            // Transparent source pixels keep destination, opaque ones replace it, others are blended
+            uint32x4_t pixels = vbslq_u32(opaque, vreinterpretq_u32_u8(source), vreinterpretq_u32_u8(target));
+
+            if ((vget_lane_u32(resolvedPairs, 0) & vget_lane_u32(resolvedPairs, 1)) != 0xffffffff)
+            {
+                uint16x8_t sourceHalf[2] = { vmovl_u8(vget_low_u8(source)), vmovl_u8(vget_high_u8(source)) };
+                uint16x8_t targetHalf[2] = { vmovl_u8(vget_low_u8(target)), vmovl_u8(vget_high_u8(target)) };
+                uint32x4_t result[4];
+
+                for (int h = 0; h < 2; h++)
+                {
+                    // Alpha values broadcast to every channel of their pixel
+                    uint16x8_t alpha = vaddq_u16(vcombine_u16(vdup_lane_u16(vget_low_u16(sourceHalf[h]), 3), vdup_lane_u16(vget_high_u16(sourceHalf[h]), 3)), vdupq_n_u16(1));
+                    uint16x8_t inverse = vsubq_u16(vdupq_n_u16(256), alpha);
+                    uint16x8_t targetAlpha = vcombine_u16(vdup_lane_u16(vget_low_u16(targetHalf[h]), 3), vdup_lane_u16(vget_high_u16(targetHalf[h]), 3));
+
+                    // out.a = (alpha*256 + dst.a*(256 - alpha)) >> 8 = alpha + ((dst.a*(256 - alpha)) >> 8)
+                    uint16x8_t outAlpha = vaddq_u16(alpha, vcombine_u16(vshrn_n_u32(vmull_u16(vget_low_u16(targetAlpha), vget_low_u16(inverse)), 8),
+                                                                        vshrn_n_u32(vmull_u16(vget_high_u16(targetAlpha), vget_high_u16(inverse)), 8)));
+
+                    // (src*alpha*256 + dst*dst.a*(256 - alpha)) >> 8 = src*alpha + ((dst*dst.a*(256 - alpha)) >> 8)
+                    uint16x8_t weighted = vmulq_u16(targetHalf[h], targetAlpha);
+                    uint16x8_t contribution = vcombine_u16(vshrn_n_u32(vmull_u16(vget_low_u16(weighted), vget_low_u16(inverse)), 8),
+                                                           vshrn_n_u32(vmull_u16(vget_high_u16(weighted), vget_high_u16(inverse)), 8));
+
+                    for (int p = 0; p < 2; p++)
+                    {
+                        uint16x4_t sourcePixel = (p == 0)? vget_low_u16(sourceHalf[h]) : vget_high_u16(sourceHalf[h]);
+                        uint16x4_t alphaPixel = (p == 0)? vget_low_u16(alpha) : vget_high_u16(alpha);
+                        uint16x4_t contributionPixel = (p == 0)? vget_low_u16(contribution) : vget_high_u16(contribution);
+                        unsigned int outAlphaPixel = (p == 0)? vgetq_lane_u16(outAlpha, 3) : vgetq_lane_u16(outAlpha, 7);
+
+                        uint32x4_t numerator = vaddw_u16(vmull_u16(sourcePixel, alphaPixel), contributionPixel);
+                        float32x4_t quotient = vmulq_n_f32(vaddq_f32(vcvtq_f32_u32(numerator), vdupq_n_f32(0.5f)), 1.0f/(float)outAlphaPixel);
+
+                        // NOTE: Color channels are truncated to 8 bit like in ColorAlphaBlend()
+                        result[h*2 + p] = vsetq_lane_u32(outAlphaPixel, vandq_u32(vcvtq_u32_f32(quotient), vdupq_n_u32(0xff)), 3);
+                    }
+                }
+
+                uint8x16_t blended = vcombine_u8(vmovn_u16(vcombine_u16(vmovn_u32(result[0]), vmovn_u32(result[1]))),
+                                                 vmovn_u16(vcombine_u16(vmovn_u32(result[2]), vmovn_u32(result[3]))));
+                pixels = vbslq_u32(resolved, pixels, vreinterpretq_u32_u8(blended));
+            }
+
+            vst1q_u8(dstColors + k*4, vreinterpretq_u8_u32(pixels));
+        }
+    #elif defined(RTEXTURES_SIMD_SSE2)
+        __m128i tintFactor = _mm_setr_epi16(tint.r + 1, tint.g + 1, tint.b + 1, tint.a + 1, tint.r + 1, tint.g + 1, tint.b + 1, tint.a + 1);
+        __m128i alphaMask = _mm_set1_epi32((int)0xff000000);
+        __m128i zero = _mm_setzero_si128();
+
+        for (; k + 4 <= chunk; k += 4)
+        {
+            __m128i source = _mm_loadu_si128((const __m128i *)(srcColors + k*4));
+            __m128i target = _mm_loadu_si128((const __m128i *)(dstColors + k*4));
+
+            // Tint: (src*(tint + 1)) >> 8
+            if (tinted)
+            {
+                __m128i low = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(source, zero), tintFactor), 8);
+                __m128i high = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(source, zero), tintFactor), 8);
+                source = _mm_packus_epi16(low, high);
+            }
+
+            __m128i sourceAlpha = _mm_and_si128(source, alphaMask);
+            __m128i transparent = _mm_cmpeq_epi32(sourceAlpha, zero);
+            __m128i opaque = _mm_cmpeq_epi32(sourceAlpha, alphaMask);
+            __m128i resolved = _mm_or_si128(transparent, opaque);
+
+            // Transparent source pixels keep destination, opaque ones replace it, others are blended
+            __m128i pixels = _mm_or_si128(_mm_and_si128(opaque, source), _mm_andnot_si128(opaque, target));
+
+            if (_mm_movemask_epi8(resolved) != 0xffff)
+            {
+                __m128i sourceHalf[2] = { _mm_unpacklo_epi8(source, zero), _mm_unpackhi_epi8(source, zero) };
+                __m128i targetHalf[2] = { _mm_unpacklo_epi8(target, zero), _mm_unpackhi_epi8(target, zero) };
+                __m128i result[4];
+
+                for (int h = 0; h < 2; h++)
+                {
+                    // Alpha values broadcast to every channel of their pixel
+                    __m128i alpha = _mm_add_epi16(_mm_shufflehi_epi16(_mm_shufflelo_epi16(sourceHalf[h], _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3)), _mm_set1_epi16(1));
+                    __m128i inverse = _mm_sub_epi16(_mm_set1_epi16(256), alpha);
+                    __m128i targetAlpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(targetHalf[h], _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+
+                    // NOTE: 32 bit products shifted by 8 are composed from 16 bit high and low halves
+                    // out.a = (alpha*256 + dst.a*(256 - alpha)) >> 8 = alpha + ((dst.a*(256 - alpha)) >> 8)
+                    __m128i outAlpha = _mm_add_epi16(alpha, _mm_or_si128(_mm_slli_epi16(_mm_mulhi_epu16(targetAlpha, inverse), 8), _mm_srli_epi16(_mm_mullo_epi16(targetAlpha, inverse), 8)));
+
+                    // (src*alpha*256 + dst*dst.a*(256 - alpha)) >> 8 = src*alpha + ((dst*dst.a*(256 - alpha)) >> 8)
+                    __m128i weighted = _mm_mullo_epi16(targetHalf[h], targetAlpha);
+                    __m128i contribution = _mm_or_si128(_mm_slli_epi16(_mm_mulhi_epu16(weighted, inverse), 8), _mm_srli_epi16(_mm_mullo_epi16(weighted, inverse), 8));
+                    __m128i product = _mm_mullo_epi16(sourceHalf[h], alpha);
+
+                    for (int p = 0; p < 2; p++)
+                    {
+                        __m128i numerator = (p == 0)? _mm_add_epi32(_mm_unpacklo_epi16(product, zero), _mm_unpacklo_epi16(contribution, zero)) :
+                                                      _mm_add_epi32(_mm_unpackhi_epi16(product, zero), _mm_unpackhi_epi16(contribution, zero));
+                        int outAlphaPixel = (p == 0)? _mm_extract_epi16(outAlpha, 3) : _mm_extract_epi16(outAlpha, 7);
+
+                        __m128 quotient = _mm_mul_ps(_mm_add_ps(_mm_cvtepi32_ps(numerator), _mm_set1_ps(0.5f)), _mm_set1_ps(1.0f/(float)outAlphaPixel));
+
+                        // NOTE: Color channels are truncated to 8 bit like in ColorAlphaBlend()
+                        result[h*2 + p] = _mm_insert_epi16(_mm_and_si128(_mm_cvttps_epi32(quotient), _mm_set1_epi32(0xff)), outAlphaPixel, 6);
+                    }
+                }
+
+                __m128i blended = _mm_packus_epi16(_mm_packs_epi32(result[0], result[1]), _mm_packs_epi32(result[2], result[3]));
+                pixels = _mm_or_si128(_mm_and_si128(resolved, pixels), _mm_andnot_si128(resolved, blended));
+            }
+
+            _mm_storeu_si128((__m128i *)(dstColors + k*4), pixels);
+        }
+    #endif
+        for (; k < chunk; k++)
+        {
+            Color source = { srcColors[k*4], srcColors[k*4 + 1], srcColors[k*4 + 2], srcColors[k*4 + 3] };
+            Color target = { dstColors[k*4], dstColors[k*4 + 1], dstColors[k*4 + 2], dstColors[k*4 + 3] };
+            Color blend = ColorAlphaBlend(target, source, tint);
+
+            dstColors[k*4] = blend.r;
+            dstColors[k*4 + 1] = blend.g;
+            dstColors[k*4 + 2] = blend.b;
+            dstColors[k*4 + 3] = blend.a;
+        }
+    }
+}
+
+#if defined(SUPPORT_IMAGE_THREADS)
+// Image threads pool worker, processes its rows range of every job
+static void *ImageThreadMain(void *arg)
+{
+    int index = (int)(size_t)arg;
+    unsigned int jobId = 0;
+
+    pthread_mutex_lock(&imageThreads.lock);
+
+    while (true)
+    {
+        while (imageThreads.jobId == jobId) pthread_cond_wait(&imageThreads.jobReady, &imageThreads.lock);
+        jobId = imageThreads.jobId;
+
+        if (index < imageThreads.ranges)
+        {
+            ImageRowsCallback callback = imageThreads.callback;
+            void *data = imageThreads.data;
+            int rowStart = imageThreads.rows*index/imageThreads.ranges;
+            int rowEnd = imageThreads.rows*(index + 1)/imageThreads.ranges;
+
+            pthread_mutex_unlock(&imageThreads.lock);
+            callback(data, rowStart, rowEnd);
+            pthread_mutex_lock(&imageThreads.lock);
+
+            imageThreads.pending--;
+            if (imageThreads.pending == 0) pthread_cond_signal(&imageThreads.jobDone);
+        }
+    }
+
+    return NULL;
+}
+
+// Get number of big cores, online cores when all cores have the same maximum frequency
+// NOTE: Big cores are the ones with a maximum frequency over the slowest cores, on big.LITTLE devices
+// the little cores would finish their rows range last and set the processing time
+static int GetBigCoreCount(void)
+{
+    int coreCount = (int)sysconf(_SC_NPROCESSORS_CONF);
+    long frequencies[64] = { 0 };
+    long minFrequency = 0;
+    long maxFrequency = 0;
+
+    if (coreCount > 64) coreCount = 64;
+
+    for (int i = 0; i < coreCount; i++)
+    {
+        char path[64] = { 0 };
+        snprintf(path, 64, "/sys/devices/system/cpu/cpu%i/cpufreq/cpuinfo_max_freq", i);
+
+        FILE *file = fopen(path, "rt");
+
+        if (file != NULL)
+        {
+            if (fscanf(file, "%li", &frequencies[i]) != 1) frequencies[i] = 0;
+            fclose(file);
+        }
+
+        if ((i == 0) || (frequencies[i] < minFrequency)) minFrequency = frequencies[i];
+        if (frequencies[i] > maxFrequency) maxFrequency = frequencies[i];
+    }
+
+    int bigCoreCount = 0;
+
+    if ((minFrequency > 0) && (minFrequency < maxFrequency))
+    {
+        for (int i = 0; i < coreCount; i++) if (frequencies[i] > minFrequency) bigCoreCount++;
+    }
+    else bigCoreCount = (int)sysconf(_SC_NPROCESSORS_ONLN);    // Same frequency for all cores or frequency not available
+
+    if (bigCoreCount > (int)sysconf(_SC_NPROCESSORS_ONLN)) bigCoreCount = (int)sysconf(_SC_NPROCESSORS_ONLN);
+
+    return bigCoreCount;
+}
+
+// Init image threads pool, IMAGE_THREADS_COUNT threads or one per big core (calling thread included)
+static void InitImageThreads(void)
+{
+    int threadCount = (IMAGE_THREADS_COUNT > 0)? IMAGE_THREADS_COUNT : GetBigCoreCount();
+
+    if (threadCount > IMAGE_THREADS_MAX) threadCount = IMAGE_THREADS_MAX;
+
+    // Workers wait for jobs until the program ends, calling thread processes the first rows range
+    imageThreads.threadCount = 1;
+
+    for (int i = 1; i < threadCount; i++)
+    {
+        pthread_t thread;
+
+        if (pthread_create(&thread, NULL, ImageThreadMain, (void *)(size_t)i) != 0) break;
+
+        pthread_detach(thread);
+        imageThreads.threadCount++;
+    }
+
+    TRACELOG(LOG_INFO, "IMAGE: Processing threads initialized successfully (%i threads)", imageThreads.threadCount);
+}
+#endif
+
+// Queue decoded request for upload, cancelled requests are freed (called under loader lock)
+static void CompleteTextureRequest(TextureRequest *request, Image image)
+{
+    if (request->cancelled)
+    {
+        UnloadImage(image);
+        RL_FREE(request->fileName);
+        RL_FREE(request);
+        return;
+    }
+
+    request->image = image;
+
+    if (textureLoader.uploadTail != NULL) textureLoader.uploadTail->next = request;
+    else textureLoader.uploadHead = request;
+    textureLoader.uploadTail = request;
+}
+
+#if defined(SUPPORT_IMAGE_THREADS)
+// Init texture loader threads (called under loader lock)
+// NOTE: If no thread can be created, requests are decoded on calling thread
+static void InitTextureLoader(void)
+{
+    textureLoader.threadCount = 0;
+
+    for (int i = 0; i < TEXTURE_LOADER_THREADS; i++)
+    {
+        if (pthread_create(&textureLoader.threads[textureLoader.threadCount], NULL, TextureLoaderThread, NULL) == 0) textureLoader.threadCount++;
+        else TRACELOG(LOG_WARNING, "TEXTURE: Failed to create texture loader thread");
+    }
+
+    textureLoader.ready = true;
+}
+
+// Texture loader thread, reads and decodes queued requests until loader is closed
+static void *TextureLoaderThread(void *arg)
+{
+    (void)arg;
+
+    pthread_mutex_lock(&textureLoader.lock);
+
+    while (true)
+    {
+        while ((textureLoader.decodeHead == NULL) && !textureLoader.quit) pthread_cond_wait(&textureLoader.requestReady, &textureLoader.lock);
+
+        if (textureLoader.quit) break;
+
+        TextureRequest *request = textureLoader.decodeHead;
+        textureLoader.decodeHead = request->next;
+        if (textureLoader.decodeHead == NULL) textureLoader.decodeTail = NULL;
+        request->next = NULL;
+
+        bool cancelled = request->cancelled;
+        pthread_mutex_unlock(&textureLoader.lock);
+
+        Image image = { 0 };
+        if (!cancelled) image = LoadImage(request->fileName);
+
+        pthread_mutex_lock(&textureLoader.lock);
+        CompleteTextureRequest(request, image);
+    }
+
+    pthread_mutex_unlock(&textureLoader.lock);
+
+    return NULL;
+}
+#endif
+
+// Get atlas image slot index from handle, -1 if handle is not valid
+static int GetAtlasImageIndex(TextureAtlas *atlas, int handle)
+{
+    if ((atlas == NULL) || (handle < 0)) return -1;
+
+    int index = handle & 0xffff;
+    unsigned int generation = ((unsigned int)handle >> 16) & 0x7fff;
+
+    if ((index >= atlas->imageCapacity) || (atlas->images[index].page == -1) || ((atlas->images[index].generation & 0x7fff) != generation)) return -1;
+
+    return index;
+}
+
+// Pack rectangle into atlas page skyline
+static bool PackAtlasImage(TextureAtlas *atlas, int page, int width, int height, int *x, int *y)
+{
+    AtlasPage *atlasPage = &atlas->pages[page];
+    stbrp_rect rect = { 0, width, height, 0, 0, 0 };
+
+    stbrp_pack_rects(&atlasPage->context, &rect, 1);
+
+    if (rect.was_packed)
+    {
+        *x = rect.x;
+        *y = rect.y;
+        atlasPage->packedArea += width*height;
+    }
+
+    return (rect.was_packed != 0);
+}
+
+// Repack atlas page images, reclaiming space of removed images
+// NOTE: All images are packed together (sorted by height), images not fitting anymore are evicted
+static void RepackAtlasPage(TextureAtlas *atlas, int page)
+{
+    AtlasPage *atlasPage = &atlas->pages[page];
+    int padding = atlas->padding;
+    int pageRowSize = atlas->pageWidth*4;
+
+    rlDrawRenderBatchActive();      // Pending draws could be using page texture
+
+    stbrp_rect *rects = (stbrp_rect *)RL_MALLOC((atlasPage->imageCount + 1)*sizeof(stbrp_rect));
+    int count = 0;
+
+    for (int i = 0; i < atlas->imageCapacity; i++)
+    {
+        AtlasImage *atlasImage = &atlas->images[i];
+        if (atlasImage->page == page) rects[count++] = (stbrp_rect){ i, atlasImage->width + 2*padding, atlasImage->height + 2*padding, 0, 0, 0 };
+    }
+
+    stbrp_init_target(&atlasPage->context, atlas->pageWidth, atlas->pageHeight, atlasPage->nodes, atlas->pageWidth);
+    stbrp_setup_heuristic(&atlasPage->context, STBRP_HEURISTIC_Skyline_BF_sortHeight);
+    stbrp_pack_rects(&atlasPage->context, rects, count);
+
+    unsigned char *pixels = (unsigned char *)RL_CALLOC(atlas->pageWidth*atlas->pageHeight*4, 1);
+    atlasPage->packedArea = 0;
+    atlasPage->usedArea = 0;
+    atlasPage->imageCount = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        AtlasImage *atlasImage = &atlas->images[rects[i].id];
+
+        if (rects[i].was_packed)
+        {
+            for (int j = 0; j < rects[i].h; j++)
+            {
+                memcpy(pixels + (rects[i].y + j)*pageRowSize + rects[i].x*4, atlasPage->pixels + (atlasImage->y + j)*pageRowSize + atlasImage->x*4, rects[i].w*4);
+            }
+
+            atlasImage->x = rects[i].x;
+            atlasImage->y = rects[i].y;
+
+            atlasPage->packedArea += rects[i].w*rects[i].h;
+            atlasPage->usedArea += rects[i].w*rects[i].h;
+            atlasPage->imageCount++;
+        }
+        else
+        {
+            atlasImage->page = -1;
+            atlasImage->generation++;
+            TRACELOG(LOG_WARNING, "TEXTURE: Atlas image (%ix%i) evicted, it does not fit in repacked page", atlasImage->width, atlasImage->height);
+        }
+    }
+
+    RL_FREE(rects);
+    RL_FREE(atlasPage->pixels);
+    atlasPage->pixels = pixels;
+
+    UpdateTexture(atlasPage->texture, atlasPage->pixels);
+}
+
+// Remove image from atlas page, page skyline reset when empty
+static void RemoveAtlasImage(TextureAtlas *atlas, int index)
+{
+    AtlasImage *atlasImage = &atlas->images[index];
+    AtlasPage *atlasPage = &atlas->pages[atlasImage->page];
+
+    atlasPage->usedArea -= (atlasImage->width + 2*atlas->padding)*(atlasImage->height + 2*atlas->padding);
+    atlasPage->imageCount--;
+
+    atlasImage->page = -1;
+    atlasImage->generation++;
+
+    if (atlasPage->imageCount == 0)
+    {
+        // Page space is reused from now, pending draws could still be using it
+        rlDrawRenderBatchActive();
+
+        stbrp_init_target(&atlasPage->context, atlas->pageWidth, atlas->pageHeight, atlasPage->nodes, atlas->pageWidth);
+        stbrp_setup_heuristic(&atlasPage->context, STBRP_HEURISTIC_Skyline_BF_sortHeight);
+        atlasPage->packedArea = 0;
+    }
+}
+
+// Get number of threads used for image processing, calling thread included
+static int GetImageThreadCount(void)
+{
+#if defined(SUPPORT_IMAGE_THREADS)
+    pthread_once(&imageThreadsOnce, InitImageThreads);
+
+    return imageThreads.threadCount;
+#else
+    return 1;
+#endif
+}
+
+// Process image rows, split in one contiguous rows range per thread
+// NOTE: Rows are processed independently, results do not depend on the number of threads,
+// jobs overlapping a running one (i.e. submitted from other threads) are processed on calling thread
+static void ProcessImageRows(ImageRowsCallback callback, void *data, int rows, int rowSize)
+{
+#if defined(SUPPORT_IMAGE_THREADS)
+    if ((rows > 1) && ((long long)rows*rowSize >= IMAGE_THREADS_MIN_PIXELS) && (GetImageThreadCount() > 1) &&
+        (pthread_mutex_trylock(&imageThreads.dispatch) == 0))
+    {
+        int ranges = (imageThreads.threadCount < rows)? imageThreads.threadCount : rows;
+
+        pthread_mutex_lock(&imageThreads.lock);
+        imageThreads.callback = callback;
+        imageThreads.data = data;
+        imageThreads.rows = rows;
+        imageThreads.ranges = ranges;
+        imageThreads.pending = ranges - 1;
+        imageThreads.jobId++;
+        pthread_cond_broadcast(&imageThreads.jobReady);
+        pthread_mutex_unlock(&imageThreads.lock);
+
+        callback(data, 0, rows/ranges);
+
+        pthread_mutex_lock(&imageThreads.lock);
+        while (imageThreads.pending > 0) pthread_cond_wait(&imageThreads.jobDone, &imageThreads.lock);
+        pthread_mutex_unlock(&imageThreads.lock);
+
+        pthread_mutex_unlock(&imageThreads.dispatch);
+
+        return;
+    }
+#endif
+
+    callback(data, 0, rows);
+}
+
+// Resize output pixels splits, data is a STBIR_RESIZE with samplers built for the splits
+static void ResizeSplits(void *data, int splitStart, int splitEnd)
+{
+    stbir_resize_extended_split((STBIR_RESIZE *)data, splitStart, splitEnd - splitStart);
+}
+
+// Resize 8 bit per channel pixels, output is split by rows between threads
+// NOTE: stb_image_resize2 splits compute exactly the same pixels than a single pass
+static void ResizePixels(const unsigned char *input, int width, int height, unsigned char *output, int newWidth, int newHeight, int channels)
+{
+    STBIR_RESIZE resize = { 0 };
+    stbir_resize_init(&resize, input, width, height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)channels, STBIR_TYPE_UINT8);
+
+    int splits = ((newWidth*newHeight) >= IMAGE_THREADS_MIN_PIXELS)? GetImageThreadCount() : 1;
+    splits = stbir_build_samplers_with_splits(&resize, splits);
+
+    if (splits > 0) ProcessImageRows(ResizeSplits, &resize, splits, newWidth*newHeight/splits);
+
+    stbir_free_samplers(&resize);
+}
+
+// Box blur columns, vertical pass
+// NOTE: Columns are blurred in strips of GAUSSIAN_BLUR_TILE_COLUMNS reading and writing whole row segments,
+// window sums are kept per channel and normalized in 8.24 fixed point: (sum*round(2^24/size) + 2^23) >> 24
+static void BlurBoxColumns(void *data, int columnStart, int columnEnd)
+{
+    static const unsigned char zeros[GAUSSIAN_BLUR_TILE_COLUMNS*4] = { 0 };
+
+    BlurPass *pass = (BlurPass *)data;
+    int width = pass->width;
+    int height = pass->height;
+    int radius = pass->radius;
+
+    for (int tileStart = columnStart; tileStart < columnEnd; tileStart += GAUSSIAN_BLUR_TILE_COLUMNS)
+    {
+        int channels = (((columnEnd - tileStart) < GAUSSIAN_BLUR_TILE_COLUMNS)? (columnEnd - tileStart) : GAUSSIAN_BLUR_TILE_COLUMNS)*4;
+        unsigned int sums[GAUSSIAN_BLUR_TILE_COLUMNS*4] = { 0 };
+
+        // Initial window: [0, radius]
+        for (int y = 0; (y <= radius) && (y < height); y++)
+        {
+            const unsigned char *row = pass->src + (y*width + tileStart)*4;
+            for (int k = 0; k < channels; k++) sums[k] += row[k];
+        }
+
+        for (int y = 0; y < height; y++)
+        {
+            // Window [y - radius, y + radius] clipped by image borders
+            int first = ((y - radius) > 0)? (y - radius) : 0;
+            int last = ((y + radius) < (height - 1))? (y + radius) : (height - 1);
+            unsigned int inverse = pass->inverse[last - first + 1];
+            const unsigned char *add = ((y + radius + 1) < height)? pass->src + ((y + radius + 1)*width + tileStart)*4 : zeros;
+            const unsigned char *remove = ((y - radius) >= 0)? pass->src + ((y - radius)*width + tileStart)*4 : zeros;
+            unsigned char *colors = pass->dst + (y*width + tileStart)*4;
+            int k = 0;
+
+        #if defined(RTEXTURES_SIMD_NEON)
+            for (; k + 16 <= channels; k += 16)
+            {
+                uint8x16_t addColors = vld1q_u8(add + k);
+                uint8x16_t removeColors = vld1q_u8(remove + k);
+                uint16x8_t addHalf[2] = { vmovl_u8(vget_low_u8(addColors)), vmovl_u8(vget_high_u8(addColors)) };
+                uint16x8_t removeHalf[2] = { vmovl_u8(vget_low_u8(removeColors)), vmovl_u8(vget_high_u8(removeColors)) };
+                uint16x4_t value[4];
+
+                for (int i = 0; i < 4; i++)
+                {
+                    uint32x4_t sum = vld1q_u32(sums + k + i*4);
+                    value[i] = vmovn_u32(vshrq_n_u32(vmlaq_n_u32(vdupq_n_u32(1 << 23), sum, inverse), 24));
+
+                    sum = vaddw_u16(sum, (i%2 == 0)? vget_low_u16(addHalf[i/2]) : vget_high_u16(addHalf[i/2]));
+                    sum = vsubw_u16(sum, (i%2 == 0)? vget_low_u16(removeHalf[i/2]) : vget_high_u16(removeHalf[i/2]));
+                    vst1q_u32(sums + k + i*4, sum);
+                }
+
+                vst1q_u8(colors + k, vcombine_u8(vmovn_u16(vcombine_u16(value[0], value[1])), vmovn_u16(vcombine_u16(value[2], value[3]))));
+            }
+        #elif defined(RTEXTURES_SIMD_SSE2)
+            __m128i factor = _mm_set1_epi32((int)inverse);
+            __m128i rounding = _mm_set1_epi64x(1 << 23);
+            __m128i zero = _mm_setzero_si128();
+
+            for (; k + 16 <= channels; k += 16)
+            {
+                __m128i addColors = _mm_loadu_si128((const __m128i *)(add + k));
+                __m128i removeColors = _mm_loadu_si128((const __m128i *)(remove + k));
+                __m128i addHalf[2] = { _mm_unpacklo_epi8(addColors, zero), _mm_unpackhi_epi8(addColors, zero) };
+                __m128i removeHalf[2] = { _mm_unpacklo_epi8(removeColors, zero), _mm_unpackhi_epi8(removeColors, zero) };
+                __m128i value[4];
+
+                for (int i = 0; i < 4; i++)
+                {
+                    __m128i sum = _mm_loadu_si128((const __m128i *)(sums + k + i*4));
+
+                    // NOTE: SSE2 has no 32 bit multiply, even and odd channels are multiplied as 64 bit products
+                    __m128i even = _mm_srli_epi64(_mm_add_epi64(_mm_mul_epu32(sum, factor), rounding), 24);
+                    __m128i odd = _mm_srli_epi64(_mm_add_epi64(_mm_mul_epu32(_mm_srli_epi64(sum, 32), factor), rounding), 24);
+                    value[i] = _mm_or_si128(even, _mm_slli_epi64(odd, 32));
+
+                    __m128i addQuarter = (i%2 == 0)? _mm_unpacklo_epi16(addHalf[i/2], zero) : _mm_unpackhi_epi16(addHalf[i/2], zero);
+                    __m128i removeQuarter = (i%2 == 0)? _mm_unpacklo_epi16(removeHalf[i/2], zero) : _mm_unpackhi_epi16(removeHalf[i/2], zero);
+                    sum = _mm_sub_epi32(_mm_add_epi32(sum, addQuarter), removeQuarter);
+                    _mm_storeu_si128((__m128i *)(sums + k + i*4), sum);
+                }
+
+                _mm_storeu_si128((__m128i *)(colors + k), _mm_packus_epi16(_mm_packs_epi32(value[0], value[1]), _mm_packs_epi32(value[2], value[3])));
+            }
+        #endif
+            for (; k < channels; k++)
+            {
+                colors[k] = (unsigned char)((sums[k]*inverse + (1 << 23)) >> 24);
+                sums[k] += add[k];
+                sums[k] -= remove[k];
+            }
+        }
+    }
+}
+
+// Transpose RGBA8 rows, source rows are written as destination columns
+// NOTE: Pixels are moved in 8x8 blocks to keep source and destination cache lines in use
+static void TransposeRows(void *data, int rowStart, int rowEnd)
+{
+    BlurPass *pass = (BlurPass *)data;
+    const unsigned int *src = (const unsigned int *)pass->src;
+    unsigned int *dst = (unsigned int *)pass->dst;
+    int width = pass->width;
+    int height = pass->height;
+
+    for (int blockY = rowStart; blockY < rowEnd; blockY += 8)
+    {
+        int blockEndY = ((blockY + 8) < rowEnd)? (blockY + 8) : rowEnd;
+
+        for (int blockX = 0; blockX < width; blockX += 8)
+        {
+            int blockEndX = ((blockX + 8) < width)? (blockX + 8) : width;
+
+            for (int x = blockX; x < blockEndX; x++)
+            {
+                for (int y = blockY; y < blockEndY; y++) dst[x*height + y] = src[y*width + x];
+            }
+        }
+    }
+}
+
+// Premultiply alpha of RGBA8 rows, rounding to nearest: round(color*alpha/255)
+static void AlphaPremultiplyRows(void *data, int rowStart, int rowEnd)
+{
+    BlurPass *pass = (BlurPass *)data;
+    unsigned char *pixels = pass->dst + rowStart*pass->width*4;
+
+    for (int i = 0; i < (rowEnd - rowStart)*pass->width; i++, pixels += 4)
+    {
+        unsigned int alpha = pixels[3];
+
+        for (int c = 0; c < 3; c++)
+        {
+            unsigned int value = pixels[c]*alpha + 128;
+            pixels[c] = (unsigned char)((value + (value >> 8)) >> 8);
+        }
+    }
+}
+
+// Reverse alpha premultiply of RGBA8 rows: color*255/alpha, computed in 16.16 fixed point
+static void AlphaUnpremultiplyRows(void *data, int rowStart, int rowEnd)
+{
+    BlurPass *pass = (BlurPass *)data;
+    unsigned char *pixels = pass->dst + rowStart*pass->width*4;
+    unsigned int reciprocals[256] = { 0 };
+
+    for (int i = 1; i < 256; i++) reciprocals[i] = (255u*65536u + i/2)/i;
+
+    for (int i = 0; i < (rowEnd - rowStart)*pass->width; i++, pixels += 4)
+    {
+        unsigned int alpha = pixels[3];
+
+        if (alpha == 0)
+        {
+            pixels[0] = 0;
+            pixels[1] = 0;
+            pixels[2] = 0;
+        }
+        else if (alpha < 255)
+        {
+            for (int c = 0; c < 3; c++)
+            {
+                unsigned int value = (pixels[c]*reciprocals[alpha] + (1 << 15)) >> 16;
+                pixels[c] = (value > 255)? 255 : (unsigned char)value;
+            }
+        }
+    }
+}
+
+#if defined(SUPPORT_IMAGE_GENERATION)
+// Generate linear gradient rows
+static void GenGradientLinearRows(void *data, int rowStart, int rowEnd)
+{
+    GeneratorPass *pass = (GeneratorPass *)data;
+    Color *pixels = pass->pixels;
+    int width = pass->width;
+    int height = pass->height;
+    float cosDir = pass->cosDir;
+    float sinDir = pass->sinDir;
+    Color start = pass->colors[0];
+    Color end = pass->colors[1];
+
+    for (int j = rowStart; j < rowEnd; j++)
+    {
+        for (int i = 0; i < width; i++)
+        {
+            // Calculate the relative position of the pixel along the gradient direction
+            float pos = (i*cosDir + j*sinDir)/(width*cosDir + height*sinDir);
+
+            float factor = pos;
+            factor = (factor > 1.0f)? 1.0f : factor;  // Clamp to [0,1]
+            factor = (factor < 0.0f)? 0.0f : factor;  // Clamp to [0,1]
+
+            // Generate the color for this pixel
+            pixels[j*width + i].r = (int)((float)end.r*factor + (float)start.r*(1.0f - factor));
+            pixels[j*width + i].g = (int)((float)end.g*factor + (float)start.g*(1.0f - factor));
+            pixels[j*width + i].b = (int)((float)end.b*factor + (float)start.b*(1.0f - factor));
+            pixels[j*width + i].a = (int)((float)end.a*factor + (float)start.a*(1.0f - factor));
+        }
+    }
+}
+
+// Generate radial gradient rows
+static void GenGradientRadialRows(void *data, int rowStart, int rowEnd)
+{
+    GeneratorPass *pass = (GeneratorPass *)data;
+    Color *pixels = pass->pixels;
+    int width = pass->width;
+    int height = pass->height;
+    float density = pass->density;
+    Color inner = pass->colors[0];
+    Color outer = pass->colors[1];
+
+    float radius = (width < height)? (float)width/2.0f : (float)height/2.0f;
+
+    float centerX = (float)width/2.0f;
+    float centerY = (float)height/2.0f;
+
+    for (int y = rowStart; y < rowEnd; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            float dist = hypotf((float)x - centerX, (float)y - centerY);
+            float factor = (dist - radius*density)/(radius*(1.0f - density));
+
+            factor = (float)fmax(factor, 0.0f);
+            factor = (float)fmin(factor, 1.f); // dist can be bigger than radius, so we have to check
+
+            pixels[y*width + x].r = (int)((float)outer.r*factor + (float)inner.r*(1.0f - factor));
+            pixels[y*width + x].g = (int)((float)outer.g*factor + (float)inner.g*(1.0f - factor));
+            pixels[y*width + x].b = (int)((float)outer.b*factor + (float)inner.b*(1.0f - factor));
+            pixels[y*width + x].a = (int)((float)outer.a*factor + (float)inner.a*(1.0f - factor));
+        }
+    }
+}
+
+// Generate square gradient rows
+static void GenGradientSquareRows(void *data, int rowStart, int rowEnd)
+{
+    GeneratorPass *pass = (GeneratorPass *)data;
+    Color *pixels = pass->pixels;
+    int width = pass->width;
+    int height = pass->height;
+    float density = pass->density;
+    Color inner = pass->colors[0];
+    Color outer = pass->colors[1];
+
+    float centerX = (float)width/2.0f;
+    float centerY = (float)height/2.0f;
+
+    for (int y = rowStart; y < rowEnd; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            // Calculate the Manhattan distance from the center
+            float distX = fabsf(x - centerX);
+            float distY = fabsf(y - centerY);
+
+            // Normalize the distances by the dimensions of the gradient rectangle
+            float normalizedDistX = distX / centerX;
+            float normalizedDistY = distY / centerY;
+
+            // Calculate the total normalized Manhattan distance
+            float manhattanDist = fmaxf(normalizedDistX, normalizedDistY);
 
-                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
-                    pixels[i].y = (float)((pixel & 0b0000011111000000) >> 6)*(1.0f/31);
-                    pixels[i].z = (float)((pixel & 0b0000000000111110) >> 1)*(1.0f/31);
-                    pixels[i].w = ((pixel & 0b0000000000000001) == 0)? 0.0f : 1.0f;
+            // Subtract the density from the manhattanDist, then divide by (1 - density)
+            // This makes the gradient start from the center when density is 0, and from the edge when density is 1
+            float factor = (manhattanDist - density)/(1.0f - density);
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+            // Clamp the factor between 0 and 1
+            factor = fminf(fmaxf(factor, 0.0f), 1.0f);
 
-                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
-                    pixels[i].y = (float)((pixel & 0b0000011111100000) >> 5)*(1.0f/63);
-                    pixels[i].z = (float)(pixel & 0b0000000000011111)*(1.0f/31);
-                    pixels[i].w = 1.0f;
+            // Blend the colors based on the calculated factor
+            pixels[y*width + x].r = (int)((float)outer.r*factor + (float)inner.r*(1.0f - factor));
+            pixels[y*width + x].g = (int)((float)outer.g*factor + (float)inner.g*(1.0f - factor));
+            pixels[y*width + x].b = (int)((float)outer.b*factor + (float)inner.b*(1.0f - factor));
+            pixels[y*width + x].a = (int)((float)outer.a*factor + (float)inner.a*(1.0f - factor));
+        }
+    }
+}
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+// Generate checked rows
+static void GenCheckedRows(void *data, int rowStart, int rowEnd)
+{
+    GeneratorPass *pass = (GeneratorPass *)data;
+    Color *pixels = pass->pixels;
+    int width = pass->width;
 
-                    pixels[i].x = (float)((pixel & 0b1111000000000000) >> 12)*(1.0f/15);
-                    pixels[i].y = (float)((pixel & 0b0000111100000000) >> 8)*(1.0f/15);
-                    pixels[i].z = (float)((pixel & 0b0000000011110000) >> 4)*(1.0f/15);
-                    pixels[i].w = (float)(pixel & 0b0000000000001111)*(1.0f/15);
+    for (int y = rowStart; y < rowEnd; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            if ((x/pass->checksX + y/pass->checksY)%2 == 0) pixels[y*width + x] = pass->colors[0];
+            else pixels[y*width + x] = pass->colors[1];
+        }
+    }
+}
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
-                    pixels[i].w = (float)((unsigned char *)image.data)[k + 3]/255.0f;
+// Generate perlin noise rows
+static void GenPerlinNoiseRows(void *data, int rowStart, int rowEnd)
+{
+    GeneratorPass *pass = (GeneratorPass *)data;
+    Color *pixels = pass->pixels;
+    int width = pass->width;
+    int height = pass->height;
+    float scale = pass->scale;
 
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+    for (int y = rowStart; y < rowEnd; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            float nx = (float)(x + pass->offsetX)*(scale/(float)width);
+            float ny = (float)(y + pass->offsetY)*(scale/(float)height);
+
+            // Basic perlin noise implementation (not used)
+            //float p = (stb_perlin_noise3(nx, ny, 0.0f, 0, 0, 0);
+
+            // Calculate a better perlin noise using fbm (fractal brownian motion)
+            // Typical values to start playing with:
+            //   lacunarity = ~2.0   -- spacing between successive octaves (use exactly 2.0 for wrapping output)
+            //   gain       =  0.5   -- relative weighting applied to each successive octave
+            //   octaves    =  6     -- number of "octaves" of noise3() to sum
+            float p = stb_perlin_fbm_noise3(nx, ny, 1.0f, 2.0f, 0.5f, 6);
+
+            // Clamp between -1.0f and 1.0f
+            if (p < -1.0f) p = -1.0f;
+            if (p > 1.0f) p = 1.0f;
+
+            // We need to normalize the data from [-1..1] to [0..1]
+            float np = (p + 1.0f)/2.0f;
+
+            int intensity = (int)(np*255.0f);
+            pixels[y*width + x] = (Color){ intensity, intensity, intensity, 255 };
+        }
+    }
+}
+
+// Generate cellular rows, seeds are generated previously
+static void GenCellularRows(void *data, int rowStart, int rowEnd)
+{
+    GeneratorPass *pass = (GeneratorPass *)data;
+    Color *pixels = pass->pixels;
+    int width = pass->width;
+    int tileSize = pass->tileSize;
+    int seedsPerRow = pass->seedsPerRow;
+    int seedsPerCol = pass->seedsPerCol;
+    const Vector2 *seeds = pass->seeds;
+
+    for (int y = rowStart; y < rowEnd; y++)
+    {
+        int tileY = y/tileSize;
+
+        for (int x = 0; x < width; x++)
+        {
+            int tileX = x/tileSize;
+
+            float minDistance = 65536.0f; //(float)strtod("Inf", NULL);
+
+            // Check all adjacent tiles
+            for (int i = -1; i < 2; i++)
+            {
+                if ((tileX + i < 0) || (tileX + i >= seedsPerRow)) continue;
+
+                for (int j = -1; j < 2; j++)
                 {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
-                    pixels[i].w = 1.0f;
+                    if ((tileY + j < 0) || (tileY + j >= seedsPerCol)) continue;
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32:
+                    Vector2 neighborSeed = seeds[(tileY + j)*seedsPerRow + tileX + i];
+
+                    float dist = (float)hypot(x - (int)neighborSeed.x, y - (int)neighborSeed.y);
+                    minDistance = (float)fmin(minDistance, dist);
+                }
+            }
+
+            // I made this up, but it seems to give good results at all tile sizes
+            int intensity = (int)(minDistance*256.0f/tileSize);
+            if (intensity > 255) intensity = 255;
+
+            pixels[y*width + x] = (Color){ intensity, intensity, intensity, 255 };
+        }
+    }
+}
+#endif      // SUPPORT_IMAGE_GENERATION
+
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+// Dither RGBA8 rows to 16bpp or lower (Floyd-Steinberg dithering)
+// NOTE: Error is diffused to next row, so rows are interleaved between threads: row y is processed
+// once row y-1 is 3 pixels ahead (last pixel modifying the pixel at the right), like a single-thread pass
+static void DitherRows(void *data, int laneStart, int laneEnd)
+{
+    DitherPass *pass = (DitherPass *)data;
+    Color *pixels = pass->pixels;
+    int width = pass->width;
+    int height = pass->height;
+    int rBpp = pass->rBpp, gBpp = pass->gBpp, bBpp = pass->bBpp, aBpp = pass->aBpp;
+
+    Color oldPixel = WHITE;
+    Color newPixel = WHITE;
+
+    int rError, gError, bError;
+    unsigned short rPixel, gPixel, bPixel, aPixel;   // Used for 16bit pixel composition
+
+    for (int lanesRow = 0; lanesRow < height; lanesRow += pass->lanes)
+    {
+        for (int y = lanesRow + laneStart; (y < (lanesRow + laneEnd)) && (y < height); y++)
+        {
+        #if defined(SUPPORT_IMAGE_THREADS)
+            int ready = (y == 0)? width : 0;    // Pixels processed on previous row
+        #endif
+
+            for (int x = 0; x < width; x++)
+            {
+            #if defined(SUPPORT_IMAGE_THREADS)
+                int required = ((x + 3) < width)? (x + 3) : width;
+                while (ready < required)
                 {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = 0.0f;
-                    pixels[i].z = 0.0f;
-                    pixels[i].w = 1.0f;
+                    ready = __atomic_load_n(&pass->progress[y - 1], __ATOMIC_ACQUIRE);
+                    if (ready < required) sched_yield();
+                }
+            #endif
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+                oldPixel = pixels[y*width + x];
+
+                // NOTE: New pixel obtained by bits truncate, it would be better to round values (check ImageFormat())
+                newPixel.r = oldPixel.r >> (8 - rBpp);     // R bits
+                newPixel.g = oldPixel.g >> (8 - gBpp);     // G bits
+                newPixel.b = oldPixel.b >> (8 - bBpp);     // B bits
+                newPixel.a = oldPixel.a >> (8 - aBpp);     // A bits (not used on dithering)
+
+                // NOTE: Error must be computed between new and old pixel but using same number of bits!
+                // We want to know how much color precision we have lost...
+                rError = (int)oldPixel.r - (int)(newPixel.r << (8 - rBpp));
+                gError = (int)oldPixel.g - (int)(newPixel.g << (8 - gBpp));
+                bError = (int)oldPixel.b - (int)(newPixel.b << (8 - bBpp));
+
+                pixels[y*width + x] = newPixel;
+
+                // NOTE: Some cases are out of the array and should be ignored
+                if (x < (width - 1))
                 {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = ((float *)image.data)[k + 1];
-                    pixels[i].z = ((float *)image.data)[k + 2];
-                    pixels[i].w = 1.0f;
+                    pixels[y*width + x+1].r = MIN((int)pixels[y*width + x+1].r + (int)((float)rError*7.0f/16), 0xff);
+                    pixels[y*width + x+1].g = MIN((int)pixels[y*width + x+1].g + (int)((float)gError*7.0f/16), 0xff);
+                    pixels[y*width + x+1].b = MIN((int)pixels[y*width + x+1].b + (int)((float)bError*7.0f/16), 0xff);
+                }
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+                if ((x > 0) && (y < (height - 1)))
                 {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = ((float *)image.data)[k + 1];
-                    pixels[i].z = ((float *)image.data)[k + 2];
-                    pixels[i].w = ((float *)image.data)[k + 3];
+                    pixels[(y+1)*width + x-1].r = MIN((int)pixels[(y+1)*width + x-1].r + (int)((float)rError*3.0f/16), 0xff);
+                    pixels[(y+1)*width + x-1].g = MIN((int)pixels[(y+1)*width + x-1].g + (int)((float)gError*3.0f/16), 0xff);
+                    pixels[(y+1)*width + x-1].b = MIN((int)pixels[(y+1)*width + x-1].b + (int)((float)bError*3.0f/16), 0xff);
+                }
 
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16:
+                if (y < (height - 1))
                 {
-                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
-                    pixels[i].y = 0.0f;
-                    pixels[i].z = 0.0f;
-                    pixels[i].w = 1.0f;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+                    pixels[(y+1)*width + x].r = MIN((int)pixels[(y+1)*width + x].r + (int)((float)rError*5.0f/16), 0xff);
+                    pixels[(y+1)*width + x].g = MIN((int)pixels[(y+1)*width + x].g + (int)((float)gError*5.0f/16), 0xff);
+                    pixels[(y+1)*width + x].b = MIN((int)pixels[(y+1)*width + x].b + (int)((float)bError*5.0f/16), 0xff);
+                }
+
+                if ((x < (width - 1)) && (y < (height - 1)))
                 {
-                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
-                    pixels[i].y = HalfToFloat(((unsigned short *)image.data)[k + 1]);
-                    pixels[i].z = HalfToFloat(((unsigned short *)image.data)[k + 2]);
-                    pixels[i].w = 1.0f;
+                    pixels[(y+1)*width + x+1].r = MIN((int)pixels[(y+1)*width + x+1].r + (int)((float)rError*1.0f/16), 0xff);
+                    pixels[(y+1)*width + x+1].g = MIN((int)pixels[(y+1)*width + x+1].g + (int)((float)gError*1.0f/16), 0xff);
+                    pixels[(y+1)*width + x+1].b = MIN((int)pixels[(y+1)*width + x+1].b + (int)((float)bError*1.0f/16), 0xff);
+                }
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+                rPixel = (unsigned short)newPixel.r;
+                gPixel = (unsigned short)newPixel.g;
+                bPixel = (unsigned short)newPixel.b;
+                aPixel = (unsigned short)newPixel.a;
+
+                pass->output[y*width + x] = (rPixel << (gBpp + bBpp + aBpp)) | (gPixel << (bBpp + aBpp)) | (bPixel << aBpp) | aPixel;
+
+            #if defined(SUPPORT_IMAGE_THREADS)
+                // Publish row progress every 64 pixels, next row waits for it
+                if ((((x + 1)%64) == 0) || (x == (width - 1))) __atomic_store_n(&pass->progress[y], x + 1, __ATOMIC_RELEASE);
+            #endif
+            }
+        }
+    }
+}
+
+// Rotate image rows, destination rows are sampled from source with bilinear filtering
+static void RotateRows(void *data, int rowStart, int rowEnd)
+{
+    RotatePass *pass = (RotatePass *)data;
+    const unsigned char *srcData = pass->src;
+    unsigned char *rotatedData = pass->dst;
+    int srcWidth = pass->srcWidth;
+    int srcHeight = pass->srcHeight;
+    int width = pass->width;
+    int height = pass->height;
+    int bytesPerPixel = pass->bytesPerPixel;
+    float sinRadius = pass->sinRadius;
+    float cosRadius = pass->cosRadius;
+
+    for (int y = rowStart; y < rowEnd; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            float oldX = ((x - width/2.0f)*cosRadius + (y - height/2.0f)*sinRadius) + srcWidth/2.0f;
+            float oldY = ((y - height/2.0f)*cosRadius - (x - width/2.0f)*sinRadius) + srcHeight/2.0f;
+
+            if ((oldX >= 0) && (oldX < srcWidth) && (oldY >= 0) && (oldY < srcHeight))
+            {
+                int x1 = (int)floorf(oldX);
+                int y1 = (int)floorf(oldY);
+                int x2 = MIN(x1 + 1, srcWidth - 1);
+                int y2 = MIN(y1 + 1, srcHeight - 1);
+
+                float px = oldX - x1;
+                float py = oldY - y1;
+
+                for (int i = 0; i < bytesPerPixel; i++)
                 {
-                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
-                    pixels[i].y = HalfToFloat(((unsigned short *)image.data)[k + 1]);
-                    pixels[i].z = HalfToFloat(((unsigned short *)image.data)[k + 2]);
-                    pixels[i].w = HalfToFloat(((unsigned short *)image.data)[k + 3]);
+                    float f1 = srcData[(y1*srcWidth + x1)*bytesPerPixel + i];
+                    float f2 = srcData[(y1*srcWidth + x2)*bytesPerPixel + i];
+                    float f3 = srcData[(y2*srcWidth + x1)*bytesPerPixel + i];
+                    float f4 = srcData[(y2*srcWidth + x2)*bytesPerPixel + i];
 
-                    k += 4;
-                } break;
-                default: break;
+                    float val = f1*(1 - px)*(1 - py) + f2*px*(1 - py) + f3*(1 - px)*py + f4*px*py;
+
+                    rotatedData[(y*width + x)*bytesPerPixel + i] = (unsigned char)val;
+                }
             }
         }
     }
+}
 
-    return pixels;
+// Tint RGBA8 rows
+static void ColorTintRows(void *data, int rowStart, int rowEnd)
+{
+    ColorPass *pass = (ColorPass *)data;
+    Color *pixels = pass->pixels;
+
+    float cR = (float)pass->color.r/255;
+    float cG = (float)pass->color.g/255;
+    float cB = (float)pass->color.b/255;
+    float cA = (float)pass->color.a/255;
+
+    for (int y = rowStart; y < rowEnd; y++)
+    {
+        for (int x = 0; x < pass->width; x++)
+        {
+            int index = y*pass->width + x;
+            unsigned char r = (unsigned char)(((float)pixels[index].r/255*cR)*255.0f);
+            unsigned char g = (unsigned char)(((float)pixels[index].g/255*cG)*255.0f);
+            unsigned char b = (unsigned char)(((float)pixels[index].b/255*cB)*255.0f);
+            unsigned char a = (unsigned char)(((float)pixels[index].a/255*cA)*255.0f);
+
+            pixels[index].r = r;
+            pixels[index].g = g;
+            pixels[index].b = b;
+            pixels[index].a = a;
+        }
+    }
+}
+
+// Change brightness of RGBA8 rows
+static void ColorBrightnessRows(void *data, int rowStart, int rowEnd)
+{
+    ColorPass *pass = (ColorPass *)data;
+    Color *pixels = pass->pixels;
+    int width = pass->width;
+    int brightness = pass->brightness;
+
+    for (int y = rowStart; y < rowEnd; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            int cR = pixels[y*width + x].r + brightness;
+            int cG = pixels[y*width + x].g + brightness;
+            int cB = pixels[y*width + x].b + brightness;
+
+            if (cR < 0) cR = 1;
+            if (cR > 255) cR = 255;
+
+            if (cG < 0) cG = 1;
+            if (cG > 255) cG = 255;
+
+            if (cB < 0) cB = 1;
+            if (cB > 255) cB = 255;
+
+            pixels[y*width + x].r = (unsigned char)cR;
+            pixels[y*width + x].g = (unsigned char)cG;
+            pixels[y*width + x].b = (unsigned char)cB;
+        }
+    }
+}
+#endif      // SUPPORT_IMAGE_MANIPULATION
+
+#if defined(SUPPORT_IMAGE_EXPORT) && defined(SUPPORT_FILEFORMAT_PNG) && defined(SUPPORT_COMPRESSION_API)
+// Filter PNG rows, best filter estimated per row
+// NOTE: Same filter selection than stb_image_write, rows are filtered from source rows so they are independent
+static void FilterPngRows(void *data, int rowStart, int rowEnd)
+{
+    PngPass *pass = (PngPass *)data;
+    int rowSize = pass->width*pass->channels;
+    signed char *line = (signed char *)RL_MALLOC(rowSize);
+
+    for (int y = rowStart; y < rowEnd; y++)
+    {
+        int bestFilter = 0;
+        int bestEstimate = 0x7fffffff;
+        int filter = 0;
+
+        for (filter = 0; filter < 5; filter++)
+        {
+            stbiw__encode_png_line((unsigned char *)pass->pixels, rowSize, pass->width, pass->height, y, pass->channels, filter, line);
+
+            // Estimate line entropy using this filter, the less the better
+            int estimate = 0;
+            for (int i = 0; i < rowSize; i++) estimate += abs(line[i]);
+
+            if (estimate < bestEstimate)
+            {
+                bestEstimate = estimate;
+                bestFilter = filter;
+            }
+        }
+
+        // Last filter tried could already be the best one
+        if (filter - 1 != bestFilter) stbiw__encode_png_line((unsigned char *)pass->pixels, rowSize, pass->width, pass->height, y, pass->channels, bestFilter, line);
+
+        unsigned char *filtered = pass->filtered + y*(rowSize + 1);
+        filtered[0] = (unsigned char)bestFilter;
+        memcpy(filtered + 1, line, rowSize);
+    }
+
+    RL_FREE(line);
 }
 
+// Deflate filtered data chunks into IDAT chunks
+// NOTE: First chunk starts zlib stream, all chunks but last one end with a sync flush (byte aligned)
+static void CompressPngChunks(void *data, int chunkStart, int chunkEnd)
+{
+    PngPass *pass = (PngPass *)data;
+    int filteredSize = pass->height*(pass->width*pass->channels + 1);
+    struct sdefl *sdefl = (struct sdefl *)RL_MALLOC(sizeof(struct sdefl));   // WARNING: struct sdefl is almost 1MB
+
+    for (int i = chunkStart; (i < chunkEnd) && (sdefl != NULL); i++)
+    {
+        const unsigned char *input = pass->filtered + i*pass->chunkSize;
+        int inputSize = MIN(pass->chunkSize, filteredSize - i*pass->chunkSize);
+        int headerSize = (i == 0)? 2 : 0;
+        unsigned char *chunk = (unsigned char *)RL_MALLOC(8 + headerSize + sdefl_bound(inputSize) + 5 + 4);
+
+        if (chunk == NULL) break;
+
+        unsigned char *output = chunk + 8;
+        if (i == 0)
+        {
+            *output++ = 0x78;   // Deflate, 32K window
+            *output++ = 0x01;   // Fastest compression
+        }
+
+        int size = headerSize + sdeflate_part(sdefl, output, input, inputSize, pass->level, (i == pass->chunkCount - 1));
+
+        output = chunk;
+        stbiw__wp32(output, size);
+        stbiw__wptag(output, "IDAT");
+        output += size;
+        stbiw__wpcrc(&output, size);
+
+        pass->chunks[i] = chunk;
+        pass->chunkSizes[i] = size + 12;
+        pass->adlers[i] = ComputeAdler32(input, inputSize);
+    }
+
+    RL_FREE(sdefl);
+}
+
+// Compute Adler-32 checksum
+static unsigned int ComputeAdler32(const unsigned char *data, int dataSize)
+{
+    unsigned int s1 = 1;
+    unsigned int s2 = 0;
+
+    while (dataSize > 0)
+    {
+        // NOTE: 5552 is the maximum number of bytes summed before s2 could overflow
+        int blockSize = MIN(dataSize, 5552);
+
+        for (int i = 0; i < blockSize; i++)
+        {
+            s1 += data[i];
+            s2 += s1;
+        }
+
+        s1 %= 65521;
+        s2 %= 65521;
+        data += blockSize;
+        dataSize -= blockSize;
+    }
+
+    return (s2 << 16) | s1;
+}
+
+// Combine Adler-32 checksums of consecutive data, second checksum computed over dataSize2 bytes
+static unsigned int CombineAdler32(unsigned int adler1, unsigned int adler2, int dataSize2)
+{
+    unsigned int remainder = (unsigned int)(dataSize2%65521);
+    unsigned int s1 = adler1 & 0xffff;
+    unsigned int s2 = (remainder*s1)%65521;
+
+    s1 += (adler2 & 0xffff) + 65521 - 1;
+    s2 += (adler1 >> 16) + (adler2 >> 16) + 65521 - remainder;
+
+    if (s1 >= 65521) s1 -= 65521;
+    if (s1 >= 65521) s1 -= 65521;
+    if (s2 >= 2*65521) s2 -= 2*65521;
+    if (s2 >= 65521) s2 -= 65521;
+
+    return (s2 << 16) | s1;
+}
+#endif
+
 #endif      // SUPPORT_MODULE_RTEXTURES
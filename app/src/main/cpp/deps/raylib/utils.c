@@ -44,6 +44,21 @@
     #include <android/asset_manager.h>  // Required for: Android assets manager: AAsset, AAssetManager_open(), ...
 #endif
 
+#if defined(SUPPORT_STANDARD_FILEIO) && (defined(__linux__) || defined(__APPLE__) || defined(__FreeBSD__))
+    #define UTILS_FILE_MAPPING          // File views are memory-mapped (Linux/Android included)
+
+    #include <fcntl.h>                  // Required for: open(), O_RDONLY
+    #include <unistd.h>                 // Required for: close()
+    #include <sys/stat.h>               // Required for: fstat()
+    #include <sys/mman.h>               // Required for: mmap(), munmap(), madvise()
+#endif
+
+#if defined(SUPPORT_IMAGE_THREADS)
+    #define UTILS_ASSET_PACK_LOCK       // Asset packs are locked, files are loaded from texture loader threads
+
+    #include <pthread.h>                // Required for: pthread_rwlock_rdlock(), pthread_rwlock_wrlock()
+#endif
+
 #include <stdlib.h>                     // Required for: exit()
 #include <stdio.h>                      // Required for: FILE, fopen(), fseek(), ftell(), fread(), fwrite(), fprintf(), vprintf(), fclose()
 #include <stdarg.h>                     // Required for: va_list, va_start(), va_end()
@@ -55,6 +70,52 @@
 #ifndef MAX_TRACELOG_MSG_LENGTH
     #define MAX_TRACELOG_MSG_LENGTH     256         // Max length of one trace-log message
 #endif
+#ifndef MAX_FILEPATH_LENGTH
+    #define MAX_FILEPATH_LENGTH        4096         // Maximum length for filepaths
+#endif
+#ifndef MAX_ASSET_PACKS
+    #define MAX_ASSET_PACKS               4         // Maximum number of asset packs mounted at once
+#endif
+
+#define ASSET_PACK_VERSION                1         // Asset pack format version supported
+
+// Asset pack entries compression
+#define ASSET_PACK_STORE                  0         // Entry data stored as is
+#define ASSET_PACK_DEFLATE                1         // Entry data compressed with DEFLATE (raw, no zlib header)
+#define ASSET_PACK_QOI                    2         // Entry image stored as QOI data
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Asset pack header
+// NOTE: Pack layout: header, entries index (sorted by name hash), entries names ('\0' terminated),
+// entries data (16 bytes aligned), all values are little-endian
+typedef struct AssetPackHeader {
+    unsigned char magic[4];             // Asset pack file signature: "rPAK"
+    unsigned int version;               // Asset pack format version
+    unsigned int entryCount;            // Number of entries
+    unsigned int namesSize;             // Entries names table size in bytes
+} AssetPackHeader;
+
+// Asset pack entry
+typedef struct AssetPackEntry {
+    unsigned int hash;                  // Entry name hash (FNV-1a)
+    unsigned int nameOffset;            // Entry name offset in names table
+    unsigned int offset;                // Entry data offset in pack
+    unsigned int size;                  // Entry data size in pack
+    unsigned int dataSize;              // Entry data size once decompressed
+    unsigned int compression;           // Entry data compression: ASSET_PACK_STORE, ASSET_PACK_DEFLATE, ASSET_PACK_QOI
+} AssetPackEntry;
+
+// Asset pack mounted
+typedef struct AssetPack {
+    char *fileName;                     // Asset pack file name
+    FileView view;                      // Asset pack file view (memory-mapped if supported)
+    const AssetPackEntry *entries;      // Entries index, sorted by name hash
+    const char *names;                  // Entries names table
+    unsigned int entryCount;            // Number of entries
+    int refCount;                       // References: mounted (1) and file views of pack entries not unloaded yet
+} AssetPack;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -67,6 +128,12 @@ static SaveFileDataCallback saveFileData = NULL;    // SaveFileText callback fun
 static LoadFileTextCallback loadFileText = NULL;    // LoadFileText callback function pointer
 static SaveFileTextCallback saveFileText = NULL;    // SaveFileText callback function pointer
 
+static AssetPack *assetPacks[MAX_ASSET_PACKS] = { 0 };  // Asset packs mounted, last mounted is searched first
+static int assetPackCount = 0;                      // Number of asset packs mounted
+#if defined(UTILS_ASSET_PACK_LOCK)
+static pthread_rwlock_t assetPackLock = PTHREAD_RWLOCK_INITIALIZER;     // Asset packs lock, write locked to mount/unmount
+#endif
+
 //----------------------------------------------------------------------------------
 // Functions to set internal callbacks
 //----------------------------------------------------------------------------------
@@ -85,6 +152,18 @@ static const char *internalDataPath = NULL;         // Android internal data pat
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
+#if defined(SUPPORT_COMPRESSION_API)
+// [Module: rcore] Deflate decompressor (sinfl)
+extern int sinflate(void *out, int cap, const void *in, int size);
+#endif
+
+static void LockAssetPacks(bool write);                     // Lock mounted asset packs (shared for lookups)
+static void UnlockAssetPacks(void);                         // Unlock mounted asset packs
+static unsigned int GetAssetNameHash(const char *name);     // Get asset name hash (FNV-1a)
+static void ReleaseAssetPack(AssetPack *pack);              // Release asset pack reference, pack is unloaded on last one
+static const AssetPackEntry *FindAssetPackEntry(const char *fileName, AssetPack **pack);  // Find file entry in mounted asset packs
+static unsigned char *LoadAssetPackEntry(const AssetPack *pack, const AssetPackEntry *entry, const char *fileName); // Load asset pack entry data (decompressed)
+
 #if defined(PLATFORM_ANDROID)
 FILE *funopen(const void *cookie, int (*readfn)(void *, char *, int), int (*writefn)(void *, const char *, int),
               fpos_t (*seekfn)(void *, fpos_t, int), int (*closefn)(void *));
@@ -187,6 +266,21 @@ unsigned char *LoadFileData(const char *fileName, int *dataSize)
 
     if (fileName != NULL)
     {
+        // File names are resolved through mounted asset packs first
+        AssetPack *pack = NULL;
+        LockAssetPacks(false);
+        const AssetPackEntry *entry = FindAssetPackEntry(fileName, &pack);
+
+        if (entry != NULL)
+        {
+            data = LoadAssetPackEntry(pack, entry, fileName);
+            if (data != NULL) *dataSize = (int)entry->dataSize;
+            UnlockAssetPacks();
+            return data;
+        }
+
+        UnlockAssetPacks();
+
         if (loadFileData)
         {
             data = loadFileData(fileName, dataSize);
@@ -251,6 +345,164 @@ void UnloadFileData(unsigned char *data)
     RL_FREE(data);
 }
 
+// Load file data as read-only view
+// NOTE: File is memory-mapped if supported: pages are read on access and belong to system
+// file cache, so no heap buffer is allocated and data is not copied. On Android, assets are
+// accessed through asset manager buffer, uncompressed assets are directly mapped from APK.
+// If file can not be mapped (or a custom file data loader is set) data is loaded with LoadFileData()
+FileView LoadFileView(const char *fileName)
+{
+    FileView view = { 0 };
+
+    if (fileName == NULL)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: File name provided is not valid");
+        return view;
+    }
+
+    // File names are resolved through mounted asset packs first,
+    // entries not compressed are viewed directly in asset pack data
+    // NOTE: Views of pack data keep a pack reference, pack data stays valid until views are unloaded
+    AssetPack *pack = NULL;
+    LockAssetPacks(false);
+    const AssetPackEntry *entry = FindAssetPackEntry(fileName, &pack);
+
+    if (entry != NULL)
+    {
+        if (entry->compression == ASSET_PACK_DEFLATE)
+        {
+            view.data = LoadAssetPackEntry(pack, entry, fileName);
+            if (view.data != NULL) view.size = (int)entry->dataSize;
+            view.type = FILE_VIEW_HEAP;
+        }
+        else
+        {
+            view.data = pack->view.data + entry->offset;
+            view.size = (int)entry->size;
+            view.type = (entry->compression == ASSET_PACK_QOI)? FILE_VIEW_PACKED_QOI : FILE_VIEW_PACKED;
+            view.handle = pack;
+
+#if defined(UTILS_ASSET_PACK_LOCK)
+            __atomic_add_fetch(&pack->refCount, 1, __ATOMIC_RELAXED);
+#else
+            pack->refCount++;
+#endif
+            TRACELOG(LOG_INFO, "FILEIO: [%s] File mapped successfully from asset pack", fileName);
+        }
+
+        UnlockAssetPacks();
+        return view;
+    }
+
+    UnlockAssetPacks();
+
+    if (loadFileData == NULL)
+    {
+        const char *filePath = fileName;
+
+#if defined(PLATFORM_ANDROID)
+        if (assetManager != NULL)
+        {
+            AAsset *asset = AAssetManager_open(assetManager, fileName, AASSET_MODE_BUFFER);
+
+            if (asset != NULL)
+            {
+                // NOTE: Compressed assets are inflated into a buffer owned by asset
+                const void *buffer = AAsset_getBuffer(asset);
+                off64_t length = AAsset_getLength64(asset);
+
+                if ((buffer != NULL) && (length > 0) && (length <= 2147483647))
+                {
+                    view.data = (const unsigned char *)buffer;
+                    view.size = (int)length;
+                    view.type = FILE_VIEW_ASSET;
+                    view.handle = asset;
+
+                    TRACELOG(LOG_INFO, "FILEIO: [%s] File mapped successfully (%s)", fileName, AAsset_isAllocated(asset)? "inflated asset" : "uncompressed asset");
+                    return view;
+                }
+
+                AAsset_close(asset);
+            }
+        }
+
+        // File not found in assets, internal data path is used (as android_fopen() does)
+        // NOTE: TextFormat() is not used, file views could be loaded from multiple threads
+        char internalPath[MAX_FILEPATH_LENGTH] = { 0 };
+
+        if (internalDataPath != NULL)
+        {
+            snprintf(internalPath, MAX_FILEPATH_LENGTH, "%s/%s", internalDataPath, fileName);
+            filePath = internalPath;
+        }
+#endif
+#if defined(UTILS_FILE_MAPPING)
+        int fd = open(filePath, O_RDONLY);
+
+        if (fd != -1)
+        {
+            struct stat info = { 0 };
+
+            if ((fstat(fd, &info) == 0) && (info.st_size > 0))
+            {
+                if (info.st_size > 2147483647)
+                {
+                    TRACELOG(LOG_WARNING, "FILEIO: [%s] File is bigger than 2147483647 bytes, avoid using LoadFileView()", fileName);
+                    close(fd);
+                    return view;
+                }
+
+                void *data = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+                if (data != MAP_FAILED)
+                {
+                    // File data is expected to be fully read, start reading pages ahead
+                    madvise(data, (size_t)info.st_size, MADV_WILLNEED);
+
+                    view.data = (const unsigned char *)data;
+                    view.size = (int)info.st_size;
+                    view.type = FILE_VIEW_MAPPED;
+                }
+            }
+
+            // NOTE: Mapping keeps file referenced, descriptor is not required anymore
+            close(fd);
+
+            if (view.data != NULL)
+            {
+                TRACELOG(LOG_INFO, "FILEIO: [%s] File mapped successfully", fileName);
+                return view;
+            }
+        }
+#endif
+    }
+
+    // File can not be mapped, loaded into heap buffer instead
+    view.data = LoadFileData(fileName, &view.size);
+    view.type = FILE_VIEW_HEAP;
+
+    return view;
+}
+
+// Unload file view loaded by LoadFileView()
+void UnloadFileView(FileView view)
+{
+    if (view.data == NULL) return;
+
+    switch (view.type)
+    {
+#if defined(UTILS_FILE_MAPPING)
+        case FILE_VIEW_MAPPED: munmap((void *)view.data, (size_t)view.size); break;
+#endif
+#if defined(PLATFORM_ANDROID)
+        case FILE_VIEW_ASSET: AAsset_close((AAsset *)view.handle); break;
+#endif
+        case FILE_VIEW_PACKED:
+        case FILE_VIEW_PACKED_QOI: ReleaseAssetPack((AssetPack *)view.handle); break;  // Data owned by asset pack
+        default: UnloadFileData((unsigned char *)view.data); break;
+    }
+}
+
 // Save data to file from buffer
 bool SaveFileData(const char *fileName, void *data, int dataSize)
 {
@@ -343,6 +595,28 @@ char *LoadFileText(const char *fileName)
 
     if (fileName != NULL)
     {
+        // File names are resolved through mounted asset packs first
+        AssetPack *pack = NULL;
+        LockAssetPacks(false);
+        const AssetPackEntry *entry = FindAssetPackEntry(fileName, &pack);
+
+        if (entry != NULL)
+        {
+            unsigned char *data = LoadAssetPackEntry(pack, entry, fileName);
+
+            if (data != NULL)
+            {
+                // Zero-terminate the string
+                text = (char *)RL_REALLOC(data, entry->dataSize + 1);
+                text[entry->dataSize] = '\0';
+            }
+
+            UnlockAssetPacks();
+            return text;
+        }
+
+        UnlockAssetPacks();
+
         if (loadFileText)
         {
             text = loadFileText(fileName);
@@ -433,6 +707,103 @@ bool SaveFileText(const char *fileName, char *text)
     return success;
 }
 
+// Mount asset pack, files are looked up in mounted asset packs before file system
+// NOTE: Asset pack is kept as a file view (memory-mapped if supported) until unmounted,
+// on Android the pack must be stored uncompressed in APK to be mapped directly
+bool MountAssetPack(const char *fileName)
+{
+    FileView view = LoadFileView(fileName);
+
+    if (view.data == NULL) return false;
+
+    AssetPackHeader header = { 0 };
+    if (view.size >= (int)sizeof(AssetPackHeader)) memcpy(&header, view.data, sizeof(AssetPackHeader));
+
+    // Check pack header and entries are contained in pack data
+    // NOTE: Entries data is checked once on mounting, so entries can be accessed later without checks
+    long long indexSize = (long long)header.entryCount*sizeof(AssetPackEntry);
+    bool valid = (memcmp(header.magic, "rPAK", 4) == 0) && (header.version == ASSET_PACK_VERSION) &&
+        ((sizeof(AssetPackHeader) + indexSize + header.namesSize) <= (unsigned long long)view.size);
+
+    const AssetPackEntry *entries = (const AssetPackEntry *)(view.data + sizeof(AssetPackHeader));
+    const char *names = (const char *)(view.data + sizeof(AssetPackHeader) + indexSize);
+
+    if (valid && (header.entryCount > 0)) valid = (header.namesSize > 0) && (names[header.namesSize - 1] == '\0');
+
+    for (unsigned int i = 0; valid && (i < header.entryCount); i++)
+    {
+        const AssetPackEntry *entry = &entries[i];
+
+        valid = (entry->nameOffset < header.namesSize) && (entry->compression <= ASSET_PACK_QOI) &&
+            (((long long)entry->offset + entry->size) <= view.size) && (entry->dataSize <= 2147483647) &&
+            ((entry->compression == ASSET_PACK_DEFLATE) || (entry->size == entry->dataSize)) &&
+            ((i == 0) || (entries[i - 1].hash <= entry->hash));
+    }
+
+    if (!valid)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Asset pack data is not valid", fileName);
+        UnloadFileView(view);
+        return false;
+    }
+
+    LockAssetPacks(true);
+
+    if (assetPackCount == MAX_ASSET_PACKS)
+    {
+        UnlockAssetPacks();
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to mount asset pack, maximum asset packs mounted (%i)", fileName, MAX_ASSET_PACKS);
+        UnloadFileView(view);
+        return false;
+    }
+
+    AssetPack *pack = (AssetPack *)RL_CALLOC(1, sizeof(AssetPack));
+    pack->fileName = (char *)RL_MALLOC(strlen(fileName) + 1);
+    strcpy(pack->fileName, fileName);
+    pack->view = view;
+    pack->entries = entries;
+    pack->names = names;
+    pack->entryCount = header.entryCount;
+    pack->refCount = 1;
+    assetPacks[assetPackCount] = pack;
+    assetPackCount++;
+
+    UnlockAssetPacks();
+
+    TRACELOG(LOG_INFO, "FILEIO: [%s] Asset pack mounted successfully (%i entries)", fileName, header.entryCount);
+
+    return true;
+}
+
+// Unmount asset pack
+// NOTE: Pack files are not found anymore once unmounted, but pack data is kept
+// until file views of pack entries (loaded before unmounting) are unloaded
+void UnmountAssetPack(const char *fileName)
+{
+    LockAssetPacks(true);
+
+    for (int i = 0; i < assetPackCount; i++)
+    {
+        if (strcmp(assetPacks[i]->fileName, fileName) == 0)
+        {
+            AssetPack *pack = assetPacks[i];
+
+            for (int j = i; j < (assetPackCount - 1); j++) assetPacks[j] = assetPacks[j + 1];
+            assetPackCount--;
+            assetPacks[assetPackCount] = NULL;
+
+            UnlockAssetPacks();
+
+            ReleaseAssetPack(pack);
+            TRACELOG(LOG_INFO, "FILEIO: [%s] Asset pack unmounted successfully", fileName);
+            return;
+        }
+    }
+
+    UnlockAssetPacks();
+    TRACELOG(LOG_WARNING, "FILEIO: [%s] Asset pack is not mounted", fileName);
+}
+
 #if defined(PLATFORM_ANDROID)
 // Initialize asset manager from android app
 void InitAssetManager(AAssetManager *manager, const char *dataPath)
@@ -479,6 +850,136 @@ FILE *android_fopen(const char *fileName, const char *mode)
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
+// Lock mounted asset packs, lookups share the lock, mount/unmount lock it exclusively
+// NOTE: Lookups keep the lock while entry data is copied (or decompressed) from pack
+static void LockAssetPacks(bool write)
+{
+#if defined(UTILS_ASSET_PACK_LOCK)
+    if (write) pthread_rwlock_wrlock(&assetPackLock);
+    else pthread_rwlock_rdlock(&assetPackLock);
+#else
+    (void)write;
+#endif
+}
+
+// Unlock mounted asset packs
+static void UnlockAssetPacks(void)
+{
+#if defined(UTILS_ASSET_PACK_LOCK)
+    pthread_rwlock_unlock(&assetPackLock);
+#endif
+}
+
+// Release asset pack reference, pack data is unloaded once unmounted and no file view references it
+// NOTE: Pack references are only added while pack is mounted (asset packs locked for lookups),
+// so last reference is released once, after pack is not reachable anymore
+static void ReleaseAssetPack(AssetPack *pack)
+{
+#if defined(UTILS_ASSET_PACK_LOCK)
+    int refCount = __atomic_sub_fetch(&pack->refCount, 1, __ATOMIC_ACQ_REL);
+#else
+    int refCount = --pack->refCount;
+#endif
+
+    if (refCount == 0)
+    {
+        UnloadFileView(pack->view);
+        RL_FREE(pack->fileName);
+        RL_FREE(pack);
+    }
+}
+
+// Get asset name hash (FNV-1a), same hash is computed by asset packer
+static unsigned int GetAssetNameHash(const char *name)
+{
+    unsigned int hash = 2166136261u;
+
+    for (; *name != '\0'; name++)
+    {
+        hash ^= (unsigned char)*name;
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+// Find file entry in mounted asset packs, last mounted pack is searched first
+// NOTE: Asset packs must be locked by caller
+static const AssetPackEntry *FindAssetPackEntry(const char *fileName, AssetPack **pack)
+{
+    if (assetPackCount == 0) return NULL;
+
+    // Entries names are relative to packed directory
+    if ((fileName[0] == '.') && (fileName[1] == '/')) fileName += 2;
+
+    unsigned int hash = GetAssetNameHash(fileName);
+
+    for (int i = assetPackCount - 1; i >= 0; i--)
+    {
+        AssetPack *current = assetPacks[i];
+
+        // Binary search first entry with same name hash
+        unsigned int low = 0;
+        unsigned int high = current->entryCount;
+
+        while (low < high)
+        {
+            unsigned int mid = low + (high - low)/2;
+
+            if (current->entries[mid].hash < hash) low = mid + 1;
+            else high = mid;
+        }
+
+        for (unsigned int k = low; (k < current->entryCount) && (current->entries[k].hash == hash); k++)
+        {
+            if (strcmp(current->names + current->entries[k].nameOffset, fileName) == 0)
+            {
+                *pack = current;
+                return &current->entries[k];
+            }
+        }
+    }
+
+    return NULL;
+}
+
+// Load asset pack entry data into a new buffer, decompressed if required
+// NOTE: QOI entries data is not decoded, LoadImage() and LoadImageFromMemory() recognize it
+static unsigned char *LoadAssetPackEntry(const AssetPack *pack, const AssetPackEntry *entry, const char *fileName)
+{
+    const unsigned char *entryData = pack->view.data + entry->offset;
+    unsigned char *data = (unsigned char *)RL_MALLOC((entry->dataSize > 0)? entry->dataSize : 1);
+
+    if (data == NULL)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to allocated memory for file reading", fileName);
+        return NULL;
+    }
+
+    if (entry->compression == ASSET_PACK_DEFLATE)
+    {
+#if defined(SUPPORT_COMPRESSION_API)
+        int length = sinflate(data, (int)entry->dataSize, entryData, (int)entry->size);
+
+        if (length != (int)entry->dataSize)
+        {
+            TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to decompress file from asset pack", fileName);
+            RL_FREE(data);
+            return NULL;
+        }
+#else
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Asset pack compressed entries not supported (SUPPORT_COMPRESSION_API required)", fileName);
+        RL_FREE(data);
+        return NULL;
+#endif
+    }
+    else memcpy(data, entryData, entry->size);
+
+    TRACELOG(LOG_INFO, "FILEIO: [%s] File loaded successfully from asset pack", fileName);
+
+    return data;
+}
+
 #if defined(PLATFORM_ANDROID)
 static int android_read(void *cookie, char *data, int dataSize)
 {
@@ -52,6 +52,13 @@
     #define fopen(name, mode) android_fopen(name, mode)
 #endif
 
+// File view types, FileView.type
+#define FILE_VIEW_HEAP          0   // File data copied into heap buffer by LoadFileData()
+#define FILE_VIEW_MAPPED        1   // File data memory-mapped
+#define FILE_VIEW_ASSET         2   // File data from Android asset buffer
+#define FILE_VIEW_PACKED        3   // File data stored in mounted asset pack
+#define FILE_VIEW_PACKED_QOI    4   // File data stored in mounted asset pack, image encoded as QOI
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
@@ -38,6 +38,7 @@
 #include "raymob.h" // This header can replace 'raylib.h' and includes additional functions related to Android.
 
 #include "dns_task.h"
+#include "ui.h"
 
 #ifndef NDEBUG
 #define SRV_HOSTNAME "dzajac-zenbook.local"
@@ -57,9 +58,6 @@
 #define BUTT_COLOR_INACTIVE GRAY
 #define BUTT_COLOR_STOP RED
 
-#define FONT_SIZE 36
-#define FONT_SPACING 2.0f
-
 enum conn_state {
     RESOLVING,
     START_CONNECT,
@@ -82,14 +80,6 @@ enum move_state {
     MOVE_DOWN,
 };
 
-typedef struct {
-    Rectangle bounds;
-    Color fg;
-    Color bg;
-    char *text;
-    bool active;
-} button_t;
-
 typedef struct {
     enum conn_state conn;
     enum conn_err conn_err;
@@ -105,124 +95,21 @@ static app_state state = {
         .move = MOVE_STOP,
 };
 
-
-static Rectangle RecScreenToPixel(Rectangle rec)
+static Color up_color(void)
 {
-    return CLITERAL(Rectangle) {
-        .x = rec.x * screen_dim.x,
-        .y = rec.y * screen_dim.y,
-        .width = rec.width * screen_dim.x,
-        .height = rec.height * screen_dim.y
-    };
+    if (state.conn != CONNECTED) return BUTT_COLOR_INACTIVE;
+    return state.move == MOVE_UP ? BUTT_COLOR_ACTIVE : BUTT_COLOR_DEF;
 }
 
-static bool button(button_t *b) {
-    Vector3 bg_hsv = ColorToHSV(b->bg);
-    bool within_bounds = CheckCollisionPointRec(GetMousePosition(), RecScreenToPixel(b->bounds));
-    if (within_bounds && IsMouseButtonDown(0) && b->active) {
-        bg_hsv.z *= 0.9;
-    }
-    DrawRectangleRounded(RecScreenToPixel(b->bounds), 0.25f, 12, ColorFromHSV(bg_hsv.x, bg_hsv.y, bg_hsv.z));
-
-    Vector2 text_size = Vector2Divide(MeasureTextEx(font, b->text, FONT_SIZE, FONT_SPACING), screen_dim);
-    Vector2 text_pos = {
-        .x = b->bounds.x + b->bounds.width/2-text_size.x/2,
-        .y = b->bounds.y + b->bounds.height/2-text_size.y/2
-    };
-    DrawTextEx(font, b->text, Vector2Multiply(text_pos, screen_dim), FONT_SIZE, FONT_SPACING, b->fg);
-    if (within_bounds && IsMouseButtonPressed(0)) {
-        return true;
-    } else {
-        return false;
-    }
-}
-
-static bool up_button() {
-    bool active = state.conn == CONNECTED;
-    const Vector2 size = {
-        .x = 0.4f,
-        .y = 0.1f,
-    };
-    const Rectangle bounds = {
-        .x = 0.5f-size.x/2,
-        .y = 0.2f,
-        .width = size.x,
-        .height = size.y
-    };
-    Color bg;
-    if (active) {
-        if (state.move == MOVE_UP)
-            bg = BUTT_COLOR_ACTIVE;
-        else
-            bg = BUTT_COLOR_DEF;
-    } else {
-        bg = BUTT_COLOR_INACTIVE;
-    }
-    button_t butt = {
-        bounds,
-        WHITE,
-        bg,
-        "Up",
-        active,
-    };
-
-    return button(&butt);
-}
-
-static bool stop_button() {
-    bool active = state.conn == CONNECTED;
-    const Vector2 size = {
-        .x = 0.4f,
-        .y = 0.1f,
-    };
-    const Rectangle bounds = {
-        .x = 0.5f-size.x/2,
-        .y = 0.315f,
-        .width = size.x,
-        .height = size.y
-    };
-    Color bg = active ? BUTT_COLOR_STOP : BUTT_COLOR_INACTIVE;
-    button_t butt = {
-        bounds,
-        WHITE,
-        bg,
-        "Stop",
-        active,
-    };
-
-    return button(&butt);
+static Color stop_color(void)
+{
+    return state.conn == CONNECTED ? BUTT_COLOR_STOP : BUTT_COLOR_INACTIVE;
 }
 
-static bool down_button() {
-    bool active = state.conn == CONNECTED;
-    const Vector2 size = {
-        .x = 0.4f,
-        .y = 0.1f,
-    };
-    const Rectangle bounds = {
-        .x = 0.5f-size.x/2,
-        .y = 0.430f,
-        .width = size.x,
-        .height = size.y
-    };
-    Color bg;
-    if (active) {
-        if (state.move == MOVE_DOWN)
-            bg = BUTT_COLOR_ACTIVE;
-        else
-            bg = BUTT_COLOR_DEF;
-    } else {
-        bg = BUTT_COLOR_INACTIVE;
-    }
-    button_t butt = {
-        bounds,
-        WHITE,
-        bg,
-        "Down",
-        active,
-    };
-
-    return button(&butt);
+static Color down_color(void)
+{
+    if (state.conn != CONNECTED) return BUTT_COLOR_INACTIVE;
+    return state.move == MOVE_DOWN ? BUTT_COLOR_ACTIVE : BUTT_COLOR_DEF;
 }
 
 sig_atomic_t dns_done = 0;
@@ -254,23 +141,48 @@ int main(void)
 {
     // Initialization
     //--------------------------------------------------------------------------------------
-    SetConfigFlags(FLAG_MSAA_4X_HINT);
     InitWindow(0, 0, "raylib [core] example - basic window");
     SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
-    font = GetFontDefault();
+    // One SDF atlas generated from the default font, drawn crisp at any size
+    font = GenFontSDF(GetFontDefault(), 3);
+    if (!IsFontReady(font)) font = GetFontDefault();
     screen_dim = CLITERAL(Vector2) {GetScreenWidth(), GetScreenHeight()};
+    if (!ui_init(font)) {
+        exit(1);
+    }
     //--------------------------------------------------------------------------------------
 
     static const char *up = "up";
     static const char *stop = "stop";
     static const char *down = "down";
-    Rectangle status_rec = {
-        .x = fmaxf(0.05f*screen_dim.x, 0.05f*screen_dim.y),
-        .y = fmaxf(0.05f*screen_dim.x, 0.05f*screen_dim.y),
-        .width = 64,
-        .height = 64,
+    const float status_margin = fmaxf(0.05f*screen_dim.x, 0.05f*screen_dim.y);
+    const Rectangle status_bounds = {
+        .x = status_margin/screen_dim.x,
+        .y = status_margin/screen_dim.y,
+        .width = 64/screen_dim.x,
+        .height = 64/screen_dim.y,
+    };
+    const Vector2 butt_size = {
+        .x = 0.4f,
+        .y = 0.1f,
+    };
+    Rectangle butt_bounds = {
+        .x = 0.5f-butt_size.x/2,
+        .y = 0.2f,
+        .width = butt_size.x,
+        .height = butt_size.y
     };
     Color status_color = WHITE;
+    ui_id_t status_panel = ui_panel_add(status_bounds, 0.0f, status_color);
+    ui_id_t up_butt = ui_button_add(butt_bounds, "Up", WHITE, up_color());
+    butt_bounds.y = 0.315f;
+    ui_id_t stop_butt = ui_button_add(butt_bounds, "Stop", WHITE, stop_color());
+    butt_bounds.y = 0.430f;
+    ui_id_t down_butt = ui_button_add(butt_bounds, "Down", WHITE, down_color());
+    if (status_panel < 0 || up_butt < 0 || stop_butt < 0 || down_butt < 0) {
+        LOG_ERR("Failed to create widgets");
+        exit(1);
+    }
 
     if (!dns_task_start()) {
         exit(1);
@@ -339,25 +251,22 @@ int main(void)
                 break;
         }
 
-        // Draw
+        // Update UI
         //----------------------------------------------------------------------------------
-        BeginDrawing();
-
-        ClearBackground(RAYWHITE);
-        DrawRectangleRec(status_rec, status_color);
+        ui_update();
 
         int ret = 0;
-        if (up_button()) {
+        if (ui_clicked(up_butt)) {
             LOG_INFO("Up!");
             ret = write(sock, up, strlen(up));
             if (state.move == MOVE_STOP) state.move = MOVE_UP;
         }
-        if (stop_button()) {
+        if (ui_clicked(stop_butt)) {
             LOG_INFO("Stop!");
             ret = write(sock, stop, strlen(stop));
             state.move = MOVE_STOP;
         }
-        if (down_button()) {
+        if (ui_clicked(down_butt)) {
             LOG_INFO("Down!");
             ret = write(sock, down, strlen(down));
             if (state.move == MOVE_STOP) state.move = MOVE_DOWN;
@@ -366,12 +275,34 @@ int main(void)
             LOG_INFO("Error writing to socket: %s", strerror(errno));
         }
 
+        // Widget state is pushed every frame, unchanged colors are skipped by ui_set_color()
+        bool active = state.conn == CONNECTED;
+        ui_set_color(status_panel, status_color);
+        ui_set_active(up_butt, active);
+        ui_set_color(up_butt, up_color());
+        ui_set_active(stop_butt, active);
+        ui_set_color(stop_butt, stop_color());
+        ui_set_active(down_butt, active);
+        ui_set_color(down_butt, down_color());
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+        ClearBackground(RAYWHITE);
+        ui_draw();
+#if defined(SHOW_RENDER_STATS)
+        DrawRenderStats(10, (int)screen_dim.y - 80);
+#endif
+
         EndDrawing();
         //----------------------------------------------------------------------------------
     }
 
     // De-Initialization
     //--------------------------------------------------------------------------------------
+    ui_shutdown();
+    UnloadFont(font);
     CloseWindow();        // Close window and OpenGL context
     shutdown(sock, SHUT_RDWR);
     close(sock);
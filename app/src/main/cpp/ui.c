@@ -0,0 +1,318 @@
+#include <android/log.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "raylib.h"
+#include "raymath.h"
+#include "rlgl.h"
+
+#include "ui.h"
+
+#define MY_LOG_TAG "ui"
+
+#define LOG_INFO(...) do { __android_log_print(ANDROID_LOG_INFO, MY_LOG_TAG, __VA_ARGS__); } while(0)
+#define LOG_ERR(...) do { __android_log_print(ANDROID_LOG_ERROR, MY_LOG_TAG, __VA_ARGS__); } while(0)
+
+#define FONT_SIZE 36
+#define FONT_SPACING 2.0f
+
+// Label geometry budget per widget, every widget owns a fixed range of the vertex buffer
+#define UI_LABEL_MAX_GLYPHS 16
+#define UI_WIDGET_VERTICES (UI_LABEL_MAX_GLYPHS*6)
+
+typedef struct {
+    float x, y;
+    float u, v;
+    unsigned char r, g, b, a;
+} ui_vertex_t;
+
+typedef enum {
+    UI_PANEL,
+    UI_BUTTON,
+} ui_kind_t;
+
+typedef struct {
+    ui_kind_t kind;
+    Rectangle bounds;
+    float roundness;
+    Color fg;
+    Color bg;
+    Color bg_pressed;
+    const char *text;
+    TextLayout label;
+    bool active;
+    bool pressed;
+    bool clicked;
+    bool dirty;
+} ui_widget_t;
+
+static struct {
+    Font font;
+    Shader shader;
+    Vector2 screen_dim;
+    ui_widget_t widgets[UI_MAX_WIDGETS];
+    int widget_count;
+    ui_vertex_t *vertices;
+    unsigned int vao;
+    unsigned int vbo;
+} ui = {0};
+
+static Rectangle rec_screen_to_pixel(Rectangle rec)
+{
+    return CLITERAL(Rectangle) {
+        .x = rec.x * ui.screen_dim.x,
+        .y = rec.y * ui.screen_dim.y,
+        .width = rec.width * ui.screen_dim.x,
+        .height = rec.height * ui.screen_dim.y
+    };
+}
+
+static void set_vertex(ui_vertex_t *v, Vector2 pos, Vector2 uv, Color color)
+{
+    v->x = pos.x;
+    v->y = pos.y;
+    v->u = uv.x;
+    v->v = uv.y;
+    v->r = color.r;
+    v->g = color.g;
+    v->b = color.b;
+    v->a = color.a;
+}
+
+// Label glyph quads from the shaped text layout, centered in the bounds
+static int build_label(ui_vertex_t *v, const TextLayout *label, Rectangle rec, Color color)
+{
+    Vector2 origin = {
+        .x = rec.x + rec.width/2 - label->size.x/2,
+        .y = rec.y + rec.height/2 - label->size.y/2
+    };
+    int glyphs = label->quadCount < UI_LABEL_MAX_GLYPHS ? label->quadCount : UI_LABEL_MAX_GLYPHS;
+    int count = 0;
+
+    for (int i = 0; i < glyphs; i++) {
+        const float *q = &label->quads[i*8];
+        Vector2 tl = { origin.x + q[0], origin.y + q[1] };
+        Vector2 br = { origin.x + q[2], origin.y + q[3] };
+        Vector2 bl = { tl.x, br.y };
+        Vector2 tr = { br.x, tl.y };
+
+        set_vertex(&v[count++], tl, CLITERAL(Vector2) { q[4], q[5] }, color);
+        set_vertex(&v[count++], bl, CLITERAL(Vector2) { q[4], q[7] }, color);
+        set_vertex(&v[count++], br, CLITERAL(Vector2) { q[6], q[7] }, color);
+
+        set_vertex(&v[count++], tl, CLITERAL(Vector2) { q[4], q[5] }, color);
+        set_vertex(&v[count++], br, CLITERAL(Vector2) { q[6], q[7] }, color);
+        set_vertex(&v[count++], tr, CLITERAL(Vector2) { q[6], q[5] }, color);
+    }
+
+    return count;
+}
+
+static void rebuild_widget(int index)
+{
+    ui_widget_t *w = &ui.widgets[index];
+    ui_vertex_t *v = &ui.vertices[index*UI_WIDGET_VERTICES];
+    Rectangle rec = rec_screen_to_pixel(w->bounds);
+
+    int count = 0;
+    if (w->kind == UI_BUTTON) {
+        count = build_label(v, &w->label, rec, w->fg);
+    }
+
+    // Unused vertices collapse into degenerate triangles, so the whole
+    // buffer can still be drawn with one call
+    memset(&v[count], 0, (UI_WIDGET_VERTICES - count)*sizeof(ui_vertex_t));
+
+    rlUpdateVertexBuffer(ui.vbo, v, UI_WIDGET_VERTICES*sizeof(ui_vertex_t), index*UI_WIDGET_VERTICES*sizeof(ui_vertex_t));
+    w->dirty = false;
+}
+
+static void set_attributes(void)
+{
+    int *locs = ui.shader.locs;
+
+    rlSetVertexAttribute(locs[SHADER_LOC_VERTEX_POSITION], 2, RL_FLOAT, false, sizeof(ui_vertex_t), (void *)0);
+    rlEnableVertexAttribute(locs[SHADER_LOC_VERTEX_POSITION]);
+    rlSetVertexAttribute(locs[SHADER_LOC_VERTEX_TEXCOORD01], 2, RL_FLOAT, false, sizeof(ui_vertex_t), (void *)(2*sizeof(float)));
+    rlEnableVertexAttribute(locs[SHADER_LOC_VERTEX_TEXCOORD01]);
+    rlSetVertexAttribute(locs[SHADER_LOC_VERTEX_COLOR], 4, RL_UNSIGNED_BYTE, true, sizeof(ui_vertex_t), (void *)(4*sizeof(float)));
+    rlEnableVertexAttribute(locs[SHADER_LOC_VERTEX_COLOR]);
+}
+
+// Pressed shade is only recomputed when the color changes
+static void set_background(ui_widget_t *w, Color bg)
+{
+    Vector3 hsv = ColorToHSV(bg);
+    hsv.z *= 0.9;
+    w->bg = bg;
+    w->bg_pressed = ColorFromHSV(hsv.x, hsv.y, hsv.z);
+}
+
+static ui_widget_t *get_widget(ui_id_t id)
+{
+    if (id < 0 || id >= ui.widget_count) {
+        LOG_ERR("Invalid widget id %d", id);
+        return NULL;
+    }
+    return &ui.widgets[id];
+}
+
+static ui_id_t add_widget(ui_kind_t kind, Rectangle bounds, float roundness, Color bg)
+{
+    if (ui.widget_count >= UI_MAX_WIDGETS) {
+        LOG_ERR("Too many widgets, max is %d", UI_MAX_WIDGETS);
+        return -1;
+    }
+    ui_id_t id = ui.widget_count++;
+    ui_widget_t *w = &ui.widgets[id];
+    memset(w, 0, sizeof(*w));
+    w->kind = kind;
+    w->bounds = bounds;
+    w->roundness = roundness;
+    w->active = true;
+    w->dirty = true;
+    set_background(w, bg);
+    return id;
+}
+
+bool ui_init(Font font)
+{
+    ui.font = font;
+    // SDF fonts need the SDF shader
+    ui.shader = GetFontShader(font, FONT_SIZE);
+    ui.screen_dim = CLITERAL(Vector2) { GetScreenWidth(), GetScreenHeight() };
+
+    ui.vertices = calloc(UI_MAX_WIDGETS*UI_WIDGET_VERTICES, sizeof(ui_vertex_t));
+    if (ui.vertices == NULL) {
+        LOG_ERR("Failed to allocate widget geometry");
+        return false;
+    }
+
+    ui.vao = rlLoadVertexArray();
+    rlEnableVertexArray(ui.vao);
+    ui.vbo = rlLoadVertexBuffer(ui.vertices, UI_MAX_WIDGETS*UI_WIDGET_VERTICES*sizeof(ui_vertex_t), true);
+    set_attributes();
+    rlDisableVertexArray();
+    rlDisableVertexBuffer();
+
+    if (ui.vbo == 0) {
+        LOG_ERR("Failed to create widget vertex buffer");
+        return false;
+    }
+    return true;
+}
+
+void ui_shutdown(void)
+{
+    for (int i = 0; i < ui.widget_count; i++) {
+        UnloadTextLayout(ui.widgets[i].label);
+    }
+    if (ui.vao != 0) rlUnloadVertexArray(ui.vao);
+    rlUnloadVertexBuffer(ui.vbo);
+    free(ui.vertices);
+    memset(&ui, 0, sizeof(ui));
+}
+
+ui_id_t ui_panel_add(Rectangle bounds, float roundness, Color bg)
+{
+    return add_widget(UI_PANEL, bounds, roundness, bg);
+}
+
+ui_id_t ui_button_add(Rectangle bounds, const char *text, Color fg, Color bg)
+{
+    ui_id_t id = add_widget(UI_BUTTON, bounds, 0.25f, bg);
+    if (id < 0) return id;
+
+    ui_widget_t *w = &ui.widgets[id];
+    w->fg = fg;
+    w->text = text;
+    UpdateTextLayout(&w->label, ui.font, text, FONT_SIZE, FONT_SPACING);
+    if (w->label.quadCount > UI_LABEL_MAX_GLYPHS) {
+        LOG_ERR("Label \"%s\" truncated to %d glyphs", text, UI_LABEL_MAX_GLYPHS);
+    }
+    return id;
+}
+
+void ui_set_color(ui_id_t id, Color bg)
+{
+    ui_widget_t *w = get_widget(id);
+    if (w == NULL || ColorToInt(w->bg) == ColorToInt(bg)) return;
+    set_background(w, bg);
+}
+
+void ui_set_active(ui_id_t id, bool active)
+{
+    ui_widget_t *w = get_widget(id);
+    if (w == NULL) return;
+    w->active = active;
+}
+
+void ui_update(void)
+{
+    Vector2 dim = { GetScreenWidth(), GetScreenHeight() };
+    bool resized = dim.x != ui.screen_dim.x || dim.y != ui.screen_dim.y;
+    ui.screen_dim = dim;
+
+    Vector2 mouse = GetMousePosition();
+    bool down = IsMouseButtonDown(0);
+    bool pressed = IsMouseButtonPressed(0);
+
+    for (int i = 0; i < ui.widget_count; i++) {
+        ui_widget_t *w = &ui.widgets[i];
+        if (resized) w->dirty = true;
+        if (w->kind != UI_BUTTON) continue;
+
+        bool within_bounds = CheckCollisionPointRec(mouse, rec_screen_to_pixel(w->bounds));
+        w->pressed = within_bounds && down && w->active;
+        w->clicked = within_bounds && pressed;
+    }
+}
+
+bool ui_clicked(ui_id_t id)
+{
+    ui_widget_t *w = get_widget(id);
+    return w != NULL && w->clicked;
+}
+
+void ui_draw(void)
+{
+    if (ui.widget_count == 0) return;
+
+    for (int i = 0; i < ui.widget_count; i++) {
+        if (ui.widgets[i].dirty) rebuild_widget(i);
+    }
+
+    // Backgrounds go through the SDF shapes batch, one instanced quad per widget.
+    // Queueing them flushes anything drawn before through the immediate-mode batch.
+    for (int i = 0; i < ui.widget_count; i++) {
+        ui_widget_t *w = &ui.widgets[i];
+        Color bg = (w->kind == UI_BUTTON && w->active && w->pressed) ? w->bg_pressed : w->bg;
+        DrawRectangleRoundedSDF(rec_screen_to_pixel(w->bounds), w->roundness, bg);
+    }
+    rlDrawRenderBatchActive();
+
+    // Sets the SDF smoothing for FONT_SIZE, other text may have changed it
+    ui.shader = GetFontShader(ui.font, FONT_SIZE);
+    int *locs = ui.shader.locs;
+    float white[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+    int slot = 0;
+
+    rlEnableShader(ui.shader.id);
+    rlSetUniformMatrix(locs[SHADER_LOC_MATRIX_MVP], MatrixMultiply(rlGetMatrixModelview(), rlGetMatrixProjection()));
+    rlSetUniform(locs[SHADER_LOC_COLOR_DIFFUSE], white, SHADER_UNIFORM_VEC4, 1);
+    rlSetUniform(locs[SHADER_LOC_MAP_DIFFUSE], &slot, SHADER_UNIFORM_INT, 1);
+    rlActiveTextureSlot(0);
+    rlEnableTexture(ui.font.texture.id);
+
+    if (!rlEnableVertexArray(ui.vao)) {
+        rlEnableVertexBuffer(ui.vbo);
+        set_attributes();
+    }
+    rlDrawVertexArray(0, ui.widget_count*UI_WIDGET_VERTICES);
+
+    rlDisableVertexArray();
+    rlDisableVertexBuffer();
+    rlDisableTexture();
+    rlDisableShader();
+}
@@ -0,0 +1,32 @@
+#ifndef UI_H
+#define UI_H
+
+#include <stdbool.h>
+
+#include "raylib.h"
+
+// Retained-mode widgets for the control screen.
+// Backgrounds are drawn each frame as SDF rounded rectangles (one instanced quad
+// per widget). Labels keep their glyph quads in a single static vertex buffer,
+// the label of a widget is only rebuilt when the screen size changes and all
+// labels are drawn with one draw call.
+
+#define UI_MAX_WIDGETS 8
+
+typedef int ui_id_t;
+
+bool ui_init(Font font);
+void ui_shutdown(void);
+
+// Bounds are normalized to the screen size
+ui_id_t ui_panel_add(Rectangle bounds, float roundness, Color bg);
+ui_id_t ui_button_add(Rectangle bounds, const char *text, Color fg, Color bg);
+
+void ui_set_color(ui_id_t id, Color bg);
+void ui_set_active(ui_id_t id, bool active);
+
+void ui_update(void);
+bool ui_clicked(ui_id_t id);
+void ui_draw(void);
+
+#endif // UI_H
@@ -0,0 +1,87 @@
+/**********************************************************************************************
+*
+*   bench - Shared helpers for tools/bench harnesses
+*
+*   Timing uses the monotonic clock directly, so harnesses that do not call InitWindow()
+*   can measure too. Timings are reported as the median of repeated runs.
+*
+**********************************************************************************************/
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdio.h>              // Required for: printf(), snprintf()
+#include <stdlib.h>             // Required for: qsort(), getenv()
+#include <time.h>               // Required for: clock_gettime()
+#include <sys/stat.h>           // Required for: mkdir()
+
+#ifndef BENCH_RUNS
+    #define BENCH_RUNS      7       // Default runs per measurement, median reported
+#endif
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static int benchFailures = 0;       // Failed CHECK() count, harness exit code
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Check condition, failures are reported and counted (harness keeps running)
+#define CHECK(condition, ...) do { if (!(condition)) { benchFailures++; printf("FAIL %s:%i: ", __FILE__, __LINE__); printf(__VA_ARGS__); printf("\n"); } } while (0)
+
+// Get monotonic time in seconds
+static double BenchTime(void)
+{
+    struct timespec ts = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec + (double)ts.tv_nsec*1e-9;
+}
+
+static int BenchCompareTimes(const void *a, const void *b)
+{
+    double ta = *(const double *)a;
+    double tb = *(const double *)b;
+
+    return (ta > tb) - (ta < tb);
+}
+
+// Get median of timings (values are sorted)
+static double BenchMedian(double *values, int count)
+{
+    qsort(values, count, sizeof(double), BenchCompareTimes);
+
+    return (count%2 == 1)? values[count/2] : (values[count/2 - 1] + values[count/2])/2.0;
+}
+
+// Measure median time of a statement in milliseconds, over BENCH_RUNS runs of iterations
+#define BENCH_MS(iterations, statement) ({ \
+    double times_[BENCH_RUNS]; \
+    for (int run_ = 0; run_ < BENCH_RUNS; run_++) { \
+        double start_ = BenchTime(); \
+        for (int it_ = 0; it_ < (iterations); it_++) { statement; } \
+        times_[run_] = (BenchTime() - start_)*1000.0/(iterations); \
+    } \
+    BenchMedian(times_, BENCH_RUNS); })
+
+// Get path of a file in harness temporary directory ($TMPDIR/raylib_bench, created on first use)
+static const char *GetBenchTempPath(const char *fileName)
+{
+    static char path[4][512];
+    static int index = 0;
+    const char *tmp = getenv("TMPDIR");
+
+    if ((tmp == NULL) || (tmp[0] == '\0')) tmp = "/tmp";
+
+    char *result = path[index];
+    index = (index + 1)%4;
+
+    snprintf(result, 512, "%s/raylib_bench", tmp);
+    mkdir(result, 0755);
+    snprintf(result, 512, "%s/raylib_bench/%s", tmp, fileName);
+
+    return result;
+}
+
+#endif // BENCH_H
@@ -0,0 +1,195 @@
+/**********************************************************************************************
+*
+*   bench_asset_pack - Assets loading from loose files against asset packs (tools/rpak)
+*
+*   An assets directory is generated in a temporary directory (200 64x64 PNG icons,
+*   4 1024x1024 PNG backgrounds, 30 text files, 6 binary files) and packed with rpak:
+*     - store: -level 0, all files stored as is
+*     - deflate: default level, DEFLATE kept when it saves at least 10%
+*     - qoi: -qoi, images re-encoded as QOI
+*   Time: ms to load every file (LoadImage(), LoadFileText(), LoadFileData()), mount included,
+*   median of BENCH_RUNS, warm page cache. Size: pack file against loose files total.
+*   Checks: loaded pixels, text and data are the same from the loose files and every pack.
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+#include "bench.h"
+
+#include <stdlib.h>             // Required for: system(), rand()
+#include <string.h>             // Required for: strlen()
+#include <unistd.h>             // Required for: chdir()
+
+#ifndef RPAK_PATH
+    #define RPAK_PATH       "./build/rpak"
+#endif
+
+#define ICON_COUNT          200
+#define BACKGROUND_COUNT    4
+#define TEXT_COUNT          30
+#define BINARY_COUNT        6
+#define BINARY_SIZE         (400*1024)
+#define FILE_COUNT          (ICON_COUNT + BACKGROUND_COUNT + TEXT_COUNT + BINARY_COUNT)
+#define SOURCE_COUNT        4
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static char fileNames[FILE_COUNT][64] = { 0 };
+static double categoryTimes[3] = { 0 };         // Images, text and binary files load time (last run)
+
+static const char *sourceNames[SOURCE_COUNT] = { "loose files", "store pack", "deflate pack", "qoi pack" };
+static const char *packNames[SOURCE_COUNT] = { NULL, "../store.rpak", "../deflate.rpak", "../qoi.rpak" };
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Generate assets in current directory, file names are filled
+static void GenAssets(void)
+{
+    int index = 0;
+
+    for (int i = 0; i < ICON_COUNT; i++, index++)
+    {
+        Image image = GenImageGradientLinear(64, 64, i, (Color){ i, 50, 200, 255 }, (Color){ 255, i, 0, 128 });
+        ImageDrawCircle(&image, 32, 32, 10 + i%20, WHITE);
+        snprintf(fileNames[index], 64, "icons/icon%03i.png", i);
+        ExportImage(image, fileNames[index]);
+        UnloadImage(image);
+    }
+
+    for (int i = 0; i < BACKGROUND_COUNT; i++, index++)
+    {
+        Image image = GenImageGradientRadial(1024, 1024, 0.2f, (Color){ i*40, 80, 160, 255 }, BLACK);
+        ImageDrawRectangle(&image, 100 + i*10, 100, 300, 200, RED);
+        snprintf(fileNames[index], 64, "background%i.png", i);
+        ExportImage(image, fileNames[index]);
+        UnloadImage(image);
+    }
+
+    char *text = (char *)MemAlloc(20000);
+
+    for (int i = 0; i < TEXT_COUNT; i++, index++)
+    {
+        for (int k = 0, length = 0; length < 19900; k++) length += snprintf(text + length, 20000 - length, "line %i of config file %i: key_%i = value_%i\n", k, i, k%37, k*i);
+        snprintf(fileNames[index], 64, "text/config%02i.txt", i);
+        SaveFileText(fileNames[index], text);
+    }
+
+    MemFree(text);
+
+    // Binary data with font-like redundancy: offsets tables, small values and repeated records
+    unsigned char *data = (unsigned char *)MemAlloc(BINARY_SIZE);
+
+    srand(1);
+    for (int i = 0; i < BINARY_COUNT; i++, index++)
+    {
+        for (int k = 0; k < BINARY_SIZE; k++)
+        {
+            switch ((k/4096)%3)
+            {
+                case 0: data[k] = (unsigned char)((k%4 == 3)? k/4 : 0); break;
+                case 1: data[k] = (unsigned char)(rand()%16); break;
+                default: data[k] = (unsigned char)rand(); break;
+            }
+        }
+
+        snprintf(fileNames[index], 64, "data/data%i.bin", i);
+        SaveFileData(fileNames[index], data, BINARY_SIZE);
+    }
+
+    MemFree(data);
+}
+
+// Load every file, returns checksum of loaded pixels, text and data
+static unsigned long long LoadAssets(void)
+{
+    unsigned long long checksum = 0;
+
+    categoryTimes[0] = categoryTimes[1] = categoryTimes[2] = 0.0;
+
+    for (int i = 0; i < FILE_COUNT; i++)
+    {
+        double start = BenchTime();
+        int category = 0;
+
+        if (IsFileExtension(fileNames[i], ".png"))
+        {
+            Image image = LoadImage(fileNames[i]);
+            int size = GetPixelDataSize(image.width, image.height, image.format);
+            for (int k = 0; k < size; k++) checksum = checksum*31 + ((unsigned char *)image.data)[k];
+            UnloadImage(image);
+        }
+        else if (IsFileExtension(fileNames[i], ".txt"))
+        {
+            char *text = LoadFileText(fileNames[i]);
+            for (char *c = text; (c != NULL) && (*c != '\0'); c++) checksum = checksum*31 + *c;
+            UnloadFileText(text);
+            category = 1;
+        }
+        else
+        {
+            int size = 0;
+            unsigned char *data = LoadFileData(fileNames[i], &size);
+            for (int k = 0; k < size; k++) checksum = checksum*31 + data[k];
+            UnloadFileData(data);
+            category = 2;
+        }
+
+        categoryTimes[category] += (BenchTime() - start)*1000.0;
+    }
+
+    return checksum;
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    SetTraceLogLevel(LOG_WARNING);
+
+    const char *root = GetBenchTempPath("bench_pack");
+    system(TextFormat("rm -rf %s && mkdir -p %s/assets/icons %s/assets/text %s/assets/data", root, root, root, root));
+    CHECK(chdir(TextFormat("%s/assets", root)) == 0, "failed to create assets directory");
+
+    GenAssets();
+
+    CHECK(system(TextFormat("%s -level 0 ../store.rpak . > /dev/null", RPAK_PATH)) == 0, "rpak -level 0 failed (%s)", RPAK_PATH);
+    CHECK(system(TextFormat("%s ../deflate.rpak . > /dev/null", RPAK_PATH)) == 0, "rpak failed (%s)", RPAK_PATH);
+    CHECK(system(TextFormat("%s -qoi ../qoi.rpak . > /dev/null", RPAK_PATH)) == 0, "rpak -qoi failed (%s)", RPAK_PATH);
+
+    int looseSize = 0;
+    for (int i = 0; i < FILE_COUNT; i++) looseSize += GetFileLength(fileNames[i]);
+
+    printf("%i files, load time (mount included, median of %i) and size\n", FILE_COUNT, BENCH_RUNS);
+    printf("%-14s %9s %9s %9s %9s %9s\n", "", "total ms", "images", "text", "binary", "size KB");
+
+    unsigned long long looseChecksum = 0;
+
+    for (int s = 0; s < SOURCE_COUNT; s++)
+    {
+        double times[BENCH_RUNS] = { 0 };
+        unsigned long long checksum = 0;
+
+        for (int run = 0; run < BENCH_RUNS; run++)
+        {
+            double start = BenchTime();
+
+            if (packNames[s] != NULL) CHECK(MountAssetPack(packNames[s]), "%s: mount failed", packNames[s]);
+            checksum = LoadAssets();
+            times[run] = (BenchTime() - start)*1000.0;
+            if (packNames[s] != NULL) UnmountAssetPack(packNames[s]);
+        }
+
+        if (s == 0) looseChecksum = checksum;
+        else CHECK(checksum == looseChecksum, "%s: loaded data differs from loose files", sourceNames[s]);
+
+        int size = (packNames[s] != NULL)? GetFileLength(packNames[s]) : looseSize;
+
+        printf("%-14s %9.1f %9.1f %9.1f %9.1f %9i\n", sourceNames[s], BenchMedian(times, BENCH_RUNS),
+            categoryTimes[0], categoryTimes[1], categoryTimes[2], size/1024);
+    }
+
+    return (benchFailures == 0)? 0 : 1;
+}
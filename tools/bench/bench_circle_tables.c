@@ -0,0 +1,329 @@
+/**********************************************************************************************
+*
+*   bench_circle_tables - Circular shapes tessellation with cached unit circle tables
+*
+*   A UI-heavy frame (rounded buttons, status circles and progress rings) is drawn with the
+*   current rshapes functions and with the previous ones (sinf()/cosf() per vertex and
+*   acosf(2*powf()) segments selection, QUADS draw mode code kept below as reference).
+*   Reported: CPU time per frame and vertices submitted.
+*   Checks: with the same segments count, tessellated vertices stay within CIRCLE_TOLERANCE
+*   pixels of the previous ones (radius up to 400).
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+#include "rlgl.h"
+#include "bench.h"
+#include "capture.h"
+
+#include <math.h>               // Required for: sinf(), cosf(), acosf(), powf(), ceilf(), fabsf()
+
+#define FRAMES              500
+#define BUTTON_COUNT        64
+#define CIRCLE_COUNT        32
+#define RING_COUNT          16
+#define CIRCLE_TOLERANCE    0.002f      // Maximum vertex distance to previous tessellation (pixels)
+#define MAX_CAPTURE_VERTEX  (6*CAPTURE_BATCH_QUADS)
+
+#define SMOOTH_CIRCLE_ERROR_RATE    0.5f
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static CaptureVertex current[MAX_CAPTURE_VERTEX] = { 0 };
+static CaptureVertex previous[MAX_CAPTURE_VERTEX] = { 0 };
+static Texture2D texShapes = { 0 };             // Shapes texture, set for current and previous code
+static Rectangle texShapesRec = { 0 };
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: previous tessellation (QUADS draw mode)
+//----------------------------------------------------------------------------------
+static void DrawCircleSectorPrevious(Vector2 center, float radius, float startAngle, float endAngle, int segments, Color color)
+{
+    Texture2D tex = texShapes;
+    Rectangle rec = texShapesRec;
+
+    if (radius <= 0.0f) radius = 0.1f;
+    if (endAngle < startAngle) { float tmp = startAngle; startAngle = endAngle; endAngle = tmp; }
+
+    int minSegments = (int)ceilf((endAngle - startAngle)/90);
+
+    if (segments < minSegments)
+    {
+        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
+        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
+        if (segments <= 0) segments = minSegments;
+    }
+
+    float stepLength = (endAngle - startAngle)/(float)segments;
+    float angle = startAngle;
+
+    rlSetTexture(tex.id);
+    rlBegin(RL_QUADS);
+        for (int i = 0; i < segments/2; i++)
+        {
+            rlColor4ub(color.r, color.g, color.b, color.a);
+            rlTexCoord2f(rec.x/tex.width, rec.y/tex.height);
+            rlVertex2f(center.x, center.y);
+            rlTexCoord2f((rec.x + rec.width)/tex.width, rec.y/tex.height);
+            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength*2.0f))*radius, center.y + sinf(DEG2RAD*(angle + stepLength*2.0f))*radius);
+            rlTexCoord2f((rec.x + rec.width)/tex.width, (rec.y + rec.height)/tex.height);
+            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
+            rlTexCoord2f(rec.x/tex.width, (rec.y + rec.height)/tex.height);
+            rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
+            angle += (stepLength*2.0f);
+        }
+
+        if ((segments%2) == 1)
+        {
+            rlColor4ub(color.r, color.g, color.b, color.a);
+            rlTexCoord2f(rec.x/tex.width, rec.y/tex.height);
+            rlVertex2f(center.x, center.y);
+            rlTexCoord2f((rec.x + rec.width)/tex.width, (rec.y + rec.height)/tex.height);
+            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
+            rlTexCoord2f(rec.x/tex.width, (rec.y + rec.height)/tex.height);
+            rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
+            rlTexCoord2f((rec.x + rec.width)/tex.width, rec.y/tex.height);
+            rlVertex2f(center.x, center.y);
+        }
+    rlEnd();
+    rlSetTexture(0);
+}
+
+static void DrawRingPrevious(Vector2 center, float innerRadius, float outerRadius, float startAngle, float endAngle, int segments, Color color)
+{
+    Texture2D tex = texShapes;
+    Rectangle rec = texShapesRec;
+
+    if (startAngle == endAngle) return;
+    if (endAngle < startAngle) { float tmp = startAngle; startAngle = endAngle; endAngle = tmp; }
+
+    int minSegments = (int)ceilf((endAngle - startAngle)/90);
+
+    if (segments < minSegments)
+    {
+        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/outerRadius, 2) - 1);
+        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
+        if (segments <= 0) segments = minSegments;
+    }
+
+    float stepLength = (endAngle - startAngle)/(float)segments;
+    float angle = startAngle;
+
+    rlSetTexture(tex.id);
+    rlBegin(RL_QUADS);
+        for (int i = 0; i < segments; i++)
+        {
+            rlColor4ub(color.r, color.g, color.b, color.a);
+            rlTexCoord2f(rec.x/tex.width, (rec.y + rec.height)/tex.height);
+            rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
+            rlTexCoord2f(rec.x/tex.width, rec.y/tex.height);
+            rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
+            rlTexCoord2f((rec.x + rec.width)/tex.width, rec.y/tex.height);
+            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
+            rlTexCoord2f((rec.x + rec.width)/tex.width, (rec.y + rec.height)/tex.height);
+            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*outerRadius);
+            angle += stepLength;
+        }
+    rlEnd();
+    rlSetTexture(0);
+}
+
+static void DrawRectangleRoundedPrevious(Rectangle rec, float roundness, int segments, Color color)
+{
+    Texture2D tex = texShapes;
+    Rectangle texRec = texShapesRec;
+
+    if (roundness >= 1.0f) roundness = 1.0f;
+
+    float radius = (rec.width > rec.height)? (rec.height*roundness)/2 : (rec.width*roundness)/2;
+    if (radius <= 0.0f) return;
+
+    if (segments < 4)
+    {
+        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
+        segments = (int)(ceilf(2*PI/th)/4.0f);
+        if (segments <= 0) segments = 4;
+    }
+
+    float stepLength = 90.0f/(float)segments;
+
+    const Vector2 point[12] = {
+        { rec.x + radius, rec.y }, { (rec.x + rec.width) - radius, rec.y }, { rec.x + rec.width, rec.y + radius },
+        { rec.x + rec.width, (rec.y + rec.height) - radius }, { (rec.x + rec.width) - radius, rec.y + rec.height },
+        { rec.x + radius, rec.y + rec.height }, { rec.x, (rec.y + rec.height) - radius }, { rec.x, rec.y + radius },
+        { rec.x + radius, rec.y + radius }, { (rec.x + rec.width) - radius, rec.y + radius },
+        { (rec.x + rec.width) - radius, (rec.y + rec.height) - radius }, { rec.x + radius, (rec.y + rec.height) - radius }
+    };
+
+    const Vector2 centers[4] = { point[8], point[9], point[10], point[11] };
+    const float angles[4] = { 180.0f, 270.0f, 0.0f, 90.0f };
+    const int quads[5][4] = { { 0, 8, 9, 1 }, { 2, 9, 10, 3 }, { 11, 5, 4, 10 }, { 7, 6, 11, 8 }, { 8, 11, 10, 9 } };
+
+    rlSetTexture(tex.id);
+    rlBegin(RL_QUADS);
+        for (int k = 0; k < 4; ++k)
+        {
+            float angle = angles[k];
+            const Vector2 center = centers[k];
+
+            for (int i = 0; i < segments/2; i++)
+            {
+                rlColor4ub(color.r, color.g, color.b, color.a);
+                rlTexCoord2f(texRec.x/tex.width, texRec.y/tex.height);
+                rlVertex2f(center.x, center.y);
+                rlTexCoord2f((texRec.x + texRec.width)/tex.width, texRec.y/tex.height);
+                rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength*2))*radius, center.y + sinf(DEG2RAD*(angle + stepLength*2))*radius);
+                rlTexCoord2f((texRec.x + texRec.width)/tex.width, (texRec.y + texRec.height)/tex.height);
+                rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
+                rlTexCoord2f(texRec.x/tex.width, (texRec.y + texRec.height)/tex.height);
+                rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
+                angle += (stepLength*2);
+            }
+
+            if (segments%2)
+            {
+                rlColor4ub(color.r, color.g, color.b, color.a);
+                rlTexCoord2f(texRec.x/tex.width, texRec.y/tex.height);
+                rlVertex2f(center.x, center.y);
+                rlTexCoord2f((texRec.x + texRec.width)/tex.width, (texRec.y + texRec.height)/tex.height);
+                rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
+                rlTexCoord2f(texRec.x/tex.width, (texRec.y + texRec.height)/tex.height);
+                rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
+                rlTexCoord2f((texRec.x + texRec.width)/tex.width, texRec.y/tex.height);
+                rlVertex2f(center.x, center.y);
+            }
+        }
+
+        // Upper, right, bottom, left and middle rectangles
+        for (int q = 0; q < 5; q++)
+        {
+            rlColor4ub(color.r, color.g, color.b, color.a);
+            rlTexCoord2f(texRec.x/tex.width, texRec.y/tex.height);
+            rlVertex2f(point[quads[q][0]].x, point[quads[q][0]].y);
+            rlTexCoord2f(texRec.x/tex.width, (texRec.y + texRec.height)/tex.height);
+            rlVertex2f(point[quads[q][1]].x, point[quads[q][1]].y);
+            rlTexCoord2f((texRec.x + texRec.width)/tex.width, (texRec.y + texRec.height)/tex.height);
+            rlVertex2f(point[quads[q][2]].x, point[quads[q][2]].y);
+            rlTexCoord2f((texRec.x + texRec.width)/tex.width, texRec.y/tex.height);
+            rlVertex2f(point[quads[q][3]].x, point[quads[q][3]].y);
+        }
+    rlEnd();
+    rlSetTexture(0);
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+static void DrawScene(bool previousCode)
+{
+    for (int i = 0; i < BUTTON_COUNT; i++)
+    {
+        Rectangle rec = { 20.0f + (i%4)*260.0f, 40.0f + (i/4)*130.0f, 240.0f, 110.0f };
+
+        if (previousCode) DrawRectangleRoundedPrevious(rec, 0.4f, 0, (Color){ 40, 40, 60, 255 });
+        else DrawRectangleRounded(rec, 0.4f, 0, (Color){ 40, 40, 60, 255 });
+    }
+
+    for (int i = 0; i < CIRCLE_COUNT; i++)
+    {
+        Vector2 center = { 60.0f + (i%8)*130.0f, 2150.0f + (i/8)*40.0f };
+
+        if (previousCode) DrawCircleSectorPrevious(center, 16.0f, 0, 360, 36, SKYBLUE);
+        else DrawCircleV(center, 16.0f, SKYBLUE);
+    }
+
+    for (int i = 0; i < RING_COUNT; i++)
+    {
+        Vector2 center = { 100.0f + (i%8)*120.0f, 1200.0f + (i/8)*200.0f };
+
+        if (previousCode) DrawRingPrevious(center, 30.0f, 50.0f, -90.0f, -90.0f + 22.5f*i, 0, ORANGE);
+        else DrawRing(center, 30.0f, 50.0f, -90.0f, -90.0f + 22.5f*i, 0, ORANGE);
+    }
+}
+
+// Get maximum distance from any vertex in a to the closest vertex in b
+static float GetMaxVertexDistance(const CaptureVertex *a, int countA, const CaptureVertex *b, int countB)
+{
+    float maxDistance = (countB == 0)? 1e9f : 0.0f;
+
+    for (int i = 0; i < countA; i++)
+    {
+        float minDistance = 1e9f;
+        for (int j = 0; j < countB; j++)
+        {
+            float distance = fmaxf(fabsf(a[i].x - b[j].x), fabsf(a[i].y - b[j].y));
+            if (distance < minDistance) minDistance = distance;
+        }
+
+        if (minDistance > maxDistance) maxDistance = minDistance;
+    }
+
+    return maxDistance;
+}
+
+// Compare current and previous tessellation of a shape, same segments count
+static float CheckShape(int shape, float radius, int segments)
+{
+    Vector2 center = { 500.0f, 500.0f };
+    Rectangle rec = { 100.0f, 100.0f, 2*radius + 40.0f, 2*radius };
+    float startAngle = (float)(segments*7%90);
+
+    BeginCapture();
+    if (shape == 0) DrawCircleSector(center, radius, startAngle, startAngle + 250.0f, segments, WHITE);
+    else if (shape == 1) DrawRing(center, radius*0.5f, radius, startAngle, startAngle + 300.0f, segments, WHITE);
+    else DrawRectangleRounded(rec, 1.0f, segments, WHITE);
+    int currentCount = EndCapture(current, MAX_CAPTURE_VERTEX);
+
+    BeginCapture();
+    if (shape == 0) DrawCircleSectorPrevious(center, radius, startAngle, startAngle + 250.0f, segments, WHITE);
+    else if (shape == 1) DrawRingPrevious(center, radius*0.5f, radius, startAngle, startAngle + 300.0f, segments, WHITE);
+    else DrawRectangleRoundedPrevious(rec, 1.0f, segments, WHITE);
+    int previousCount = EndCapture(previous, MAX_CAPTURE_VERTEX);
+
+    return fmaxf(GetMaxVertexDistance(current, currentCount, previous, previousCount), GetMaxVertexDistance(previous, previousCount, current, currentCount));
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    SetTraceLogLevel(LOG_WARNING);
+    InitWindow(0, 0, "bench_circle_tables");
+
+    Image white = GenImageColor(4, 4, WHITE);
+    texShapes = LoadTextureFromImage(white);
+    texShapesRec = (Rectangle){ 1.0f, 1.0f, 2.0f, 2.0f };
+    SetShapesTexture(texShapes, texShapesRec);
+    UnloadImage(white);
+
+    static const char *shapeNames[3] = { "DrawCircleSector()", "DrawRing()", "DrawRectangleRounded()" };
+
+    for (int shape = 0; shape < 3; shape++)
+    {
+        float maxDistance = 0.0f;
+
+        for (float radius = 1.0f; radius <= 400.0f; radius += 13.3f)
+        {
+            for (int segments = 4; segments <= 64; segments += 5) maxDistance = fmaxf(maxDistance, CheckShape(shape, radius, segments));
+        }
+
+        CHECK(maxDistance <= CIRCLE_TOLERANCE, "%s: vertices %f pixels away from previous tessellation", shapeNames[shape], maxDistance);
+        printf("%-24s max vertex distance to previous tessellation %.5f px\n", shapeNames[shape], maxDistance);
+    }
+
+    printf("UI frame: %i rounded buttons, %i circles, %i progress rings\n", BUTTON_COUNT, CIRCLE_COUNT, RING_COUNT);
+
+    double before = BENCH_MS(FRAMES, BeginDrawing(); DrawScene(true); EndDrawing());
+    int beforeVertices = rlGetRenderStats().vertices;
+    double after = BENCH_MS(FRAMES, BeginDrawing(); DrawScene(false); EndDrawing());
+    int afterVertices = rlGetRenderStats().vertices;
+
+    printf("previous %8.4f ms/frame (%i vertices)   tables %8.4f ms/frame (%i vertices)   x%.2f\n", before, beforeVertices, after, afterVertices, before/after);
+
+    UnloadTexture(texShapes);
+    CloseWindow();
+
+    return (benchFailures == 0)? 0 : 1;
+}
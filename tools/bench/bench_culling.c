@@ -0,0 +1,96 @@
+/**********************************************************************************************
+*
+*   bench_culling - Off-screen 2d shapes and text culling stress scene
+*
+*   A long scrolling list (rounded card, outline, text label, sector icon and bezier arrow per
+*   row) is drawn through a Camera2D with most rows off-screen. Reported: CPU time per frame,
+*   vertices and culled primitives (rlGetRenderStats()) for:
+*     - scrolled list: all rows drawn, off-screen rows culled before tessellation
+*     - visible rows only: rows selected by the application, best case for culling
+*     - zoomed out list: all rows on screen, nothing culled (cost without culling)
+*   Checks: off-screen rows are culled, on-screen rows vertices are all submitted.
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+#include "rlgl.h"
+#include "bench.h"
+
+#define FRAMES              50
+#define ROW_COUNT           2000
+#define ROW_HEIGHT          120.0f
+#define ROW_PRIMITIVES      5           // Culled primitives per row (card, outline, label, icon, arrow)
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static char labels[ROW_COUNT][32] = { 0 };
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+static void DrawRow(int row)
+{
+    float y = row*ROW_HEIGHT;
+    Rectangle card = { 20.0f, y + 10.0f, GetScreenWidth() - 40.0f, ROW_HEIGHT - 20.0f };
+
+    DrawRectangleRounded(card, 0.3f, 0, (Color){ 40, 40, 60, 255 });
+    DrawRectangleRoundedLines(card, 0.3f, 0, 2.0f, GRAY);
+    DrawTextEx(GetFontDefault(), labels[row], (Vector2){ 140.0f, y + 40.0f }, 40.0f, 4.0f, RAYWHITE);
+    DrawCircleSector((Vector2){ 80.0f, y + ROW_HEIGHT/2 }, 35.0f, 0.0f, 40.0f*(row%9), 0, SKYBLUE);
+    DrawSplineSegmentBezierCubic((Vector2){ card.width - 160.0f, y + 60.0f }, (Vector2){ card.width - 100.0f, y + 20.0f },
+                                 (Vector2){ card.width - 60.0f, y + 100.0f }, (Vector2){ card.width, y + 60.0f }, 4.0f, ORANGE);
+}
+
+// Draw list rows [first, last] through camera, returns frame stats
+static rlRenderStats RunFrames(const char *name, Camera2D camera, int first, int last)
+{
+    double ms = BENCH_MS(FRAMES,
+        BeginDrawing();
+        ClearBackground(BLACK);
+        BeginMode2D(camera);
+        for (int row = first; row <= last; row++) DrawRow(row);
+        EndMode2D();
+        EndDrawing());
+
+    rlRenderStats stats = rlGetRenderStats();
+    printf("%-20s %8.3f ms/frame   %7i vertices   %5i culled   (%i rows drawn)\n", name, ms, stats.vertices, stats.culled, last - first + 1);
+
+    return stats;
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    SetTraceLogLevel(LOG_WARNING);
+    InitWindow(0, 0, "bench_culling");
+
+    for (int i = 0; i < ROW_COUNT; i++) snprintf(labels[i], 32, "Item %04i - settings", i);
+
+    // Scrolled to middle of list, rows [firstVisible, lastVisible] overlap the screen
+    Camera2D camera = { .target = (Vector2){ 0.0f, ROW_COUNT*ROW_HEIGHT/2 }, .zoom = 1.0f };
+    int firstVisible = (int)(camera.target.y/ROW_HEIGHT);
+    int lastVisible = (int)((camera.target.y + GetScreenHeight())/ROW_HEIGHT);
+    int offscreenRows = ROW_COUNT - (lastVisible - firstVisible + 1);
+
+    printf("%i rows, %i visible (%i primitives per row)\n", ROW_COUNT, lastVisible - firstVisible + 1, ROW_PRIMITIVES);
+
+    rlRenderStats scrolled = RunFrames("scrolled list", camera, 0, ROW_COUNT - 1);
+    rlRenderStats visible = RunFrames("visible rows only", camera, firstVisible, lastVisible);
+
+    // NOTE: Rows just outside the screen can be kept (conservative bounds), one row each side
+    CHECK(scrolled.culled >= (offscreenRows - 2)*ROW_PRIMITIVES, "scrolled: %i primitives culled, %i rows off-screen", scrolled.culled, offscreenRows);
+    CHECK(scrolled.culled <= offscreenRows*ROW_PRIMITIVES, "scrolled: %i primitives culled, more than off-screen ones", scrolled.culled);
+    CHECK(scrolled.vertices >= visible.vertices, "scrolled: %i vertices, visible rows alone submit %i", scrolled.vertices, visible.vertices);
+    CHECK(visible.culled == 0, "visible rows: %i primitives culled", visible.culled);
+
+    Camera2D zoomed = { .target = (Vector2){ 0.0f, 0.0f }, .zoom = GetScreenHeight()/(ROW_COUNT*ROW_HEIGHT) };
+    rlRenderStats all = RunFrames("zoomed out list", zoomed, 0, ROW_COUNT - 1);
+    CHECK(all.culled == 0, "zoomed out: %i primitives culled, all rows are on screen", all.culled);
+
+    CloseWindow();
+
+    return (benchFailures == 0)? 0 : 1;
+}
@@ -0,0 +1,219 @@
+/**********************************************************************************************
+*
+*   bench_feather - Feathered lines and splines anti-aliasing against aliased and MSAA 4x
+*
+*   Lines and splines geometry is captured (capture.h) and rasterized on the CPU into a small
+*   coverage target, error is the mean per-pixel coverage difference against a 16x16
+*   supersampled reference of the hard-edged geometry (touched pixels only):
+*     - aliased: hard-edged geometry, one sample per pixel (MSAA off)
+*     - msaa 4x: hard-edged geometry, 2x2 ordered samples per pixel
+*     - feathered: SetShapesFeather(1.0f) geometry, one sample, vertex alpha blended
+*   Frame time: CPU time to tessellate a frame of lines and splines, hard-edged and feathered.
+*   Checks: feathered error is below aliased error, feathered triangles are front facing.
+*
+*   NOTE: MSAA cost is on the GPU side (multisampled buffers and resolve), not measured here
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+#include "rlgl.h"
+#include "bench.h"
+#include "capture.h"
+
+#include <string.h>             // Required for: memset(), memcpy()
+#include <math.h>               // Required for: floorf(), ceilf(), fabs()
+
+#define TARGET_WIDTH        160
+#define TARGET_HEIGHT       120
+#define REFERENCE_SAMPLES   16          // Reference samples per pixel side
+#define FEATHER_WIDTH       1.0f
+#define FRAMES              200
+#define FRAME_SCENES        100         // Scenes drawn per measured frame
+#define MAX_CAPTURE_VERTEX  (6*CAPTURE_BATCH_QUADS)
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static CaptureVertex vertices[MAX_CAPTURE_VERTEX] = { 0 };
+static int vertexCount = 0;
+static float coverage[TARGET_HEIGHT][TARGET_WIDTH] = { 0 };
+static float reference[TARGET_HEIGHT][TARGET_WIDTH] = { 0 };
+static unsigned char hits[TARGET_HEIGHT][TARGET_WIDTH][REFERENCE_SAMPLES*REFERENCE_SAMPLES] = { 0 };
+
+static const char *sceneNames[4] = { "DrawLineEx()", "DrawSplineLinear()", "DrawSplineCatmullRom()", "DrawSplineBezierCubic()" };
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+static void DrawScene(int scene)
+{
+    Vector2 linear[5] = { { 10, 100 }, { 40, 20 }, { 70, 90 }, { 100, 30 }, { 150, 60 } };
+    Vector2 catmullRom[7] = { { 0, 60 }, { 10, 100 }, { 50, 15 }, { 90, 100 }, { 130, 20 }, { 150, 80 }, { 160, 60 } };
+    Vector2 bezier[7] = { { 10, 60 }, { 40, 0 }, { 60, 120 }, { 80, 60 }, { 100, 0 }, { 130, 120 }, { 150, 60 } };
+
+    switch (scene)
+    {
+        case 0:
+        {
+            DrawLineEx((Vector2){ 12.3f, 8.7f }, (Vector2){ 147.1f, 103.2f }, 3.0f, RED);
+            DrawLineEx((Vector2){ 10.0f, 110.0f }, (Vector2){ 150.0f, 95.0f }, 1.5f, RED);
+        } break;
+        case 1: DrawSplineLinear(linear, 5, 4.0f, RED); break;
+        case 2: DrawSplineCatmullRom(catmullRom, 7, 3.0f, RED); break;
+        case 3: DrawSplineBezierCubic(bezier, 7, 2.5f, RED); break;
+        default: break;
+    }
+}
+
+static void CaptureScene(int scene, float feather)
+{
+    SetShapesFeather(feather);
+    BeginCapture();
+    DrawScene(scene);
+    vertexCount = EndCapture(vertices, MAX_CAPTURE_VERTEX);
+    SetShapesFeather(0.0f);
+}
+
+// Rasterize captured triangles: hard-edged with samples*samples ordered samples per pixel
+// (union of triangles), or with one sample per pixel and interpolated alpha blended
+static void Rasterize(int samples, bool blend)
+{
+    memset(coverage, 0, sizeof(coverage));
+    if (!blend) memset(hits, 0, sizeof(hits));
+
+    for (int t = 0; (t + 2) < vertexCount; t += 3)
+    {
+        CaptureVertex a = vertices[t], b = vertices[t + 1], c = vertices[t + 2];
+        float area = (b.x - a.x)*(c.y - a.y) - (b.y - a.y)*(c.x - a.x);
+
+        if (fabsf(area) < 1e-9f) continue;
+
+        int x0 = (int)fmaxf(floorf(fminf(a.x, fminf(b.x, c.x))), 0.0f);
+        int y0 = (int)fmaxf(floorf(fminf(a.y, fminf(b.y, c.y))), 0.0f);
+        int x1 = (int)fminf(ceilf(fmaxf(a.x, fmaxf(b.x, c.x))), TARGET_WIDTH);
+        int y1 = (int)fminf(ceilf(fmaxf(a.y, fmaxf(b.y, c.y))), TARGET_HEIGHT);
+
+        for (int y = y0; y < y1; y++)
+        {
+            for (int x = x0; x < x1; x++)
+            {
+                for (int s = 0; s < samples*samples; s++)
+                {
+                    float px = x + (s%samples + 0.5f)/samples;
+                    float py = y + (s/samples + 0.5f)/samples;
+                    float w0 = ((b.x - px)*(c.y - py) - (b.y - py)*(c.x - px))/area;
+                    float w1 = ((c.x - px)*(a.y - py) - (c.y - py)*(a.x - px))/area;
+                    float w2 = 1.0f - w0 - w1;
+
+                    if ((w0 < 0.0f) || (w1 < 0.0f) || (w2 < 0.0f)) continue;
+
+                    if (blend)
+                    {
+                        float alpha = w0*a.alpha + w1*b.alpha + w2*c.alpha;
+                        coverage[y][x] = alpha + coverage[y][x]*(1.0f - alpha);
+                    }
+                    else hits[y][x][s] = 1;
+                }
+            }
+        }
+    }
+
+    if (!blend)
+    {
+        for (int y = 0; y < TARGET_HEIGHT; y++)
+        {
+            for (int x = 0; x < TARGET_WIDTH; x++)
+            {
+                int count = 0;
+                for (int s = 0; s < samples*samples; s++) count += hits[y][x][s];
+                coverage[y][x] = (float)count/(samples*samples);
+            }
+        }
+    }
+}
+
+// Get mean coverage error against reference, pixels touched by any of both
+static double GetCoverageError(void)
+{
+    double error = 0.0;
+    int count = 0;
+
+    for (int y = 0; y < TARGET_HEIGHT; y++)
+    {
+        for (int x = 0; x < TARGET_WIDTH; x++)
+        {
+            if ((reference[y][x] > 0.0f) || (coverage[y][x] > 0.0f))
+            {
+                error += fabs(coverage[y][x] - reference[y][x]);
+                count++;
+            }
+        }
+    }
+
+    return (count > 0)? error/count : 0.0;
+}
+
+// Get number of back facing triangles (counter-clockwise on screen, y down)
+static int GetBackFacingCount(void)
+{
+    int count = 0;
+
+    for (int t = 0; (t + 2) < vertexCount; t += 3)
+    {
+        CaptureVertex a = vertices[t], b = vertices[t + 1], c = vertices[t + 2];
+        if (((b.x - a.x)*(c.y - a.y) - (b.y - a.y)*(c.x - a.x)) > 0.0f) count++;
+    }
+
+    return count;
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    SetTraceLogLevel(LOG_WARNING);
+    InitWindow(0, 0, "bench_feather");
+
+    printf("%-24s  mean coverage error vs %ix%i supersampled (%ix%i target)\n", "", REFERENCE_SAMPLES, REFERENCE_SAMPLES, TARGET_WIDTH, TARGET_HEIGHT);
+    printf("%-24s %9s %9s %9s   %s\n", "", "aliased", "msaa 4x", "feathered", "vertices (hard/feathered)");
+
+    for (int scene = 0; scene < 4; scene++)
+    {
+        CaptureScene(scene, 0.0f);
+        int hardVertices = vertexCount;
+        Rasterize(REFERENCE_SAMPLES, false);
+        memcpy(reference, coverage, sizeof(reference));
+
+        Rasterize(1, false);
+        double aliased = GetCoverageError();
+        Rasterize(2, false);
+        double msaa = GetCoverageError();
+
+        CaptureScene(scene, FEATHER_WIDTH);
+        Rasterize(1, true);
+        double feathered = GetCoverageError();
+        int backFacing = GetBackFacingCount();
+
+        printf("%-24s %9.4f %9.4f %9.4f   %i/%i\n", sceneNames[scene], aliased, msaa, feathered, hardVertices, vertexCount);
+
+        CHECK(feathered < aliased, "%s: feathered error %.4f not below aliased %.4f", sceneNames[scene], feathered, aliased);
+        CHECK(backFacing == 0, "%s: %i feathered triangles back facing", sceneNames[scene], backFacing);
+    }
+
+    // CPU frame time, all scenes drawn FRAME_SCENES times per frame
+    double hard = BENCH_MS(FRAMES, BeginDrawing(); for (int i = 0; i < FRAME_SCENES; i++) DrawScene(i%4); EndDrawing());
+    SetShapesFeather(FEATHER_WIDTH);
+    double feather = BENCH_MS(FRAMES, BeginDrawing(); for (int i = 0; i < FRAME_SCENES; i++) DrawScene(i%4); EndDrawing());
+    SetShapesFeather(0.0f);
+
+    printf("frame (%i lines/splines draws): hard-edged %.3f ms   feathered %.3f ms (CPU)\n", FRAME_SCENES, hard, feather);
+
+    // MSAA 4x multisampled color (RGBA8) and depth (24/8) buffers, not needed with feathering
+    float msaaMegabytes = GetScreenWidth()*GetScreenHeight()*4*(4 + 4)/(1024.0f*1024.0f);
+    printf("msaa 4x at %ix%i: %.1f MB of multisampled buffers (GPU side, not measured)\n", GetScreenWidth(), GetScreenHeight(), msaaMegabytes);
+
+    CloseWindow();
+
+    return (benchFailures == 0)? 0 : 1;
+}
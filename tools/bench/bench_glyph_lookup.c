@@ -0,0 +1,97 @@
+/**********************************************************************************************
+*
+*   bench_glyph_lookup - Font glyphs lookup index against linear search
+*
+*   BMFont files are generated with 95 glyphs (printable ASCII) and 20000 glyphs (ASCII plus
+*   CJK ideographs), loaded with LoadFont() so the lookup index is built as for any font.
+*   The same font without index (glyphLookup = NULL) takes the linear search, as before.
+*   Reported: GetGlyphIndex() nanoseconds per lookup and MeasureTextEx() microseconds per
+*   string, indexed results are checked against linear search ones.
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+#include "bench.h"
+
+#define TEXT_LENGTH         1000            // Codepoints per measured string
+#define CJK_FIRST           0x4e00          // First CJK unified ideograph
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Generate BMFont file with printable ASCII and (glyphCount - 95) CJK glyphs, 8x8 pixels each
+static const char *GenBMFont(int glyphCount)
+{
+    const char *imageName = GetBenchTempPath("glyphs.png");
+    Image atlas = GenImageChecked(256, 256, 8, 8, WHITE, BLANK);
+    ExportImage(atlas, imageName);
+    UnloadImage(atlas);
+
+    const char *fileName = GetBenchTempPath(TextFormat("glyphs%i.fnt", glyphCount));
+    FILE *file = fopen(fileName, "wt");
+
+    fprintf(file, "info face=\"bench\" size=8\ncommon lineHeight=8 base=7 scaleW=256 scaleH=256 pages=1\n");
+    fprintf(file, "page id=0 file=\"glyphs.png\"\nchars count=%i\n", glyphCount);
+
+    for (int i = 0; i < glyphCount; i++)
+    {
+        int codepoint = (i < 95)? 32 + i : CJK_FIRST + (i - 95);
+        fprintf(file, "char id=%i x=%i y=%i width=8 height=8 xoffset=0 yoffset=0 xadvance=%i page=0\n", codepoint, (i%32)*8, ((i/32)%32)*8, 6 + i%3);
+    }
+
+    fclose(file);
+
+    return fileName;
+}
+
+static void RunFont(const char *name, int glyphCount)
+{
+    Font font = LoadFont(GenBMFont(glyphCount));
+    Font linear = font;
+    linear.glyphLookup = NULL;
+
+    CHECK(font.glyphCount == glyphCount, "%s: loaded %i glyphs, expected %i", name, font.glyphCount, glyphCount);
+
+    // Text codepoints: ASCII only for 95 glyphs font, mostly CJK (some not in font) for bigger one
+    static int codepoints[TEXT_LENGTH] = { 0 };
+    for (int i = 0; i < TEXT_LENGTH; i++)
+    {
+        if ((glyphCount <= 95) || (i%5 == 0)) codepoints[i] = GetRandomValue(32, 126);
+        else codepoints[i] = CJK_FIRST + GetRandomValue(0, glyphCount - 95 + 200);
+    }
+
+    char *text = LoadUTF8(codepoints, TEXT_LENGTH);
+
+    int mismatches = 0;
+    for (int i = 0; i < TEXT_LENGTH; i++) if (GetGlyphIndex(font, codepoints[i]) != GetGlyphIndex(linear, codepoints[i])) mismatches++;
+    CHECK(mismatches == 0, "%s: %i lookups differ from linear search", name, mismatches);
+
+    static volatile int sink = 0;
+    double before = BENCH_MS(20, for (int i = 0; i < TEXT_LENGTH; i++) sink += GetGlyphIndex(linear, codepoints[i]));
+    double after = BENCH_MS(2000, for (int i = 0; i < TEXT_LENGTH; i++) sink += GetGlyphIndex(font, codepoints[i]));
+    printf("%-14s GetGlyphIndex()   linear %10.2f ns   indexed %6.2f ns   x%.0f\n", name, before*1e6/TEXT_LENGTH, after*1e6/TEXT_LENGTH, before/after);
+
+    before = BENCH_MS(20, sink += (int)MeasureTextEx(linear, text, 16.0f, 1.0f).x);
+    after = BENCH_MS(2000, sink += (int)MeasureTextEx(font, text, 16.0f, 1.0f).x);
+    printf("%-14s MeasureTextEx()   linear %10.2f us   indexed %6.2f us   x%.0f (%i codepoints)\n", name, before*1000.0, after*1000.0, before/after, TEXT_LENGTH);
+
+    UnloadUTF8(text);
+    UnloadFont(font);
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    SetTraceLogLevel(LOG_WARNING);
+    SetRandomSeed(1);
+    InitWindow(0, 0, "bench_glyph_lookup");
+
+    RunFont("95 glyphs", 95);
+    RunFont("20000 glyphs", 20000);
+
+    CloseWindow();
+
+    return (benchFailures == 0)? 0 : 1;
+}
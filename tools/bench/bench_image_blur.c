@@ -0,0 +1,279 @@
+/**********************************************************************************************
+*
+*   bench_image_blur - ImageBlurGaussian() fixed-point passes against the previous float blur
+*
+*   The previous ImageBlurGaussian() (image converted to a float color array, box passes in
+*   float, rows then columns per iteration) is ported below as ImageBlurGaussianPrevious().
+*   Time: ms per blur of random RGBA8 images, over image sizes and blur radii.
+*   Checks: opaque images stay within 2 LSB of a double precision reference of the same filter
+*   (GAUSSIAN_BLUR_ITERATIONS symmetric box passes per axis, window clamped at borders).
+*
+*   NOTE: Host timings use the threads available to the process, see bench_image_threads
+*
+**********************************************************************************************/
+
+#define BENCH_RUNS      3           // Previous blurs are slow, fewer runs per size
+
+#include "raylib.h"
+#include "bench.h"
+
+#include <stdlib.h>             // Required for: malloc(), free(), rand(), abs()
+#include <math.h>               // Required for: lround()
+
+#define BLUR_ITERATIONS     4           // Same as GAUSSIAN_BLUR_ITERATIONS
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Previous ImageBlurGaussian(), RGBA8 images only
+static void ImageBlurGaussianPrevious(Image *image, int blurSize)
+{
+    int width = image->width;
+    int height = image->height;
+    Color *pixels = (Color *)image->data;
+
+    // Previous ImageAlphaPremultiply()
+    for (int i = 0; i < width*height; i++)
+    {
+        if (pixels[i].a == 0) pixels[i] = (Color){ 0, 0, 0, 0 };
+        else if (pixels[i].a < 255)
+        {
+            float alpha = (float)pixels[i].a/255.0f;
+            pixels[i].r = (unsigned char)((float)pixels[i].r*alpha);
+            pixels[i].g = (unsigned char)((float)pixels[i].g*alpha);
+            pixels[i].b = (unsigned char)((float)pixels[i].b*alpha);
+        }
+    }
+
+    Vector4 *pixelsCopy1 = (Vector4 *)malloc((size_t)width*height*sizeof(Vector4));
+    Vector4 *pixelsCopy2 = (Vector4 *)malloc((size_t)width*height*sizeof(Vector4));
+
+    for (int i = 0; i < width*height; i++) pixelsCopy1[i] = (Vector4){ pixels[i].r, pixels[i].g, pixels[i].b, pixels[i].a };
+
+    for (int j = 0; j < BLUR_ITERATIONS; j++)
+    {
+        // Horizontal motion blur
+        for (int row = 0; row < height; row++)
+        {
+            Vector4 sum = { 0 };
+            int convolutionSize = blurSize + 1;
+
+            for (int i = 0; i < blurSize + 1; i++)
+            {
+                Vector4 p = pixelsCopy1[row*width + i];
+                sum.x += p.x; sum.y += p.y; sum.z += p.z; sum.w += p.w;
+            }
+
+            pixelsCopy2[row*width] = (Vector4){ sum.x/convolutionSize, sum.y/convolutionSize, sum.z/convolutionSize, sum.w/convolutionSize };
+
+            for (int x = 1; x < width; x++)
+            {
+                if (x - blurSize >= 0)
+                {
+                    Vector4 p = pixelsCopy1[row*width + x - blurSize];
+                    sum.x -= p.x; sum.y -= p.y; sum.z -= p.z; sum.w -= p.w;
+                    convolutionSize--;
+                }
+
+                if (x + blurSize < width)
+                {
+                    Vector4 p = pixelsCopy1[row*width + x + blurSize];
+                    sum.x += p.x; sum.y += p.y; sum.z += p.z; sum.w += p.w;
+                    convolutionSize++;
+                }
+
+                pixelsCopy2[row*width + x] = (Vector4){ sum.x/convolutionSize, sum.y/convolutionSize, sum.z/convolutionSize, sum.w/convolutionSize };
+            }
+        }
+
+        // Vertical motion blur
+        for (int col = 0; col < width; col++)
+        {
+            Vector4 sum = { 0 };
+            int convolutionSize = blurSize + 1;
+
+            for (int i = 0; i < blurSize + 1; i++)
+            {
+                Vector4 p = pixelsCopy2[i*width + col];
+                sum.x += p.x; sum.y += p.y; sum.z += p.z; sum.w += p.w;
+            }
+
+            pixelsCopy1[col] = (Vector4){ (unsigned char)(sum.x/convolutionSize), (unsigned char)(sum.y/convolutionSize),
+                                          (unsigned char)(sum.z/convolutionSize), (unsigned char)(sum.w/convolutionSize) };
+
+            for (int y = 1; y < height; y++)
+            {
+                if (y - blurSize >= 0)
+                {
+                    Vector4 p = pixelsCopy2[(y - blurSize)*width + col];
+                    sum.x -= p.x; sum.y -= p.y; sum.z -= p.z; sum.w -= p.w;
+                    convolutionSize--;
+                }
+
+                if (y + blurSize < height)
+                {
+                    Vector4 p = pixelsCopy2[(y + blurSize)*width + col];
+                    sum.x += p.x; sum.y += p.y; sum.z += p.z; sum.w += p.w;
+                    convolutionSize++;
+                }
+
+                pixelsCopy1[y*width + col] = (Vector4){ (unsigned char)(sum.x/convolutionSize), (unsigned char)(sum.y/convolutionSize),
+                                                        (unsigned char)(sum.z/convolutionSize), (unsigned char)(sum.w/convolutionSize) };
+            }
+        }
+    }
+
+    // Reverse premultiply
+    for (int i = 0; i < width*height; i++)
+    {
+        if (pixelsCopy1[i].w == 0.0f) pixels[i] = (Color){ 0, 0, 0, 0 };
+        else
+        {
+            float alpha = pixelsCopy1[i].w/255.0f;
+            pixels[i].r = (unsigned char)(pixelsCopy1[i].x/alpha);
+            pixels[i].g = (unsigned char)(pixelsCopy1[i].y/alpha);
+            pixels[i].b = (unsigned char)(pixelsCopy1[i].z/alpha);
+            pixels[i].a = (unsigned char)pixelsCopy1[i].w;
+        }
+    }
+
+    free(pixelsCopy1);
+    free(pixelsCopy2);
+}
+
+// Blur with a double precision reference filter, values in/out as doubles (4 per pixel)
+static void BlurReference(double *values, double *temp, int width, int height, int radius)
+{
+    for (int pass = 0; pass < 2*BLUR_ITERATIONS; pass++)
+    {
+        bool vertical = (pass < BLUR_ITERATIONS);
+
+        for (int y = 0; y < height; y++)
+        {
+            for (int x = 0; x < width; x++)
+            {
+                for (int c = 0; c < 4; c++)
+                {
+                    double sum = 0.0;
+                    int count = 0;
+
+                    for (int d = -radius; d <= radius; d++)
+                    {
+                        int sx = vertical? x : x + d;
+                        int sy = vertical? y + d : y;
+
+                        if ((sx < 0) || (sy < 0) || (sx >= width) || (sy >= height)) continue;
+
+                        sum += values[(sy*width + sx)*4 + c];
+                        count++;
+                    }
+
+                    temp[(y*width + x)*4 + c] = sum/count;
+                }
+            }
+        }
+
+        for (int i = 0; i < width*height*4; i++) values[i] = temp[i];
+    }
+}
+
+// Get image with random RGBA8 pixels, alpha optionally opaque
+static Image GenImageRandom(int width, int height, bool opaque, int seed)
+{
+    Image image = GenImageColor(width, height, BLANK);
+    unsigned char *data = (unsigned char *)image.data;
+
+    srand(seed);
+    for (int i = 0; i < width*height*4; i++) data[i] = (opaque && (i%4 == 3))? 255 : (unsigned char)rand();
+
+    return image;
+}
+
+// Get blur time in ms (median of BENCH_RUNS, copy not measured)
+static double GetBlurTime(Image source, int radius, bool previous)
+{
+    double times[BENCH_RUNS] = { 0 };
+
+    for (int run = 0; run < BENCH_RUNS; run++)
+    {
+        Image image = ImageCopy(source);
+
+        double start = BenchTime();
+        if (previous) ImageBlurGaussianPrevious(&image, radius);
+        else ImageBlurGaussian(&image, radius);
+        times[run] = BenchTime() - start;
+
+        UnloadImage(image);
+    }
+
+    return BenchMedian(times, BENCH_RUNS)*1000.0;
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    SetTraceLogLevel(LOG_WARNING);
+
+    // Reference check, small and degenerate sizes, radii below and above image size
+    const int checkSizes[4][2] = { { 1, 1 }, { 3, 50 }, { 97, 61 }, { 130, 200 } };
+    const int checkRadii[4] = { 1, 3, 9, 40 };
+    int maxError = 0;
+
+    for (int s = 0; s < 4; s++)
+    {
+        int width = checkSizes[s][0];
+        int height = checkSizes[s][1];
+        double *values = (double *)malloc((size_t)width*height*4*sizeof(double));
+        double *temp = (double *)malloc((size_t)width*height*4*sizeof(double));
+
+        for (int r = 0; r < 4; r++)
+        {
+            Image image = GenImageRandom(width, height, true, s*4 + r);
+            unsigned char *data = (unsigned char *)image.data;
+
+            for (int i = 0; i < width*height*4; i++) values[i] = data[i];
+            BlurReference(values, temp, width, height, checkRadii[r]);
+            ImageBlurGaussian(&image, checkRadii[r]);
+            data = (unsigned char *)image.data;
+
+            int error = 0;
+            for (int i = 0; i < width*height*4; i++) if (abs(data[i] - (int)lround(values[i])) > error) error = abs(data[i] - (int)lround(values[i]));
+
+            CHECK(error <= 2, "%ix%i radius %i: differs by %i LSB from reference", width, height, checkRadii[r], error);
+            if (error > maxError) maxError = error;
+
+            UnloadImage(image);
+        }
+
+        free(values);
+        free(temp);
+    }
+
+    printf("opaque images, max error to double precision reference: %i LSB\n\n", maxError);
+
+    // Blur time, previous -> current
+    const int sizes[4][2] = { { 256, 256 }, { 1280, 720 }, { 1920, 1080 }, { 2048, 2048 } };
+    const int radii[3] = { 2, 8, 32 };
+
+    printf("%-10s %6s %12s %12s %8s\n", "size", "radius", "previous ms", "current ms", "speedup");
+
+    for (int s = 0; s < 4; s++)
+    {
+        Image source = GenImageRandom(sizes[s][0], sizes[s][1], false, 1);
+
+        for (int r = 0; r < 3; r++)
+        {
+            double previous = GetBlurTime(source, radii[r], true);
+            double current = GetBlurTime(source, radii[r], false);
+
+            printf("%4ix%-5i %6i %12.2f %12.2f %7.1fx\n", sizes[s][0], sizes[s][1], radii[r], previous, current, previous/current);
+            fflush(stdout);
+        }
+
+        UnloadImage(source);
+    }
+
+    return (benchFailures == 0)? 0 : 1;
+}
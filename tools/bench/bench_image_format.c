@@ -0,0 +1,427 @@
+/**********************************************************************************************
+*
+*   bench_image_format - ImageFormat() integer kernels against the previous float conversion
+*
+*   The previous ImageFormat() (whole image expanded to a Vector4 array, packed back with
+*   per-pixel float math) is ported below as ImageFormatPrevious() for reference.
+*   Throughput: Mpixel/s for every pair of the format matrix at 2048x2048, previous and current.
+*   Checks: for every pair of 8 bit per channel formats, current results stay within one LSB
+*   of the exact result (source normalized, converted in double precision and rounded).
+*   Previous results truncated to 8 bit, so both can differ by up to two LSB (GRAY targets).
+*
+*   NOTE: 16 bit per channel formats are not measured, they keep float math
+*
+**********************************************************************************************/
+
+#define BENCH_RUNS      3           // Previous conversions are slow, fewer runs per pair
+
+#include "raylib.h"
+#include "bench.h"
+
+#include <stdlib.h>             // Required for: malloc(), free(), rand(), abs()
+#include <math.h>               // Required for: round()
+
+#define IMAGE_SIZE          2048        // Image size for throughput
+#define CHECK_SIZE          256         // Image size for results check
+#define FORMAT_COUNT        8
+#define ALPHA_THRESHOLD     50          // Same as PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static const int formats[FORMAT_COUNT] = {
+    PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA,
+    PIXELFORMAT_UNCOMPRESSED_R5G6B5, PIXELFORMAT_UNCOMPRESSED_R8G8B8, PIXELFORMAT_UNCOMPRESSED_R5G5B5A1,
+    PIXELFORMAT_UNCOMPRESSED_R4G4B4A4, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32
+};
+static const char *formatNames[FORMAT_COUNT] = { "RGBA8", "GRAY", "GRAY_A", "565", "RGB8", "5551", "4444", "RGBA32" };
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Previous LoadImageDataNormalized(), uncompressed 8 and 32 bit per channel formats
+static Vector4 *LoadImageDataNormalizedPrevious(Image image)
+{
+    Vector4 *pixels = (Vector4 *)malloc(image.width*image.height*sizeof(Vector4));
+
+    for (int i = 0, k = 0; i < image.width*image.height; i++)
+    {
+        switch (image.format)
+        {
+            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+            {
+                float value = (float)((unsigned char *)image.data)[i]/255.0f;
+                pixels[i] = (Vector4){ value, value, value, 1.0f };
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+            {
+                float value = (float)((unsigned char *)image.data)[k]/255.0f;
+                pixels[i] = (Vector4){ value, value, value, (float)((unsigned char *)image.data)[k + 1]/255.0f };
+                k += 2;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+            {
+                unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
+                pixels[i].y = (float)((pixel & 0b0000011111000000) >> 6)*(1.0f/31);
+                pixels[i].z = (float)((pixel & 0b0000000000111110) >> 1)*(1.0f/31);
+                pixels[i].w = ((pixel & 0b0000000000000001) == 0)? 0.0f : 1.0f;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+            {
+                unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
+                pixels[i].y = (float)((pixel & 0b0000011111100000) >> 5)*(1.0f/63);
+                pixels[i].z = (float)(pixel & 0b0000000000011111)*(1.0f/31);
+                pixels[i].w = 1.0f;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+            {
+                unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                pixels[i].x = (float)((pixel & 0b1111000000000000) >> 12)*(1.0f/15);
+                pixels[i].y = (float)((pixel & 0b0000111100000000) >> 8)*(1.0f/15);
+                pixels[i].z = (float)((pixel & 0b0000000011110000) >> 4)*(1.0f/15);
+                pixels[i].w = (float)(pixel & 0b0000000000001111)*(1.0f/15);
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+            {
+                unsigned char *data = (unsigned char *)image.data + k;
+                pixels[i] = (Vector4){ data[0]/255.0f, data[1]/255.0f, data[2]/255.0f, data[3]/255.0f };
+                k += 4;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+            {
+                unsigned char *data = (unsigned char *)image.data + k;
+                pixels[i] = (Vector4){ data[0]/255.0f, data[1]/255.0f, data[2]/255.0f, 1.0f };
+                k += 3;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+            {
+                float *data = (float *)image.data + k;
+                pixels[i] = (Vector4){ data[0], data[1], data[2], data[3] };
+                k += 4;
+            } break;
+            default: break;
+        }
+    }
+
+    return pixels;
+}
+
+// Previous ImageFormat(), uncompressed 8 and 32 bit per channel formats, no mipmaps
+static void ImageFormatPrevious(Image *image, int newFormat)
+{
+    if (image->format == newFormat) return;
+
+    Vector4 *pixels = LoadImageDataNormalizedPrevious(*image);
+    int count = image->width*image->height;
+
+    free(image->data);
+    image->data = NULL;
+    image->format = newFormat;
+
+    switch (newFormat)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+        {
+            unsigned char *data = (unsigned char *)malloc((size_t)count);
+            for (int i = 0; i < count; i++) data[i] = (unsigned char)((pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f)*255.0f);
+            image->data = data;
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        {
+            unsigned char *data = (unsigned char *)malloc((size_t)count*2);
+            for (int i = 0; i < count; i++)
+            {
+                data[i*2] = (unsigned char)((pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f)*255.0f);
+                data[i*2 + 1] = (unsigned char)(pixels[i].w*255.0f);
+            }
+            image->data = data;
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        {
+            unsigned short *data = (unsigned short *)malloc((size_t)count*sizeof(unsigned short));
+            for (int i = 0; i < count; i++)
+            {
+                unsigned char r = (unsigned char)(round(pixels[i].x*31.0f));
+                unsigned char g = (unsigned char)(round(pixels[i].y*63.0f));
+                unsigned char b = (unsigned char)(round(pixels[i].z*31.0f));
+
+                data[i] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
+            }
+            image->data = data;
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        {
+            unsigned char *data = (unsigned char *)malloc((size_t)count*3);
+            for (int i = 0; i < count; i++)
+            {
+                data[i*3] = (unsigned char)(pixels[i].x*255.0f);
+                data[i*3 + 1] = (unsigned char)(pixels[i].y*255.0f);
+                data[i*3 + 2] = (unsigned char)(pixels[i].z*255.0f);
+            }
+            image->data = data;
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        {
+            unsigned short *data = (unsigned short *)malloc((size_t)count*sizeof(unsigned short));
+            for (int i = 0; i < count; i++)
+            {
+                unsigned char r = (unsigned char)(round(pixels[i].x*31.0f));
+                unsigned char g = (unsigned char)(round(pixels[i].y*31.0f));
+                unsigned char b = (unsigned char)(round(pixels[i].z*31.0f));
+                unsigned char a = (pixels[i].w > ((float)ALPHA_THRESHOLD/255.0f))? 1 : 0;
+
+                data[i] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+            }
+            image->data = data;
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        {
+            unsigned short *data = (unsigned short *)malloc((size_t)count*sizeof(unsigned short));
+            for (int i = 0; i < count; i++)
+            {
+                unsigned char r = (unsigned char)(round(pixels[i].x*15.0f));
+                unsigned char g = (unsigned char)(round(pixels[i].y*15.0f));
+                unsigned char b = (unsigned char)(round(pixels[i].z*15.0f));
+                unsigned char a = (unsigned char)(round(pixels[i].w*15.0f));
+
+                data[i] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
+            }
+            image->data = data;
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+        {
+            unsigned char *data = (unsigned char *)malloc((size_t)count*4);
+            for (int i = 0; i < count; i++)
+            {
+                data[i*4] = (unsigned char)(pixels[i].x*255.0f);
+                data[i*4 + 1] = (unsigned char)(pixels[i].y*255.0f);
+                data[i*4 + 2] = (unsigned char)(pixels[i].z*255.0f);
+                data[i*4 + 3] = (unsigned char)(pixels[i].w*255.0f);
+            }
+            image->data = data;
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+        {
+            float *data = (float *)malloc((size_t)count*4*sizeof(float));
+            for (int i = 0; i < count; i++)
+            {
+                data[i*4] = pixels[i].x;
+                data[i*4 + 1] = pixels[i].y;
+                data[i*4 + 2] = pixels[i].z;
+                data[i*4 + 3] = pixels[i].w;
+            }
+            image->data = data;
+        } break;
+        default: break;
+    }
+
+    free(pixels);
+}
+
+// Get pixel channels as stored in format (packed fields unscaled), returns channel count
+static int GetPixelChannels(Image image, int index, int *channels)
+{
+    unsigned char *bytes = (unsigned char *)image.data;
+    unsigned short pixel = 0;
+
+    switch (image.format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: channels[0] = bytes[index]; return 1;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: channels[0] = bytes[index*2]; channels[1] = bytes[index*2 + 1]; return 2;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        {
+            for (int c = 0; c < 3; c++) channels[c] = bytes[index*3 + c];
+            return 3;
+        }
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+        {
+            for (int c = 0; c < 4; c++) channels[c] = bytes[index*4 + c];
+            return 4;
+        }
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        {
+            pixel = ((unsigned short *)image.data)[index];
+            channels[0] = pixel >> 11; channels[1] = (pixel >> 5) & 0x3f; channels[2] = pixel & 0x1f;
+            return 3;
+        }
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        {
+            pixel = ((unsigned short *)image.data)[index];
+            channels[0] = pixel >> 11; channels[1] = (pixel >> 6) & 0x1f; channels[2] = (pixel >> 1) & 0x1f; channels[3] = pixel & 1;
+            return 4;
+        }
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        {
+            pixel = ((unsigned short *)image.data)[index];
+            for (int c = 0; c < 4; c++) channels[c] = (pixel >> (12 - 4*c)) & 0xf;
+            return 4;
+        }
+        default: break;
+    }
+
+    return 0;
+}
+
+// Get exact pixel channels in format, from normalized color, returns channel count
+static int GetExactChannels(Vector4 color, int format, int *channels)
+{
+    double gray = color.x*0.299 + color.y*0.587 + color.z*0.114;
+    int alpha = (color.w > ALPHA_THRESHOLD/255.0)? 1 : 0;
+
+    switch (format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: channels[0] = (int)round(gray*255.0); return 1;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: channels[0] = (int)round(gray*255.0); channels[1] = (int)round(color.w*255.0); return 2;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+        {
+            channels[0] = (int)round(color.x*255.0); channels[1] = (int)round(color.y*255.0);
+            channels[2] = (int)round(color.z*255.0); channels[3] = (int)round(color.w*255.0);
+            return (format == PIXELFORMAT_UNCOMPRESSED_R8G8B8)? 3 : 4;
+        }
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5: channels[0] = (int)round(color.x*31.0); channels[1] = (int)round(color.y*63.0); channels[2] = (int)round(color.z*31.0); return 3;
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        {
+            channels[0] = (int)round(color.x*31.0); channels[1] = (int)round(color.y*31.0);
+            channels[2] = (int)round(color.z*31.0); channels[3] = alpha;
+            return 4;
+        }
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        {
+            channels[0] = (int)round(color.x*15.0); channels[1] = (int)round(color.y*15.0);
+            channels[2] = (int)round(color.z*15.0); channels[3] = (int)round(color.w*15.0);
+            return 4;
+        }
+        default: break;
+    }
+
+    return 0;
+}
+
+// Get image with random RGBA8 pixels
+static Image GenImageRandom(int size)
+{
+    Image image = GenImageColor(size, size, BLACK);
+    unsigned char *data = (unsigned char *)image.data;
+
+    srand(3);
+    for (int i = 0; i < size*size*4; i++) data[i] = (unsigned char)rand();
+
+    return image;
+}
+
+// Get conversion throughput in Mpixel/s (median of BENCH_RUNS, copy not measured)
+static double GetConversionSpeed(Image source, int format, bool previous)
+{
+    double times[BENCH_RUNS] = { 0 };
+
+    for (int run = 0; run < BENCH_RUNS; run++)
+    {
+        Image image = ImageCopy(source);
+
+        double start = BenchTime();
+        if (previous) ImageFormatPrevious(&image, format);
+        else ImageFormat(&image, format);
+        times[run] = BenchTime() - start;
+
+        UnloadImage(image);
+    }
+
+    return source.width*source.height/BenchMedian(times, BENCH_RUNS)/1e6;
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    SetTraceLogLevel(LOG_WARNING);
+
+    // Results check, all pairs of 8 bit per channel formats (RGBA32 excluded)
+    Image base = GenImageRandom(CHECK_SIZE);
+    int previousError = 0;
+    int currentError = 0;
+
+    for (int a = 0; a < FORMAT_COUNT - 1; a++)
+    {
+        Image source = ImageCopy(base);
+        ImageFormatPrevious(&source, formats[a]);
+        Vector4 *normalized = LoadImageDataNormalizedPrevious(source);     // Exact for 8 bit per channel formats
+
+        for (int b = 0; b < FORMAT_COUNT - 1; b++)
+        {
+            if (a == b) continue;
+
+            Image previous = ImageCopy(source);
+            Image current = ImageCopy(source);
+            ImageFormatPrevious(&previous, formats[b]);
+            ImageFormat(&current, formats[b]);
+
+            int maxError = 0;
+            for (int i = 0; i < CHECK_SIZE*CHECK_SIZE; i++)
+            {
+                int e[4] = { 0 }, p[4] = { 0 }, c[4] = { 0 };
+                int count = GetExactChannels(normalized[i], formats[b], e);
+                GetPixelChannels(previous, i, p);
+                GetPixelChannels(current, i, c);
+
+                for (int k = 0; k < count; k++)
+                {
+                    if (abs(p[k] - e[k]) > previousError) previousError = abs(p[k] - e[k]);
+                    if (abs(c[k] - e[k]) > maxError) maxError = abs(c[k] - e[k]);
+                }
+            }
+
+            CHECK(maxError <= 1, "%s -> %s: results differ by %i LSB from exact", formatNames[a], formatNames[b], maxError);
+            if (maxError > currentError) currentError = maxError;
+
+            UnloadImage(previous);
+            UnloadImage(current);
+        }
+
+        free(normalized);
+        UnloadImage(source);
+    }
+
+    printf("8 bit per channel pairs, max error to exact: previous %i LSB, current %i LSB\n\n", previousError, currentError);
+
+    UnloadImage(base);
+
+    // Throughput matrix
+    base = GenImageRandom(IMAGE_SIZE);
+
+    printf("%ix%i, Mpixel/s previous -> current\n", IMAGE_SIZE, IMAGE_SIZE);
+    printf("%-8s", "src\\dst");
+    for (int b = 0; b < FORMAT_COUNT; b++) printf("%13s", formatNames[b]);
+    printf("\n");
+
+    for (int a = 0; a < FORMAT_COUNT; a++)
+    {
+        Image source = ImageCopy(base);
+        ImageFormat(&source, formats[a]);
+
+        printf("%-8s", formatNames[a]);
+        for (int b = 0; b < FORMAT_COUNT; b++)
+        {
+            if (a == b) { printf("%13s", "-"); continue; }
+
+            double previous = GetConversionSpeed(source, formats[b], true);
+            double current = GetConversionSpeed(source, formats[b], false);
+
+            printf("%6.0f ->%5.0f", previous, current);
+            fflush(stdout);
+        }
+        printf("\n");
+
+        UnloadImage(source);
+    }
+
+    UnloadImage(base);
+
+    return (benchFailures == 0)? 0 : 1;
+}
@@ -0,0 +1,166 @@
+/**********************************************************************************************
+*
+*   bench_image_threads - Image operations on the worker pool at 1, 2, 4 and 8 threads
+*
+*   Operations processed with ProcessImageRows() are run from rtextures.c variants built with
+*   a forced threads count (image_threads_variants.h) on a 1920x1080 RGBA8 image.
+*   Time: ms per operation with 1 thread, speedup with 2, 4 and 8 threads.
+*   Checks: results are byte-identical for every threads count.
+*
+*   NOTE: Speedup is limited by the host online cores, forced threads over it only add overhead
+*
+**********************************************************************************************/
+
+#define BENCH_RUNS      3           // Runs per operation and threads count
+
+#include "raylib.h"
+#include "bench.h"
+#include "image_threads_variants.h"
+
+#include <stdlib.h>             // Required for: rand(), srand()
+#include <string.h>             // Required for: memcmp()
+#include <unistd.h>             // Required for: sysconf()
+
+#define IMAGE_WIDTH         1920
+#define IMAGE_HEIGHT        1080
+#define VARIANT_COUNT       4
+#define OPERATION_COUNT     11
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Image operations of one variant
+typedef struct ImageOperations {
+    Image (*GenImageGradientLinear)(int width, int height, int direction, Color start, Color end);
+    Image (*GenImageChecked)(int width, int height, int checksX, int checksY, Color col1, Color col2);
+    Image (*GenImagePerlinNoise)(int width, int height, int offsetX, int offsetY, float scale);
+    Image (*GenImageCellular)(int width, int height, int tileSize);
+    void (*ImageBlurGaussian)(Image *image, int blurSize);
+    void (*ImageResize)(Image *image, int newWidth, int newHeight);
+    void (*ImageMipmaps)(Image *image);
+    void (*ImageDither)(Image *image, int rBpp, int gBpp, int bBpp, int aBpp);
+    void (*ImageRotate)(Image *image, int degrees);
+    void (*ImageColorTint)(Image *image, Color color);
+    void (*ImageColorBrightness)(Image *image, int brightness);
+} ImageOperations;
+
+#define IMAGE_OPERATIONS(prefix) { \
+    prefix##GenImageGradientLinear, prefix##GenImageChecked, prefix##GenImagePerlinNoise, prefix##GenImageCellular, \
+    prefix##ImageBlurGaussian, prefix##ImageResize, prefix##ImageMipmaps, prefix##ImageDither, \
+    prefix##ImageRotate, prefix##ImageColorTint, prefix##ImageColorBrightness }
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static const ImageOperations variants[VARIANT_COUNT] = {
+    IMAGE_OPERATIONS(Threads1), IMAGE_OPERATIONS(Threads2), IMAGE_OPERATIONS(Threads4), IMAGE_OPERATIONS(Threads8)
+};
+static const int variantThreads[VARIANT_COUNT] = { 1, 2, 4, 8 };
+
+static const char *operationNames[OPERATION_COUNT] = {
+    "GenImageGradientLinear()", "GenImageChecked()", "GenImagePerlinNoise()", "GenImageCellular()",
+    "ImageBlurGaussian(8)", "ImageResize(1280x720)", "ImageMipmaps()", "ImageDither(565)",
+    "ImageRotate(30)", "ImageColorTint()", "ImageColorBrightness()"
+};
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Run operation on a copy of source (or generate image), operation time in ms is returned in time
+static Image RunOperation(const ImageOperations *ops, int operation, Image source, double *time)
+{
+    Image image = (operation >= 4)? ImageCopy(source) : (Image){ 0 };
+
+    SetRandomSeed(1);       // GenImageCellular() seeds come from GetRandomValue()
+
+    double start = BenchTime();
+
+    switch (operation)
+    {
+        case 0: image = ops->GenImageGradientLinear(IMAGE_WIDTH, IMAGE_HEIGHT, 30, RED, BLUE); break;
+        case 1: image = ops->GenImageChecked(IMAGE_WIDTH, IMAGE_HEIGHT, 32, 32, RED, BLUE); break;
+        case 2: image = ops->GenImagePerlinNoise(IMAGE_WIDTH, IMAGE_HEIGHT, 0, 0, 4.0f); break;
+        case 3: image = ops->GenImageCellular(IMAGE_WIDTH, IMAGE_HEIGHT, 64); break;
+        case 4: ops->ImageBlurGaussian(&image, 8); break;
+        case 5: ops->ImageResize(&image, 1280, 720); break;
+        case 6: ops->ImageMipmaps(&image); break;
+        case 7: ops->ImageDither(&image, 5, 6, 5, 0); break;
+        case 8: ops->ImageRotate(&image, 30); break;
+        case 9: ops->ImageColorTint(&image, ORANGE); break;
+        case 10: ops->ImageColorBrightness(&image, 40); break;
+        default: break;
+    }
+
+    *time = (BenchTime() - start)*1000.0;
+
+    return image;
+}
+
+// Get image data size, mipmaps included
+static int GetImageDataSize(Image image)
+{
+    int size = 0;
+
+    for (int i = 0, width = image.width, height = image.height; i < image.mipmaps; i++)
+    {
+        size += GetPixelDataSize(width, height, image.format);
+        width = (width > 1)? width/2 : 1;
+        height = (height > 1)? height/2 : 1;
+    }
+
+    return size;
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    SetTraceLogLevel(LOG_WARNING);
+
+    Image source = GenImageColor(IMAGE_WIDTH, IMAGE_HEIGHT, BLANK);
+    unsigned char *data = (unsigned char *)source.data;
+
+    srand(1);
+    for (int i = 0; i < IMAGE_WIDTH*IMAGE_HEIGHT*4; i++) data[i] = (unsigned char)rand();
+
+    printf("%ix%i, host online cores: %li\n", IMAGE_WIDTH, IMAGE_HEIGHT, sysconf(_SC_NPROCESSORS_ONLN));
+    printf("%-24s %10s %10s %10s %10s\n", "", "1 thread", "2 threads", "4 threads", "8 threads");
+
+    for (int op = 0; op < OPERATION_COUNT; op++)
+    {
+        double times[VARIANT_COUNT] = { 0 };
+        double runTimes[BENCH_RUNS] = { 0 };
+        Image reference = { 0 };
+
+        for (int v = 0; v < VARIANT_COUNT; v++)
+        {
+            // First run starts the variant threads pool and is checked, not measured
+            Image result = RunOperation(&variants[v], op, source, &runTimes[0]);
+
+            if (v == 0) reference = result;
+            else
+            {
+                bool identical = (result.width == reference.width) && (result.height == reference.height) &&
+                    (result.format == reference.format) && (result.mipmaps == reference.mipmaps) &&
+                    (memcmp(result.data, reference.data, GetImageDataSize(reference)) == 0);
+
+                CHECK(identical, "%s: %i threads result differs from 1 thread", operationNames[op], variantThreads[v]);
+                UnloadImage(result);
+            }
+
+            for (int run = 0; run < BENCH_RUNS; run++) UnloadImage(RunOperation(&variants[v], op, source, &runTimes[run]));
+
+            times[v] = BenchMedian(runTimes, BENCH_RUNS);
+        }
+
+        printf("%-24s %7.2f ms %9.2fx %9.2fx %9.2fx\n", operationNames[op], times[0], times[0]/times[1], times[0]/times[2], times[0]/times[3]);
+        fflush(stdout);
+
+        UnloadImage(reference);
+    }
+
+    UnloadImage(source);
+
+    return (benchFailures == 0)? 0 : 1;
+}
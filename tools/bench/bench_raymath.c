@@ -0,0 +1,145 @@
+/**********************************************************************************************
+*
+*   bench_raymath - raymath.h scalar and SIMD code paths timings
+*
+*   Functions are called through raymath_variants.h: matrix functions inlined in a loop (as
+*   raylib modules use them) and as out-of-line calls (by-value Matrix copies included).
+*   Reported: nanoseconds per call (per vector for transform arrays), median of BENCH_RUNS
+*   runs, and speedup of SIMD path over scalar reference.
+*   GetRayCollisionMesh() is measured against the previous per vertex transform loop.
+*
+*   NOTE: On x86_64 hosts the SIMD path is SSE, NEON timings require an ARM host
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+#include "bench.h"
+#include "raymath_variants.h"
+
+#define RAYMATH_STATIC_INLINE
+#include "raymath.h"
+
+#define MATRIX_CALLS        200000
+#define VECTOR_COUNT        1024
+#define GRID_SIZE           64
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static volatile float sink = 0.0f;      // Results are accumulated, so calls are not optimized out
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+static void PrintResult(const char *name, const char *unit, double scalar, double simd)
+{
+    printf("%-36s scalar %8.2f %s   simd %8.2f %s   x%.2f\n", name, scalar, unit, simd, unit, scalar/simd);
+}
+
+// Get collision info between ray and mesh, vertices transformed one by one (previous code)
+static RayCollision GetRayCollisionMeshPerVertex(Ray ray, Mesh mesh, Matrix transform)
+{
+    RayCollision collision = { 0 };
+    Vector3 *vertdata = (Vector3 *)mesh.vertices;
+
+    for (int i = 0; i < mesh.triangleCount; i++)
+    {
+        Vector3 a = vertdata[mesh.indices[i*3 + 0]];
+        Vector3 b = vertdata[mesh.indices[i*3 + 1]];
+        Vector3 c = vertdata[mesh.indices[i*3 + 2]];
+
+        RayCollision hit = GetRayCollisionTriangle(ray, Vector3Transform(a, transform), Vector3Transform(b, transform), Vector3Transform(c, transform));
+
+        if (hit.hit && ((!collision.hit) || (collision.distance > hit.distance))) collision = hit;
+    }
+
+    return collision;
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    SetTraceLogLevel(LOG_WARNING);
+    SetRandomSeed(1);
+
+    Matrix matrices[64] = { 0 };
+    for (int i = 0; i < 64; i++)
+    {
+        matrices[i] = MatrixMultiply(MatrixRotateXYZ((Vector3){ 0.1f*i, 0.2f*i, 0.3f*i }), MatrixTranslate((float)i, 2.0f*i, 3.0f));
+        matrices[i].m3 = 0.001f*i;      // Not affine, full inverse
+    }
+
+    static Vector3 points3[VECTOR_COUNT] = { 0 };
+    static Vector3 result3[VECTOR_COUNT] = { 0 };
+    static Vector2 points2[VECTOR_COUNT] = { 0 };
+    static Vector2 result2[VECTOR_COUNT] = { 0 };
+    for (int i = 0; i < VECTOR_COUNT; i++)
+    {
+        points3[i] = (Vector3){ (float)GetRandomValue(-1000, 1000), (float)GetRandomValue(-1000, 1000), (float)GetRandomValue(-1000, 1000) };
+        points2[i] = (Vector2){ points3[i].x, points3[i].y };
+    }
+
+    double scalar = 0.0;
+    double simd = 0.0;
+
+    static Matrix products[64] = { 0 };
+
+    scalar = BENCH_MS(MATRIX_CALLS/64, ScalarMatrixMultiplyN(matrices, matrices + 1, products, 63); sink += products[it_%63].m5);
+    simd = BENCH_MS(MATRIX_CALLS/64, SimdMatrixMultiplyN(matrices, matrices + 1, products, 63); sink += products[it_%63].m5);
+    PrintResult("MatrixMultiply()", "ns", scalar*1e6/63, simd*1e6/63);
+
+    scalar = BENCH_MS(MATRIX_CALLS/64, ScalarMatrixInvertN(matrices, products, 64); sink += products[it_%64].m5);
+    simd = BENCH_MS(MATRIX_CALLS/64, SimdMatrixInvertN(matrices, products, 64); sink += products[it_%64].m5);
+    PrintResult("MatrixInvert()", "ns", scalar*1e6/64, simd*1e6/64);
+
+    scalar = BENCH_MS(MATRIX_CALLS, sink += ScalarMatrixMultiply(matrices[it_%64], matrices[(it_ + 1)%64]).m5);
+    simd = BENCH_MS(MATRIX_CALLS, sink += SimdMatrixMultiply(matrices[it_%64], matrices[(it_ + 1)%64]).m5);
+    PrintResult("MatrixMultiply() out-of-line call", "ns", scalar*1e6, simd*1e6);
+
+    scalar = BENCH_MS(MATRIX_CALLS, sink += ScalarMatrixInvert(matrices[it_%64]).m5);
+    simd = BENCH_MS(MATRIX_CALLS, sink += SimdMatrixInvert(matrices[it_%64]).m5);
+    PrintResult("MatrixInvert() out-of-line call", "ns", scalar*1e6, simd*1e6);
+
+    scalar = BENCH_MS(1000, ScalarVector3TransformLoop(points3, result3, VECTOR_COUNT, matrices[it_%64]); sink += result3[it_%VECTOR_COUNT].x);
+    simd = BENCH_MS(1000, SimdVector3TransformArray(points3, result3, VECTOR_COUNT, matrices[it_%64]); sink += result3[it_%VECTOR_COUNT].x);
+    PrintResult("Vector3Transform() loop vs array", "ns", scalar*1e6/VECTOR_COUNT, simd*1e6/VECTOR_COUNT);
+
+    scalar = BENCH_MS(1000, ScalarVector3TransformArray(points3, result3, VECTOR_COUNT, matrices[it_%64]); sink += result3[it_%VECTOR_COUNT].x);
+    PrintResult("Vector3TransformArray()", "ns", scalar*1e6/VECTOR_COUNT, simd*1e6/VECTOR_COUNT);
+
+    scalar = BENCH_MS(1000, ScalarVector2TransformArray(points2, result2, VECTOR_COUNT, matrices[it_%64]); sink += result2[it_%VECTOR_COUNT].x);
+    simd = BENCH_MS(1000, SimdVector2TransformArray(points2, result2, VECTOR_COUNT, matrices[it_%64]); sink += result2[it_%VECTOR_COUNT].x);
+    PrintResult("Vector2TransformArray()", "ns", scalar*1e6/VECTOR_COUNT, simd*1e6/VECTOR_COUNT);
+
+    // Ray picking against an indexed grid mesh (shared vertices)
+    static Vector3 grid[GRID_SIZE*GRID_SIZE] = { 0 };
+    static unsigned short indices[(GRID_SIZE - 1)*(GRID_SIZE - 1)*6] = { 0 };
+    int triangleCount = 0;
+
+    for (int z = 0; z < GRID_SIZE; z++)
+    {
+        for (int x = 0; x < GRID_SIZE; x++) grid[z*GRID_SIZE + x] = (Vector3){ (float)x, 0.01f*GetRandomValue(-50, 50), (float)z };
+    }
+
+    for (int z = 0; z < (GRID_SIZE - 1); z++)
+    {
+        for (int x = 0; x < (GRID_SIZE - 1); x++)
+        {
+            unsigned short i0 = z*GRID_SIZE + x;
+            unsigned short quad[6] = { i0, i0 + GRID_SIZE, i0 + 1, i0 + 1, i0 + GRID_SIZE, i0 + GRID_SIZE + 1 };
+            for (int k = 0; k < 6; k++) indices[triangleCount*3 + k] = quad[k];
+            triangleCount += 2;
+        }
+    }
+
+    Mesh mesh = { .vertexCount = GRID_SIZE*GRID_SIZE, .triangleCount = triangleCount, .vertices = &grid[0].x, .indices = indices };
+    Ray ray = { (Vector3){ 10.0f, 50.0f, 10.0f }, Vector3Normalize((Vector3){ 0.3f, -1.0f, 0.2f }) };
+
+    scalar = BENCH_MS(50, sink += GetRayCollisionMeshPerVertex(ray, mesh, matrices[it_%64]).distance);
+    simd = BENCH_MS(50, sink += GetRayCollisionMesh(ray, mesh, matrices[it_%64]).distance);
+    printf("%-36s before %8.2f ms   after %8.2f ms   x%.2f (%i triangles)\n", "GetRayCollisionMesh()", scalar, simd, scalar/simd, triangleCount);
+
+    return 0;
+}
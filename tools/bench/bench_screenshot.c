@@ -0,0 +1,177 @@
+/**********************************************************************************************
+*
+*   bench_screenshot - Screenshot encoders time and size, main thread cost of async screenshots
+*
+*   Encoders: a 1080x2400 UI-like RGBA image (flat panels, gradients, text-like strokes,
+*   noise) is encoded with the previous screenshot encoder (stb_image_write PNG), QOI and
+*   ExportImageToMemoryPNG() at several levels, single and parallel chunks.
+*   Main thread: time spent in TakeScreenshot() against TakeScreenshotAsync() in a frame.
+*   Checks: every encoded file decodes pixel-exact, async screenshots are saved and reported.
+*
+*   NOTE: Null driver screen readback is black, main thread timings include readback and
+*   encoding of a trivially compressible image (encoding time is measured on the UI image)
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+#include "bench.h"
+
+#include <stdlib.h>             // Required for: malloc(), free(), rand()
+#include <string.h>             // Required for: memcmp()
+#include <unistd.h>             // Required for: chdir()
+
+#define IMAGE_WIDTH         1080
+#define IMAGE_HEIGHT        2400
+#define SCREENSHOTS         8
+
+//----------------------------------------------------------------------------------
+// Other Modules Functions Declaration
+//----------------------------------------------------------------------------------
+extern unsigned char *ExportImageToMemoryPNG(Image image, int compressionLevel, bool parallel, int *dataSize);   // [Module: textures]
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static int screenshotsSaved = 0;
+static int screenshotsFailed = 0;
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Get UI-like image: horizontal bands of flat panels, gradients, text-like strokes and noise
+static Image GenImageInterface(void)
+{
+    unsigned char *pixels = (unsigned char *)malloc(IMAGE_WIDTH*IMAGE_HEIGHT*4);
+
+    srand(1);
+
+    for (int y = 0; y < IMAGE_HEIGHT; y++)
+    {
+        for (int x = 0; x < IMAGE_WIDTH; x++)
+        {
+            unsigned char *color = pixels + (y*IMAGE_WIDTH + x)*4;
+
+            switch ((y/200)%4)
+            {
+                case 0: color[0] = 30; color[1] = 30; color[2] = 40; break;
+                case 1: color[0] = x*255/IMAGE_WIDTH; color[1] = y%256; color[2] = 128; break;
+                case 2:
+                {
+                    bool stroke = (((x/6 + y/10)%7) == 0) && ((x%6) < 4) && ((y%10) < 8) && ((rand()&3) != 0);
+                    color[0] = stroke? 240 : 20;
+                    color[1] = stroke? 240 : 20;
+                    color[2] = stroke? 240 : 25;
+                } break;
+                default:
+                {
+                    color[0] = rand()&255;
+                    color[1] = (color[0] + rand()%20)&255;
+                    color[2] = (x + y)&255;
+                } break;
+            }
+
+            color[3] = 255;
+        }
+    }
+
+    return (Image){ pixels, IMAGE_WIDTH, IMAGE_HEIGHT, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+}
+
+// Check encoded file decodes to image, print encoding time and size
+static void ReportEncoding(const char *name, Image image, unsigned char *fileData, int dataSize, double time, const char *fileType)
+{
+    Image decoded = LoadImageFromMemory(fileType, fileData, dataSize);
+    bool exact = (decoded.data != NULL) && (decoded.width == image.width) && (decoded.height == image.height) &&
+        (decoded.format == image.format) && (memcmp(decoded.data, image.data, image.width*image.height*4) == 0);
+
+    printf("%-24s %8.1f ms %8i KB\n", name, time, dataSize/1024);
+    CHECK(exact, "%s: decoded image differs from encoded one", name);
+
+    UnloadImage(decoded);
+    MemFree(fileData);
+}
+
+static void ScreenshotSaved(const char *fileName, bool success)
+{
+    if (success && FileExists(fileName)) screenshotsSaved++;
+    else screenshotsFailed++;
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    SetTraceLogLevel(LOG_WARNING);
+
+    // Encoders time and size
+    Image image = GenImageInterface();
+    const int levels[4] = { 0, 1, 5, 8 };
+    int dataSize = 0;
+    double start = 0.0;
+    unsigned char *fileData = NULL;
+
+    printf("%ix%i UI-like image, encoding time (single run) and size\n", IMAGE_WIDTH, IMAGE_HEIGHT);
+
+    start = BenchTime();
+    fileData = ExportImageToMemory(image, ".png", &dataSize);
+    ReportEncoding("stb_image_write (prev)", image, fileData, dataSize, (BenchTime() - start)*1000.0, ".png");
+
+    start = BenchTime();
+    fileData = ExportImageToMemory(image, ".qoi", &dataSize);
+    ReportEncoding("QOI", image, fileData, dataSize, (BenchTime() - start)*1000.0, ".qoi");
+
+    for (int i = 0; i < 4; i++)
+    {
+        for (int parallel = 0; parallel < 2; parallel++)
+        {
+            start = BenchTime();
+            fileData = ExportImageToMemoryPNG(image, levels[i], parallel, &dataSize);
+            ReportEncoding(TextFormat("PNG %slevel %i", parallel? "parallel " : "", levels[i]), image, fileData, dataSize, (BenchTime() - start)*1000.0, ".png");
+        }
+    }
+
+    UnloadImage(image);
+
+    // Main thread time per screenshot, screenshots saved in harness temporary directory
+    CHECK(chdir(GetBenchTempPath("")) == 0, "failed to enter temporary directory");
+    InitWindow(0, 0, "bench_screenshot");
+
+    double syncTimes[SCREENSHOTS] = { 0 };
+    double asyncTimes[SCREENSHOTS] = { 0 };
+
+    for (int i = 0; i < SCREENSHOTS; i++)
+    {
+        BeginDrawing();
+            ClearBackground(RAYWHITE);
+            start = BenchTime();
+            TakeScreenshot("screenshot_sync.png");
+            syncTimes[i] = (BenchTime() - start)*1000.0;
+        EndDrawing();
+
+        BeginDrawing();
+            ClearBackground(RAYWHITE);
+            start = BenchTime();
+            TakeScreenshotAsync(TextFormat("screenshot%02i", i), ScreenshotSaved);
+            asyncTimes[i] = (BenchTime() - start)*1000.0;
+        EndDrawing();
+    }
+
+    // Wait for pending exports, callbacks are called from EndDrawing()
+    for (int frame = 0; ((screenshotsSaved + screenshotsFailed) < SCREENSHOTS) && (frame < 10000); frame++)
+    {
+        BeginDrawing();
+        EndDrawing();
+        WaitTime(0.001);
+    }
+
+    printf("\n%ix%i screen, main thread time per screenshot (median of %i)\n", GetScreenWidth(), GetScreenHeight(), SCREENSHOTS);
+    printf("TakeScreenshot()         %8.2f ms\n", BenchMedian(syncTimes, SCREENSHOTS));
+    printf("TakeScreenshotAsync()    %8.2f ms\n", BenchMedian(asyncTimes, SCREENSHOTS));
+
+    CHECK(screenshotsSaved == SCREENSHOTS, "%i of %i async screenshots saved (%i failed)", screenshotsSaved, SCREENSHOTS, screenshotsFailed);
+
+    CloseWindow();
+
+    return (benchFailures == 0)? 0 : 1;
+}
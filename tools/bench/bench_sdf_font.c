@@ -0,0 +1,154 @@
+/**********************************************************************************************
+*
+*   bench_sdf_font - SDF font (one atlas for all sizes) against one bitmap font per size
+*
+*   TTF font (FONT_PATH, skipped if not found): LoadFontEx() at every size against one
+*   LoadFontSDF() atlas. Default font: GetFontDefault() scaled against GenFontSDF() at 3x.
+*   Reported per font: load time, atlas bytes (GPU texture data), CPU time per frame drawing
+*   TEXT_LINES lines at each size and at all sizes in the same frame, draw calls per frame.
+*   Checks: a custom shader set with BeginShaderMode() is kept active by SDF text drawing.
+*
+*   NOTE: Only the CPU side is measured, SDF fragment shader cost is not (null GLES2 driver)
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+#include "rlgl.h"
+#include "bench.h"
+
+#ifndef FONT_PATH
+    #define FONT_PATH       "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf"
+#endif
+
+#define SIZE_COUNT          7
+#define SDF_BASE_SIZE       32          // LoadFontSDF() glyphs size
+#define SDF_DEFAULT_SCALE   3           // GenFontSDF() upscale, as used by the app
+#define TEXT_LINES          20
+#define FRAMES              100
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static const int sizes[SIZE_COUNT] = { 12, 16, 20, 24, 32, 48, 64 };
+static const char *text = "The quick brown fox jumps over the lazy dog 0123456789 (+-*/)";
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Get font atlas texture data size in bytes
+static int GetAtlasSize(Font font)
+{
+    return GetPixelDataSize(font.texture.width, font.texture.height, font.texture.format);
+}
+
+// Draw text lines at size with font for size index
+static void DrawLines(const Font *fonts, int sizeIndex)
+{
+    for (int i = 0; i < TEXT_LINES; i++) DrawTextEx(fonts[sizeIndex], text, (Vector2){ 10.0f, 10.0f + i*(float)sizes[sizeIndex] }, (float)sizes[sizeIndex], 1.0f, WHITE);
+}
+
+// Draw text lines, all sizes in the same frame (every size once per line)
+static void DrawLinesMixed(const Font *fonts)
+{
+    for (int i = 0; i < TEXT_LINES; i++)
+    {
+        for (int s = 0; s < SIZE_COUNT; s++) DrawTextEx(fonts[s], text, (Vector2){ 10.0f, 10.0f + i*20.0f + s*2.0f }, (float)sizes[s], 1.0f, WHITE);
+    }
+}
+
+// Report draw time per size and mixed sizes, fonts has one font per size (the same for SDF)
+static void RunFonts(const char *name, const Font *fonts, double loadTime, int atlasBytes)
+{
+    printf("%-16s %8.1f %10i", name, loadTime, atlasBytes/1024);
+
+    for (int s = 0; s < SIZE_COUNT; s++)
+    {
+        double ms = BENCH_MS(FRAMES, BeginDrawing(); ClearBackground(BLACK); DrawLines(fonts, s); EndDrawing());
+        printf(" %7.3f", ms);
+    }
+
+    double ms = BENCH_MS(FRAMES, BeginDrawing(); ClearBackground(BLACK); DrawLinesMixed(fonts); EndDrawing());
+    rlRenderStats stats = rlGetRenderStats();
+
+    printf(" %7.3f %6i\n", ms, stats.drawCalls);
+}
+
+static void PrintHeader(void)
+{
+    printf("%-16s %8s %10s", "", "load ms", "atlas KB");
+    for (int s = 0; s < SIZE_COUNT; s++) printf(" %5ipx", sizes[s]);
+    printf(" %7s %6s\n", "mixed", "calls");
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    SetTraceLogLevel(LOG_WARNING);
+    InitWindow(0, 0, "bench_sdf_font");
+
+    Font fonts[SIZE_COUNT] = { 0 };
+    double start = 0.0;
+
+    printf("%i lines of %i characters, CPU ms per frame (median of %i) at each size and all sizes mixed\n", TEXT_LINES, TextLength(text), BENCH_RUNS);
+
+    // TTF font: one bitmap font per size against one SDF font
+    if (FileExists(FONT_PATH))
+    {
+        printf("\n%s\n", GetFileName(FONT_PATH));
+        PrintHeader();
+
+        int atlasBytes = 0;
+        start = BenchTime();
+        for (int s = 0; s < SIZE_COUNT; s++) fonts[s] = LoadFontEx(FONT_PATH, sizes[s], NULL, 0);
+        double loadTime = (BenchTime() - start)*1000.0;
+
+        for (int s = 0; s < SIZE_COUNT; s++) atlasBytes += GetAtlasSize(fonts[s]);
+        RunFonts("bitmap per size", fonts, loadTime, atlasBytes);
+        for (int s = 0; s < SIZE_COUNT; s++) UnloadFont(fonts[s]);
+
+        start = BenchTime();
+        Font sdf = LoadFontSDF(FONT_PATH, SDF_BASE_SIZE, NULL, 0);
+        loadTime = (BenchTime() - start)*1000.0;
+
+        CHECK(sdf.type == FONT_SDF, "%s: LoadFontSDF() failed", FONT_PATH);
+        for (int s = 0; s < SIZE_COUNT; s++) fonts[s] = sdf;
+        RunFonts(TextFormat("sdf %ipx", SDF_BASE_SIZE), fonts, loadTime, GetAtlasSize(sdf));
+        UnloadFont(sdf);
+    }
+    else printf("\n%s not found, TTF fonts skipped (set FONT_PATH)\n", FONT_PATH);
+
+    // Default font: scaled bitmap against SDF generated from it
+    printf("\ndefault font\n");
+    PrintHeader();
+
+    Font font = GetFontDefault();
+    for (int s = 0; s < SIZE_COUNT; s++) fonts[s] = font;
+    RunFonts("bitmap scaled", fonts, 0.0, GetAtlasSize(font));
+
+    start = BenchTime();
+    Font sdf = GenFontSDF(font, SDF_DEFAULT_SCALE);
+    double loadTime = (BenchTime() - start)*1000.0;
+
+    CHECK(sdf.type == FONT_SDF, "GenFontSDF() failed");
+    for (int s = 0; s < SIZE_COUNT; s++) fonts[s] = sdf;
+    RunFonts(TextFormat("sdf %ix", SDF_DEFAULT_SCALE), fonts, loadTime, GetAtlasSize(sdf));
+
+    // Custom shader set by caller is not replaced by built-in SDF shader
+    Shader custom = LoadShaderFromMemory(NULL, "void main() { gl_FragColor = vec4(1.0); }");
+
+    BeginDrawing();
+        BeginShaderMode(custom);
+            DrawTextEx(sdf, text, (Vector2){ 10.0f, 10.0f }, 40.0f, 1.0f, WHITE);
+            CHECK(rlGetShaderIdCurrent() == custom.id, "custom shader replaced by SDF text drawing");
+        EndShaderMode();
+    EndDrawing();
+
+    UnloadShader(custom);
+    UnloadFont(sdf);
+
+    CloseWindow();
+
+    return (benchFailures == 0)? 0 : 1;
+}
@@ -0,0 +1,83 @@
+/**********************************************************************************************
+*
+*   bench_sdf_shapes - SDF shapes batch against tessellated shapes
+*
+*   Draws the same UI-like frame (rounded buttons with outlines, circles and rings) with the
+*   tessellated functions and with the *SDF() functions, reports CPU time per frame and
+*   vertices/draw calls submitted (rlGetRenderStats()).
+*
+*   NOTE: Only the CPU side is measured, the SDF path also replaces 4x MSAA on the GPU side
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+#include "rlgl.h"
+#include "bench.h"
+
+#define FRAMES              200
+#define BUTTON_COUNT        64
+#define CIRCLE_COUNT        32
+#define RING_COUNT          16
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+static void DrawScene(bool sdf)
+{
+    for (int i = 0; i < BUTTON_COUNT; i++)
+    {
+        Rectangle rec = { 20.0f + (i%4)*260.0f, 40.0f + (i/4)*130.0f, 240.0f, 110.0f };
+
+        if (sdf)
+        {
+            DrawRectangleRoundedSDF(rec, 0.4f, (Color){ 40, 40, 60, 255 });
+            DrawRectangleRoundedLinesSDF(rec, 0.4f, 3.0f, RAYWHITE);
+        }
+        else
+        {
+            DrawRectangleRounded(rec, 0.4f, 0, (Color){ 40, 40, 60, 255 });
+            DrawRectangleRoundedLines(rec, 0.4f, 0, 3.0f, RAYWHITE);
+        }
+    }
+
+    for (int i = 0; i < CIRCLE_COUNT; i++)
+    {
+        Vector2 center = { 60.0f + (i%8)*130.0f, 2150.0f + (i/8)*40.0f };
+
+        if (sdf) DrawCircleSDF(center, 10.0f + i, SKYBLUE);
+        else DrawCircleV(center, 10.0f + i, SKYBLUE);
+    }
+
+    for (int i = 0; i < RING_COUNT; i++)
+    {
+        Vector2 center = { 100.0f + (i%8)*120.0f, 1200.0f + (i/8)*200.0f };
+
+        if (sdf) DrawRingSDF(center, 30.0f, 50.0f, ORANGE);
+        else DrawRing(center, 30.0f, 50.0f, 0.0f, 360.0f, 0, ORANGE);
+    }
+}
+
+static void RunScene(const char *name, bool sdf)
+{
+    double ms = BENCH_MS(FRAMES, BeginDrawing(); ClearBackground(BLACK); DrawScene(sdf); EndDrawing());
+    rlRenderStats stats = rlGetRenderStats();
+
+    printf("%-12s %8.3f ms/frame   %6i vertices   %3i draw calls   %7i bytes uploaded\n", name, ms, stats.vertices, stats.drawCalls, stats.uploadedBytes);
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    SetTraceLogLevel(LOG_WARNING);
+    InitWindow(0, 0, "bench_sdf_shapes");
+
+    printf("%i rounded buttons with outline, %i circles, %i rings per frame\n", BUTTON_COUNT, CIRCLE_COUNT, RING_COUNT);
+    RunScene("tessellated", false);
+    RunScene("sdf", true);
+
+    CloseWindow();
+
+    return 0;
+}
@@ -0,0 +1,83 @@
+/**********************************************************************************************
+*
+*   capture - Capture 2d geometry submitted to rlgl, for harnesses checking tessellation
+*
+*   Draws between BeginCapture() and EndCapture() go to a dedicated render batch, vertex data
+*   is read back from it as triangles (quads split in two, lines skipped) before it is drawn.
+*
+*   NOTE: Captured geometry must fit CAPTURE_BATCH_QUADS quads, the batch is not flushed
+*
+**********************************************************************************************/
+
+#ifndef CAPTURE_H
+#define CAPTURE_H
+
+#include "raylib.h"
+#include "rlgl.h"
+
+#ifndef CAPTURE_BATCH_QUADS
+    #define CAPTURE_BATCH_QUADS     16384   // Capture batch size (ES2 indices are 16 bit: 65536 vertex max)
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Captured vertex: position and alpha (0..1)
+typedef struct CaptureVertex {
+    float x;
+    float y;
+    float alpha;
+} CaptureVertex;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static rlRenderBatch captureBatch = { 0 };
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Begin capturing geometry, drawing goes to capture batch
+static void BeginCapture(void)
+{
+    captureBatch = rlLoadRenderBatch(1, CAPTURE_BATCH_QUADS);
+    rlSetRenderBatchActive(&captureBatch);
+}
+
+// End capturing geometry, fills triangles vertices (3 per triangle) and returns vertex count
+static int EndCapture(CaptureVertex *vertices, int maxCount)
+{
+    const float *positions = captureBatch.vertexBuffer[0].vertices;
+    const unsigned char *colors = captureBatch.vertexBuffer[0].colors;
+    int count = 0;
+
+    for (int i = 0, offset = 0; i < captureBatch.drawCounter; i++)
+    {
+        const rlDrawCall draw = captureBatch.draws[i];
+        static const int quadOrder[6] = { 0, 1, 2, 0, 2, 3 };
+
+        if ((draw.mode == RL_TRIANGLES) || (draw.mode == RL_QUADS))
+        {
+            int corners = (draw.mode == RL_QUADS)? 4 : 3;
+            int emitted = (draw.mode == RL_QUADS)? 6 : 3;
+
+            for (int k = 0; (k + corners) <= draw.vertexCount; k += corners)
+            {
+                for (int j = 0; (j < emitted) && (count < maxCount); j++)
+                {
+                    int v = offset + k + ((draw.mode == RL_QUADS)? quadOrder[j] : j);
+                    vertices[count++] = (CaptureVertex){ positions[3*v], positions[3*v + 1], colors[4*v + 3]/255.0f };
+                }
+            }
+        }
+
+        offset += (draw.vertexCount + draw.vertexAlignment);
+    }
+
+    rlSetRenderBatchActive(NULL);       // Capture batch is drawn and reset
+    rlUnloadRenderBatch(captureBatch);
+
+    return count;
+}
+
+#endif // CAPTURE_H
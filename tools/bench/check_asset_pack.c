@@ -0,0 +1,205 @@
+/**********************************************************************************************
+*
+*   check_asset_pack - Asset packs (MountAssetPack) packed with tools/rpak
+*
+*   Assets are generated in a temporary directory, packed with and without -qoi and loaded
+*   from the pack and from the loose files. Checks:
+*     - LoadImage() and LoadFileData() + LoadImageFromMemory() decode QOI entries stored
+*       under their original names, pixels equal to the loose files
+*     - LoadFileText() and LoadFileData() entries equal to the loose files
+*     - packs with a stored/QOI entry size different from its data size are not mounted
+*     - file views of pack entries stay valid after pack is unmounted, until unloaded
+*     - files keep loading from other threads (LoadImage() from stored/QOI entries views,
+*       LoadFileData()) while packs are mounted and unmounted
+*       (run with -fsanitize=thread or -fsanitize=address to check asset packs locking)
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+#include "bench.h"
+
+#include <string.h>             // Required for: memcmp()
+#include <unistd.h>             // Required for: chdir()
+#include <pthread.h>            // Required for: pthread_create(), pthread_join()
+
+#ifndef RPAK_PATH
+    #define RPAK_PATH       "./build/rpak"
+#endif
+
+#define IMAGE_COUNT         8
+#define TEXT_COUNT          4
+#define LOADER_THREADS      4
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static bool loadersQuit = false;
+static char imageNames[IMAGE_COUNT][64] = { 0 };   // NOTE: TextFormat() is not thread-safe
+static int loaderErrors[LOADER_THREADS] = { 0 };
+static int loaderCount[LOADER_THREADS] = { 0 };
+static Image expected[IMAGE_COUNT] = { 0 };
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+static bool ImagesEqual(Image a, Image b)
+{
+    if ((a.data == NULL) || (b.data == NULL) || (a.width != b.width) || (a.height != b.height)) return false;
+
+    Color *pa = LoadImageColors(a);
+    Color *pb = LoadImageColors(b);
+    bool equal = (memcmp(pa, pb, a.width*a.height*sizeof(Color)) == 0);
+
+    UnloadImageColors(pa);
+    UnloadImageColors(pb);
+
+    return equal;
+}
+
+// Loader thread, loads images while packs are mounted/unmounted (pack and loose files are equal)
+// NOTE: Odd threads use LoadImage(), decoding from a view of pack data when found in a pack
+static void *LoaderThread(void *arg)
+{
+    int index = (int)(long)arg;
+
+    for (int i = 0; !__atomic_load_n(&loadersQuit, __ATOMIC_RELAXED); i = (i + 1)%IMAGE_COUNT)
+    {
+        if (index%2 == 1)
+        {
+            Image image = LoadImage(imageNames[i]);
+
+            if (!ImagesEqual(image, expected[i])) loaderErrors[index]++;
+
+            UnloadImage(image);
+        }
+        else
+        {
+            int size = 0;
+            unsigned char *data = LoadFileData(imageNames[i], &size);
+            Image image = LoadImageFromMemory(".png", data, size);
+
+            if (!ImagesEqual(image, expected[i])) loaderErrors[index]++;
+
+            UnloadImage(image);
+            UnloadFileData(data);
+        }
+
+        loaderCount[index]++;
+    }
+
+    return NULL;
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    SetTraceLogLevel(LOG_WARNING);
+
+    const char *root = GetBenchTempPath("pack");
+    system(TextFormat("rm -rf %s && mkdir -p %s/assets/images %s/assets/text", root, root, root));
+    CHECK(chdir(TextFormat("%s/assets", root)) == 0, "failed to create assets directory");
+
+    for (int i = 0; i < IMAGE_COUNT; i++)
+    {
+        // NOTE: Grayscale images are expanded to RGBA by rpak
+        expected[i] = GenImageGradientRadial(64 + i*16, 64, 0.3f, (Color){ 30*i, 80, 160, 255 }, (Color){ 0, 0, 0, 128 });
+        if (i%4 == 3) ImageFormat(&expected[i], PIXELFORMAT_UNCOMPRESSED_GRAYSCALE);
+        snprintf(imageNames[i], 64, "images/image%i.png", i);
+        ExportImage(expected[i], imageNames[i]);
+    }
+
+    for (int i = 0; i < TEXT_COUNT; i++) SaveFileText(TextFormat("text/config%i.txt", i), (char *)TextFormat("config %i\nkey = value_%i\n", i, i*i));
+
+    CHECK(system(TextFormat("%s -qoi ../qoi.rpak . > /dev/null", RPAK_PATH)) == 0, "rpak -qoi failed (%s)", RPAK_PATH);
+    CHECK(system(TextFormat("%s ../store.rpak . > /dev/null", RPAK_PATH)) == 0, "rpak failed (%s)", RPAK_PATH);
+
+    const char *packs[2] = { "../qoi.rpak", "../store.rpak" };
+
+    for (int p = 0; p < 2; p++)
+    {
+        CHECK(MountAssetPack(packs[p]), "%s: mount failed", packs[p]);
+
+        for (int i = 0; i < IMAGE_COUNT; i++)
+        {
+            const char *fileName = imageNames[i];
+            Image image = LoadImage(fileName);
+            CHECK(ImagesEqual(image, expected[i]), "%s: LoadImage(%s) differs from loose file", packs[p], fileName);
+            UnloadImage(image);
+
+            int size = 0;
+            unsigned char *data = LoadFileData(fileName, &size);
+            image = LoadImageFromMemory(".png", data, size);
+            CHECK(ImagesEqual(image, expected[i]), "%s: LoadImageFromMemory(LoadFileData(%s)) differs from loose file", packs[p], fileName);
+            UnloadImage(image);
+            UnloadFileData(data);
+        }
+
+        for (int i = 0; i < TEXT_COUNT; i++)
+        {
+            char *text = LoadFileText(TextFormat("./text/config%i.txt", i));
+            CHECK((text != NULL) && (strcmp(text, TextFormat("config %i\nkey = value_%i\n", i, i*i)) == 0), "%s: LoadFileText(config%i.txt) differs", packs[p], i);
+            UnloadFileText(text);
+        }
+
+        UnmountAssetPack(packs[p]);
+    }
+
+    // Pack with a QOI entry data size smaller than entry size (copied by LoadFileData()) is rejected
+    // NOTE: Entries index follows 16 bytes header, entries are 6 unsigned int (compression last)
+    int packSize = 0;
+    unsigned char *packData = LoadFileData(packs[0], &packSize);
+    unsigned int *entry = (unsigned int *)(packData + 16);
+    while (entry[5] != 2) entry += 6;
+    entry[4] = entry[3]/2;
+    SaveFileData("../invalid.rpak", packData, packSize);
+    UnloadFileData(packData);
+
+    SetTraceLogLevel(LOG_ERROR);
+    CHECK(!MountAssetPack("../invalid.rpak"), "../invalid.rpak: pack with invalid QOI entry size mounted");
+    SetTraceLogLevel(LOG_WARNING);
+
+    // File views of pack entries outlive pack unmounting
+    CHECK(MountAssetPack(packs[1]), "%s: mount failed", packs[1]);
+    FileView view = LoadFileView(imageNames[0]);
+    UnmountAssetPack(packs[1]);
+
+    CHECK(FileExists(imageNames[0]), "%s: loose file missing", imageNames[0]);
+    int looseSize = 0;
+    unsigned char *looseData = LoadFileData(imageNames[0], &looseSize);
+    CHECK((view.data != NULL) && (view.size == looseSize) && (memcmp(view.data, looseData, looseSize) == 0), "%s: file view differs after pack unmounted", packs[1]);
+    UnloadFileData(looseData);
+    UnloadFileView(view);
+
+    // Load from threads while packs are mounted and unmounted
+    pthread_t threads[LOADER_THREADS] = { 0 };
+    for (int i = 0; i < LOADER_THREADS; i++) pthread_create(&threads[i], NULL, LoaderThread, (void *)(long)i);
+
+    for (int i = 0; i < 200; i++)
+    {
+        MountAssetPack(packs[i%2]);
+        if (i%3 == 0) MountAssetPack(packs[(i + 1)%2]);
+        UnmountAssetPack(packs[i%2]);
+        if (i%3 == 0) UnmountAssetPack(packs[(i + 1)%2]);
+    }
+
+    __atomic_store_n(&loadersQuit, true, __ATOMIC_RELAXED);
+
+    int loads = 0;
+    int errors = 0;
+    for (int i = 0; i < LOADER_THREADS; i++)
+    {
+        pthread_join(threads[i], NULL);
+        loads += loaderCount[i];
+        errors += loaderErrors[i];
+    }
+
+    CHECK(errors == 0, "threads: %i of %i loads differ while mounting/unmounting", errors, loads);
+
+    for (int i = 0; i < IMAGE_COUNT; i++) UnloadImage(expected[i]);
+
+    printf("%s (%i threaded loads)\n", (benchFailures == 0)? "asset pack: OK" : "asset pack: FAILED", loads);
+
+    return (benchFailures == 0)? 0 : 1;
+}
@@ -0,0 +1,206 @@
+/**********************************************************************************************
+*
+*   check_image_draw - ImageDraw() blending over RGBA8, SIMD code paths against ColorAlphaBlend()
+*
+*   Scalar, Simd and Neon (emulated) builds of rtextures.c (image_draw_variants.h) blend random
+*   pixels with every source/destination alpha pair (256x256 plus a 3 pixels tail per line,
+*   crossing a conversion chunk) and several tints. Checks:
+*     - BlendPixelsRGBA8() is bit-exact to ColorAlphaBlend() for every 8 bit per channel source
+*       format (gray, gray-alpha, RGB8, RGBA8)
+*     - ImageDraw() over RGBA8 is bit-exact to the per pixel path (GetPixelColor(), ColorAlphaBlend())
+*       for 6 source formats, line fast paths and per pixel path (565, 4444), clipped draws included
+*
+*   NOTE: Per pixel path skips blending (tint ignored) for opaque source formats when tint is
+*   opaque, reference does the same
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+#include "bench.h"
+#include "image_draw_variants.h"
+
+#include <stdlib.h>             // Required for: rand(), srand()
+#include <string.h>             // Required for: memcmp(), memcpy()
+
+#define LINE_WIDTH          259         // Source alpha 0..255, then a tail of 3 pixels
+#define LINES               256         // Destination alpha 0..255
+#define FORMAT_COUNT        6
+#define BLEND_FORMAT_COUNT  4           // Formats supported by BlendPixelsRGBA8(), first ones
+#define TINT_COUNT          5
+#define VARIANT_COUNT       3
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef void (*ImageDrawFunc)(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint);
+typedef void (*BlendPixelsFunc)(const void *src, int srcFormat, unsigned char *dst, int count, Color tint);
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static const int formats[FORMAT_COUNT] = {
+    PIXELFORMAT_UNCOMPRESSED_GRAYSCALE, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA, PIXELFORMAT_UNCOMPRESSED_R8G8B8,
+    PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, PIXELFORMAT_UNCOMPRESSED_R5G6B5, PIXELFORMAT_UNCOMPRESSED_R4G4B4A4
+};
+static const char *formatNames[FORMAT_COUNT] = { "GRAY", "GRAY_ALPHA", "RGB8", "RGBA8", "565", "4444" };
+
+static const Color tints[TINT_COUNT] = { { 255, 255, 255, 255 }, { 255, 255, 255, 128 }, { 200, 100, 50, 255 }, { 90, 180, 255, 77 }, { 255, 255, 255, 0 } };
+
+static const char *variantNames[VARIANT_COUNT] = { "Scalar", "Simd", "Neon" };
+static const ImageDrawFunc imageDraws[VARIANT_COUNT] = { ScalarImageDraw, SimdImageDraw, NeonImageDraw };
+static const BlendPixelsFunc blendPixels[VARIANT_COUNT] = { ScalarBlendPixelsRGBA8, SimdBlendPixelsRGBA8, NeonBlendPixelsRGBA8 };
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Generate random source: raw random bytes, alpha of pixel x set to x (formats with 8 bit alpha)
+static Image GenImageSource(int format)
+{
+    int pixelSize = GetPixelDataSize(1, 1, format);
+    Image image = { MemAlloc(LINE_WIDTH*LINES*pixelSize), LINE_WIDTH, LINES, 1, format };
+    unsigned char *data = (unsigned char *)image.data;
+
+    for (int i = 0; i < LINE_WIDTH*LINES*pixelSize; i++) data[i] = (unsigned char)rand();
+
+    for (int y = 0; y < LINES; y++)
+    {
+        for (int x = 0; x < LINE_WIDTH; x++)
+        {
+            unsigned char *pixel = data + (y*LINE_WIDTH + x)*pixelSize;
+
+            if (format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) pixel[1] = (unsigned char)x;
+            else if (format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) pixel[3] = (unsigned char)x;
+        }
+    }
+
+    return image;
+}
+
+// Generate random RGBA8 destination, alpha of line y set to y
+static Image GenImageTarget(void)
+{
+    Image image = { MemAlloc(LINE_WIDTH*LINES*4), LINE_WIDTH, LINES, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+    unsigned char *data = (unsigned char *)image.data;
+
+    for (int i = 0; i < LINE_WIDTH*LINES*4; i++) data[i] = ((i%4) == 3)? (unsigned char)(i/(LINE_WIDTH*4)) : (unsigned char)rand();
+
+    return image;
+}
+
+// Draw source over RGBA8 destination at offset, per pixel path of ImageDraw() (reference)
+static void DrawReference(Image *dst, Image src, int offsetX, int offsetY, Color tint)
+{
+    bool blendRequired = !((tint.a == 255) && ((src.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) ||
+        (src.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) || (src.format == PIXELFORMAT_UNCOMPRESSED_R5G6B5)));
+    int pixelSize = GetPixelDataSize(1, 1, src.format);
+
+    for (int y = 0; y < src.height; y++)
+    {
+        for (int x = 0; x < src.width; x++)
+        {
+            int dx = x + offsetX;
+            int dy = y + offsetY;
+
+            if ((dx < 0) || (dy < 0) || (dx >= dst->width) || (dy >= dst->height)) continue;
+
+            unsigned char *target = (unsigned char *)dst->data + (dy*dst->width + dx)*4;
+            Color colSrc = GetPixelColor((unsigned char *)src.data + (y*src.width + x)*pixelSize, src.format);
+            Color colDst = { target[0], target[1], target[2], target[3] };
+            Color blend = blendRequired? ColorAlphaBlend(colDst, colSrc, tint) : colSrc;
+
+            target[0] = blend.r;
+            target[1] = blend.g;
+            target[2] = blend.b;
+            target[3] = blend.a;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    SetTraceLogLevel(LOG_WARNING);
+
+    srand(1);
+
+    const int offsets[2][2] = { { 0, 0 }, { -5, 3 } };  // Full draw and clipped draw
+    Image target = GenImageTarget();
+    Image expected = ImageCopy(target);
+    Image result = ImageCopy(target);
+    int checks = 0;
+
+    for (int f = 0; f < FORMAT_COUNT; f++)
+    {
+        Image source = GenImageSource(formats[f]);
+        int pixelSize = GetPixelDataSize(1, 1, formats[f]);
+
+        for (int t = 0; t < TINT_COUNT; t++)
+        {
+            // BlendPixelsRGBA8() lines against ColorAlphaBlend()
+            if (f < BLEND_FORMAT_COUNT)
+            {
+                for (int y = 0; y < LINES; y++)
+                {
+                    unsigned char *line = (unsigned char *)expected.data + y*LINE_WIDTH*4;
+                    memcpy(line, (unsigned char *)target.data + y*LINE_WIDTH*4, LINE_WIDTH*4);
+
+                    for (int x = 0; x < LINE_WIDTH; x++)
+                    {
+                        Color colSrc = GetPixelColor((unsigned char *)source.data + (y*LINE_WIDTH + x)*pixelSize, formats[f]);
+                        Color blend = ColorAlphaBlend((Color){ line[x*4], line[x*4 + 1], line[x*4 + 2], line[x*4 + 3] }, colSrc, tints[t]);
+
+                        line[x*4] = blend.r;
+                        line[x*4 + 1] = blend.g;
+                        line[x*4 + 2] = blend.b;
+                        line[x*4 + 3] = blend.a;
+                    }
+                }
+
+                for (int v = 0; v < VARIANT_COUNT; v++)
+                {
+                    memcpy(result.data, target.data, LINE_WIDTH*LINES*4);
+
+                    for (int y = 0; y < LINES; y++)
+                    {
+                        blendPixels[v]((unsigned char *)source.data + y*LINE_WIDTH*pixelSize, formats[f], (unsigned char *)result.data + y*LINE_WIDTH*4, LINE_WIDTH, tints[t]);
+                    }
+
+                    CHECK(memcmp(result.data, expected.data, LINE_WIDTH*LINES*4) == 0, "%s BlendPixelsRGBA8() %s tint %i: differs from ColorAlphaBlend()", variantNames[v], formatNames[f], t);
+                    checks++;
+                }
+            }
+
+            // ImageDraw() against per pixel path
+            for (int o = 0; o < 2; o++)
+            {
+                Rectangle srcRec = { 0, 0, (float)LINE_WIDTH, (float)LINES };
+                Rectangle dstRec = { (float)offsets[o][0], (float)offsets[o][1], (float)LINE_WIDTH, (float)LINES };
+
+                memcpy(expected.data, target.data, LINE_WIDTH*LINES*4);
+                DrawReference(&expected, source, offsets[o][0], offsets[o][1], tints[t]);
+
+                for (int v = 0; v < VARIANT_COUNT; v++)
+                {
+                    memcpy(result.data, target.data, LINE_WIDTH*LINES*4);
+                    imageDraws[v](&result, source, srcRec, dstRec, tints[t]);
+
+                    CHECK(memcmp(result.data, expected.data, LINE_WIDTH*LINES*4) == 0, "%s ImageDraw() %s tint %i offset (%i, %i): differs from per pixel path",
+                        variantNames[v], formatNames[f], t, offsets[o][0], offsets[o][1]);
+                    checks++;
+                }
+            }
+        }
+
+        UnloadImage(source);
+    }
+
+    UnloadImage(target);
+    UnloadImage(expected);
+    UnloadImage(result);
+
+    printf("%s (%i variants, formats and tints)\n", (benchFailures == 0)? "image draw: OK" : "image draw: FAILED", checks);
+
+    return (benchFailures == 0)? 0 : 1;
+}
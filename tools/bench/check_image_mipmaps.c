@@ -0,0 +1,141 @@
+/**********************************************************************************************
+*
+*   check_image_mipmaps - Image manipulation keeps mipmaps of images with mipmaps
+*
+*   Operations replacing image data (ImageResize(), ImageResizeNN(), ImageAlphaPremultiply(),
+*   ImageColor*(), ImageBlurGaussian()) are applied to images with a full mipmap chain, in formats going through
+*   every resize path (8 bit per channel fast path, RGBA8 conversion). Checks:
+*     - mipmaps count is the full chain of the resulting size
+*     - mipmap levels equal ImageMipmaps() of the same operation applied to the base level
+*
+*   NOTE: ImageColorGrayscale() is not checked, it converts every level with ImageFormat()
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+#include "bench.h"
+
+#include <stdlib.h>             // Required for: rand(), srand()
+#include <string.h>             // Required for: memcmp()
+
+#define IMAGE_WIDTH         96
+#define IMAGE_HEIGHT        70
+#define FORMAT_COUNT        4
+#define OPERATION_COUNT     9
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static const int formats[FORMAT_COUNT] = {
+    PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE,
+    PIXELFORMAT_UNCOMPRESSED_R5G6B5, PIXELFORMAT_UNCOMPRESSED_R4G4B4A4
+};
+static const char *formatNames[FORMAT_COUNT] = { "RGBA8", "GRAY", "565", "4444" };
+
+static const char *operationNames[OPERATION_COUNT] = {
+    "ImageResize()", "ImageResizeNN()", "ImageAlphaPremultiply()", "ImageColorTint()", "ImageColorInvert()",
+    "ImageColorContrast()", "ImageColorBrightness()", "ImageColorReplace()", "ImageBlurGaussian()"
+};
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+static void ApplyOperation(Image *image, int operation)
+{
+    switch (operation)
+    {
+        case 0: ImageResize(image, 45, 33); break;
+        case 1: ImageResizeNN(image, 130, 64); break;
+        case 2: ImageAlphaPremultiply(image); break;
+        case 3: ImageColorTint(image, ORANGE); break;
+        case 4: ImageColorInvert(image); break;
+        case 5: ImageColorContrast(image, 40.0f); break;
+        case 6: ImageColorBrightness(image, -30); break;
+        case 7: ImageColorReplace(image, BLACK, RED); break;
+        case 8: ImageBlurGaussian(image, 3); break;
+        default: break;
+    }
+}
+
+// Get mipmaps count of a full chain
+static int GetMipmapsCount(int width, int height)
+{
+    int count = 1;
+
+    while ((width > 1) || (height > 1))
+    {
+        width = (width > 1)? width/2 : 1;
+        height = (height > 1)? height/2 : 1;
+        count++;
+    }
+
+    return count;
+}
+
+// Get image data size, mipmaps included
+static int GetImageDataSize(Image image)
+{
+    int size = 0;
+
+    for (int i = 0, width = image.width, height = image.height; i < image.mipmaps; i++)
+    {
+        size += GetPixelDataSize(width, height, image.format);
+        width = (width > 1)? width/2 : 1;
+        height = (height > 1)? height/2 : 1;
+    }
+
+    return size;
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    SetTraceLogLevel(LOG_ERROR);
+
+    Image source = GenImageColor(IMAGE_WIDTH, IMAGE_HEIGHT, BLANK);
+    unsigned char *data = (unsigned char *)source.data;
+
+    // Random pixels, some of them black (ImageColorReplace())
+    srand(1);
+    for (int i = 0; i < IMAGE_WIDTH*IMAGE_HEIGHT*4; i++) data[i] = ((i/4)%7 == 0)? ((i%4 == 3)? 255 : 0) : (unsigned char)rand();
+
+    int checks = 0;
+
+    for (int f = 0; f < FORMAT_COUNT; f++)
+    {
+        for (int op = 0; op < OPERATION_COUNT; op++)
+        {
+            // Operation on image with mipmaps
+            Image image = ImageCopy(source);
+            ImageFormat(&image, formats[f]);
+            ImageMipmaps(&image);
+            ApplyOperation(&image, op);
+
+            // Operation on base level, mipmaps generated after
+            Image expected = ImageCopy(source);
+            ImageFormat(&expected, formats[f]);
+            ApplyOperation(&expected, op);
+            ImageMipmaps(&expected);
+
+            bool equal = (image.width == expected.width) && (image.height == expected.height) &&
+                (image.format == expected.format) && (image.mipmaps == expected.mipmaps) &&
+                (memcmp(image.data, expected.data, GetImageDataSize(expected)) == 0);
+
+            CHECK(image.mipmaps == GetMipmapsCount(image.width, image.height), "%s %s: %i mipmaps, %i expected",
+                formatNames[f], operationNames[op], image.mipmaps, GetMipmapsCount(image.width, image.height));
+            CHECK(equal, "%s %s: mipmaps differ from base level operation", formatNames[f], operationNames[op]);
+            checks++;
+
+            UnloadImage(image);
+            UnloadImage(expected);
+        }
+    }
+
+    UnloadImage(source);
+
+    printf("%s (%i operations and formats)\n", (benchFailures == 0)? "image mipmaps: OK" : "image mipmaps: FAILED", checks);
+
+    return (benchFailures == 0)? 0 : 1;
+}
@@ -0,0 +1,243 @@
+/**********************************************************************************************
+*
+*   check_raymath - raymath.h SIMD code paths exactness
+*
+*   SIMD code paths perform the same operations in the same order than scalar code, so results
+*   are checked bit for bit against the scalar reference (RAYMATH_DISABLE_SIMD), for the host
+*   SIMD path and for the NEON path (emulated intrinsics on non-ARM hosts):
+*     - MatrixMultiply(), MatrixInvert(): random, affine, projection and singular matrices
+*     - Vector2TransformArray(), Vector3TransformArray(): all counts up to 37, in place too,
+*       also checked against Vector2Transform()/Vector3Transform() one by one
+*     - GetRayCollisionMesh() (transforms vertices in batches) against per vertex transform,
+*       indexed and not indexed meshes
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+#include "bench.h"
+#include "raymath_variants.h"
+
+#define RAYMATH_STATIC_INLINE
+#include "raymath.h"
+
+#include <string.h>             // Required for: memcmp(), memcpy()
+#include <math.h>               // Required for: isnan()
+
+#define MATRIX_TESTS        20000
+#define VECTOR_MAX_COUNT    37
+#define GRID_SIZE           24          // Mesh grid vertices per side (2*23*23 triangles)
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+static float RandomFloat(float min, float max)
+{
+    return min + (max - min)*((float)GetRandomValue(0, 1000000)/1000000.0f);
+}
+
+static Matrix RandomMatrix(int kind)
+{
+    Matrix mat = { 0 };
+
+    switch (kind%4)
+    {
+        case 0: { float *m = &mat.m0; for (int i = 0; i < 16; i++) m[i] = RandomFloat(-10.0f, 10.0f); } break;
+        case 1: mat = MatrixMultiply(MatrixMultiply(MatrixScale(RandomFloat(0.1f, 4.0f), RandomFloat(0.1f, 4.0f), 1.0f),
+                    MatrixRotateXYZ((Vector3){ RandomFloat(-3.0f, 3.0f), RandomFloat(-3.0f, 3.0f), RandomFloat(-3.0f, 3.0f) })),
+                    MatrixTranslate(RandomFloat(-1000.0f, 1000.0f), RandomFloat(-1000.0f, 1000.0f), RandomFloat(-10.0f, 10.0f))); break;
+        case 2: mat = MatrixPerspective(RandomFloat(0.2f, 2.0f), RandomFloat(0.3f, 3.0f), RandomFloat(0.01f, 1.0f), RandomFloat(10.0f, 1000.0f)); break;
+        case 3: { float *m = &mat.m0; for (int i = 0; i < 16; i++) m[i] = (float)GetRandomValue(-3, 3); } break;     // Singular at times
+        default: break;
+    }
+
+    return mat;
+}
+
+// Compare floats bit for bit, NaN values are considered equal (payload not checked)
+static bool FloatsEqual(const float *a, const float *b, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        if (isnan(a[i]) && isnan(b[i])) continue;
+        if (memcmp(&a[i], &b[i], sizeof(float)) != 0) return false;
+    }
+
+    return true;
+}
+
+// Get collision info between ray and mesh, vertices transformed one by one (reference)
+static RayCollision GetRayCollisionMeshReference(Ray ray, Mesh mesh, Matrix transform)
+{
+    RayCollision collision = { 0 };
+    Vector3 *vertdata = (Vector3 *)mesh.vertices;
+
+    for (int i = 0; i < mesh.triangleCount; i++)
+    {
+        Vector3 a = vertdata[mesh.indices? mesh.indices[i*3 + 0] : i*3 + 0];
+        Vector3 b = vertdata[mesh.indices? mesh.indices[i*3 + 1] : i*3 + 1];
+        Vector3 c = vertdata[mesh.indices? mesh.indices[i*3 + 2] : i*3 + 2];
+
+        RayCollision hit = GetRayCollisionTriangle(ray, Vector3Transform(a, transform), Vector3Transform(b, transform), Vector3Transform(c, transform));
+
+        if (hit.hit && ((!collision.hit) || (collision.distance > hit.distance))) collision = hit;
+    }
+
+    return collision;
+}
+
+static int CheckMatrices(const char *name, Matrix (*multiply)(Matrix, Matrix), Matrix (*invert)(Matrix))
+{
+    int failures = 0;
+
+    SetRandomSeed(1);
+
+    for (int i = 0; i < MATRIX_TESTS; i++)
+    {
+        Matrix a = RandomMatrix(i);
+        Matrix b = RandomMatrix(i/4);
+
+        Matrix expected = ScalarMatrixMultiply(a, b);
+        Matrix result = multiply(a, b);
+        if (!FloatsEqual(&expected.m0, &result.m0, 16)) failures++;
+
+        expected = ScalarMatrixInvert(a);
+        result = invert(a);
+        if (!FloatsEqual(&expected.m0, &result.m0, 16)) failures++;
+    }
+
+    CHECK(failures == 0, "%s: %i of %i matrix results differ from scalar", name, failures, MATRIX_TESTS*2);
+
+    return failures;
+}
+
+static int CheckTransforms(const char *name, void (*transform2)(const Vector2 *, Vector2 *, int, Matrix), void (*transform3)(const Vector3 *, Vector3 *, int, Matrix))
+{
+    int failures = 0;
+    Vector2 points2[VECTOR_MAX_COUNT + 1] = { 0 };
+    Vector2 result2[VECTOR_MAX_COUNT + 1] = { 0 };
+    Vector3 points3[VECTOR_MAX_COUNT + 1] = { 0 };
+    Vector3 result3[VECTOR_MAX_COUNT + 1] = { 0 };
+    Vector3 expected3[VECTOR_MAX_COUNT] = { 0 };
+
+    SetRandomSeed(2);
+
+    for (int count = 0; count <= VECTOR_MAX_COUNT; count++)
+    {
+        for (int t = 0; t < 50; t++)
+        {
+            Matrix mat = RandomMatrix(t);
+
+            for (int i = 0; i <= VECTOR_MAX_COUNT; i++)
+            {
+                points2[i] = (Vector2){ RandomFloat(-2000.0f, 2000.0f), RandomFloat(-2000.0f, 2000.0f) };
+                points3[i] = (Vector3){ RandomFloat(-2000.0f, 2000.0f), RandomFloat(-2000.0f, 2000.0f), RandomFloat(-2000.0f, 2000.0f) };
+            }
+
+            // Guard element after last vector must not be written
+            result2[count] = (Vector2){ 1234.0f, 1234.0f };
+            result3[count] = (Vector3){ 1234.0f, 1234.0f, 1234.0f };
+
+            transform2(points2, result2, count, mat);
+            transform3(points3, result3, count, mat);
+            ScalarVector3TransformLoop(points3, expected3, count, mat);
+
+            for (int i = 0; i < count; i++)
+            {
+                Vector2 expected2 = Vector2Transform(points2[i], mat);
+                if (!FloatsEqual(&expected2.x, &result2[i].x, 2)) failures++;
+                if (!FloatsEqual(&expected3[i].x, &result3[i].x, 3)) failures++;
+            }
+
+            if ((result2[count].x != 1234.0f) || (result3[count].z != 1234.0f)) failures++;
+
+            // In place
+            transform2(points2, points2, count, mat);
+            transform3(points3, points3, count, mat);
+            if (!FloatsEqual(&result2[0].x, &points2[0].x, count*2)) failures++;
+            if (!FloatsEqual(&result3[0].x, &points3[0].x, count*3)) failures++;
+        }
+    }
+
+    CHECK(failures == 0, "%s: %i transform arrays differ from one by one transform", name, failures);
+
+    return failures;
+}
+
+static void CheckRayCollisionMesh(void)
+{
+    Vector3 grid[GRID_SIZE*GRID_SIZE] = { 0 };
+    unsigned short indices[(GRID_SIZE - 1)*(GRID_SIZE - 1)*6] = { 0 };
+    Vector3 unrolled[(GRID_SIZE - 1)*(GRID_SIZE - 1)*6] = { 0 };
+    int triangleCount = 0;
+
+    SetRandomSeed(3);
+
+    // Height field grid, indexed and not indexed versions
+    for (int z = 0; z < GRID_SIZE; z++)
+    {
+        for (int x = 0; x < GRID_SIZE; x++) grid[z*GRID_SIZE + x] = (Vector3){ (float)x - GRID_SIZE/2, RandomFloat(-0.5f, 0.5f), (float)z - GRID_SIZE/2 };
+    }
+
+    for (int z = 0; z < (GRID_SIZE - 1); z++)
+    {
+        for (int x = 0; x < (GRID_SIZE - 1); x++)
+        {
+            unsigned short i0 = z*GRID_SIZE + x;
+            unsigned short quad[6] = { i0, i0 + GRID_SIZE, i0 + 1, i0 + 1, i0 + GRID_SIZE, i0 + GRID_SIZE + 1 };
+
+            for (int k = 0; k < 6; k++)
+            {
+                indices[triangleCount*3 + k] = quad[k];
+                unrolled[triangleCount*3 + k] = grid[quad[k]];
+            }
+
+            triangleCount += 2;
+        }
+    }
+
+    Mesh indexed = { .vertexCount = GRID_SIZE*GRID_SIZE, .triangleCount = triangleCount, .vertices = &grid[0].x, .indices = indices };
+    Mesh flat = { .vertexCount = triangleCount*3, .triangleCount = triangleCount, .vertices = &unrolled[0].x };
+
+    int failures = 0;
+    int hits = 0;
+
+    for (int i = 0; i < 2000; i++)
+    {
+        Matrix transform = RandomMatrix(1);
+        Vector3 target = Vector3Transform((Vector3){ RandomFloat(-12.0f, 12.0f), 0.0f, RandomFloat(-12.0f, 12.0f) }, transform);
+        Vector3 origin = Vector3Add(target, (Vector3){ RandomFloat(-50.0f, 50.0f), RandomFloat(-50.0f, 50.0f), RandomFloat(-50.0f, 50.0f) });
+        Ray ray = { origin, Vector3Normalize(Vector3Subtract(target, origin)) };
+
+        Mesh mesh = (i%2 == 0)? indexed : flat;
+        RayCollision expected = GetRayCollisionMeshReference(ray, mesh, transform);
+        RayCollision result = GetRayCollisionMesh(ray, mesh, transform);
+
+        if ((expected.hit != result.hit) || !FloatsEqual(&expected.distance, &result.distance, 1) ||
+            !FloatsEqual(&expected.point.x, &result.point.x, 3) || !FloatsEqual(&expected.normal.x, &result.normal.x, 3)) failures++;
+        if (result.hit) hits++;
+    }
+
+    CHECK(failures == 0, "GetRayCollisionMesh(): %i of 2000 collisions differ from per vertex transform", failures);
+    CHECK(hits > 0, "GetRayCollisionMesh(): no ray hit, test not meaningful");
+
+    printf("GetRayCollisionMesh(): %i triangles, %i/2000 hits\n", triangleCount, hits);
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    SetTraceLogLevel(LOG_WARNING);
+
+    CheckMatrices("simd", SimdMatrixMultiply, SimdMatrixInvert);
+    CheckMatrices("neon (emulated)", NeonMatrixMultiply, NeonMatrixInvert);
+    CheckTransforms("scalar", ScalarVector2TransformArray, ScalarVector3TransformArray);
+    CheckTransforms("simd", SimdVector2TransformArray, SimdVector3TransformArray);
+    CheckTransforms("neon (emulated)", NeonVector2TransformArray, NeonVector3TransformArray);
+    CheckRayCollisionMesh();
+
+    printf("%s\n", (benchFailures == 0)? "raymath: OK" : "raymath: FAILED");
+
+    return (benchFailures == 0)? 0 : 1;
+}
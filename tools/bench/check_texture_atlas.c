@@ -0,0 +1,225 @@
+/**********************************************************************************************
+*
+*   check_texture_atlas - Texture atlas add/remove/defrag stress (LoadTextureAtlas())
+*
+*   OPERATIONS random adds (4x4 to 80x80 images, RGBA8 and converted formats) and removes on an
+*   atlas of 512x512 pages, padding 2, 3 pages max: pages fill up and least recently used images
+*   get evicted. DefragTextureAtlas() every DEFRAG_INTERVAL operations. Checks:
+*     - removed handles are not valid anymore, evicted images report texture id 0
+*     - regions lie in their page, padded rectangles of a page do not overlap
+*     - after every defrag, page texture contents (null driver RGBA8 textures) match every image,
+*       padding filled with extruded image edges
+*     - compressed format images are rejected
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+#include "bench.h"
+
+#include <GLES2/gl2.h>
+
+#include <stdlib.h>             // Required for: rand(), srand()
+#include <string.h>             // Required for: memcmp()
+
+#define PAGE_SIZE           512
+#define PADDING             2
+#define MAX_PAGES           3
+#define OPERATIONS          3000
+#define DEFRAG_INTERVAL     100
+#define MAX_ENTRIES         4096
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Image added to atlas, expected contents kept as RGBA8
+typedef struct AtlasEntry {
+    int handle;
+    Image image;
+} AtlasEntry;
+
+//----------------------------------------------------------------------------------
+// Other Modules Functions Declaration
+//----------------------------------------------------------------------------------
+extern const unsigned char *GetNullTexturePixels(GLuint texture, int *width, int *height);     // [Module: gles2_null]
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static AtlasEntry entries[MAX_ENTRIES] = { 0 };
+static int entryCount = 0;
+static int evictedCount = 0;
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Remove entry from list, last entry moved in its place
+static void RemoveEntry(int index)
+{
+    UnloadImage(entries[index].image);
+    entries[index] = entries[--entryCount];
+}
+
+// Check regions of every entry, evicted entries are removed from list
+// NOTE: Getting regions updates images last use, eviction order follows checks order
+static void CheckRegions(TextureAtlas *atlas, int operation)
+{
+    static AtlasRegion regions[MAX_ENTRIES] = { 0 };
+
+    for (int i = 0; i < entryCount; i++)
+    {
+        regions[i] = GetTextureAtlasRegion(atlas, entries[i].handle);
+
+        if (regions[i].texture.id == 0)
+        {
+            RemoveEntry(i--);
+            evictedCount++;
+            continue;
+        }
+
+        Rectangle rec = regions[i].source;
+
+        CHECK((rec.width == entries[i].image.width) && (rec.height == entries[i].image.height) &&
+            (rec.x >= PADDING) && (rec.y >= PADDING) && (rec.x + rec.width + PADDING <= PAGE_SIZE) && (rec.y + rec.height + PADDING <= PAGE_SIZE),
+            "operation %i: region (%g, %g, %g, %g) out of page or wrong size", operation, rec.x, rec.y, rec.width, rec.height);
+
+        for (int k = 0; k < i; k++)
+        {
+            Rectangle other = regions[k].source;
+
+            if (regions[k].texture.id != regions[i].texture.id) continue;
+
+            bool overlap = (rec.x - PADDING < other.x + other.width + PADDING) && (other.x - PADDING < rec.x + rec.width + PADDING) &&
+                (rec.y - PADDING < other.y + other.height + PADDING) && (other.y - PADDING < rec.y + rec.height + PADDING);
+
+            CHECK(!overlap, "operation %i: regions (%g, %g) and (%g, %g) overlap", operation, rec.x, rec.y, other.x, other.y);
+        }
+    }
+}
+
+// Check page texture contents of every entry, padding included
+static void CheckContents(TextureAtlas *atlas, int operation)
+{
+    for (int i = 0; i < entryCount; i++)
+    {
+        AtlasRegion region = GetTextureAtlasRegion(atlas, entries[i].handle);
+        int pageWidth = 0;
+        int pageHeight = 0;
+        const unsigned char *pixels = GetNullTexturePixels(region.texture.id, &pageWidth, &pageHeight);
+
+        if ((region.texture.id == 0) || (pixels == NULL))
+        {
+            CHECK(false, "operation %i: image %i page texture not available", operation, i);
+            continue;
+        }
+
+        const Image image = entries[i].image;
+        const unsigned char *expected = (const unsigned char *)image.data;
+        int x = (int)region.source.x;
+        int y = (int)region.source.y;
+        bool equal = true;
+
+        for (int py = y - PADDING; py < y + image.height + PADDING; py++)
+        {
+            for (int px = x - PADDING; px < x + image.width + PADDING; px++)
+            {
+                int sx = (px < x)? 0 : ((px >= x + image.width)? image.width - 1 : px - x);
+                int sy = (py < y)? 0 : ((py >= y + image.height)? image.height - 1 : py - y);
+
+                if (memcmp(pixels + (py*pageWidth + px)*4, expected + (sy*image.width + sx)*4, 4) != 0) equal = false;
+            }
+        }
+
+        CHECK(equal, "operation %i: image %i (%ix%i) contents or padding differ in page", operation, i, image.width, image.height);
+    }
+}
+
+// Generate random image, expected RGBA8 contents returned with converted format image
+static Image GenImageRandom(Image *expected)
+{
+    const int formats[3] = { PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, PIXELFORMAT_UNCOMPRESSED_R8G8B8, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA };
+    Image image = GenImageColor(4 + rand()%77, 4 + rand()%77, BLANK);
+    unsigned char *data = (unsigned char *)image.data;
+
+    for (int i = 0; i < image.width*image.height*4; i++) data[i] = (unsigned char)rand();
+
+    ImageFormat(&image, formats[rand()%3]);
+
+    // Expected contents go through the same conversion
+    *expected = ImageCopy(image);
+    ImageFormat(expected, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+    return image;
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    SetTraceLogLevel(LOG_ERROR);
+    InitWindow(0, 0, "check_texture_atlas");
+
+    TextureAtlas *atlas = LoadTextureAtlas(PAGE_SIZE, PAGE_SIZE, PADDING, MAX_PAGES);
+    int adds = 0;
+    int removes = 0;
+    int defrags = 0;
+
+    srand(1);
+
+    for (int op = 1; op <= OPERATIONS; op++)
+    {
+        if ((entryCount == 0) || ((rand()%10) < 6))
+        {
+            Image expected = { 0 };
+            Image image = GenImageRandom(&expected);
+            int handle = AddTextureAtlasImage(atlas, image);
+
+            UnloadImage(image);
+            CHECK(handle >= 0, "operation %i: image (%ix%i) not added", op, expected.width, expected.height);
+
+            if ((handle >= 0) && (entryCount < MAX_ENTRIES)) entries[entryCount++] = (AtlasEntry){ handle, expected };
+            else UnloadImage(expected);
+            adds++;
+        }
+        else
+        {
+            int index = rand()%entryCount;
+            int handle = entries[index].handle;
+
+            RemoveTextureAtlasImage(atlas, handle);
+            CHECK(GetTextureAtlasRegion(atlas, handle).texture.id == 0, "operation %i: removed handle still valid", op);
+            RemoveEntry(index);
+            removes++;
+        }
+
+        CheckRegions(atlas, op);
+
+        if ((op%DEFRAG_INTERVAL) == 0)
+        {
+            DefragTextureAtlas(atlas);
+            CheckRegions(atlas, op);
+            CheckContents(atlas, op);
+            defrags++;
+        }
+    }
+
+    // Pages fill, padding included
+    int usedArea = 0;
+    for (int i = 0; i < entryCount; i++) usedArea += (entries[i].image.width + 2*PADDING)*(entries[i].image.height + 2*PADDING);
+
+    printf("%i adds, %i removes, %i defrags: %i images in atlas, %i evicted, pages %.0f%% full\n",
+        adds, removes, defrags, entryCount, evictedCount, 100.0f*usedArea/(MAX_PAGES*PAGE_SIZE*PAGE_SIZE));
+
+    // Compressed formats are rejected, their data can not be copied to pages
+    unsigned char blocks[8*8/2] = { 0 };
+    Image compressed = { blocks, 8, 8, 1, PIXELFORMAT_COMPRESSED_DXT1_RGB };
+    CHECK(AddTextureAtlasImage(atlas, compressed) == -1, "compressed image added to atlas");
+
+    for (int i = 0; i < entryCount; i++) UnloadImage(entries[i].image);
+    UnloadTextureAtlas(atlas);
+    CloseWindow();
+
+    printf("%s (%i operations)\n", (benchFailures == 0)? "texture atlas: OK" : "texture atlas: FAILED", OPERATIONS);
+
+    return (benchFailures == 0)? 0 : 1;
+}
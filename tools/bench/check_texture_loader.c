@@ -0,0 +1,157 @@
+/**********************************************************************************************
+*
+*   check_texture_loader - Asynchronous texture loading (LoadTextureAsync)
+*
+*   Uploads go to a fake sink (SetUploadTextureCallback) that records bytes per frame, frames
+*   are driven by EndDrawing(). Checks:
+*     - all requests complete with the decoded size, missing files complete with id 0
+*     - uploaded bytes per frame stay within budget (single textures over budget excepted)
+*     - CloseWindow() with requests still queued completes them (not uploaded) and joins
+*       loader threads, loading works again after the next InitWindow()
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+#include "bench.h"
+
+#include <unistd.h>             // Required for: usleep()
+
+#define IMAGE_COUNT         20
+#define UPLOAD_BUDGET       (600*1024)
+#define MAX_FRAMES          5000
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static int uploadCount = 0;
+static int frameBytes = 0;
+static int frameUploads = 0;
+static unsigned int nextId = 1;
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Fake upload sink, records uploaded bytes, no GPU texture created
+static Texture2D FakeUpload(Image image)
+{
+    int size = GetPixelDataSize(image.width, image.height, image.format);
+
+    frameBytes += size;
+    frameUploads++;
+    uploadCount++;
+
+    return (Texture2D){ nextId++, image.width, image.height, image.mipmaps, image.format };
+}
+
+static const char *GetImagePath(int index)
+{
+    return GetBenchTempPath(TextFormat("loader%02i.%s", index, (index%2)? "qoi" : "png"));
+}
+
+// Run frames until all requests (except skipped one) are done, returns frames run
+static int RunFrames(Texture2D **textures, int count, int skip, int *maxFrameBytes)
+{
+    int frames = 0;
+
+    for (; frames < MAX_FRAMES; frames++)
+    {
+        bool done = true;
+        for (int i = 0; i < count; i++) if ((i != skip) && !IsTextureAsyncDone(textures[i])) done = false;
+        if (done) break;
+
+        frameBytes = 0;
+        frameUploads = 0;
+        BeginDrawing();
+        EndDrawing();           // Calls UpdateTextureUploads()
+
+        // NOTE: A texture bigger than budget is allowed, uploaded alone in its frame
+        if ((frameUploads > 1) && (frameBytes > *maxFrameBytes)) *maxFrameBytes = frameBytes;
+
+        usleep(500);
+    }
+
+    return frames;
+}
+
+// Release textures loaded with the fake sink (ids not valid for rlgl)
+static void UnloadFakeTextures(Texture2D **textures, int count, int skip)
+{
+    for (int i = 0; i < count; i++)
+    {
+        if (i == skip) continue;
+        textures[i]->id = 0;
+        UnloadTextureAsync(textures[i]);
+    }
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    SetTraceLogLevel(LOG_WARNING);
+
+    for (int i = 0; i < IMAGE_COUNT; i++)
+    {
+        Image image = GenImageColor(256 + i*8, 256, (Color){ i, 2*i, 3*i, 255 });
+        ExportImage(image, GetImagePath(i));
+        UnloadImage(image);
+    }
+
+    InitWindow(0, 0, "check_texture_loader");
+    SetUploadTextureCallback(FakeUpload);
+    SetTextureUploadBudget(UPLOAD_BUDGET, 100.0f);
+
+    // Load all, one missing file and one cancelled request
+    Texture2D *textures[IMAGE_COUNT + 1] = { 0 };
+    for (int i = 0; i < IMAGE_COUNT; i++) textures[i] = LoadTextureAsync(GetImagePath(i));
+    textures[IMAGE_COUNT] = LoadTextureAsync(GetBenchTempPath("missing.png"));
+    UnloadTextureAsync(textures[5]);
+
+    int maxFrameBytes = 0;
+    int frames = RunFrames(textures, IMAGE_COUNT + 1, 5, &maxFrameBytes);
+
+    CHECK(frames < MAX_FRAMES, "requests not done after %i frames", MAX_FRAMES);
+    CHECK(uploadCount == IMAGE_COUNT - 1, "uploads: %i, expected %i", uploadCount, IMAGE_COUNT - 1);
+    CHECK(maxFrameBytes <= UPLOAD_BUDGET, "frame uploaded %i bytes, budget %i", maxFrameBytes, UPLOAD_BUDGET);
+    for (int i = 0; i < IMAGE_COUNT; i++)
+    {
+        if (i == 5) continue;
+        CHECK((textures[i]->id != 0) && (textures[i]->width == 256 + i*8), "texture %i: id %u, width %i", i, textures[i]->id, textures[i]->width);
+    }
+    CHECK(IsTextureAsyncDone(textures[IMAGE_COUNT]) && (textures[IMAGE_COUNT]->id == 0), "missing file: id %u", textures[IMAGE_COUNT]->id);
+
+    printf("load: %i textures in %i frames, max %i bytes per frame (budget %i)\n", uploadCount, frames, maxFrameBytes, UPLOAD_BUDGET);
+
+    UnloadFakeTextures(textures, IMAGE_COUNT + 1, 5);
+
+    // Close with requests still queued: all completed without upload, none leaked
+    uploadCount = 0;
+    for (int i = 0; i < IMAGE_COUNT; i++) textures[i] = LoadTextureAsync(GetImagePath(i));
+    UnloadTextureAsync(textures[3]);
+
+    CloseWindow();
+
+    int notDone = 0;
+    for (int i = 0; i < IMAGE_COUNT; i++) if ((i != 3) && (!IsTextureAsyncDone(textures[i]) || (textures[i]->id != 0))) notDone++;
+    CHECK(notDone == 0, "after close: %i requests not completed", notDone);
+    CHECK(uploadCount == 0, "after close: %i uploads", uploadCount);
+
+    UnloadFakeTextures(textures, IMAGE_COUNT, 3);
+
+    // Restart: loader threads created again
+    InitWindow(0, 0, "check_texture_loader");
+    SetUploadTextureCallback(FakeUpload);
+
+    Texture2D *texture = LoadTextureAsync(GetImagePath(0));
+    frames = RunFrames(&texture, 1, -1, &maxFrameBytes);
+    CHECK((texture->id != 0) && (texture->width == 256), "restart: id %u, width %i", texture->id, texture->width);
+
+    UnloadFakeTextures(&texture, 1, -1);
+    SetUploadTextureCallback(NULL);
+    CloseWindow();
+
+    printf("%s\n", (benchFailures == 0)? "texture loader: OK" : "texture loader: FAILED");
+
+    return (benchFailures == 0)? 0 : 1;
+}
@@ -0,0 +1,116 @@
+/**********************************************************************************************
+*
+*   check_vertex_array - Bulk vertex submission (rlVertexArray2f) on every render batch size
+*
+*   Triangles, lines and quads are submitted with rlVertexArray2f() and with one rlVertex2f()
+*   per vertex to render batches of 1 to 64 elements (quads). Checks:
+*     - submission completes on batches too small for an aligned chunk (less than 4 quads)
+*     - vertex counted on the frame are the same for both submissions
+*       (flushes are not: chunks are aligned to 12 vertex, batches fill less before flushing)
+*     - current texcoord and color are not changed by rlVertexArray2f()
+*
+*   NOTE: A hang is reported as a failure by an alarm (CHECK_TIMEOUT seconds)
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+#include "rlgl.h"
+#include "bench.h"
+
+#include <unistd.h>             // Required for: alarm()
+
+#define VERTEX_COUNT        120         // Multiple of 2, 3 and 4 vertex primitives
+#define BATCH_SIZES         7
+#define CHECK_TIMEOUT       20
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Submit vertex to a render batch of given size, returns stats of submission frame
+static rlRenderStats SubmitVertex(int batchElements, int mode, const float *positions, const unsigned char *colors, bool bulk)
+{
+    rlRenderBatch batch = rlLoadRenderBatch(1, batchElements);
+    rlSetRenderBatchActive(&batch);
+    rlEndFrameStats();
+
+    rlBegin(mode);
+        if (bulk) rlVertexArray2f(positions, NULL, colors, VERTEX_COUNT);
+        else
+        {
+            for (int i = 0; i < VERTEX_COUNT; i++)
+            {
+                rlColor4ub(colors[4*i], colors[4*i + 1], colors[4*i + 2], colors[4*i + 3]);
+                rlVertex2f(positions[2*i], positions[2*i + 1]);
+            }
+        }
+    rlEnd();
+
+    rlDrawRenderBatchActive();
+    rlEndFrameStats();
+    rlSetRenderBatchActive(NULL);
+    rlUnloadRenderBatch(batch);
+
+    return rlGetRenderStats();
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    SetTraceLogLevel(LOG_WARNING);
+    InitWindow(0, 0, "check_vertex_array");
+    alarm(CHECK_TIMEOUT);
+
+    float positions[2*VERTEX_COUNT] = { 0 };
+    unsigned char colors[4*VERTEX_COUNT] = { 0 };
+
+    for (int i = 0; i < VERTEX_COUNT; i++)
+    {
+        positions[2*i] = (float)(i%10)*8.0f;
+        positions[2*i + 1] = (float)(i/10)*8.0f;
+        colors[4*i] = (unsigned char)i;
+        colors[4*i + 3] = 255;
+    }
+
+    const int batchSizes[BATCH_SIZES] = { 1, 2, 3, 4, 5, 8, 64 };
+    const int modes[3] = { RL_LINES, RL_TRIANGLES, RL_QUADS };
+    const char *modeNames[3] = { "lines", "triangles", "quads" };
+    int checks = 0;
+
+    for (int s = 0; s < BATCH_SIZES; s++)
+    {
+        for (int m = 0; m < 3; m++)
+        {
+            rlColor4ub(1, 2, 3, 4);
+            rlTexCoord2f(0.25f, 0.75f);
+            rlRenderStats bulk = SubmitVertex(batchSizes[s], modes[m], positions, colors, true);
+
+            // Current color and texcoord are read back through a vertex without arrays
+            rlRenderBatch batch = rlLoadRenderBatch(1, 4);
+            rlSetRenderBatchActive(&batch);
+            rlBegin(RL_QUADS);
+                rlVertex2f(0.0f, 0.0f);
+            rlEnd();
+
+            const unsigned char *color = batch.vertexBuffer[0].colors;
+            const float *texcoord = batch.vertexBuffer[0].texcoords;
+            CHECK((color[0] == 1) && (color[1] == 2) && (color[2] == 3) && (color[3] == 4) && (texcoord[0] == 0.25f) && (texcoord[1] == 0.75f),
+                "%i elements %s: current color or texcoord changed", batchSizes[s], modeNames[m]);
+
+            rlSetRenderBatchActive(NULL);
+            rlUnloadRenderBatch(batch);
+
+            rlRenderStats single = SubmitVertex(batchSizes[s], modes[m], positions, colors, false);
+
+            CHECK(bulk.vertices == single.vertices, "%i elements %s: %i vertex, %i expected", batchSizes[s], modeNames[m], bulk.vertices, single.vertices);
+            checks++;
+        }
+    }
+
+    CloseWindow();
+
+    printf("%s (%i batch sizes and modes)\n", (benchFailures == 0)? "vertex array: OK" : "vertex array: FAILED", checks);
+
+    return (benchFailures == 0)? 0 : 1;
+}
@@ -0,0 +1,282 @@
+/**********************************************************************************************
+*
+*   gles2_null - OpenGL ES 2.0 null driver for headless host benchmarks and checks
+*
+*   Every GL entry point used by rlgl is implemented as a no-op that keeps just enough state
+*   for rlgl to initialize: object ids are handed out in sequence, shaders always compile and
+*   link, framebuffers are always complete and pixels read back are zero.
+*   RGBA8 textures keep their contents (level 0), available to checks through GetNullTexturePixels().
+*
+*   Extensions reported: VAOs and instancing (loaded through GetNullProcAddress()), NPOT textures.
+*   No pixel pack buffers are reported (version string is OpenGL ES 2.0), so screen readback
+*   takes the synchronous path.
+*
+*   Draw calls and vertex counts are available through rlGetRenderStats(), GPU time is not
+*   measured: numbers from tools/bench harnesses are CPU-side only.
+*
+**********************************************************************************************/
+
+#include <GLES2/gl2.h>
+#include <GLES2/gl2ext.h>
+
+#include <stdlib.h>             // Required for: realloc(), free()
+#include <string.h>             // Required for: memset(), memcpy(), strcmp()
+
+#define MAX_TEXTURE_UNITS       16
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static GLuint nextObjectId = 1;                 // Ids for textures, buffers, framebuffers, renderbuffers and VAOs
+static GLuint nextProgramId = 1;                // Ids for shaders and programs
+static GLint nextLocation = 0;                  // Attribute and uniform locations
+
+// RGBA8 textures contents, indexed by texture id
+static struct NullTexture { int width; int height; unsigned char *pixels; } *textures = NULL;
+static GLuint textureCapacity = 0;
+static GLuint boundTextures[MAX_TEXTURE_UNITS] = { 0 };
+static int activeUnit = 0;
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+static void GenIds(GLsizei n, GLuint *ids) { for (GLsizei i = 0; i < n; i++) ids[i] = nextObjectId++; }
+
+// Get texture bound to active unit, NULL if none or its contents are not kept
+static struct NullTexture *GetBoundTexture(GLenum target, GLint level, GLenum format, GLenum type)
+{
+    GLuint id = boundTextures[activeUnit];
+
+    if ((target != GL_TEXTURE_2D) || (level != 0) || (format != GL_RGBA) || (type != GL_UNSIGNED_BYTE) || (id == 0)) return NULL;
+
+    if (id >= textureCapacity)
+    {
+        GLuint capacity = (id + 1)*2;
+        textures = realloc(textures, capacity*sizeof(textures[0]));
+        memset(textures + textureCapacity, 0, (capacity - textureCapacity)*sizeof(textures[0]));
+        textureCapacity = capacity;
+    }
+
+    return &textures[id];
+}
+
+// Extensions, loaded by rlLoadExtensions()
+static void GL_APIENTRY NullGenVertexArraysOES(GLsizei n, GLuint *arrays) { GenIds(n, arrays); }
+static void GL_APIENTRY NullBindVertexArrayOES(GLuint array) { (void)array; }
+static void GL_APIENTRY NullDeleteVertexArraysOES(GLsizei n, const GLuint *arrays) { (void)n; (void)arrays; }
+static void GL_APIENTRY NullDrawArraysInstancedEXT(GLenum mode, GLint start, GLsizei count, GLsizei primcount) { (void)mode; (void)start; (void)count; (void)primcount; }
+static void GL_APIENTRY NullDrawElementsInstancedEXT(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei primcount) { (void)mode; (void)count; (void)type; (void)indices; (void)primcount; }
+static void GL_APIENTRY NullVertexAttribDivisorEXT(GLuint index, GLuint divisor) { (void)index; (void)divisor; }
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Get extension function address, passed to rlLoadExtensions()
+void *GetNullProcAddress(const char *name)
+{
+    static const struct { const char *name; void *proc; } procs[] = {
+        { "glGenVertexArraysOES", (void *)NullGenVertexArraysOES },
+        { "glBindVertexArrayOES", (void *)NullBindVertexArrayOES },
+        { "glDeleteVertexArraysOES", (void *)NullDeleteVertexArraysOES },
+        { "glDrawArraysInstancedEXT", (void *)NullDrawArraysInstancedEXT },
+        { "glDrawElementsInstancedEXT", (void *)NullDrawElementsInstancedEXT },
+        { "glVertexAttribDivisorEXT", (void *)NullVertexAttribDivisorEXT },
+    };
+
+    for (unsigned int i = 0; i < sizeof(procs)/sizeof(procs[0]); i++)
+    {
+        if (strcmp(procs[i].name, name) == 0) return procs[i].proc;
+    }
+
+    return NULL;
+}
+
+// Get RGBA8 texture contents (level 0), NULL if texture has no RGBA8 data
+const unsigned char *GetNullTexturePixels(GLuint texture, int *width, int *height)
+{
+    if ((texture >= textureCapacity) || (textures[texture].pixels == NULL)) return NULL;
+
+    *width = textures[texture].width;
+    *height = textures[texture].height;
+
+    return textures[texture].pixels;
+}
+
+// State queries
+const GLubyte *GL_APIENTRY glGetString(GLenum name)
+{
+    switch (name)
+    {
+        case GL_VENDOR: return (const GLubyte *)"raylib";
+        case GL_RENDERER: return (const GLubyte *)"null";
+        case GL_VERSION: return (const GLubyte *)"OpenGL ES 2.0 null";
+        case GL_SHADING_LANGUAGE_VERSION: return (const GLubyte *)"OpenGL ES GLSL ES 1.00";
+        case GL_EXTENSIONS: return (const GLubyte *)"GL_OES_vertex_array_object GL_EXT_draw_instanced GL_EXT_instanced_arrays GL_OES_texture_npot GL_OES_depth24";
+        default: return (const GLubyte *)"";
+    }
+}
+
+void GL_APIENTRY glGetIntegerv(GLenum pname, GLint *data)
+{
+    switch (pname)
+    {
+        case GL_MAX_TEXTURE_SIZE: *data = 8192; break;
+        case GL_MAX_CUBE_MAP_TEXTURE_SIZE: *data = 8192; break;
+        case GL_MAX_TEXTURE_IMAGE_UNITS: *data = 16; break;
+        case GL_MAX_VERTEX_ATTRIBS: *data = 16; break;
+        default: *data = 0; break;
+    }
+}
+
+void GL_APIENTRY glGetFloatv(GLenum pname, GLfloat *data) { *data = (pname == GL_LINE_WIDTH)? 1.0f : 0.0f; }
+GLenum GL_APIENTRY glGetError(void) { return GL_NO_ERROR; }
+GLenum GL_APIENTRY glCheckFramebufferStatus(GLenum target) { (void)target; return GL_FRAMEBUFFER_COMPLETE; }
+void GL_APIENTRY glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) { (void)target; (void)attachment; (void)pname; *params = 0; }
+
+// Objects
+void GL_APIENTRY glGenTextures(GLsizei n, GLuint *textures) { GenIds(n, textures); }
+void GL_APIENTRY glGenBuffers(GLsizei n, GLuint *buffers) { GenIds(n, buffers); }
+void GL_APIENTRY glGenFramebuffers(GLsizei n, GLuint *framebuffers) { GenIds(n, framebuffers); }
+void GL_APIENTRY glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) { GenIds(n, renderbuffers); }
+void GL_APIENTRY glDeleteTextures(GLsizei n, const GLuint *ids)
+{
+    for (GLsizei i = 0; i < n; i++)
+    {
+        if (ids[i] < textureCapacity)
+        {
+            free(textures[ids[i]].pixels);
+            textures[ids[i]] = (struct NullTexture){ 0 };
+        }
+    }
+}
+
+void GL_APIENTRY glDeleteBuffers(GLsizei n, const GLuint *buffers) { (void)n; (void)buffers; }
+void GL_APIENTRY glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) { (void)n; (void)framebuffers; }
+void GL_APIENTRY glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) { (void)n; (void)renderbuffers; }
+void GL_APIENTRY glBindTexture(GLenum target, GLuint texture) { if (target == GL_TEXTURE_2D) boundTextures[activeUnit] = texture; }
+void GL_APIENTRY glBindBuffer(GLenum target, GLuint buffer) { (void)target; (void)buffer; }
+void GL_APIENTRY glBindFramebuffer(GLenum target, GLuint framebuffer) { (void)target; (void)framebuffer; }
+void GL_APIENTRY glBindRenderbuffer(GLenum target, GLuint renderbuffer) { (void)target; (void)renderbuffer; }
+void GL_APIENTRY glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) { (void)target; (void)attachment; (void)textarget; (void)texture; (void)level; }
+void GL_APIENTRY glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) { (void)target; (void)attachment; (void)renderbuffertarget; (void)renderbuffer; }
+void GL_APIENTRY glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) { (void)target; (void)internalformat; (void)width; (void)height; }
+
+// Buffers and textures data
+void GL_APIENTRY glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) { (void)target; (void)size; (void)data; (void)usage; }
+void GL_APIENTRY glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) { (void)target; (void)offset; (void)size; (void)data; }
+void GL_APIENTRY glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) { (void)target; (void)level; (void)internalformat; (void)width; (void)height; (void)border; (void)imageSize; (void)data; }
+void GL_APIENTRY glTexParameterf(GLenum target, GLenum pname, GLfloat param) { (void)target; (void)pname; (void)param; }
+void GL_APIENTRY glTexParameteri(GLenum target, GLenum pname, GLint param) { (void)target; (void)pname; (void)param; }
+void GL_APIENTRY glGenerateMipmap(GLenum target) { (void)target; }
+void GL_APIENTRY glPixelStorei(GLenum pname, GLint param) { (void)pname; (void)param; }
+void GL_APIENTRY glActiveTexture(GLenum texture) { activeUnit = (int)(texture - GL_TEXTURE0)%MAX_TEXTURE_UNITS; }
+
+// NOTE: Rows are expected tightly packed, rlgl uploads with GL_UNPACK_ALIGNMENT 1
+void GL_APIENTRY glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+    (void)internalformat; (void)border;
+    struct NullTexture *texture = GetBoundTexture(target, level, format, type);
+
+    if (texture != NULL)
+    {
+        texture->pixels = realloc(texture->pixels, (size_t)width*height*4);
+        texture->width = width;
+        texture->height = height;
+
+        if (pixels != NULL) memcpy(texture->pixels, pixels, (size_t)width*height*4);
+        else memset(texture->pixels, 0, (size_t)width*height*4);
+    }
+}
+
+void GL_APIENTRY glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels)
+{
+    struct NullTexture *texture = GetBoundTexture(target, level, format, type);
+
+    if ((texture != NULL) && (texture->pixels != NULL) && (xoffset >= 0) && (yoffset >= 0) &&
+        (xoffset + width <= texture->width) && (yoffset + height <= texture->height))
+    {
+        for (int j = 0; j < height; j++)
+        {
+            memcpy(texture->pixels + ((size_t)(yoffset + j)*texture->width + xoffset)*4, (const unsigned char *)pixels + (size_t)j*width*4, (size_t)width*4);
+        }
+    }
+}
+
+// NOTE: Only RGBA unsigned byte readback is used by rlgl
+void GL_APIENTRY glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels)
+{
+    (void)x; (void)y; (void)format; (void)type;
+    memset(pixels, 0, (size_t)width*height*4);
+}
+
+// Shaders
+GLuint GL_APIENTRY glCreateShader(GLenum type) { (void)type; return nextProgramId++; }
+GLuint GL_APIENTRY glCreateProgram(void) { return nextProgramId++; }
+void GL_APIENTRY glShaderSource(GLuint shader, GLsizei count, const GLchar *const *string, const GLint *length) { (void)shader; (void)count; (void)string; (void)length; }
+void GL_APIENTRY glCompileShader(GLuint shader) { (void)shader; }
+void GL_APIENTRY glAttachShader(GLuint program, GLuint shader) { (void)program; (void)shader; }
+void GL_APIENTRY glDetachShader(GLuint program, GLuint shader) { (void)program; (void)shader; }
+void GL_APIENTRY glLinkProgram(GLuint program) { (void)program; }
+void GL_APIENTRY glUseProgram(GLuint program) { (void)program; }
+void GL_APIENTRY glDeleteShader(GLuint shader) { (void)shader; }
+void GL_APIENTRY glDeleteProgram(GLuint program) { (void)program; }
+void GL_APIENTRY glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) { (void)program; (void)index; (void)name; }
+void GL_APIENTRY glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) { (void)shader; (void)bufSize; if (length != NULL) *length = 0; if (bufSize > 0) infoLog[0] = '\0'; }
+void GL_APIENTRY glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) { (void)program; (void)bufSize; if (length != NULL) *length = 0; if (bufSize > 0) infoLog[0] = '\0'; }
+
+void GL_APIENTRY glGetShaderiv(GLuint shader, GLenum pname, GLint *params)
+{
+    (void)shader;
+    *params = (pname == GL_COMPILE_STATUS)? GL_TRUE : 0;
+}
+
+void GL_APIENTRY glGetProgramiv(GLuint program, GLenum pname, GLint *params)
+{
+    (void)program;
+    *params = (pname == GL_LINK_STATUS)? GL_TRUE : 0;
+}
+
+// NOTE: Every attribute and uniform gets its own location, none is reported missing
+GLint GL_APIENTRY glGetAttribLocation(GLuint program, const GLchar *name) { (void)program; (void)name; return (nextLocation++)%16; }
+GLint GL_APIENTRY glGetUniformLocation(GLuint program, const GLchar *name) { (void)program; (void)name; return nextLocation++; }
+
+// Uniforms and attributes
+void GL_APIENTRY glUniform1i(GLint location, GLint v0) { (void)location; (void)v0; }
+void GL_APIENTRY glUniform2f(GLint location, GLfloat v0, GLfloat v1) { (void)location; (void)v0; (void)v1; }
+void GL_APIENTRY glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) { (void)location; (void)v0; (void)v1; (void)v2; (void)v3; }
+void GL_APIENTRY glUniform1fv(GLint location, GLsizei count, const GLfloat *value) { (void)location; (void)count; (void)value; }
+void GL_APIENTRY glUniform2fv(GLint location, GLsizei count, const GLfloat *value) { (void)location; (void)count; (void)value; }
+void GL_APIENTRY glUniform3fv(GLint location, GLsizei count, const GLfloat *value) { (void)location; (void)count; (void)value; }
+void GL_APIENTRY glUniform4fv(GLint location, GLsizei count, const GLfloat *value) { (void)location; (void)count; (void)value; }
+void GL_APIENTRY glUniform1iv(GLint location, GLsizei count, const GLint *value) { (void)location; (void)count; (void)value; }
+void GL_APIENTRY glUniform2iv(GLint location, GLsizei count, const GLint *value) { (void)location; (void)count; (void)value; }
+void GL_APIENTRY glUniform3iv(GLint location, GLsizei count, const GLint *value) { (void)location; (void)count; (void)value; }
+void GL_APIENTRY glUniform4iv(GLint location, GLsizei count, const GLint *value) { (void)location; (void)count; (void)value; }
+void GL_APIENTRY glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { (void)location; (void)count; (void)transpose; (void)value; }
+void GL_APIENTRY glVertexAttrib1fv(GLuint index, const GLfloat *v) { (void)index; (void)v; }
+void GL_APIENTRY glVertexAttrib2fv(GLuint index, const GLfloat *v) { (void)index; (void)v; }
+void GL_APIENTRY glVertexAttrib3fv(GLuint index, const GLfloat *v) { (void)index; (void)v; }
+void GL_APIENTRY glVertexAttrib4fv(GLuint index, const GLfloat *v) { (void)index; (void)v; }
+void GL_APIENTRY glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) { (void)index; (void)size; (void)type; (void)normalized; (void)stride; (void)pointer; }
+void GL_APIENTRY glEnableVertexAttribArray(GLuint index) { (void)index; }
+void GL_APIENTRY glDisableVertexAttribArray(GLuint index) { (void)index; }
+
+// Render state and drawing
+void GL_APIENTRY glEnable(GLenum cap) { (void)cap; }
+void GL_APIENTRY glDisable(GLenum cap) { (void)cap; }
+void GL_APIENTRY glViewport(GLint x, GLint y, GLsizei width, GLsizei height) { (void)x; (void)y; (void)width; (void)height; }
+void GL_APIENTRY glScissor(GLint x, GLint y, GLsizei width, GLsizei height) { (void)x; (void)y; (void)width; (void)height; }
+void GL_APIENTRY glClear(GLbitfield mask) { (void)mask; }
+void GL_APIENTRY glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) { (void)red; (void)green; (void)blue; (void)alpha; }
+void GL_APIENTRY glClearDepthf(GLfloat d) { (void)d; }
+void GL_APIENTRY glBlendFunc(GLenum sfactor, GLenum dfactor) { (void)sfactor; (void)dfactor; }
+void GL_APIENTRY glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) { (void)sfactorRGB; (void)dfactorRGB; (void)sfactorAlpha; (void)dfactorAlpha; }
+void GL_APIENTRY glBlendEquation(GLenum mode) { (void)mode; }
+void GL_APIENTRY glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) { (void)modeRGB; (void)modeAlpha; }
+void GL_APIENTRY glDepthFunc(GLenum func) { (void)func; }
+void GL_APIENTRY glDepthMask(GLboolean flag) { (void)flag; }
+void GL_APIENTRY glCullFace(GLenum mode) { (void)mode; }
+void GL_APIENTRY glFrontFace(GLenum mode) { (void)mode; }
+void GL_APIENTRY glLineWidth(GLfloat width) { (void)width; }
+void GL_APIENTRY glDrawArrays(GLenum mode, GLint first, GLsizei count) { (void)mode; (void)first; (void)count; }
+void GL_APIENTRY glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) { (void)mode; (void)count; (void)type; (void)indices; }
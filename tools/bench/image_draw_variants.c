@@ -0,0 +1,20 @@
+/**********************************************************************************************
+*
+*   image_draw_variants - rtextures.c built with one code path (IMAGE_DRAW_VARIANT prefix)
+*
+*   NOTE: BlendPixelsRGBA8() is static in rtextures.c, it is exposed through a prefixed wrapper
+*
+**********************************************************************************************/
+
+#define VARIANT_CONCAT(a, b) a##b
+#define VARIANT_NAME(prefix, name) VARIANT_CONCAT(prefix, name)
+#define VARIANT(name) VARIANT_NAME(IMAGE_DRAW_VARIANT, name)
+
+#define ImageDraw               VARIANT(ImageDraw)
+
+#include "rtextures.c"
+
+void VARIANT(BlendPixelsRGBA8)(const void *src, int srcFormat, unsigned char *dst, int count, Color tint)
+{
+    BlendPixelsRGBA8(src, srcFormat, dst, count, tint);
+}
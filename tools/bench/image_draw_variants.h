@@ -0,0 +1,27 @@
+/**********************************************************************************************
+*
+*   image_draw_variants - rtextures.c image drawing built with each code path, side by side
+*
+*   image_draw_variants.c is compiled once per variant (see Makefile), functions are prefixed:
+*     Scalar    RTEXTURES_DISABLE_SIMD, reference implementation
+*     Simd      Native SIMD code path of the host (SSE2 on x86_64, NEON on arm64)
+*     Neon      NEON code path with emulated intrinsics (neon_emu/arm_neon.h), checks only
+*
+*   Every variant is a full rtextures.c build, other rtextures.c symbols are made local.
+*
+**********************************************************************************************/
+
+#ifndef IMAGE_DRAW_VARIANTS_H
+#define IMAGE_DRAW_VARIANTS_H
+
+#include "raylib.h"
+
+#define IMAGE_DRAW_VARIANT_DECLARE(prefix) \
+    void prefix##ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint); \
+    void prefix##BlendPixelsRGBA8(const void *src, int srcFormat, unsigned char *dst, int count, Color tint);
+
+IMAGE_DRAW_VARIANT_DECLARE(Scalar)
+IMAGE_DRAW_VARIANT_DECLARE(Simd)
+IMAGE_DRAW_VARIANT_DECLARE(Neon)
+
+#endif // IMAGE_DRAW_VARIANTS_H
@@ -0,0 +1,26 @@
+/**********************************************************************************************
+*
+*   image_threads_variants - rtextures.c built with one threads count (IMAGE_THREADS_VARIANT prefix)
+*
+*   NOTE: Names are replaced before raylib.h is included, so rtextures.c internal calls
+*   (i.e. ImageMipmaps() calling ImageResize()) stay in the variant
+*
+**********************************************************************************************/
+
+#define VARIANT_CONCAT(a, b) a##b
+#define VARIANT_NAME(prefix, name) VARIANT_CONCAT(prefix, name)
+#define VARIANT(name) VARIANT_NAME(IMAGE_THREADS_VARIANT, name)
+
+#define GenImageGradientLinear  VARIANT(GenImageGradientLinear)
+#define GenImageChecked         VARIANT(GenImageChecked)
+#define GenImagePerlinNoise     VARIANT(GenImagePerlinNoise)
+#define GenImageCellular        VARIANT(GenImageCellular)
+#define ImageBlurGaussian       VARIANT(ImageBlurGaussian)
+#define ImageResize             VARIANT(ImageResize)
+#define ImageMipmaps            VARIANT(ImageMipmaps)
+#define ImageDither             VARIANT(ImageDither)
+#define ImageRotate             VARIANT(ImageRotate)
+#define ImageColorTint          VARIANT(ImageColorTint)
+#define ImageColorBrightness    VARIANT(ImageColorBrightness)
+
+#include "rtextures.c"
@@ -0,0 +1,36 @@
+/**********************************************************************************************
+*
+*   image_threads_variants - rtextures.c image operations built with a fixed threads count
+*
+*   image_threads_variants.c is compiled once per threads count (see Makefile), with
+*   IMAGE_THREADS_COUNT set and operations prefixed: Threads1, Threads2, Threads4, Threads8.
+*   Every variant has its own threads pool, other rtextures.c symbols are made local.
+*
+*   NOTE: Threads count is forced, it is not limited by the host cores count
+*
+**********************************************************************************************/
+
+#ifndef IMAGE_THREADS_VARIANTS_H
+#define IMAGE_THREADS_VARIANTS_H
+
+#include "raylib.h"
+
+#define IMAGE_THREADS_VARIANT_DECLARE(prefix) \
+    Image prefix##GenImageGradientLinear(int width, int height, int direction, Color start, Color end); \
+    Image prefix##GenImageChecked(int width, int height, int checksX, int checksY, Color col1, Color col2); \
+    Image prefix##GenImagePerlinNoise(int width, int height, int offsetX, int offsetY, float scale); \
+    Image prefix##GenImageCellular(int width, int height, int tileSize); \
+    void prefix##ImageBlurGaussian(Image *image, int blurSize); \
+    void prefix##ImageResize(Image *image, int newWidth, int newHeight); \
+    void prefix##ImageMipmaps(Image *image); \
+    void prefix##ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp); \
+    void prefix##ImageRotate(Image *image, int degrees); \
+    void prefix##ImageColorTint(Image *image, Color color); \
+    void prefix##ImageColorBrightness(Image *image, int brightness);
+
+IMAGE_THREADS_VARIANT_DECLARE(Threads1)
+IMAGE_THREADS_VARIANT_DECLARE(Threads2)
+IMAGE_THREADS_VARIANT_DECLARE(Threads4)
+IMAGE_THREADS_VARIANT_DECLARE(Threads8)
+
+#endif // IMAGE_THREADS_VARIANTS_H
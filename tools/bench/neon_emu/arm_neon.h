@@ -0,0 +1,174 @@
+/**********************************************************************************************
+*
+*   arm_neon.h - Scalar emulation of the NEON intrinsics used by raymath.h and rtextures.c
+*
+*   Only for checks on hosts without NEON: every lane operation is a single IEEE float
+*   operation, as on NEON (no fused multiply-add), so results must match the scalar code
+*   bit for bit. Integer lanes wrap, narrow and saturate as NEON does (little-endian lanes).
+*   Not meant for performance measurements.
+*
+**********************************************************************************************/
+
+#ifndef NEON_EMU_ARM_NEON_H
+#define NEON_EMU_ARM_NEON_H
+
+typedef struct { float v[2]; } float32x2_t;
+typedef struct { float v[4]; } float32x4_t;
+typedef struct { float32x4_t val[2]; } float32x4x2_t;
+typedef struct { float32x4_t val[3]; } float32x4x3_t;
+typedef struct { float32x4_t val[4]; } float32x4x4_t;
+
+static inline float32x4_t vdupq_n_f32(float f) { float32x4_t r; for (int i = 0; i < 4; i++) r.v[i] = f; return r; }
+static inline float32x4_t vld1q_f32(const float *p) { float32x4_t r; for (int i = 0; i < 4; i++) r.v[i] = p[i]; return r; }
+static inline void vst1q_f32(float *p, float32x4_t a) { for (int i = 0; i < 4; i++) p[i] = a.v[i]; }
+
+static inline float32x4_t vaddq_f32(float32x4_t a, float32x4_t b) { for (int i = 0; i < 4; i++) a.v[i] += b.v[i]; return a; }
+static inline float32x4_t vsubq_f32(float32x4_t a, float32x4_t b) { for (int i = 0; i < 4; i++) a.v[i] -= b.v[i]; return a; }
+static inline float32x4_t vmulq_f32(float32x4_t a, float32x4_t b) { for (int i = 0; i < 4; i++) a.v[i] *= b.v[i]; return a; }
+static inline float32x4_t vmulq_n_f32(float32x4_t a, float b) { for (int i = 0; i < 4; i++) a.v[i] *= b; return a; }
+
+// Lane moves (NOTE: lane arguments must be constants on NEON)
+static inline float32x2_t vget_low_f32(float32x4_t a) { float32x2_t r = { { a.v[0], a.v[1] } }; return r; }
+static inline float32x2_t vget_high_f32(float32x4_t a) { float32x2_t r = { { a.v[2], a.v[3] } }; return r; }
+static inline float32x4_t vcombine_f32(float32x2_t a, float32x2_t b) { float32x4_t r = { { a.v[0], a.v[1], b.v[0], b.v[1] } }; return r; }
+static inline float vgetq_lane_f32(float32x4_t a, int lane) { return a.v[lane]; }
+static inline float32x4_t vsetq_lane_f32(float f, float32x4_t a, int lane) { a.v[lane] = f; return a; }
+static inline float32x2_t vset_lane_f32(float f, float32x2_t a, int lane) { a.v[lane] = f; return a; }
+static inline float32x4_t vdupq_lane_f32(float32x2_t a, int lane) { return vdupq_n_f32(a.v[lane]); }
+static inline float32x2_t vdup_lane_f32(float32x2_t a, int lane) { float32x2_t r = { { a.v[lane], a.v[lane] } }; return r; }
+static inline float32x2_t vrev64_f32(float32x2_t a) { float32x2_t r = { { a.v[1], a.v[0] } }; return r; }
+static inline float32x4_t vextq_f32(float32x4_t a, float32x4_t b, int n) { float32x4_t r; for (int i = 0; i < 4; i++) r.v[i] = (i + n < 4)? a.v[i + n] : b.v[i + n - 4]; return r; }
+
+// Deinterleaving loads and interleaving stores
+static inline float32x4x2_t vld2q_f32(const float *p)
+{
+    float32x4x2_t r;
+    for (int i = 0; i < 4; i++) for (int k = 0; k < 2; k++) r.val[k].v[i] = p[2*i + k];
+    return r;
+}
+
+static inline float32x4x3_t vld3q_f32(const float *p)
+{
+    float32x4x3_t r;
+    for (int i = 0; i < 4; i++) for (int k = 0; k < 3; k++) r.val[k].v[i] = p[3*i + k];
+    return r;
+}
+
+static inline float32x4x4_t vld4q_f32(const float *p)
+{
+    float32x4x4_t r;
+    for (int i = 0; i < 4; i++) for (int k = 0; k < 4; k++) r.val[k].v[i] = p[4*i + k];
+    return r;
+}
+
+static inline void vst2q_f32(float *p, float32x4x2_t x) { for (int i = 0; i < 4; i++) for (int k = 0; k < 2; k++) p[2*i + k] = x.val[k].v[i]; }
+static inline void vst3q_f32(float *p, float32x4x3_t x) { for (int i = 0; i < 4; i++) for (int k = 0; k < 3; k++) p[3*i + k] = x.val[k].v[i]; }
+
+// Integer vectors (rtextures.c pixel formats and blending)
+typedef struct { unsigned char v[8]; } uint8x8_t;
+typedef struct { unsigned char v[16]; } uint8x16_t;
+typedef struct { unsigned short v[4]; } uint16x4_t;
+typedef struct { unsigned short v[8]; } uint16x8_t;
+typedef struct { short v[8]; } int16x8_t;
+typedef struct { unsigned int v[2]; } uint32x2_t;
+typedef struct { unsigned int v[4]; } uint32x4_t;
+typedef struct { uint8x8_t val[4]; } uint8x8x4_t;
+typedef struct { uint8x16_t val[2]; } uint8x16x2_t;
+typedef struct { uint8x16_t val[3]; } uint8x16x3_t;
+typedef struct { uint8x16_t val[4]; } uint8x16x4_t;
+
+static inline uint8x8_t vdup_n_u8(unsigned char x) { uint8x8_t r; for (int i = 0; i < 8; i++) r.v[i] = x; return r; }
+static inline uint8x16_t vdupq_n_u8(unsigned char x) { uint8x16_t r; for (int i = 0; i < 16; i++) r.v[i] = x; return r; }
+static inline uint16x8_t vdupq_n_u16(unsigned short x) { uint16x8_t r; for (int i = 0; i < 8; i++) r.v[i] = x; return r; }
+static inline int16x8_t vdupq_n_s16(short x) { int16x8_t r; for (int i = 0; i < 8; i++) r.v[i] = x; return r; }
+static inline uint32x4_t vdupq_n_u32(unsigned int x) { uint32x4_t r; for (int i = 0; i < 4; i++) r.v[i] = x; return r; }
+
+static inline uint8x16_t vld1q_u8(const unsigned char *p) { uint8x16_t r; for (int i = 0; i < 16; i++) r.v[i] = p[i]; return r; }
+static inline uint16x8_t vld1q_u16(const unsigned short *p) { uint16x8_t r; for (int i = 0; i < 8; i++) r.v[i] = p[i]; return r; }
+static inline uint32x4_t vld1q_u32(const unsigned int *p) { uint32x4_t r; for (int i = 0; i < 4; i++) r.v[i] = p[i]; return r; }
+static inline void vst1q_u8(unsigned char *p, uint8x16_t a) { for (int i = 0; i < 16; i++) p[i] = a.v[i]; }
+static inline void vst1q_u16(unsigned short *p, uint16x8_t a) { for (int i = 0; i < 8; i++) p[i] = a.v[i]; }
+static inline void vst1q_u32(unsigned int *p, uint32x4_t a) { for (int i = 0; i < 4; i++) p[i] = a.v[i]; }
+
+static inline uint8x8x4_t vld4_u8(const unsigned char *p) { uint8x8x4_t r; for (int i = 0; i < 8; i++) for (int k = 0; k < 4; k++) r.val[k].v[i] = p[4*i + k]; return r; }
+static inline uint8x16x2_t vld2q_u8(const unsigned char *p) { uint8x16x2_t r; for (int i = 0; i < 16; i++) for (int k = 0; k < 2; k++) r.val[k].v[i] = p[2*i + k]; return r; }
+static inline uint8x16x3_t vld3q_u8(const unsigned char *p) { uint8x16x3_t r; for (int i = 0; i < 16; i++) for (int k = 0; k < 3; k++) r.val[k].v[i] = p[3*i + k]; return r; }
+static inline uint8x16x4_t vld4q_u8(const unsigned char *p) { uint8x16x4_t r; for (int i = 0; i < 16; i++) for (int k = 0; k < 4; k++) r.val[k].v[i] = p[4*i + k]; return r; }
+static inline void vst4_u8(unsigned char *p, uint8x8x4_t x) { for (int i = 0; i < 8; i++) for (int k = 0; k < 4; k++) p[4*i + k] = x.val[k].v[i]; }
+static inline void vst2q_u8(unsigned char *p, uint8x16x2_t x) { for (int i = 0; i < 16; i++) for (int k = 0; k < 2; k++) p[2*i + k] = x.val[k].v[i]; }
+static inline void vst3q_u8(unsigned char *p, uint8x16x3_t x) { for (int i = 0; i < 16; i++) for (int k = 0; k < 3; k++) p[3*i + k] = x.val[k].v[i]; }
+static inline void vst4q_u8(unsigned char *p, uint8x16x4_t x) { for (int i = 0; i < 16; i++) for (int k = 0; k < 4; k++) p[4*i + k] = x.val[k].v[i]; }
+
+// Lane moves, widening and narrowing (narrowing truncates)
+static inline uint8x8_t vget_low_u8(uint8x16_t a) { uint8x8_t r; for (int i = 0; i < 8; i++) r.v[i] = a.v[i]; return r; }
+static inline uint8x8_t vget_high_u8(uint8x16_t a) { uint8x8_t r; for (int i = 0; i < 8; i++) r.v[i] = a.v[i + 8]; return r; }
+static inline uint16x4_t vget_low_u16(uint16x8_t a) { uint16x4_t r; for (int i = 0; i < 4; i++) r.v[i] = a.v[i]; return r; }
+static inline uint16x4_t vget_high_u16(uint16x8_t a) { uint16x4_t r; for (int i = 0; i < 4; i++) r.v[i] = a.v[i + 4]; return r; }
+static inline uint32x2_t vget_low_u32(uint32x4_t a) { uint32x2_t r = { { a.v[0], a.v[1] } }; return r; }
+static inline uint32x2_t vget_high_u32(uint32x4_t a) { uint32x2_t r = { { a.v[2], a.v[3] } }; return r; }
+static inline uint8x16_t vcombine_u8(uint8x8_t a, uint8x8_t b) { uint8x16_t r; for (int i = 0; i < 8; i++) { r.v[i] = a.v[i]; r.v[i + 8] = b.v[i]; } return r; }
+static inline uint16x8_t vcombine_u16(uint16x4_t a, uint16x4_t b) { uint16x8_t r; for (int i = 0; i < 4; i++) { r.v[i] = a.v[i]; r.v[i + 4] = b.v[i]; } return r; }
+static inline unsigned int vget_lane_u32(uint32x2_t a, int lane) { return a.v[lane]; }
+static inline unsigned short vgetq_lane_u16(uint16x8_t a, int lane) { return a.v[lane]; }
+static inline uint32x4_t vsetq_lane_u32(unsigned int x, uint32x4_t a, int lane) { a.v[lane] = x; return a; }
+static inline uint16x4_t vdup_lane_u16(uint16x4_t a, int lane) { uint16x4_t r; for (int i = 0; i < 4; i++) r.v[i] = a.v[lane]; return r; }
+static inline uint16x8_t vmovl_u8(uint8x8_t a) { uint16x8_t r; for (int i = 0; i < 8; i++) r.v[i] = a.v[i]; return r; }
+static inline uint8x8_t vmovn_u16(uint16x8_t a) { uint8x8_t r; for (int i = 0; i < 8; i++) r.v[i] = (unsigned char)a.v[i]; return r; }
+static inline uint16x4_t vmovn_u32(uint32x4_t a) { uint16x4_t r; for (int i = 0; i < 4; i++) r.v[i] = (unsigned short)a.v[i]; return r; }
+
+static inline uint32x4_t vreinterpretq_u32_u8(uint8x16_t a)
+{
+    uint32x4_t r;
+    for (int i = 0; i < 4; i++) r.v[i] = a.v[4*i] | (a.v[4*i + 1] << 8) | (a.v[4*i + 2] << 16) | ((unsigned int)a.v[4*i + 3] << 24);
+    return r;
+}
+
+static inline uint8x16_t vreinterpretq_u8_u32(uint32x4_t a) { uint8x16_t r; for (int i = 0; i < 16; i++) r.v[i] = (unsigned char)(a.v[i/4] >> (8*(i%4))); return r; }
+
+// Arithmetic (wrapping)
+static inline uint16x8_t vaddq_u16(uint16x8_t a, uint16x8_t b) { for (int i = 0; i < 8; i++) a.v[i] += b.v[i]; return a; }
+static inline uint16x8_t vsubq_u16(uint16x8_t a, uint16x8_t b) { for (int i = 0; i < 8; i++) a.v[i] -= b.v[i]; return a; }
+static inline uint16x8_t vmulq_u16(uint16x8_t a, uint16x8_t b) { for (int i = 0; i < 8; i++) a.v[i] *= b.v[i]; return a; }
+static inline uint16x8_t vmulq_n_u16(uint16x8_t a, unsigned short b) { for (int i = 0; i < 8; i++) a.v[i] *= b; return a; }
+static inline uint16x8_t vmlaq_n_u16(uint16x8_t a, uint16x8_t b, unsigned short c) { for (int i = 0; i < 8; i++) a.v[i] += b.v[i]*c; return a; }
+static inline uint32x4_t vmlaq_n_u32(uint32x4_t a, uint32x4_t b, unsigned int c) { for (int i = 0; i < 4; i++) a.v[i] += b.v[i]*c; return a; }
+static inline uint16x8_t vmlal_u8(uint16x8_t a, uint8x8_t b, uint8x8_t c) { for (int i = 0; i < 8; i++) a.v[i] += b.v[i]*c.v[i]; return a; }
+static inline uint16x8_t vmull_u8(uint8x8_t a, uint8x8_t b) { uint16x8_t r; for (int i = 0; i < 8; i++) r.v[i] = (unsigned short)(a.v[i]*b.v[i]); return r; }
+static inline uint32x4_t vmull_u16(uint16x4_t a, uint16x4_t b) { uint32x4_t r; for (int i = 0; i < 4; i++) r.v[i] = (unsigned int)a.v[i]*b.v[i]; return r; }
+static inline uint32x4_t vaddw_u16(uint32x4_t a, uint16x4_t b) { for (int i = 0; i < 4; i++) a.v[i] += b.v[i]; return a; }
+static inline uint32x4_t vsubw_u16(uint32x4_t a, uint16x4_t b) { for (int i = 0; i < 4; i++) a.v[i] -= b.v[i]; return a; }
+
+// Shifts, vshlq_u16() shifts right for negative amounts
+static inline uint8x8_t vshr_n_u8(uint8x8_t a, int n) { for (int i = 0; i < 8; i++) a.v[i] >>= n; return a; }
+static inline uint16x8_t vshrq_n_u16(uint16x8_t a, int n) { for (int i = 0; i < 8; i++) a.v[i] >>= n; return a; }
+static inline uint32x4_t vshrq_n_u32(uint32x4_t a, int n) { for (int i = 0; i < 4; i++) a.v[i] >>= n; return a; }
+static inline uint16x8_t vsraq_n_u16(uint16x8_t a, uint16x8_t b, int n) { for (int i = 0; i < 8; i++) a.v[i] += b.v[i] >> n; return a; }
+static inline uint16x4_t vshrn_n_u32(uint32x4_t a, int n) { uint16x4_t r; for (int i = 0; i < 4; i++) r.v[i] = (unsigned short)(a.v[i] >> n); return r; }
+static inline uint8x8_t vrshrn_n_u16(uint16x8_t a, int n) { uint8x8_t r; for (int i = 0; i < 8; i++) r.v[i] = (unsigned char)((a.v[i] + (1u << (n - 1))) >> n); return r; }
+
+static inline uint16x8_t vshlq_u16(uint16x8_t a, int16x8_t b)
+{
+    for (int i = 0; i < 8; i++)
+    {
+        int n = (signed char)b.v[i];
+        a.v[i] = (n >= 16)? 0 : ((n >= 0)? (unsigned short)(a.v[i] << n) : ((n > -16)? a.v[i] >> -n : 0));
+    }
+
+    return a;
+}
+
+// Bitwise operations and comparisons (lanes all ones when true)
+static inline uint16x8_t vandq_u16(uint16x8_t a, uint16x8_t b) { for (int i = 0; i < 8; i++) a.v[i] &= b.v[i]; return a; }
+static inline uint16x8_t vorrq_u16(uint16x8_t a, uint16x8_t b) { for (int i = 0; i < 8; i++) a.v[i] |= b.v[i]; return a; }
+static inline uint32x2_t vand_u32(uint32x2_t a, uint32x2_t b) { for (int i = 0; i < 2; i++) a.v[i] &= b.v[i]; return a; }
+static inline uint32x4_t vandq_u32(uint32x4_t a, uint32x4_t b) { for (int i = 0; i < 4; i++) a.v[i] &= b.v[i]; return a; }
+static inline uint32x4_t vorrq_u32(uint32x4_t a, uint32x4_t b) { for (int i = 0; i < 4; i++) a.v[i] |= b.v[i]; return a; }
+static inline uint32x4_t vbslq_u32(uint32x4_t mask, uint32x4_t a, uint32x4_t b) { for (int i = 0; i < 4; i++) a.v[i] = (mask.v[i] & a.v[i]) | (~mask.v[i] & b.v[i]); return a; }
+static inline uint32x4_t vceqq_u32(uint32x4_t a, uint32x4_t b) { for (int i = 0; i < 4; i++) a.v[i] = (a.v[i] == b.v[i])? 0xffffffff : 0; return a; }
+static inline uint8x8_t vcgt_u8(uint8x8_t a, uint8x8_t b) { for (int i = 0; i < 8; i++) a.v[i] = (a.v[i] > b.v[i])? 0xff : 0; return a; }
+
+// Conversions, float to unsigned truncates toward zero and saturates
+static inline float32x4_t vcvtq_f32_u32(uint32x4_t a) { float32x4_t r; for (int i = 0; i < 4; i++) r.v[i] = (float)a.v[i]; return r; }
+static inline uint32x4_t vcvtq_u32_f32(float32x4_t a) { uint32x4_t r; for (int i = 0; i < 4; i++) r.v[i] = (a.v[i] > 0.0f)? ((a.v[i] < 4294967296.0f)? (unsigned int)a.v[i] : 0xffffffff) : 0; return r; }
+
+#endif // NEON_EMU_ARM_NEON_H
@@ -0,0 +1,27 @@
+/**********************************************************************************************
+*
+*   raymath_variants - raymath.h functions built with one code path (RAYMATH_VARIANT prefix)
+*
+**********************************************************************************************/
+
+#include "raymath_variants.h"
+
+#define RAYMATH_STATIC_INLINE
+#include "raymath.h"
+
+#define VARIANT_CONCAT(a, b) a##b
+#define VARIANT_NAME(prefix, name) VARIANT_CONCAT(prefix, name)
+#define VARIANT(name) VARIANT_NAME(RAYMATH_VARIANT, name)
+
+Matrix VARIANT(MatrixMultiply)(Matrix left, Matrix right) { return MatrixMultiply(left, right); }
+Matrix VARIANT(MatrixInvert)(Matrix mat) { return MatrixInvert(mat); }
+void VARIANT(MatrixMultiplyN)(const Matrix *left, const Matrix *right, Matrix *result, int count) { for (int i = 0; i < count; i++) result[i] = MatrixMultiply(left[i], right[i]); }
+void VARIANT(MatrixInvertN)(const Matrix *mats, Matrix *result, int count) { for (int i = 0; i < count; i++) result[i] = MatrixInvert(mats[i]); }
+void VARIANT(Vector2TransformArray)(const Vector2 *points, Vector2 *result, int count, Matrix mat) { Vector2TransformArray(points, result, count, mat); }
+void VARIANT(Vector3TransformArray)(const Vector3 *points, Vector3 *result, int count, Matrix mat) { Vector3TransformArray(points, result, count, mat); }
+
+// Transform vectors one by one, as code not using Vector3TransformArray() does
+void VARIANT(Vector3TransformLoop)(const Vector3 *points, Vector3 *result, int count, Matrix mat)
+{
+    for (int i = 0; i < count; i++) result[i] = Vector3Transform(points[i], mat);
+}
@@ -0,0 +1,34 @@
+/**********************************************************************************************
+*
+*   raymath_variants - raymath.h functions built with each code path, side by side
+*
+*   raymath_variants.c is compiled once per variant (see Makefile), functions are prefixed:
+*     Scalar    RAYMATH_DISABLE_SIMD, reference implementation
+*     Simd      Native SIMD code path of the host (SSE on x86_64, NEON on arm64)
+*     Neon      NEON code path with emulated intrinsics (neon_emu/arm_neon.h), checks only
+*
+*   All variants are built with -ffp-contract=off: results are expected bit-identical.
+*   *N() functions call the inlined function in a loop, as raylib modules do (no by-value
+*   Matrix copies through the stack as out-of-line calls have).
+*
+**********************************************************************************************/
+
+#ifndef RAYMATH_VARIANTS_H
+#define RAYMATH_VARIANTS_H
+
+#include "raylib.h"
+
+#define RAYMATH_VARIANT_DECLARE(prefix) \
+    Matrix prefix##MatrixMultiply(Matrix left, Matrix right); \
+    Matrix prefix##MatrixInvert(Matrix mat); \
+    void prefix##MatrixMultiplyN(const Matrix *left, const Matrix *right, Matrix *result, int count); \
+    void prefix##MatrixInvertN(const Matrix *mats, Matrix *result, int count); \
+    void prefix##Vector2TransformArray(const Vector2 *points, Vector2 *result, int count, Matrix mat); \
+    void prefix##Vector3TransformArray(const Vector3 *points, Vector3 *result, int count, Matrix mat); \
+    void prefix##Vector3TransformLoop(const Vector3 *points, Vector3 *result, int count, Matrix mat);
+
+RAYMATH_VARIANT_DECLARE(Scalar)
+RAYMATH_VARIANT_DECLARE(Simd)
+RAYMATH_VARIANT_DECLARE(Neon)
+
+#endif // RAYMATH_VARIANTS_H
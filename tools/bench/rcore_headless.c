@@ -0,0 +1,165 @@
+/**********************************************************************************************
+*
+*   rcore_headless - Headless platform backend for host benchmarks and checks
+*
+*   rcore.c is compiled with no PLATFORM_* defined (custom platform backend) and this file
+*   provides the platform functions: no window, no input, frames are not presented.
+*   Rendering goes through rlgl into the null GLES2 driver (gles2_null.c), so the whole
+*   CPU side of a frame (shapes tessellation, text layout, batching, culling) runs as on device.
+*
+*   InitWindow(width, height, title) sets the virtual screen size, 0 uses HEADLESS_SCREEN_WIDTH
+*   and HEADLESS_SCREEN_HEIGHT. Storage base path is the working directory.
+*
+**********************************************************************************************/
+
+#include "rcore.c"
+
+#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_DESKTOP_SDL) || defined(PLATFORM_WEB) || defined(PLATFORM_DRM) || defined(PLATFORM_ANDROID)
+    #error "rcore_headless.c requires rcore.c built without PLATFORM_* defined"
+#endif
+
+#ifndef HEADLESS_SCREEN_WIDTH
+    #define HEADLESS_SCREEN_WIDTH       1080        // Default virtual screen width (portrait phone)
+#endif
+#ifndef HEADLESS_SCREEN_HEIGHT
+    #define HEADLESS_SCREEN_HEIGHT      2340        // Default virtual screen height (portrait phone)
+#endif
+
+//----------------------------------------------------------------------------------
+// Other Modules Functions Declaration
+//----------------------------------------------------------------------------------
+extern void *GetNullProcAddress(const char *name);     // [gles2_null] Get extension function address
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Window and Graphics Device
+//----------------------------------------------------------------------------------
+bool WindowShouldClose(void) { return CORE.Window.shouldClose; }
+void ToggleFullscreen(void) { }
+void ToggleBorderlessWindowed(void) { }
+void MaximizeWindow(void) { }
+void MinimizeWindow(void) { }
+void RestoreWindow(void) { }
+void SetWindowState(unsigned int flags) { CORE.Window.flags |= flags; }
+void ClearWindowState(unsigned int flags) { CORE.Window.flags &= ~flags; }
+void SetWindowIcon(Image image) { (void)image; }
+void SetWindowIcons(Image *images, int count) { (void)images; (void)count; }
+void SetWindowTitle(const char *title) { CORE.Window.title = title; }
+void SetWindowPosition(int x, int y) { (void)x; (void)y; }
+void SetWindowMonitor(int monitor) { (void)monitor; }
+void SetWindowMinSize(int width, int height) { (void)width; (void)height; }
+void SetWindowMaxSize(int width, int height) { (void)width; (void)height; }
+void SetWindowOpacity(float opacity) { (void)opacity; }
+void SetWindowFocused(void) { }
+void *GetWindowHandle(void) { return NULL; }
+int GetMonitorCount(void) { return 1; }
+int GetCurrentMonitor(void) { return 0; }
+Vector2 GetMonitorPosition(int monitor) { (void)monitor; return (Vector2){ 0.0f, 0.0f }; }
+int GetMonitorWidth(int monitor) { (void)monitor; return CORE.Window.display.width; }
+int GetMonitorHeight(int monitor) { (void)monitor; return CORE.Window.display.height; }
+int GetMonitorPhysicalWidth(int monitor) { (void)monitor; return 0; }
+int GetMonitorPhysicalHeight(int monitor) { (void)monitor; return 0; }
+int GetMonitorRefreshRate(int monitor) { (void)monitor; return 60; }
+const char *GetMonitorName(int monitor) { (void)monitor; return "headless"; }
+Vector2 GetWindowPosition(void) { return (Vector2){ 0.0f, 0.0f }; }
+Vector2 GetWindowScaleDPI(void) { return (Vector2){ 1.0f, 1.0f }; }
+void SetClipboardText(const char *text) { (void)text; }
+const char *GetClipboardText(void) { return NULL; }
+void ShowCursor(void) { CORE.Input.Mouse.cursorHidden = false; }
+void HideCursor(void) { CORE.Input.Mouse.cursorHidden = true; }
+void EnableCursor(void) { CORE.Input.Mouse.cursorHidden = false; }
+void DisableCursor(void) { CORE.Input.Mouse.cursorHidden = true; }
+void OpenURL(const char *url) { (void)url; }
+
+// Set window size, virtual screen and render size change together
+void SetWindowSize(int width, int height)
+{
+    CORE.Window.screen.width = width;
+    CORE.Window.screen.height = height;
+    CORE.Window.render = CORE.Window.screen;
+    CORE.Window.currentFbo = CORE.Window.screen;
+}
+
+// Frames are not presented
+void SwapScreenBuffer(void) { }
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Misc
+//----------------------------------------------------------------------------------
+// Get elapsed time measure in seconds since InitTimer()
+double GetTime(void)
+{
+    struct timespec ts = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    unsigned long long int nanoSeconds = (unsigned long long int)ts.tv_sec*1000000000LLU + (unsigned long long int)ts.tv_nsec;
+
+    return (double)(nanoSeconds - CORE.Time.base)*1e-9;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Inputs
+//----------------------------------------------------------------------------------
+int SetGamepadMappings(const char *mappings) { (void)mappings; return 0; }
+void SetMouseCursor(int cursor) { CORE.Input.Mouse.cursor = cursor; }
+
+// Set mouse position XY, also used by harnesses to simulate touches
+void SetMousePosition(int x, int y)
+{
+    CORE.Input.Mouse.currentPosition = (Vector2){ (float)x, (float)y };
+    CORE.Input.Mouse.previousPosition = CORE.Input.Mouse.currentPosition;
+}
+
+// Register all input events, previous state is kept so key and button presses are one frame long
+void PollInputEvents(void)
+{
+    CORE.Input.Keyboard.keyPressedQueueCount = 0;
+    CORE.Input.Keyboard.charPressedQueueCount = 0;
+
+    for (int i = 0; i < MAX_KEYBOARD_KEYS; i++)
+    {
+        CORE.Input.Keyboard.previousKeyState[i] = CORE.Input.Keyboard.currentKeyState[i];
+        CORE.Input.Keyboard.keyRepeatInFrame[i] = 0;
+    }
+
+    for (int i = 0; i < MAX_MOUSE_BUTTONS; i++) CORE.Input.Mouse.previousButtonState[i] = CORE.Input.Mouse.currentButtonState[i];
+
+    CORE.Input.Mouse.previousPosition = CORE.Input.Mouse.currentPosition;
+    CORE.Input.Mouse.previousWheelMove = CORE.Input.Mouse.currentWheelMove;
+    CORE.Input.Mouse.currentWheelMove = (Vector2){ 0.0f, 0.0f };
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Initialize platform: virtual screen, null GL extensions, timer and storage
+int InitPlatform(void)
+{
+    if ((CORE.Window.screen.width <= 0) || (CORE.Window.screen.height <= 0))
+    {
+        CORE.Window.screen.width = HEADLESS_SCREEN_WIDTH;
+        CORE.Window.screen.height = HEADLESS_SCREEN_HEIGHT;
+    }
+
+    CORE.Window.display = CORE.Window.screen;
+    CORE.Window.render = CORE.Window.screen;
+    CORE.Window.currentFbo = CORE.Window.screen;
+    CORE.Window.fullscreen = true;
+    CORE.Window.flags |= FLAG_FULLSCREEN_MODE;
+
+    rlLoadExtensions(GetNullProcAddress);
+
+    CORE.Window.ready = true;
+
+    InitTimer();
+
+    CORE.Storage.basePath = GetWorkingDirectory();
+
+    TRACELOG(LOG_INFO, "PLATFORM: HEADLESS: Initialized successfully (%i x %i)", CORE.Window.screen.width, CORE.Window.screen.height);
+
+    return 0;
+}
+
+// Close platform
+void ClosePlatform(void)
+{
+    CORE.Window.ready = false;
+}
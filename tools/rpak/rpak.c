@@ -0,0 +1,400 @@
+/**********************************************************************************************
+*
+*   rpak - Asset pack builder (host tool)
+*
+*   Packs a directory of assets into a single asset pack (.rpak), to be mounted
+*   at runtime with MountAssetPack(). Packed files are looked up by their path
+*   relative to packed directory, same names used to load them from assets directory.
+*
+*   ASSET PACK LAYOUT (little-endian):
+*       AssetPackHeader      magic "rPAK", version, entries count, names table size
+*       AssetPackEntry[]     entries index, sorted by name hash (FNV-1a)
+*       char[]               entries names, '\0' terminated
+*       entries data         every entry aligned to 16 bytes (memory-mapped pack friendly)
+*
+*   ENTRIES COMPRESSION:
+*       STORE       Data stored as is, loaded with no copy from memory-mapped pack
+*       DEFLATE     Data compressed with DEFLATE, only used if it saves at least 10% of size
+*       QOI         Images (.png, .bmp, .tga, .jpg) re-encoded as QOI (-qoi option), file name is kept
+*                   NOTE: LoadImage() and LoadImageFromMemory() recognize QOI data whatever the file type,
+*                   but LoadFileData() and LoadFileText() return QOI data, not original file data
+*
+*   BUILD:
+*       cc -O2 -o rpak tools/rpak/rpak.c -Iapp/src/main/cpp/deps/raylib -lm
+*
+*   USAGE:
+*       rpak [-qoi] [-level <0-8>] <output.rpak> <assets directory>
+*
+*       i.e: rpak -qoi assets.rpak assets_src && mv assets.rpak app/src/main/assets/
+*
+*   LICENSE: zlib/libpng
+*
+**********************************************************************************************/
+
+#define SDEFL_IMPLEMENTATION
+#include "external/sdefl.h"         // Deflate (RFC 1951) compressor
+
+#define QOI_IMPLEMENTATION
+#include "external/qoi.h"           // QOI image encoder
+
+#define STB_IMAGE_IMPLEMENTATION
+#define STBI_ONLY_PNG
+#define STBI_ONLY_BMP
+#define STBI_ONLY_TGA
+#define STBI_ONLY_JPEG
+#include "external/stb_image.h"     // Images decoder
+
+#include <stdio.h>                  // Required for: FILE, fopen(), fread(), fwrite(), printf()
+#include <stdlib.h>                 // Required for: malloc(), realloc(), free(), qsort()
+#include <stdbool.h>                // Required for: bool
+#include <string.h>                 // Required for: strcmp(), strlen(), strrchr(), memcpy()
+#include <strings.h>                // Required for: strcasecmp()
+#include <dirent.h>                 // Required for: DIR, opendir(), readdir(), closedir()
+#include <sys/stat.h>               // Required for: stat()
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define ASSET_PACK_VERSION          1       // Asset pack format version
+#define ASSET_PACK_ALIGNMENT       16       // Entries data alignment
+
+#define ASSET_PACK_STORE            0       // Entry data stored as is
+#define ASSET_PACK_DEFLATE          1       // Entry data compressed with DEFLATE (raw, no zlib header)
+#define ASSET_PACK_QOI              2       // Entry image stored as QOI data
+
+#define MAX_PATH_LENGTH          4096       // Maximum length for file paths
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// NOTE: Header and entry structures must match utils.c
+typedef struct AssetPackHeader {
+    unsigned char magic[4];             // Asset pack file signature: "rPAK"
+    unsigned int version;               // Asset pack format version
+    unsigned int entryCount;            // Number of entries
+    unsigned int namesSize;             // Entries names table size in bytes
+} AssetPackHeader;
+
+typedef struct AssetPackEntry {
+    unsigned int hash;                  // Entry name hash (FNV-1a)
+    unsigned int nameOffset;            // Entry name offset in names table
+    unsigned int offset;                // Entry data offset in pack
+    unsigned int size;                  // Entry data size in pack
+    unsigned int dataSize;              // Entry data size once decompressed
+    unsigned int compression;           // Entry data compression: ASSET_PACK_STORE, ASSET_PACK_DEFLATE, ASSET_PACK_QOI
+} AssetPackEntry;
+
+// File to be packed
+typedef struct PackFile {
+    char *path;                         // File path
+    char *name;                         // Entry name (path relative to packed directory)
+    unsigned char *data;                // Entry data, as stored in pack
+    int fileSize;                       // File size, before encoding
+    AssetPackEntry entry;               // Entry index data
+} PackFile;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static PackFile *files = NULL;          // Files to be packed
+static int fileCount = 0;               // Number of files to be packed
+static int fileCapacity = 0;            // Files array capacity
+
+static struct sdefl deflater = { 0 };   // Deflate compressor state (large, not allocated on stack)
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+// Get asset name hash (FNV-1a), same hash is computed by utils.c
+static unsigned int GetAssetNameHash(const char *name)
+{
+    unsigned int hash = 2166136261u;
+
+    for (; *name != '\0'; name++)
+    {
+        hash ^= (unsigned char)*name;
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+// Load file data into a new buffer
+static unsigned char *LoadFile(const char *path, int *size)
+{
+    unsigned char *data = NULL;
+    FILE *file = fopen(path, "rb");
+    *size = 0;
+
+    if (file != NULL)
+    {
+        fseek(file, 0, SEEK_END);
+        long length = ftell(file);
+        fseek(file, 0, SEEK_SET);
+
+        if ((length >= 0) && (length <= 2147483647))
+        {
+            data = (unsigned char *)malloc((length > 0)? length : 1);
+            *size = (int)fread(data, 1, length, file);
+        }
+
+        fclose(file);
+    }
+
+    return data;
+}
+
+// Check if file is an image that can be re-encoded as QOI
+static bool IsImageFile(const char *name)
+{
+    const char *ext = strrchr(name, '.');
+
+    return (ext != NULL) && ((strcasecmp(ext, ".png") == 0) || (strcasecmp(ext, ".bmp") == 0) ||
+        (strcasecmp(ext, ".tga") == 0) || (strcasecmp(ext, ".jpg") == 0) || (strcasecmp(ext, ".jpeg") == 0));
+}
+
+// Add files in directory (recursively) to files to be packed
+static void AddDirectoryFiles(const char *basePath, const char *relativePath)
+{
+    char dirPath[MAX_PATH_LENGTH] = { 0 };
+    snprintf(dirPath, MAX_PATH_LENGTH, "%s%s%s", basePath, (relativePath[0] != '\0')? "/" : "", relativePath);
+
+    DIR *dir = opendir(dirPath);
+    if (dir == NULL) return;
+
+    struct dirent *item = NULL;
+
+    while ((item = readdir(dir)) != NULL)
+    {
+        if (item->d_name[0] == '.') continue;       // Skip hidden files and directories (.gitkeep)
+
+        char name[MAX_PATH_LENGTH] = { 0 };
+        char path[MAX_PATH_LENGTH] = { 0 };
+        snprintf(name, MAX_PATH_LENGTH, "%s%s%s", relativePath, (relativePath[0] != '\0')? "/" : "", item->d_name);
+        snprintf(path, MAX_PATH_LENGTH, "%s/%s", basePath, name);
+
+        struct stat info = { 0 };
+        if (stat(path, &info) != 0) continue;
+
+        if (S_ISDIR(info.st_mode)) AddDirectoryFiles(basePath, name);
+        else if (S_ISREG(info.st_mode))
+        {
+            if (fileCount == fileCapacity)
+            {
+                fileCapacity = (fileCapacity > 0)? fileCapacity*2 : 64;
+                files = (PackFile *)realloc(files, fileCapacity*sizeof(PackFile));
+            }
+
+            PackFile *file = &files[fileCount++];
+            memset(file, 0, sizeof(PackFile));
+            file->path = strdup(path);
+            file->name = strdup(name);
+        }
+    }
+
+    closedir(dir);
+}
+
+// Encode file data as stored in pack, selecting entry compression
+static bool EncodeFile(PackFile *file, bool useQOI, int level)
+{
+    int size = 0;
+    unsigned char *data = LoadFile(file->path, &size);
+
+    if (data == NULL)
+    {
+        printf("rpak: [%s] Failed to read file\n", file->path);
+        return false;
+    }
+
+    file->fileSize = size;
+    file->entry.hash = GetAssetNameHash(file->name);
+    file->entry.compression = ASSET_PACK_STORE;
+    file->entry.size = size;
+    file->entry.dataSize = size;
+    file->data = data;
+
+    if (useQOI && IsImageFile(file->name))
+    {
+        int width = 0;
+        int height = 0;
+        int channels = 0;
+        unsigned char *pixels = stbi_load_from_memory(data, size, &width, &height, &channels, 0);
+
+        // NOTE: QOI only supports RGB and RGBA, grayscale images are expanded to RGBA
+        if ((pixels != NULL) && (channels != 3) && (channels != 4))
+        {
+            stbi_image_free(pixels);
+            pixels = stbi_load_from_memory(data, size, &width, &height, &channels, 4);
+            channels = 4;
+        }
+
+        if (pixels != NULL)
+        {
+            qoi_desc desc = { (unsigned int)width, (unsigned int)height, (unsigned char)channels, QOI_SRGB };
+            int qoiSize = 0;
+            unsigned char *qoiData = (unsigned char *)qoi_encode(pixels, &desc, &qoiSize);
+            stbi_image_free(pixels);
+
+            if (qoiData != NULL)
+            {
+                free(data);
+                file->data = qoiData;
+                file->entry.compression = ASSET_PACK_QOI;
+                file->entry.size = qoiSize;
+                file->entry.dataSize = qoiSize;
+                return true;
+            }
+        }
+        else printf("rpak: [%s] Failed to decode image, file is stored as is\n", file->path);
+    }
+
+    if ((level > 0) && (size > 0))
+    {
+        unsigned char *compData = (unsigned char *)malloc(sdefl_bound(size));
+        int compSize = sdeflate(&deflater, compData, data, size, level);
+
+        // Compressed data is only kept if it saves at least 10% of size
+        if (compSize < (size - size/10))
+        {
+            free(data);
+            file->data = compData;
+            file->entry.compression = ASSET_PACK_DEFLATE;
+            file->entry.size = compSize;
+        }
+        else free(compData);
+    }
+
+    return true;
+}
+
+// Compare files by name hash and name, for pack index sorting
+static int CompareFiles(const void *a, const void *b)
+{
+    const PackFile *fileA = (const PackFile *)a;
+    const PackFile *fileB = (const PackFile *)b;
+
+    if (fileA->entry.hash != fileB->entry.hash) return (fileA->entry.hash < fileB->entry.hash)? -1 : 1;
+
+    return strcmp(fileA->name, fileB->name);
+}
+
+// Write padding bytes up to alignment
+static unsigned int WritePadding(FILE *file, unsigned int offset)
+{
+    static const unsigned char zeros[ASSET_PACK_ALIGNMENT] = { 0 };
+    unsigned int padding = (ASSET_PACK_ALIGNMENT - offset%ASSET_PACK_ALIGNMENT)%ASSET_PACK_ALIGNMENT;
+
+    fwrite(zeros, 1, padding, file);
+
+    return offset + padding;
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    bool useQOI = false;
+    int level = 8;
+    const char *outputPath = NULL;
+    const char *inputPath = NULL;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-qoi") == 0) useQOI = true;
+        else if ((strcmp(argv[i], "-level") == 0) && (i + 1 < argc)) level = atoi(argv[++i]);
+        else if (outputPath == NULL) outputPath = argv[i];
+        else if (inputPath == NULL) inputPath = argv[i];
+    }
+
+    if ((outputPath == NULL) || (inputPath == NULL))
+    {
+        printf("usage: rpak [-qoi] [-level <0-8>] <output.rpak> <assets directory>\n");
+        printf("    -qoi        Store images (.png, .bmp, .tga, .jpg) as QOI, faster to decode\n");
+        printf("    -level      DEFLATE compression level, 0 stores all files as is (default: 8)\n");
+        return 1;
+    }
+
+    if (level < 0) level = 0;
+    if (level > SDEFL_LVL_MAX) level = SDEFL_LVL_MAX;
+
+    AddDirectoryFiles(inputPath, "");
+
+    if (fileCount == 0)
+    {
+        printf("rpak: [%s] No files found\n", inputPath);
+        return 1;
+    }
+
+    for (int i = 0; i < fileCount; i++) if (!EncodeFile(&files[i], useQOI, level)) return 1;
+
+    qsort(files, fileCount, sizeof(PackFile), CompareFiles);
+
+    // Compute names table and entries data offsets
+    AssetPackHeader header = { { 'r', 'P', 'A', 'K' }, ASSET_PACK_VERSION, (unsigned int)fileCount, 0 };
+
+    for (int i = 0; i < fileCount; i++)
+    {
+        files[i].entry.nameOffset = header.namesSize;
+        header.namesSize += (unsigned int)strlen(files[i].name) + 1;
+    }
+
+    unsigned long long offset = sizeof(AssetPackHeader) + fileCount*sizeof(AssetPackEntry) + header.namesSize;
+
+    for (int i = 0; i < fileCount; i++)
+    {
+        offset = (offset + ASSET_PACK_ALIGNMENT - 1)/ASSET_PACK_ALIGNMENT*ASSET_PACK_ALIGNMENT;
+        files[i].entry.offset = (unsigned int)offset;
+        offset += files[i].entry.size;
+    }
+
+    if (offset > 2147483647)
+    {
+        printf("rpak: Asset pack is bigger than 2147483647 bytes, split assets into several packs\n");
+        return 1;
+    }
+
+    FILE *file = fopen(outputPath, "wb");
+
+    if (file == NULL)
+    {
+        printf("rpak: [%s] Failed to open file for writing\n", outputPath);
+        return 1;
+    }
+
+    fwrite(&header, sizeof(AssetPackHeader), 1, file);
+    for (int i = 0; i < fileCount; i++) fwrite(&files[i].entry, sizeof(AssetPackEntry), 1, file);
+    for (int i = 0; i < fileCount; i++) fwrite(files[i].name, 1, strlen(files[i].name) + 1, file);
+
+    unsigned int position = sizeof(AssetPackHeader) + fileCount*sizeof(AssetPackEntry) + header.namesSize;
+    unsigned long long totalSize = 0;
+
+    for (int i = 0; i < fileCount; i++)
+    {
+        static const char *compressionNames[] = { "store", "deflate", "qoi" };
+        const AssetPackEntry *entry = &files[i].entry;
+
+        position = WritePadding(file, position);
+        fwrite(files[i].data, 1, entry->size, file);
+        position += entry->size;
+
+        totalSize += files[i].fileSize;
+
+        printf("  %-8s %10i -> %10u  %s\n", compressionNames[entry->compression], files[i].fileSize, entry->size, files[i].name);
+    }
+
+    fclose(file);
+
+    printf("rpak: [%s] Asset pack built successfully (%i files, %llu -> %u bytes)\n", outputPath, fileCount, totalSize, position);
+
+    for (int i = 0; i < fileCount; i++)
+    {
+        free(files[i].path);
+        free(files[i].name);
+        free(files[i].data);
+    }
+    free(files);
+
+    return 0;
+}